@@ -0,0 +1,163 @@
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <boost/asio/executor_work_guard.hpp>
+#include <boost/asio/ip/address.hpp>
+
+#include "event_data.hpp"
+#include "append_to_stream.hpp"
+
+#include "connection/basic_tcp_connection.hpp"
+#include "connection/connection_pool.hpp"
+#include "tcp/discovery_service.hpp"
+
+int main(int argc, char** argv)
+{
+	GOOGLE_PROTOBUF_VERSION;
+
+	if (argc != 9)
+	{
+		ES_ERROR("expected 8 arguments, got {}", argc - 1);
+		ES_ERROR("usage: <executable> <ip endpoint> <port> <username> <password> <num-appends> <appends-in-flight> <threads> [trace | debug | info | warn | error | critical | off]");
+		ES_ERROR("example: ./connection-pool-benchmark 127.0.0.1 1113 admin changeit 100000 512 4 info");
+		ES_ERROR("tool appends num-appends events to 64 streams through pools of 1 to 16 connections and reports the throughput of each,");
+		ES_ERROR("appends-in-flight appends wait for a response at any time whatever the pool size, the io_context is run by threads threads");
+		return 0;
+	}
+
+	// get command arguments
+	std::string ep = argv[1];
+	int port = std::stoi(argv[2]);
+	std::string username = argv[3];
+	std::string password = argv[4];
+	int num_appends = std::stoi(argv[5]);
+	int appends_in_flight = std::stoi(argv[6]);
+	int num_threads = std::max(std::stoi(argv[7]), 1);
+	std::string_view lvl = argv[8];
+	ES_DEFAULT_LOG_LEVEL(lvl);
+
+	boost::asio::io_context ioc;
+
+	boost::asio::ip::tcp::endpoint endpoint;
+	endpoint.address(boost::asio::ip::make_address_v4(ep));
+	endpoint.port(port);
+
+	es::user::user_credentials credentials(username, password);
+
+	// a single connection can have all the appends in flight, so it is only limited by its socket,
+	// strands make the connections safe to use from the threads running the io_context
+	auto connection_settings =
+		es::connection_settings_builder()
+		.with_default_user_credentials(credentials)
+		.with_max_concurrent_items(appends_in_flight)
+		.require_master(false)
+		.use_strand(true)
+		.build();
+
+	using discovery_service_type = es::tcp::services::discovery_service;
+	boost::asio::make_service<discovery_service_type>(ioc, endpoint, boost::asio::ip::tcp::endpoint(), false);
+
+	using connection_type =
+		es::connection::basic_tcp_connection<
+		boost::asio::steady_timer,
+		discovery_service_type,
+		es::operation<>
+		>;
+	using pool_type = es::connection::connection_pool<connection_type>;
+
+	for (std::size_t pool_size : { 1, 2, 4, 8, 16 })
+	{
+		// appends to the same stream keep their order with stream affinity
+		auto pool = std::make_shared<pool_type>(ioc, connection_settings, pool_size, es::connection::pool_routing::stream_affinity);
+
+		// completions run on the connections' strands, so on any of the threads
+		std::atomic<int> sent{ 0 };
+		std::atomic<int> completed{ 0 };
+		std::atomic<int> failed{ 0 };
+		std::mutex mutex;
+		std::condition_variable cv;
+		bool done = false;
+		bool connected = false;
+		std::chrono::high_resolution_clock::time_point begin;
+
+		auto notify_done = [&](bool is_connected)
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			connected = is_connected;
+			done = true;
+			cv.notify_one();
+		};
+
+		// each completion sends the next append, so that appends_in_flight appends wait for a response at any time
+		std::function<void()> send_next = [&]()
+		{
+			int const index = sent.fetch_add(1);
+			if (index >= num_appends) return;
+			auto stream_name = "pool-benchmark-" + std::to_string(index % 64);
+
+			std::vector<es::event_data> events;
+			events.push_back(es::event_data{ es::guid(), "Test.Type", true, "{ \"test\": \"data\"}", "test metadata" });
+
+			es::async_append_to_stream(
+				pool,
+				stream_name,
+				std::move(events),
+				[&](boost::system::error_code ec, std::optional<es::write_result>)
+			{
+				if (ec) ++failed;
+				if (++completed == num_appends)
+				{
+					notify_done(true);
+					return;
+				}
+				send_next();
+			}
+			);
+		};
+
+		pool->async_connect([&](boost::system::error_code ec, std::optional<es::connection_result>)
+		{
+			if (ec && ec != es::connection_errors::authentication_failed)
+			{
+				ES_ERROR("pool failed to connect, {}", ec.message());
+				notify_done(false);
+				return;
+			}
+
+			begin = std::chrono::high_resolution_clock::now();
+			// the offered concurrency is the same for every pool size, only the number of sockets changes
+			for (int i = 0; i < appends_in_flight; ++i) send_next();
+		});
+
+		auto work = boost::asio::make_work_guard(ioc);
+		std::vector<std::thread> threads;
+		for (int i = 0; i < num_threads; ++i) threads.emplace_back([&ioc]() { ioc.run(); });
+
+		{
+			std::unique_lock<std::mutex> lock(mutex);
+			cv.wait(lock, [&done] { return done; });
+		}
+		auto end = std::chrono::high_resolution_clock::now();
+
+		pool->close();
+		work.reset();
+		for (auto& thread : threads) thread.join();
+		ioc.restart();
+
+		if (!connected) return 0;
+
+		auto elapsed_ms = ES_MILLISECONDS(end - begin);
+		ES_INFO("{:>2} connection(s) : {} appends in {} ms, {:.0f} appends/s, {} failed",
+			pool_size,
+			num_appends,
+			elapsed_ms,
+			num_appends * 1000.0 / std::max<decltype(elapsed_ms)>(elapsed_ms, 1),
+			failed.load()
+		);
+	}
+
+	return 0;
+}
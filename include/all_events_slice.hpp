@@ -5,6 +5,7 @@
 
 #include "position.hpp"
 #include "read_direction.hpp"
+#include "intern_table.hpp"
 #include "resolved_event.hpp"
 
 namespace es {
@@ -27,13 +28,13 @@ public:
 		// preallocate
 		events_.reserve(size);
 
-		auto events = response.events();
-		std::transform(
-			std::begin(events),
-			std::end(events),
-			std::back_inserter(events_),
-			[](message::ResolvedEvent& event) -> resolved_event { return resolved_event(event); }
-		);
+		// convert all proto events to user events, they take the strings of the
+		// records, which are left empty, and share their stream ids and types
+		intern_table interned;
+		for (auto& event : *response.mutable_events())
+		{
+			events_.emplace_back(event, &interned);
+		}
 	}
 
 	position const& from_position() const { return from_position_; }
@@ -41,6 +42,8 @@ public:
 	read_direction stream_read_direction() const { return direction_; }
 	bool is_end_of_stream() const { return is_end_of_stream_; }
 	std::vector<resolved_event> const& events() const { return events_; }
+	// events can be moved out of the slice
+	std::vector<resolved_event>& events() { return events_; }
 
 private:
 	position from_position_;
@@ -0,0 +1,46 @@
+#pragma once
+
+#ifndef ES_CONST_BUFFER_SPAN_HPP
+#define ES_CONST_BUFFER_SPAN_HPP
+
+#include <cstddef>
+
+#include <boost/asio/buffer.hpp>
+
+namespace es {
+namespace buffer {
+
+/*
+	Non-owning view over a contiguous range of const buffers. It satisfies
+	the ConstBufferSequence requirements, so asio composed operations copy
+	two pointers instead of the whole container holding the buffers.
+	The underlying storage must outlive the asynchronous operation.
+*/
+class const_buffer_span
+{
+public:
+	using value_type = boost::asio::const_buffer;
+	using const_iterator = boost::asio::const_buffer const*;
+
+	const_buffer_span() = default;
+
+	explicit const_buffer_span(
+		boost::asio::const_buffer const* first,
+		std::size_t count
+	) : first_(first), count_(count)
+	{}
+
+	const_iterator begin() const { return first_; }
+	const_iterator end() const { return first_ + count_; }
+	std::size_t size() const { return count_; }
+	bool empty() const { return count_ == 0; }
+
+private:
+	boost::asio::const_buffer const* first_ = nullptr;
+	std::size_t count_ = 0;
+};
+
+} // buffer
+} // es
+
+#endif // ES_CONST_BUFFER_SPAN_HPP
@@ -0,0 +1,113 @@
+#pragma once
+
+#ifndef ES_FRAME_BUFFER_HPP
+#define ES_FRAME_BUFFER_HPP
+
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <algorithm>
+
+#include <boost/asio/buffer.hpp>
+
+namespace es {
+namespace buffer {
+
+/*
+	Receive buffer for length prefixed tcp frames. Bytes are read into the
+	tail of a contiguous slab and complete frames are parsed in place from
+	the head, so a single socket read can yield many frames without copying
+	them. Only the trailing partial frame is ever moved, and only when the
+	tail runs out of space.
+
+	The slab is reference counted: anyone holding handle() keeps the bytes
+	of the frames parsed so far alive. When the slab is shared, the buffer
+	switches to a fresh slab instead of overwriting it.
+*/
+class frame_buffer
+{
+public:
+	struct slab
+	{
+		explicit slab(std::size_t size) : data(new std::byte[size]), capacity(size) {}
+
+		std::unique_ptr<std::byte[]> data;
+		std::size_t capacity;
+	};
+
+	using handle_type = std::shared_ptr<slab const>;
+
+	explicit frame_buffer(std::size_t capacity)
+		: slab_(std::make_shared<slab>(capacity)), read_offset_(0), write_offset_(0)
+	{}
+
+	frame_buffer(frame_buffer&& other) = default;
+	frame_buffer& operator=(frame_buffer&& other) = default;
+
+	// readable bytes (received, not yet consumed)
+	std::byte* data() { return slab_->data.get() + read_offset_; }
+	std::byte const* data() const { return slab_->data.get() + read_offset_; }
+	std::size_t size() const { return write_offset_ - read_offset_; }
+	std::size_t capacity() const { return slab_->capacity; }
+
+	// returns the whole writable tail, which is at least min_size bytes long
+	boost::asio::mutable_buffer prepare(std::size_t min_size)
+	{
+		// everything was consumed, rewind for free
+		if (read_offset_ == write_offset_ && slab_.use_count() == 1)
+		{
+			read_offset_ = write_offset_ = 0;
+		}
+
+		if (slab_->capacity - write_offset_ < min_size)
+		{
+			make_room(min_size);
+		}
+
+		return boost::asio::buffer(slab_->data.get() + write_offset_, slab_->capacity - write_offset_);
+	}
+
+	void commit(std::size_t n) { write_offset_ += std::min(n, slab_->capacity - write_offset_); }
+	void consume(std::size_t n) { read_offset_ += std::min(n, size()); }
+	void clear() { read_offset_ = write_offset_ = 0; }
+
+	// keeps the current slab alive
+	handle_type handle() const { return slab_; }
+
+private:
+	void make_room(std::size_t min_size)
+	{
+		std::size_t const pending = size();
+		std::size_t const required = pending + min_size;
+
+		// nobody else references the slab, we can reuse it
+		if (slab_.use_count() == 1 && slab_->capacity >= required)
+		{
+			if (pending != 0)
+			{
+				std::memmove(slab_->data.get(), slab_->data.get() + read_offset_, pending);
+			}
+		}
+		else
+		{
+			auto fresh = std::make_shared<slab>(std::max(slab_->capacity, required));
+			if (pending != 0)
+			{
+				std::memcpy(fresh->data.get(), slab_->data.get() + read_offset_, pending);
+			}
+			slab_ = std::move(fresh);
+		}
+
+		read_offset_ = 0;
+		write_offset_ = pending;
+	}
+
+	std::shared_ptr<slab> slab_;
+	std::size_t read_offset_;
+	std::size_t write_offset_;
+};
+
+} // buffer
+} // es
+
+#endif // ES_FRAME_BUFFER_HPP
@@ -0,0 +1,275 @@
+#pragma once
+
+#ifndef ES_FRAME_POOL_HPP
+#define ES_FRAME_POOL_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <new>
+#include <vector>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
+
+namespace es {
+namespace buffer {
+
+constexpr std::size_t kDefaultLargestPooledFrameSize = 64 * 1024;
+constexpr std::size_t kHugePageSize = 2 * 1024 * 1024;
+// mappings of large frames a huge page pool keeps for reuse
+constexpr std::size_t kMaxCachedLargeFrameBytes = 8 * kHugePageSize;
+
+struct frame_pool_options
+{
+	// larger frames are allocated and freed one by one
+	std::size_t largest_pooled_frame_size = kDefaultLargestPooledFrameSize;
+	// reserve the pool's memory in (transparent) huge pages where supported
+	bool huge_pages = false;
+};
+
+/*
+	Size class slab pool for the frames of tcp packages. Each size class
+	recycles its blocks, so once a connection has reached its working set
+	building and sending packages does not allocate anymore. Frames can be
+	allocated and freed from any thread.
+
+	With huge pages, the slabs are carved out of arenas that are mapped once,
+	2 MiB first and larger each time the pool needs more, and kept
+	until the pool is destroyed. Frames larger than the largest pooled one are
+	mapped on their own, rounded to huge pages, and their mappings are kept
+	for the next large frames of the same size, up to kMaxCachedLargeFrameBytes.
+*/
+class frame_pool : public std::pmr::memory_resource
+{
+public:
+	explicit frame_pool(frame_pool_options const& options = frame_pool_options())
+		: largest_pooled_frame_size_(options.largest_pooled_frame_size),
+		pages_(options.huge_pages),
+		arena_(pages_),
+		pool_(std::pmr::pool_options{ 0, options.largest_pooled_frame_size }, pages_.huge_pages() ? static_cast<std::pmr::memory_resource*>(&arena_) : &pages_),
+		large_frames_(pages_)
+	{
+		// the size classes stop at the pool's own limit, larger frames would never be given back to the arena
+		largest_pooled_frame_size_ = pool_.options().largest_required_pool_block;
+	}
+
+	frame_pool(frame_pool const&) = delete;
+	frame_pool& operator=(frame_pool const&) = delete;
+
+	// bytes of the frames currently allocated from the pool
+	std::size_t bytes_in_use() const { return bytes_in_use_.load(std::memory_order_relaxed); }
+	// bytes the pool holds, in use or ready to be reused, with huge pages this is the size of its mappings
+	std::size_t bytes_reserved() const { return pages_.bytes_reserved(); }
+	std::size_t allocations() const { return allocations_.load(std::memory_order_relaxed); }
+
+private:
+	// where the pool's memory comes from, mappings rounded to huge pages or the heap
+	class page_resource : public std::pmr::memory_resource
+	{
+	public:
+#if defined(__linux__)
+		explicit page_resource(bool huge_pages) : huge_pages_(huge_pages) {}
+#else
+		explicit page_resource(bool) : huge_pages_(false) {}
+#endif
+
+		bool huge_pages() const { return huge_pages_; }
+		std::size_t bytes_reserved() const { return bytes_reserved_.load(std::memory_order_relaxed); }
+
+		static std::size_t huge_page_size(std::size_t bytes) { return (bytes + kHugePageSize - 1) / kHugePageSize * kHugePageSize; }
+
+	private:
+		void* do_allocate(std::size_t bytes, std::size_t alignment) override
+		{
+#if defined(__linux__)
+			if (huge_pages_)
+			{
+				std::size_t const mapped = huge_page_size(bytes);
+				void* block = ::mmap(nullptr, mapped, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+				if (block == MAP_FAILED) throw std::bad_alloc();
+				::madvise(block, mapped, MADV_HUGEPAGE);
+
+				bytes_reserved_.fetch_add(mapped, std::memory_order_relaxed);
+				return block;
+			}
+#endif
+			void* block = std::pmr::new_delete_resource()->allocate(bytes, alignment);
+			bytes_reserved_.fetch_add(bytes, std::memory_order_relaxed);
+			return block;
+		}
+
+		void do_deallocate(void* block, std::size_t bytes, std::size_t alignment) override
+		{
+#if defined(__linux__)
+			if (huge_pages_)
+			{
+				std::size_t const mapped = huge_page_size(bytes);
+				bytes_reserved_.fetch_sub(mapped, std::memory_order_relaxed);
+				::munmap(block, mapped);
+				return;
+			}
+#endif
+			bytes_reserved_.fetch_sub(bytes, std::memory_order_relaxed);
+			std::pmr::new_delete_resource()->deallocate(block, bytes, alignment);
+		}
+
+		bool do_is_equal(std::pmr::memory_resource const& other) const noexcept override { return this == &other; }
+
+		bool huge_pages_;
+		std::atomic<std::size_t> bytes_reserved_{ 0 };
+	};
+
+	// slabs of the size classes, the pool only gives them back when it is destroyed,
+	// size classes of different threads may replenish at the same time
+	class slab_arena : public std::pmr::memory_resource
+	{
+	public:
+		explicit slab_arena(page_resource& pages) : arena_(kHugePageSize, &pages) {}
+
+	private:
+		void* do_allocate(std::size_t bytes, std::size_t alignment) override
+		{
+			std::lock_guard<std::mutex> lock(mutex_);
+			return arena_.allocate(bytes, alignment);
+		}
+
+		void do_deallocate(void*, std::size_t, std::size_t) override {}
+
+		bool do_is_equal(std::pmr::memory_resource const& other) const noexcept override { return this == &other; }
+
+		std::mutex mutex_;
+		std::pmr::monotonic_buffer_resource arena_;
+	};
+
+	// mappings of the frames too large to be pooled, kept for reuse instead of being unmapped
+	class large_frame_cache
+	{
+	public:
+		explicit large_frame_cache(page_resource& pages) : pages_(pages) {}
+
+		~large_frame_cache()
+		{
+			for (auto const& mapping : free_) pages_.deallocate(mapping.block, mapping.size, alignof(std::max_align_t));
+		}
+
+		void* allocate(std::size_t bytes, std::size_t alignment)
+		{
+			std::size_t const size = page_resource::huge_page_size(bytes);
+			{
+				std::lock_guard<std::mutex> lock(mutex_);
+				for (auto it = free_.begin(); it != free_.end(); ++it)
+				{
+					if (it->size != size) continue;
+
+					void* block = it->block;
+					cached_bytes_ -= size;
+					free_.erase(it);
+					return block;
+				}
+			}
+			return pages_.allocate(size, alignment);
+		}
+
+		void deallocate(void* block, std::size_t bytes, std::size_t alignment)
+		{
+			std::size_t const size = page_resource::huge_page_size(bytes);
+			{
+				std::lock_guard<std::mutex> lock(mutex_);
+				if (cached_bytes_ + size <= kMaxCachedLargeFrameBytes)
+				{
+					free_.push_back(mapping{ block, size });
+					cached_bytes_ += size;
+					return;
+				}
+			}
+			pages_.deallocate(block, size, alignment);
+		}
+
+	private:
+		struct mapping
+		{
+			void* block;
+			std::size_t size;
+		};
+
+		page_resource& pages_;
+		std::mutex mutex_;
+		std::vector<mapping> free_;
+		std::size_t cached_bytes_ = 0;
+	};
+
+	// frames too large for the size classes are mapped on their own with huge pages, the pool
+	// hands them to the heap one by one otherwise
+	bool is_large_mapping(std::size_t bytes) const { return pages_.huge_pages() && bytes > largest_pooled_frame_size_; }
+
+	void* do_allocate(std::size_t bytes, std::size_t alignment) override
+	{
+		void* frame = is_large_mapping(bytes) ? large_frames_.allocate(bytes, alignment) : pool_.allocate(bytes, alignment);
+		bytes_in_use_.fetch_add(bytes, std::memory_order_relaxed);
+		allocations_.fetch_add(1, std::memory_order_relaxed);
+		return frame;
+	}
+
+	void do_deallocate(void* frame, std::size_t bytes, std::size_t alignment) override
+	{
+		bytes_in_use_.fetch_sub(bytes, std::memory_order_relaxed);
+		if (is_large_mapping(bytes)) large_frames_.deallocate(frame, bytes, alignment);
+		else pool_.deallocate(frame, bytes, alignment);
+	}
+
+	bool do_is_equal(std::pmr::memory_resource const& other) const noexcept override { return this == &other; }
+
+	std::size_t largest_pooled_frame_size_;
+	page_resource pages_;
+	slab_arena arena_;
+	std::pmr::synchronized_pool_resource pool_;
+	large_frame_cache large_frames_;
+	std::atomic<std::size_t> bytes_in_use_{ 0 };
+	std::atomic<std::size_t> allocations_{ 0 };
+};
+
+// pool of the connections that were not given their own
+inline std::shared_ptr<frame_pool> const& default_frame_pool()
+{
+	static std::shared_ptr<frame_pool> const pool = std::make_shared<frame_pool>();
+	return pool;
+}
+
+/*
+	Allocator drawing from a frame pool, which it keeps alive, so that
+	packages can outlive the connection they were built for.
+*/
+template <class T>
+class frame_allocator
+{
+public:
+	using value_type = T;
+
+	frame_allocator() : pool_(default_frame_pool()) {}
+	explicit frame_allocator(std::shared_ptr<frame_pool> pool) : pool_(std::move(pool)) {}
+
+	template <class U>
+	frame_allocator(frame_allocator<U> const& other) : pool_(other.pool()) {}
+
+	T* allocate(std::size_t n) { return static_cast<T*>(pool_->allocate(n * sizeof(T), alignof(T))); }
+	void deallocate(T* p, std::size_t n) { pool_->deallocate(p, n * sizeof(T), alignof(T)); }
+
+	std::shared_ptr<frame_pool> const& pool() const { return pool_; }
+
+	template <class U>
+	bool operator==(frame_allocator<U> const& other) const { return pool_ == other.pool(); }
+	template <class U>
+	bool operator!=(frame_allocator<U> const& other) const { return pool_ != other.pool(); }
+
+private:
+	std::shared_ptr<frame_pool> pool_;
+};
+
+} // buffer
+} // es
+
+#endif // ES_FRAME_POOL_HPP
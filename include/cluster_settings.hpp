@@ -7,6 +7,7 @@
 #include <chrono>
 
 #include "tcp/gossip_seed.hpp"
+#include "connection/constants.hpp"
 #include "connection/node_preference.hpp"
 
 namespace es {
@@ -24,17 +25,21 @@ public:
 	std::vector<tcp::gossip_seed> const& gossip_seeds() const { return gossip_seeds_; }
 	std::chrono::nanoseconds gossip_timeout() const { return gossip_timeout_; }
 	node_preference preference() const { return node_preference_; }
+	std::chrono::nanoseconds gossip_refresh_interval() const { return gossip_refresh_interval_; }
+	std::string const& gossip_cache_file() const { return gossip_cache_file_; }
 
 	// we need the default constructor for the cluster_discovery_service
 	cluster_settings() = default;
 private:
 
 	std::string cluster_dns_;
-	std::int32_t max_discover_attempts_;
-	std::int32_t external_gossip_port_;
+	std::int32_t max_discover_attempts_ = es::connection::constants::kDefaultMaxClusterDiscoverAttempts;
+	std::int32_t external_gossip_port_ = es::connection::constants::kDefaultClusterManagerExternalHttpPort;
 	std::vector<tcp::gossip_seed> gossip_seeds_;
-	std::chrono::nanoseconds gossip_timeout_;
-	node_preference node_preference_;
+	std::chrono::nanoseconds gossip_timeout_ = es::connection::constants::kDefaultGossipTimeout;
+	node_preference node_preference_ = node_preference::master;
+	std::chrono::nanoseconds gossip_refresh_interval_ = std::chrono::nanoseconds::zero();
+	std::string gossip_cache_file_;
 };
 
 class cluster_settings_builder
@@ -67,6 +72,11 @@ public:
 	self_type& with_gossip_timeout(std::chrono::nanoseconds timeout) { settings_.gossip_timeout_ = timeout; return *this; }
 	self_type& prefer_random_node() { settings_.node_preference_ = node_preference::random; return *this; }
 	self_type& prefer_slave_node() { settings_.node_preference_ = node_preference::slave; return *this; }
+	self_type& prefer_lowest_latency_node() { settings_.node_preference_ = node_preference::lowest_latency; return *this; }
+	// refresh the gossip every interval in the background, zero (the default) only gossips to discover a node
+	self_type& with_gossip_refresh_interval(std::chrono::nanoseconds interval) { settings_.gossip_refresh_interval_ = interval; return *this; }
+	// keep the last gossip in file, so that the next process asks the nodes it names first
+	self_type& with_gossip_cache_file(std::string const& path) { settings_.gossip_cache_file_ = path; return *this; }
 	cluster_settings build() { return settings_; }
 
 private:
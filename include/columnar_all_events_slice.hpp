@@ -0,0 +1,75 @@
+#pragma once
+
+#ifndef ES_COLUMNAR_ALL_EVENTS_SLICE_HPP
+#define ES_COLUMNAR_ALL_EVENTS_SLICE_HPP
+
+#include <cstdint>
+#include <optional>
+#include <type_traits>
+#include <vector>
+
+#include <boost/system/error_code.hpp>
+
+#include "all_events_slice.hpp"
+#include "event_columns.hpp"
+#include "position.hpp"
+#include "read_direction.hpp"
+
+namespace es {
+
+/*
+	Column oriented counterpart of es::all_events_slice, for scans over
+	many events that only look at a few of their fields.
+*/
+class columnar_all_events_slice
+{
+public:
+	explicit columnar_all_events_slice(
+		read_direction direction,
+		message::ReadAllEventsCompleted const& response
+	) : from_position_(position{ response.commit_position(), response.prepare_position() }),
+		next_position_(position{ response.next_commit_position(), response.next_prepare_position() }),
+		direction_(direction),
+		is_end_of_stream_(response.events_size() == 0),
+		columns_(response.events()),
+		commit_positions_(),
+		prepare_positions_()
+	{
+		commit_positions_.reserve(response.events_size());
+		prepare_positions_.reserve(response.events_size());
+		for (auto const& event : response.events())
+		{
+			commit_positions_.push_back(event.commit_position());
+			prepare_positions_.push_back(event.prepare_position());
+		}
+	}
+
+	position const& from_position() const { return from_position_; }
+	position const& next_position() const { return next_position_; }
+	read_direction stream_read_direction() const { return direction_; }
+	bool is_end_of_stream() const { return is_end_of_stream_; }
+	event_columns const& columns() const { return columns_; }
+	std::vector<std::int64_t> const& commit_positions() const { return commit_positions_; }
+	std::vector<std::int64_t> const& prepare_positions() const { return prepare_positions_; }
+
+	position original_position(std::size_t i) const { return position{ commit_positions_[i], prepare_positions_[i] }; }
+
+private:
+	position from_position_;
+	position next_position_;
+	read_direction direction_;
+	bool is_end_of_stream_;
+	event_columns columns_;
+	std::vector<std::int64_t> commit_positions_;
+	std::vector<std::int64_t> prepare_positions_;
+};
+
+// read handlers are given a columnar slice if they take one and cannot take an es::all_events_slice
+template <class AllEventsSliceReadHandler>
+constexpr bool is_columnar_all_events_slice_handler_v =
+	!std::is_invocable_v<AllEventsSliceReadHandler, boost::system::error_code, std::optional<all_events_slice>> &&
+	std::is_invocable_v<AllEventsSliceReadHandler, boost::system::error_code, std::optional<columnar_all_events_slice>>;
+
+}
+
+#endif // ES_COLUMNAR_ALL_EVENTS_SLICE_HPP
@@ -0,0 +1,66 @@
+#pragma once
+
+#ifndef ES_COLUMNAR_STREAM_EVENTS_SLICE_HPP
+#define ES_COLUMNAR_STREAM_EVENTS_SLICE_HPP
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <type_traits>
+
+#include <boost/system/error_code.hpp>
+
+#include "event_columns.hpp"
+#include "read_direction.hpp"
+#include "stream_events_slice.hpp"
+
+namespace es {
+
+/*
+	Column oriented counterpart of es::stream_events_slice, for scans over
+	many events that only look at a few of their fields.
+*/
+class columnar_stream_events_slice
+{
+public:
+	explicit columnar_stream_events_slice(
+		std::string const& stream,
+		std::int64_t from_event_number,
+		read_direction direction,
+		message::ReadStreamEventsCompleted const& response
+	) : from_event_number_(from_event_number),
+		next_event_number_(response.next_event_number()),
+		last_event_number_(response.last_event_number()),
+		stream_(stream),
+		read_direction_(direction),
+		is_end_of_stream_(response.is_end_of_stream()),
+		columns_(response.events())
+	{}
+
+	std::string const& stream() const { return stream_; }
+	std::int64_t from_event_number() const { return from_event_number_; }
+	std::int64_t next_event_number() const { return next_event_number_; }
+	std::int64_t last_event_number() const { return last_event_number_; }
+	read_direction stream_read_direction() const { return read_direction_; }
+	bool is_end_of_stream() const { return is_end_of_stream_; }
+	event_columns const& columns() const { return columns_; }
+
+private:
+	std::int64_t from_event_number_;
+	std::int64_t next_event_number_;
+	std::int64_t last_event_number_;
+	std::string stream_;
+	read_direction read_direction_;
+	bool is_end_of_stream_;
+	event_columns columns_;
+};
+
+// read handlers are given a columnar slice if they take one and cannot take an es::stream_events_slice
+template <class EventsSliceReadHandler>
+constexpr bool is_columnar_stream_events_slice_handler_v =
+	!std::is_invocable_v<EventsSliceReadHandler, boost::system::error_code, std::optional<stream_events_slice>> &&
+	std::is_invocable_v<EventsSliceReadHandler, boost::system::error_code, std::optional<columnar_stream_events_slice>>;
+
+}
+
+#endif // ES_COLUMNAR_STREAM_EVENTS_SLICE_HPP
@@ -8,6 +8,7 @@
 #include "guid.hpp"
 #include "write_result.hpp"
 #include "error/error.hpp"
+#include "tcp/decode_arena.hpp"
 #include "tcp/tcp_package.hpp"
 
 namespace es {
@@ -28,7 +29,6 @@ void async_commit_transaction(
 	request.set_transaction_id(transaction_id);
 	request.set_require_master(connection->settings().require_master());
 
-	auto serialized = request.SerializeAsString();
 	auto corr_id = es::guid();
 
 	detail::tcp::tcp_package<> package;
@@ -39,8 +39,8 @@ void async_commit_transaction(
 			detail::tcp::tcp_command::transaction_commit,
 			detail::tcp::tcp_flags::none,
 			corr_id,
-			(std::byte*)serialized.data(),
-			serialized.size()
+			request,
+			connection->package_allocator()
 			));
 	}
 	else
@@ -51,8 +51,8 @@ void async_commit_transaction(
 			corr_id,
 			connection->settings().default_user_credentials().username(),
 			connection->settings().default_user_credentials().password(),
-			(std::byte*)serialized.data(),
-			serialized.size()
+			request,
+			connection->package_allocator()
 			));
 	}
 
@@ -72,22 +72,18 @@ void async_commit_transaction(
 				return;
 			}
 
-			message::TransactionCommitCompleted response;
-			response.ParseFromArray(view.data() + view.message_offset(), view.message_size());
+			auto& response = detail::tcp::decode<message::TransactionCommitCompleted>(view);
 
 			switch (response.result())
 			{
 			case message::OperationResult::Success:
 				break;
 			case message::OperationResult::PrepareTimeout:
-				// retry
-				return;
-			case message::OperationResult::ForwardTimeout:
-				// retry
-				return;
 			case message::OperationResult::CommitTimeout:
-				// retry
-				return;
+			case message::OperationResult::ForwardTimeout:
+				// the connection retries these, they only get here once retries are exhausted
+				ec = make_error_code(connection_errors::max_operation_retries);
+				break;
 			case message::OperationResult::WrongExpectedVersion:
 				ec = make_error_code(stream_errors::wrong_expected_version);
 				break;
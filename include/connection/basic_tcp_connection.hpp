@@ -3,31 +3,66 @@
 #ifndef ES_BASIC_TCP_STREAM_HPP
 #define ES_BASIC_TCP_STREAM_HPP
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <deque>
+#include <functional>
 #include <memory>
+#include <optional>
+#include <sstream>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 #include <boost/asio/io_context.hpp>
 #include <boost/asio/ip/tcp.hpp>
 #include <boost/asio/error.hpp>
 #include <boost/asio/write.hpp>
 #include <boost/asio/buffer.hpp>
+#include <boost/asio/dispatch.hpp>
+#include <boost/asio/post.hpp>
+#include <boost/asio/strand.hpp>
 
 #include "logger.hpp"
 #include "guid.hpp"
 #include "connection_result.hpp"
 #include "connection_settings.hpp"
 #include "duration_conversions.hpp"
+#include "flat_guid_map.hpp"
 #include "operations_map.hpp"
 
+#include "buffer/const_buffer_span.hpp"
+#include "buffer/frame_buffer.hpp"
+#include "buffer/frame_pool.hpp"
+#include "connection/connection_state.hpp"
+#include "connection/reconnection_info.hpp"
+#include "connection/send_statistics.hpp"
+#include "connection/timer_wheel.hpp"
+#include "resolved_event_view.hpp"
 #include "subscription/subscription_base.hpp"
+#include "tcp/decode_arena.hpp"
 #include "tcp/tcp_package.hpp"
 #include "tcp/read.hpp"
+#include "tcp/retry.hpp"
 #include "tcp/connect.hpp"
 #include "tcp/operation.hpp"
 
 namespace es {
 namespace connection {
 
+template <class ConnectionType>
+class connection_pool;
+
+// discovery services that measure the latency of nodes are told the round trip time of heartbeats
+template <class DiscoveryService, class = void>
+struct reports_round_trips : std::false_type {};
+
+template <class DiscoveryService>
+struct reports_round_trips<DiscoveryService, std::void_t<
+	decltype(std::declval<DiscoveryService&>().report_round_trip(std::declval<boost::asio::ip::tcp::endpoint const&>(), std::declval<std::chrono::nanoseconds>()))
+>> : std::true_type {};
+
 // sorry for all the template parameters...
 template <
 	class WaitableTimer, 
@@ -41,6 +76,7 @@ class basic_tcp_connection
 public:
 	using self_type = basic_tcp_connection;
 	using executor_type = typename boost::asio::ip::tcp::socket::executor_type;
+	using strand_type = boost::asio::strand<boost::asio::io_context::executor_type>;
 	using clock_type = typename WaitableTimer::clock_type;
 	using operation_type = OperationType;
 	using operations_map_type = es::operations_map<operation_type>;
@@ -48,6 +84,7 @@ public:
 	using allocator_type = Allocator;
 	using dynamic_buffer_type = DynamicBuffer;
 	using waitable_timer_type = WaitableTimer;
+	using package_allocator_type = typename detail::tcp::tcp_package<>::allocator_type;
 
 	// make type checks here for template arguments
 	// static_assert(... "...");
@@ -63,6 +100,22 @@ public:
 		es::operations_map<operation_type>& get_subscriptions_map(self_type& connection) { return connection.subscriptions_map_; }
 		es::operations_map<operation_type> const& get_subscriptios_map(self_type& connection) const { return connection.subscriptions_map_; }
 		void async_start_receive(self_type& connection) { connection.async_start_receive(); }
+		void schedule_timeout(self_type& connection, es::guid_type const& key) { connection.schedule_timeout(key); }
+		// every lost connection starts a new generation, completions of older generations are ignored
+		std::uint64_t connection_generation(self_type& connection) const { return connection.generation_; }
+		void connection_lost(self_type& connection, boost::system::error_code ec, std::uint64_t generation) { connection.on_connection_lost(ec, generation); }
+		void socket_connected(self_type& connection) { connection.on_socket_connected(); }
+		// the response to this heartbeat request measures the round trip time to the node
+		void heartbeat_sent(self_type& connection, es::guid_type const& correlation_id)
+		{
+			connection.heartbeat_id_ = correlation_id;
+			connection.heartbeat_sent_ = clock_type::now();
+		}
+		// the master a node redirected the connection to, only used by the next connection attempt
+		std::optional<boost::asio::ip::tcp::endpoint> take_redirect_endpoint(self_type& connection)
+		{
+			return std::exchange(connection.redirect_endpoint_, std::nullopt);
+		}
 	};
 	template <class Friend>
 	friend struct friend_base;
@@ -73,19 +126,47 @@ public:
 	template <class T, class U>
 	friend class subscription::subscription_base;
 
+	// pools forward the subscriptions created on them to one of their connections
+	template <class ConnectionType>
+	friend class connection_pool;
+
 	explicit basic_tcp_connection(
 		boost::asio::io_context& ioc,
 		es::connection_settings const& settings,
 		dynamic_buffer_type&& buffer
-	) : socket_(ioc), 
+	) : strand_(settings.use_strand() ? std::make_optional(boost::asio::make_strand(ioc)) : std::nullopt),
+		executor_(strand_.has_value() ? executor_type(*strand_) : executor_type(ioc.get_executor())),
+		socket_(executor_), 
 		settings_(settings),
 		connection_name_(std::string("ES-") + es::to_string(es::guid())),
 		start_(clock_type::now()),
-		message_queue_(),
+		frame_pool_(settings.frame_pool() != nullptr ? settings.frame_pool() : buffer::default_frame_pool()),
+		message_queue_(buffer::frame_allocator<outgoing_package>(frame_pool_)),
+		write_buffers_(),
+		write_batch_size_(0),
+		statistics_(),
 		package_no_(0),
 		operations_map_(),
 		subscriptions_map_(),
-		buffer_(std::move(buffer))
+		buffer_(std::move(buffer)),
+		receive_buffer_(settings.receive_buffer_size()),
+		pending_operations_(),
+		in_flight_(),
+		timeouts_(),
+		timeout_timer_(executor_),
+		timeout_sweep_running_(false),
+		state_(es::internal::connection_state::init),
+		established_(false),
+		connected_(false),
+		writing_(false),
+		generation_(0),
+		reconnection_info_(0, clock_type::duration::zero()),
+		reconnect_timer_(executor_),
+		subscription_requests_(),
+		heartbeat_id_(),
+		heartbeat_sent_(),
+		node_endpoint_(),
+		redirect_endpoint_()
 	{}
 
 	template <class ConnectionResultHandler>
@@ -96,14 +177,27 @@ public:
 			"ConnectionResultHandler requirements not met, must have signature R(boost::system::error_code, std::optional<connection_result>)"
 		);
 
+		if (off_strand())
+		{
+			boost::asio::dispatch(
+				executor_,
+				[self = this->shared_from_this(), handler = std::move(handler)]() mutable { self->async_connect(std::move(handler)); }
+			);
+			return;
+		}
+
+		state_ = es::internal::connection_state::connecting;
+
 		auto identification_package_received_handler = 
-			[handler = std::move(handler)](boost::system::error_code ec, detail::tcp::tcp_package_view view, guid_type connection_id = guid_type())
+			[handler = std::move(handler), weak = this->weak_from_this()](boost::system::error_code ec, detail::tcp::tcp_package_view view, guid_type connection_id = guid_type())
 		{
 			if (!ec || ec == es::connection_errors::authentication_failed)
 			{
 				// on success, command should be client identified
 				if (view.command() != es::detail::tcp::tcp_command::client_identified) return;
-				
+
+				// from now on, a lost connection is reestablished automatically
+				if (auto self = weak.lock()) self->on_identified();
 				handler(ec, std::make_optional(connection_result{ connection_id }));
 			}
 			else
@@ -122,58 +216,172 @@ public:
 	// send a tcp package to es server
 	void async_send(detail::tcp::tcp_package<>&& package)
 	{
-		boost::asio::post(
-			get_io_context(),
-			// use shared from this? it would extend the lifetime of the connection, even if client does not have any more references to it...
-			[this, package = std::move(package)]() mutable
+		if (off_strand())
 		{
-			bool write_in_progress = !this->message_queue_.empty();
-			message_queue_.emplace_back(std::move(package));
-			if (!write_in_progress)
-			{
-				do_async_send();
-			}
+			boost::asio::dispatch(
+				executor_,
+				[self = this->shared_from_this(), package = std::move(package)]() mutable { self->async_send(std::move(package)); }
+			);
+			return;
 		}
-		);
+
+		enqueue(std::move(package), false);
 	}
 
-	// send tcp package with notification
+	// send a subscription request, a copy is kept while the subscription
+	// is registered so that it can subscribe again after a reconnection
+	void async_subscribe(detail::tcp::tcp_package<>&& package)
+	{
+		if (off_strand())
+		{
+			boost::asio::dispatch(
+				executor_,
+				[self = this->shared_from_this(), package = std::move(package)]() mutable { self->async_subscribe(std::move(package)); }
+			);
+			return;
+		}
+
+		auto view = static_cast<detail::tcp::tcp_package_view>(package);
+		auto key = es::guid(view.correlation_id().data());
+
+		subscription_requests_.erase(key);
+		subscription_requests_.try_emplace(key, package);
+		enqueue(std::move(package), false);
+	}
+
+	// send tcp package with notification, at most max_concurrent_items operations
+	// wait for their response at any time, the next ones are queued in order up to
+	// max_queue_size and rejected with connection_errors::queue_overflow beyond that
 	template <class PackageReceivedHandler>
 	void async_send(detail::tcp::tcp_package<>&& package, PackageReceivedHandler&& handler)
 	{
-		auto view = static_cast<detail::tcp::tcp_package_view>(package);
-		auto guid = es::guid(view.correlation_id().data());
+		if (off_strand())
+		{
+			boost::asio::dispatch(
+				executor_,
+				[self = this->shared_from_this(), package = std::move(package), handler = std::move(handler)]() mutable
+			{
+				self->async_send(std::move(package), std::move(handler));
+			}
+			);
+			return;
+		}
 
-		// put package in message queue before initiating the operation (doesn't actually matter, just to give the timeout wait an extra nanosecond, haha)
-		this->async_send(std::move(package));
+		if (pending_operations_.empty() && operations_map_.size() < max_concurrent_items())
+		{
+			start_operation(std::move(package), std::move(handler));
+			return;
+		}
 
-		tcp::operations::operation_op<self_type, waitable_timer_type, PackageReceivedHandler>
-			op{ this->shared_from_this(), std::move(handler), std::move(guid) };
+		if (pending_operations_.size() >= settings_.max_queue_size())
+		{
+			ES_WARN("basic_tcp_connection::async_send : operation queue is full ({} operations), rejecting operation", pending_operations_.size());
+			boost::asio::post(
+				executor_,
+				[op = operation_type(std::move(handler))]() mutable
+			{
+				op(make_error_code(es::connection_errors::queue_overflow), {});
+			}
+			);
+			return;
+		}
 
-		op.initiate();
+		pending_operations_.push_back(pending_operation{ std::move(package), operation_type(std::move(handler)), clock_type::now() });
 	}
 
 	// return socket
 	boost::asio::ip::tcp::socket& socket() { return socket_; }
-	// returns socket's executor
-	executor_type get_executor() { return socket_.get_executor(); }
+	// returns socket's executor, the connection's strand if strands are enabled,
+	// every handler of the connection runs on it
+	executor_type const& get_executor() const { return executor_; }
 	// returns socket's io_context
 	boost::asio::io_context& get_io_context() { return *reinterpret_cast<boost::asio::io_context*>(&socket_.get_executor().context()); }
 	// returns elapsed time since the connection was created
 	typename clock_type::duration elapsed() const { return clock_type::now() - start_; }
 	// get connection settings
 	es::connection_settings const& settings() const { return settings_; }
+	// connect (and reconnect) to endpoint instead of the node the discovery service picks, set it before connecting
+	void set_node_endpoint(boost::asio::ip::tcp::endpoint const& endpoint) { node_endpoint_ = endpoint; }
+	std::optional<boost::asio::ip::tcp::endpoint> const& node_endpoint() const { return node_endpoint_; }
+	// packages built for this connection allocate their frames from its frame pool
+	package_allocator_type package_allocator() const { return package_allocator_type(frame_pool_); }
+	buffer::frame_pool const& frame_pool() const { return *frame_pool_; }
 	// get connection name
 	std::string const& connection_name() const { return connection_name_; }
+	// get send loop counters (batch sizes, bytes written)
+	es::connection::send_statistics const& statistics() const { return statistics_; }
+	// number of operations waiting for a response, with strands enabled
+	// this and pending_operations() must be called from the connection's strand
+	std::size_t operations_in_flight() const { return operations_map_.size(); }
+	// number of operations queued until the number of operations in flight drops
+	std::size_t pending_operations() const { return pending_operations_.size(); }
+
+	// true from identification to the server until the connection is lost or closed, can be called from any thread
+	bool is_connected() const { return connected_.load(std::memory_order_acquire); }
+	// true once identified to the server, also while reconnecting afterwards, can be called from any thread
+	bool was_connected() const { return established_.load(std::memory_order_acquire); }
+	// current reconnection attempt, 0 when connected
+	int reconnection_attempt() const { return reconnection_info_.reconnection_attempt_no(); }
+
+	// called by the discovery service when the cluster elected another master,
+	// the connection is dropped and reconnects to it if it is connected elsewhere
+	void on_master_changed(boost::asio::ip::tcp::endpoint const& master)
+	{
+		boost::asio::post(executor_, [weak = this->weak_from_this(), master]()
+		{
+			auto self = weak.lock();
+			if (!self || !self->is_connected()) return;
+
+			boost::system::error_code ec;
+			auto remote = self->socket_.remote_endpoint(ec);
+			if (ec || remote == master) return;
 
-	// close connection cleanly, this method needs help
+			self->on_connection_lost(make_error_code(es::connection_errors::master_changed), self->generation_);
+		});
+	}
+
+	// close the connection, operations waiting for a response or queued complete with connection_closed
 	void close()
 	{
-		// do cleanup
-		socket_.close();
+		if (off_strand())
+		{
+			boost::asio::dispatch(executor_, [self = this->shared_from_this()]() { self->close(); });
+			return;
+		}
+
+		state_ = es::internal::connection_state::closed;
+		connected_.store(false, std::memory_order_release);
+		++generation_;
+		reconnect_timer_.cancel();
+
+		boost::system::error_code ignored;
+		socket_.close(ignored);
+
+		fail_operations(make_error_code(es::connection_errors::connection_closed));
 	}
 	
+	// keeps the bytes of the package being dispatched alive after its handler returns, packages
+	// outside of the reference counted receive buffer are copied and view is moved to the copy
+	frame_handle retain_frame(detail::tcp::tcp_package_view& view)
+	{
+		auto slab = receive_buffer_.handle();
+		auto const* data = reinterpret_cast<std::byte const*>(view.data());
+		std::less_equal<std::byte const*> before;
+		if (before(slab->data.get(), data) && before(data + view.size(), slab->data.get() + slab->capacity))
+		{
+			return slab;
+		}
+
+		auto copy = std::make_shared<std::vector<std::byte>>(data, data + view.size());
+		view = detail::tcp::tcp_package_view(copy->data(), copy->size());
+		return copy;
+	}
+
 private:
+	// true if the caller runs outside of the connection's strand and has to be moved onto it,
+	// always false without strands, where the io_context is expected to be run by a single thread
+	bool off_strand() const { return strand_.has_value() && !strand_->running_in_this_thread(); }
+
 	void on_package_received(boost::system::error_code ec, detail::tcp::tcp_package_view view)
 	{
 		using tcp_command = detail::tcp::tcp_command;
@@ -181,18 +389,42 @@ private:
 		using tcp_package_view = detail::tcp::tcp_package_view;
 		using tcp_package = detail::tcp::tcp_package<>;
 
+		// responses decoded by the handlers are released once the package is dispatched
+		detail::tcp::decode_scope decode_scope;
+
 		++package_no_;
 
 		auto corr_id = es::guid(view.correlation_id().data());
-		if (operations_map_.contains(corr_id))
+		// operations are removed before being called, so they may register new ones
+		if (auto op = operations_map_.find_and_extract(corr_id))
 		{
-			operations_map_[corr_id](ec, view);
-			operations_map_.erase(corr_id);
+			if (!ec && detail::tcp::is_transient_failure(view) && retry_operation(corr_id, *op))
+			{
+				return;
+			}
+			if (!ec && redirect_operation(corr_id, *op, view))
+			{
+				return;
+			}
+
+			in_flight_.erase(corr_id);
+			(*op)(ec, view);
+			start_pending_operations();
 			return;
 		}
-		if (subscriptions_map_.contains(corr_id))
+		if (auto* subscription = subscriptions_map_.find(corr_id))
 		{
-			subscriptions_map_[corr_id](ec, view);
+			// the subscription request is sent again once reconnected to the master
+			if (!ec && !node_endpoint_.has_value() && established_)
+			{
+				if (auto master = detail::tcp::not_master_redirect(view))
+				{
+					redirect_to_master(*master);
+					return;
+				}
+			}
+
+			(*subscription)(ec, view);
 			// don't erase it, subscription operations should post their deletion to io_context
 			return;
 		}
@@ -204,11 +436,15 @@ private:
 			async_send(tcp_package(
 				tcp_command::heartbeat_response_command,
 				tcp_flags::none,
-				es::guid()
+				es::guid(),
+				nullptr,
+				0,
+				package_allocator()
 			));
 			break;
 		case tcp_command::heartbeat_response_command:
 			ES_TRACE("basic_tcp_connection::on_package_received : got heartbeat response");
+			if (corr_id == heartbeat_id_) report_round_trip(clock_type::now() - heartbeat_sent_);
 			break;
 		case tcp_command::bad_request:
 			ES_ERROR("basic_tcp_connection::on_package_received : got bad request reply from server");
@@ -222,9 +458,34 @@ private:
 
 	void async_start_receive()
 	{
+		if (settings_.batched_receive())
+		{
+			tcp::operations::read_tcp_packages_op<self_type> read_op{ this->shared_from_this(), receive_buffer_ };
+			read_op.initiate(
+				[this, generation = generation_](boost::system::error_code ec, detail::tcp::tcp_package_view view)
+			{
+				if (!ec)
+				{
+					ES_TRACE("got package : cmd={}, msg-offset={}, msg-size={}",
+						(unsigned int)view.command(),
+						view.message_offset(),
+						view.message_size()
+					);
+
+					on_package_received(ec, view);
+				}
+				else
+				{
+					on_connection_lost(ec, generation);
+				}
+			}
+			);
+			return;
+		}
+
 		tcp::operations::read_tcp_package_op<self_type, dynamic_buffer_type> read_op{ this->shared_from_this(), buffer_ };
 		read_op.initiate(
-			[this](boost::system::error_code& ec, std::size_t frame_size)
+			[this, generation = generation_](boost::system::error_code& ec, std::size_t frame_size)
 		{
 			if (!ec)
 			{
@@ -246,47 +507,671 @@ private:
 			}
 			else
 			{
-				close();
+				on_connection_lost(ec, generation);
 			}
 		}
 		);
 	}
 
+	// gathers as many queued packages as the write batch limits allow
+	// and writes them with a single scatter-gather write, packages stay
+	// in the queue until the write completes
 	void do_async_send()
 	{
+		std::size_t const max_packages = settings_.max_write_batch_size();
+		std::size_t const max_bytes = settings_.max_write_batch_bytes();
+		std::size_t bytes = 0;
+
+		std::size_t packages = 0;
+
+		write_buffers_.clear();
+		for (auto& item : message_queue_)
+		{
+			if (packages == max_packages) break;
+			// always write at least one package, even if it exceeds the byte limit
+			if (packages != 0 && bytes + item.package.size() > max_bytes) break;
+
+			// packages referring to external payloads contribute several buffers
+			item.package.append_buffers(write_buffers_);
+			bytes += item.package.size();
+			++packages;
+		}
+		write_batch_size_ = packages;
+		writing_ = true;
+
 		boost::asio::async_write(
 			socket_,
-			boost::asio::buffer(message_queue_.front().data(), message_queue_.front().size()),
-			[this](boost::system::error_code ec, std::size_t bytes_written)
+			buffer::const_buffer_span(write_buffers_.data(), write_buffers_.size()),
+			[this, generation = generation_](boost::system::error_code ec, std::size_t bytes_written)
 		{
+			// the queue was salvaged when the connection was lost
+			if (generation != generation_) return;
+
 			if (!ec)
 			{
-				message_queue_.pop_front();
+				statistics_.record_batch(write_batch_size_, bytes_written);
+				ES_TRACE("basic_tcp_connection::do_async_send : wrote {} packages, {} bytes", write_batch_size_, bytes_written);
+
+				retain_written_packages();
+				message_queue_.erase(message_queue_.begin(), message_queue_.begin() + write_batch_size_);
+				write_batch_size_ = 0;
+				writing_ = false;
 				if (!message_queue_.empty()) do_async_send();
+				complete_timed_out_writes();
 			}
 			else
 			{
-				// report error
-				socket_.close();
+				on_connection_lost(ec, generation);
 			}
 		}
 		);
 	}
 	
+	std::size_t max_concurrent_items() const { return std::max<std::size_t>(settings_.max_concurrent_items(), 1); }
+
+	template <class PackageReceivedHandler>
+	void start_operation(detail::tcp::tcp_package<>&& package, PackageReceivedHandler&& handler)
+	{
+		auto view = static_cast<detail::tcp::tcp_package_view>(package);
+		auto guid = es::guid(view.correlation_id().data());
+
+		// the package is kept after being written until the operation completes, to be sent again on retries
+		in_flight_.try_emplace(guid);
+		enqueue(std::move(package), true);
+
+		tcp::operations::operation_op<self_type, std::decay_t<PackageReceivedHandler>>
+			op{ this->shared_from_this(), std::move(handler), std::move(guid) };
+
+		op.initiate();
+	}
+
+	// queues a package on the send loop, retained packages are moved to their in-flight record once written
+	void enqueue(detail::tcp::tcp_package<>&& package, bool retain)
+	{
+		boost::asio::post(
+			executor_,
+			// use shared from this? it would extend the lifetime of the connection, even if client does not have any more references to it...
+			[this, package = std::move(package), retain]() mutable
+		{
+			if (state_ == es::internal::connection_state::closed) return;
+
+			message_queue_.push_back(outgoing_package{ std::move(package), retain });
+			// while reconnecting, packages wait for the new socket
+			if (!writing_ && state_ != es::internal::connection_state::connecting)
+			{
+				do_async_send();
+			}
+		}
+		);
+	}
+
+	// the server answered with a transient failure, send the same package again after a backoff delay,
+	// returns false if the operation is not retried and should see the response
+	bool retry_operation(es::guid_type const& key, operation_type& op)
+	{
+		auto* record = in_flight_.find(key);
+		if (record == nullptr) return false;
+
+		if (record->retries >= settings_.max_retries())
+		{
+			ES_DEBUG("basic_tcp_connection::retry_operation : operation {} reached {} retries", es::to_string(key), record->retries);
+			in_flight_.erase(key);
+			op(make_error_code(es::connection_errors::max_operation_retries), {});
+			start_pending_operations();
+			return true;
+		}
+
+		++record->retries;
+		// no timeout while waiting to be sent again, the timeout restarts with the new attempt
+		record->deadline = kNoDeadline;
+		operations_map_.register_op(key, std::move(op));
+
+		// the response can be handled before the write completion, resend once the package is back
+		if (!record->package.is_valid())
+		{
+			record->resend_when_written = true;
+			return true;
+		}
+
+		schedule_resend(key, record->retries);
+		return true;
+	}
+
+	// the node is not the master, reconnect straight to the master it advertised, the operation
+	// is sent again once reconnected, returns false if the operation should see the response
+	bool redirect_operation(es::guid_type const& key, operation_type& op, detail::tcp::tcp_package_view view)
+	{
+		// connections pinned to a node stay on it, the first connection attempt does not reconnect
+		if (node_endpoint_.has_value() || !established_) return false;
+
+		auto master = detail::tcp::not_master_redirect(view);
+		if (!master.has_value()) return false;
+
+		auto* record = in_flight_.find(key);
+		if (record == nullptr) return false;
+
+		// nodes redirecting to each other
+		if (record->retries >= settings_.max_retries())
+		{
+			ES_DEBUG("basic_tcp_connection::redirect_operation : operation {} reached {} retries", es::to_string(key), record->retries);
+			in_flight_.erase(key);
+			op(make_error_code(es::connection_errors::max_operation_retries), {});
+			start_pending_operations();
+			return true;
+		}
+
+		++record->retries;
+		operations_map_.register_op(key, std::move(op));
+		redirect_to_master(*master);
+		return true;
+	}
+
+	void redirect_to_master(boost::asio::ip::tcp::endpoint const& master)
+	{
+		std::ostringstream oss{};
+		oss << master;
+		ES_INFO("basic_tcp_connection::redirect_to_master : node is not the master, reconnecting to {}", oss.str());
+
+		redirect_endpoint_ = master;
+		on_connection_lost(make_error_code(es::connection_errors::not_master), generation_);
+	}
+
+	void schedule_resend(es::guid_type const& key, std::uint32_t attempt)
+	{
+		auto delay = detail::tcp::retry_delay(attempt, settings_.retry_delay(), settings_.max_retry_delay());
+		ES_DEBUG("basic_tcp_connection::schedule_resend : retrying operation {} in {} ms (attempt {})", es::to_string(key), delay.count(), attempt);
+
+		auto timer = std::make_shared<waitable_timer_type>(executor_);
+		timer->expires_after(delay);
+		timer->async_wait(
+			[weak = this->weak_from_this(), timer, key](boost::system::error_code ec)
+		{
+			auto self = weak.lock();
+			if (!self || ec) return;
+
+			// the operation may have timed out in the meantime
+			auto* record = self->in_flight_.find(key);
+			if (record == nullptr || !record->package.is_valid() || !self->operations_map_.contains(key)) return;
+
+			self->enqueue(std::move(record->package), true);
+			self->schedule_timeout(key);
+		}
+		);
+	}
+
+	// starts queued operations in order while there is room in the in-flight window
+	void start_pending_operations()
+	{
+		while (!pending_operations_.empty() && operations_map_.size() < max_concurrent_items())
+		{
+			pending_operation pending = std::move(pending_operations_.front());
+			pending_operations_.pop_front();
+			start_operation(std::move(pending.package), std::move(pending.op));
+		}
+	}
+
+	// fails queued operations that have waited longer than queue_timeout, 0 disables the check
+	void expire_pending_operations()
+	{
+		if (settings_.queue_timeout() <= std::chrono::milliseconds(0)) return;
+
+		auto const oldest = clock_type::now() - settings_.queue_timeout();
+		while (!pending_operations_.empty() && pending_operations_.front().enqueued <= oldest)
+		{
+			pending_operation pending = std::move(pending_operations_.front());
+			pending_operations_.pop_front();
+			ES_DEBUG("basic_tcp_connection::expire_pending_operations : operation timed out in queue");
+			pending.op(make_error_code(es::connection_errors::queue_timeout), {});
+		}
+	}
+
+	// operation deadlines are kept in a timer wheel ticking once per check period,
+	// so timeouts fire between operation_timeout and operation_timeout + check period
+	typename clock_type::duration timeout_check_period() const
+	{
+		return std::max<typename clock_type::duration>(
+			settings_.operation_timeout_check_period(),
+			std::chrono::milliseconds(1)
+		);
+	}
+
+	std::uint64_t current_tick() const { return static_cast<std::uint64_t>(elapsed() / timeout_check_period()); }
+
+	void schedule_timeout(es::guid_type const& key)
+	{
+		auto const period = timeout_check_period();
+		auto const timeout = std::chrono::duration_cast<typename clock_type::duration>(settings_.operation_timeout());
+		// first tick that starts after the timeout has fully elapsed, the wheel's own tick may lag
+		// behind the clock, so the deadline is taken from the clock rather than from the wheel
+		auto const deadline = static_cast<std::uint64_t>((elapsed() + timeout + period - typename clock_type::duration(1)) / period);
+
+		bool const start_sweep = !timeout_sweep_running_;
+		if (start_sweep)
+		{
+			// the wheel is empty, catch up with the clock before scheduling relative to it
+			timeouts_.advance(current_tick(), [](es::guid_type const&) {});
+		}
+
+		auto const ticks = deadline > timeouts_.now() ? deadline - timeouts_.now() : 1;
+		timeouts_.schedule(key, ticks);
+		if (auto* record = in_flight_.find(key)) record->deadline = timeouts_.now() + ticks;
+
+		if (start_sweep) async_sweep_timeouts();
+	}
+
+	void async_sweep_timeouts()
+	{
+		timeout_sweep_running_ = true;
+		timeout_timer_.expires_at(start_ + timeout_check_period() * (timeouts_.now() + 1));
+		timeout_timer_.async_wait(
+			[weak = this->weak_from_this()](boost::system::error_code ec)
+		{
+			auto self = weak.lock();
+			if (!self) return;
+
+			if (ec)
+			{
+				self->timeout_sweep_running_ = false;
+				return;
+			}
+
+			self->sweep_timeouts();
+		}
+		);
+	}
+
+	void sweep_timeouts()
+	{
+		timeouts_.advance(current_tick(), [this](es::guid_type const& key)
+		{
+			// retried operations have a later deadline than the one that just expired
+			auto* record = in_flight_.find(key);
+			if (record != nullptr && record->deadline > timeouts_.now()) return;
+
+			// the package of an operation whose handler is called must not be written anymore, it may
+			// refer to payloads borrowed until then, a package being written is waited for
+			if (record != nullptr && !record->package.is_valid() && !withdraw_package(key))
+			{
+				record->timed_out = true;
+				return;
+			}
+
+			in_flight_.erase(key);
+			complete_timed_out(key);
+		}
+		);
+
+		expire_pending_operations();
+		start_pending_operations();
+
+		if (timeouts_.empty())
+		{
+			timeout_sweep_running_ = false;
+			return;
+		}
+
+		async_sweep_timeouts();
+	}
+
+	// operations that got their response are no longer in the map
+	void complete_timed_out(es::guid_type const& key)
+	{
+		if (auto op = operations_map_.find_and_extract(key))
+		{
+			ES_DEBUG("basic_tcp_connection::sweep_timeouts : operation {} timed out", es::to_string(key));
+			(*op)(make_error_code(es::connection_errors::operation_timeout), {});
+		}
+	}
+
+	// removes the queued package of an operation, false if it is being written or not queued yet
+	bool withdraw_package(es::guid_type const& key)
+	{
+		std::size_t const first = writing_ ? write_batch_size_ : 0;
+		for (std::size_t i = first; i < message_queue_.size(); ++i)
+		{
+			outgoing_package& item = message_queue_[i];
+			if (!item.retain) continue;
+
+			auto view = static_cast<detail::tcp::tcp_package_view>(item.package);
+			if (es::guid(view.correlation_id().data()) != key) continue;
+
+			// the packages being written are in front of it, their buffers don't move
+			message_queue_.erase(message_queue_.begin() + i);
+			return true;
+		}
+		return false;
+	}
+
+	// completes the operations that timed out while their package was being written
+	void complete_timed_out_writes()
+	{
+		if (timed_out_writes_.empty()) return;
+
+		// handlers may send operations, which would add to the list
+		auto keys = std::move(timed_out_writes_);
+		timed_out_writes_.clear();
+		for (auto const& key : keys) complete_timed_out(key);
+	}
+
+	// hands the packages of operations still waiting for a response back to their in-flight record
+	void retain_written_packages()
+	{
+		for (std::size_t i = 0; i < write_batch_size_; ++i)
+		{
+			outgoing_package& item = message_queue_[i];
+			if (!item.retain) continue;
+
+			auto view = static_cast<detail::tcp::tcp_package_view>(item.package);
+			auto key = es::guid(view.correlation_id().data());
+			auto* record = in_flight_.find(key);
+			if (record == nullptr) continue;
+
+			if (record->timed_out)
+			{
+				in_flight_.erase(key);
+				timed_out_writes_.push_back(key);
+				continue;
+			}
+
+			record->package = std::move(item.package);
+			if (record->resend_when_written)
+			{
+				record->resend_when_written = false;
+				schedule_resend(key, record->retries);
+			}
+		}
+	}
+
+	void on_socket_connected()
+	{
+		state_ = es::internal::connection_state::connected;
+		if (!writing_ && !message_queue_.empty()) do_async_send();
+	}
+
+	void on_identified()
+	{
+		established_ = true;
+		state_ = es::internal::connection_state::connected;
+		connected_.store(true, std::memory_order_release);
+		reconnection_info_.set_reconnection_attempt_no(0);
+	}
+
+	// called for read, write, heartbeat and reconnection failures, only the first
+	// report of a given connection generation is acted upon
+	void on_connection_lost(boost::system::error_code ec, std::uint64_t generation)
+	{
+		if (generation != generation_ || state_ == es::internal::connection_state::closed) return;
+		++generation_;
+		connected_.store(false, std::memory_order_release);
+
+		boost::system::error_code ignored;
+		socket_.close(ignored);
+
+		// packages of operations waiting for a response go back to their record to be sent again,
+		// the rest (heartbeats, acks, subscription requests) is dropped or resent differently
+		for (auto& item : message_queue_)
+		{
+			if (!item.retain) continue;
+
+			auto view = static_cast<detail::tcp::tcp_package_view>(item.package);
+			auto key = es::guid(view.correlation_id().data());
+			if (auto* record = in_flight_.find(key))
+			{
+				// the socket is closed, the write no longer uses its buffers
+				if (record->timed_out)
+				{
+					in_flight_.erase(key);
+					timed_out_writes_.push_back(key);
+					continue;
+				}
+				record->package = std::move(item.package);
+			}
+		}
+		message_queue_.clear();
+		write_batch_size_ = 0;
+		writing_ = false;
+		complete_timed_out_writes();
+		receive_buffer_.clear();
+		buffer_.consume(buffer_.size());
+
+		// the first connection attempt reports failures to the async_connect handler
+		if (!established_) return;
+
+		ES_WARN("basic_tcp_connection::on_connection_lost : connection lost, {}", ec.message());
+		state_ = es::internal::connection_state::connecting;
+		schedule_reconnect();
+	}
+
+	void schedule_reconnect()
+	{
+		int attempt = reconnection_info_.reconnection_attempt_no() + 1;
+		if (attempt > static_cast<int>(settings_.max_reconnections()))
+		{
+			ES_ERROR("basic_tcp_connection::schedule_reconnect : giving up after {} reconnection attempts", attempt - 1);
+			state_ = es::internal::connection_state::closed;
+			fail_operations(make_error_code(es::connection_errors::max_reconnections));
+			return;
+		}
+
+		reconnection_info_.set_reconnection_attempt_no(attempt);
+		reconnection_info_.set_timestamp(elapsed());
+
+		// the advertised master is known to be up, reconnect to it without delay
+		if (redirect_endpoint_.has_value()) reconnect_timer_.expires_after(clock_type::duration::zero());
+		else reconnect_timer_.expires_after(settings_.reconnection_delay());
+		reconnect_timer_.async_wait(
+			[weak = this->weak_from_this()](boost::system::error_code ec)
+		{
+			auto self = weak.lock();
+			if (!self || ec) return;
+			self->reconnect();
+		}
+		);
+	}
+
+	// rediscovers the node and runs connect/identify again
+	void reconnect()
+	{
+		ES_INFO("basic_tcp_connection::reconnect : reconnection attempt {}", reconnection_info_.reconnection_attempt_no());
+
+		auto handler = [weak = this->weak_from_this(), generation = generation_]
+		(boost::system::error_code ec, detail::tcp::tcp_package_view view, guid_type = guid_type())
+		{
+			auto self = weak.lock();
+			if (!self || generation != self->generation_) return;
+
+			if (!ec || ec == es::connection_errors::authentication_failed)
+			{
+				if (view.command() != es::detail::tcp::tcp_command::client_identified) return;
+				self->on_reconnected();
+				return;
+			}
+
+			self->on_connection_lost(ec, generation);
+		};
+
+		tcp::operations::connect_op<self_type, discovery_service_type, decltype(handler)>
+			op{ this->shared_from_this(), std::move(handler) };
+		op.initiate();
+	}
+
+	// sends the requests of operations still waiting for a response again, they keep their
+	// correlation id and get a new timeout, and subscribes live subscriptions again
+	void on_reconnected()
+	{
+		ES_INFO("basic_tcp_connection::on_reconnected : reconnected after {} attempts", reconnection_info_.reconnection_attempt_no());
+		on_identified();
+
+		in_flight_.for_each([this](es::guid_type const& key, in_flight_operation& record)
+		{
+			// operations waiting for a retry are sent by their retry timer
+			if (!record.package.is_valid() || record.deadline == kNoDeadline) return;
+			if (!operations_map_.contains(key)) return;
+
+			enqueue(std::move(record.package), true);
+			schedule_timeout(key);
+		}
+		);
+
+		subscription_requests_.for_each([this](es::guid_type const& key, detail::tcp::tcp_package<>& request)
+		{
+			if (!subscriptions_map_.contains(key)) return;
+			enqueue(detail::tcp::tcp_package<>(request), false);
+		}
+		);
+	}
+
+	template <class SubscriptionHandler>
+	void register_subscription(es::guid_type const& key, SubscriptionHandler&& handler)
+	{
+		if (off_strand())
+		{
+			boost::asio::dispatch(
+				executor_,
+				[self = this->shared_from_this(), key, handler = std::move(handler)]() mutable
+			{
+				self->register_subscription(key, std::move(handler));
+			}
+			);
+			return;
+		}
+
+		subscriptions_map_.register_op(key, std::move(handler));
+	}
+
+	// completes the subscription with ec, it then posts its own removal
+	void drop_subscription(es::guid_type const& key, boost::system::error_code ec)
+	{
+		if (off_strand())
+		{
+			boost::asio::dispatch(executor_, [self = this->shared_from_this(), key, ec]() { self->drop_subscription(key, ec); });
+			return;
+		}
+
+		if (auto* subscription = subscriptions_map_.find(key)) (*subscription)(ec, {});
+	}
+
+	void remove_subscription(es::guid_type const& key)
+	{
+		subscriptions_map_.erase(key);
+		subscription_requests_.erase(key);
+	}
+
+	// completes every operation and subscription with ec
+	void fail_operations(boost::system::error_code ec)
+	{
+		std::vector<es::guid_type> keys;
+		operations_map_.for_each([&keys](es::guid_type const& key, operation_type&) { keys.push_back(key); });
+		in_flight_.clear();
+		for (auto const& key : keys)
+		{
+			if (auto op = operations_map_.find_and_extract(key)) (*op)(ec, {});
+		}
+
+		while (!pending_operations_.empty())
+		{
+			pending_operation pending = std::move(pending_operations_.front());
+			pending_operations_.pop_front();
+			pending.op(ec, {});
+		}
+
+		// subscriptions post their own removal
+		keys.clear();
+		subscriptions_map_.for_each([&keys](es::guid_type const& key, operation_type&) { keys.push_back(key); });
+		for (auto const& key : keys)
+		{
+			if (auto* subscription = subscriptions_map_.find(key)) (*subscription)(ec, {});
+		}
+	}
+
+	void report_round_trip(typename clock_type::duration round_trip)
+	{
+		if constexpr (reports_round_trips<discovery_service_type>::value)
+		{
+			boost::system::error_code ec;
+			auto remote = socket_.remote_endpoint(ec);
+			if (ec) return;
+
+			boost::asio::use_service<discovery_service_type>(get_io_context()).report_round_trip(
+				remote,
+				std::chrono::duration_cast<std::chrono::nanoseconds>(round_trip)
+			);
+		}
+	}
+
 	unsigned int& package_number() { return package_no_; }
 	unsigned int const& package_number() const { return package_no_; }
 
 private:
+	std::optional<strand_type> strand_;
+	executor_type executor_;
 	boost::asio::ip::tcp::socket socket_;
 	es::connection_settings settings_;
 	std::string connection_name_;
 	std::chrono::time_point<clock_type> start_;
-	std::deque<detail::tcp::tcp_package<>> message_queue_;
+	std::shared_ptr<buffer::frame_pool> frame_pool_;
+	struct outgoing_package
+	{
+		detail::tcp::tcp_package<> package;
+		// keep the package once written, the operation may have to send it again
+		bool retain;
+	};
+
+	std::deque<outgoing_package, buffer::frame_allocator<outgoing_package>> message_queue_;
+	std::vector<boost::asio::const_buffer> write_buffers_;
+	std::size_t write_batch_size_;
+	es::connection::send_statistics statistics_;
 	unsigned int package_no_;
 
 	operations_map_type operations_map_;
 	operations_map_type subscriptions_map_;
 	dynamic_buffer_type buffer_;
+	buffer::frame_buffer receive_buffer_;
+
+	struct pending_operation
+	{
+		detail::tcp::tcp_package<> package;
+		operation_type op;
+		typename clock_type::time_point enqueued;
+	};
+
+	std::deque<pending_operation> pending_operations_;
+
+	static constexpr std::uint64_t kNoDeadline = ~std::uint64_t(0);
+
+	// state of operations sent to the server, keyed by correlation id
+	struct in_flight_operation
+	{
+		detail::tcp::tcp_package<> package;
+		std::uint32_t retries = 0;
+		std::uint64_t deadline = kNoDeadline;
+		bool resend_when_written = false;
+		// timed out while its package was being written, completed once the write is over
+		bool timed_out = false;
+	};
+
+	es::flat_guid_map<in_flight_operation> in_flight_;
+	std::vector<es::guid_type> timed_out_writes_;
+	timer_wheel<es::guid_type> timeouts_;
+	waitable_timer_type timeout_timer_;
+	bool timeout_sweep_running_;
+
+	// atomic so that it can be read from any thread
+	std::atomic<es::internal::connection_state> state_;
+	// identified to the server at least once, lost connections are then reestablished
+	std::atomic<bool> established_;
+	// identified on the current socket, read by routers running on other executors
+	std::atomic<bool> connected_;
+	bool writing_;
+	std::uint64_t generation_;
+	detail::connection::reconnection_info<clock_type> reconnection_info_;
+	waitable_timer_type reconnect_timer_;
+	es::flat_guid_map<detail::tcp::tcp_package<>> subscription_requests_;
+	// correlation id and send time of the last heartbeat request
+	es::guid_type heartbeat_id_;
+	typename clock_type::time_point heartbeat_sent_;
+	std::optional<boost::asio::ip::tcp::endpoint> node_endpoint_;
+	std::optional<boost::asio::ip::tcp::endpoint> redirect_endpoint_;
 };
 
 } // connection
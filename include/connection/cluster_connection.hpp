@@ -0,0 +1,425 @@
+#pragma once
+
+#ifndef ES_CLUSTER_CONNECTION_HPP
+#define ES_CLUSTER_CONNECTION_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/ip/tcp.hpp>
+
+#include "logger.hpp"
+#include "connection_result.hpp"
+#include "connection_settings.hpp"
+
+#include "connection/connection_pool.hpp"
+#include "error/error.hpp"
+#include "message/cluster_messages.hpp"
+#include "tcp/encoders.hpp"
+#include "tcp/tcp_commands.hpp"
+#include "tcp/tcp_package.hpp"
+#include "tcp/wire_format.hpp"
+
+namespace es {
+namespace connection {
+
+enum class read_routing
+{
+	// each read goes to the connected follower with the fewest operations in flight or queued
+	least_outstanding,
+	// reads of the same stream always go to the same follower, reads of $all by least outstanding requests
+	stream_affinity,
+	// every read goes to one follower, if it is lost reads go to the master from then on,
+	// which is never behind a follower, so a consumer never reads back in time
+	pinned
+};
+
+// discovery services that know the members of the cluster
+template <class DiscoveryService, class = void>
+struct has_gossip : std::false_type {};
+
+template <class DiscoveryService>
+struct has_gossip<DiscoveryService, std::void_t<decltype(std::declval<DiscoveryService&>().gossip())>> : std::true_type {};
+
+// discovery services that tell Listener when the members of the cluster change
+template <class DiscoveryService, class Listener, class = void>
+struct has_gossip_listeners : std::false_type {};
+
+template <class DiscoveryService, class Listener>
+struct has_gossip_listeners<DiscoveryService, Listener, std::void_t<
+	decltype(std::declval<DiscoveryService&>().add_gossip_listener(std::declval<std::shared_ptr<Listener> const&>()))
+>> : std::true_type {};
+
+// reads that do not require the master, they are the only requests followers can serve
+inline bool is_follower_read(detail::tcp::tcp_package_view view)
+{
+	if (!view.is_valid()) return false;
+
+	std::uint32_t require_master_field = 0;
+	switch (view.command())
+	{
+	case detail::tcp::tcp_command::read_event:
+		require_master_field = detail::tcp::read_event_fields::require_master;
+		break;
+	case detail::tcp::tcp_command::read_stream_events_forward:
+	case detail::tcp::tcp_command::read_stream_events_backward:
+		require_master_field = detail::tcp::read_stream_events_fields::require_master;
+		break;
+	case detail::tcp::tcp_command::read_all_events_forward:
+	case detail::tcp::tcp_command::read_all_events_backward:
+		require_master_field = detail::tcp::read_all_events_fields::require_master;
+		break;
+	default:
+		return false;
+	}
+
+	auto require_master = detail::tcp::find_varint_field(
+		reinterpret_cast<std::byte const*>(view.data() + view.message_offset()),
+		view.message_size(),
+		require_master_field
+	);
+	return require_master.has_value() && require_master.value() == 0;
+}
+
+/*
+	Connection to a cluster that writes through the master and reads from the
+	followers. Once the master is connected, a connection is opened to every
+	slave of the discovery service's gossip. Reads sent with require_master
+	false are routed to the followers by the read routing policy, everything
+	else and reads without a connected follower go to the master.
+
+	The master connection discovers its node with the cluster settings, which
+	should prefer the master (the default). Followers are taken from the gossip
+	once the master is connected, and follow it afterwards: each time the
+	discovery service sees the members change, when the master reconnects or
+	when a background refresh sees an election, slaves that joined get a
+	connection and connections to nodes that are no longer slaves are closed.
+	A follower that is lost reconnects to the same node meanwhile.
+
+	Like the connection pool, it has the async_connect/async_send/settings
+	interface of a connection. Subscriptions live on a single connection,
+	create catch-up subscriptions on select_reader() and the others on master().
+*/
+template <class ConnectionType>
+class cluster_connection
+	: public std::enable_shared_from_this<cluster_connection<ConnectionType>>
+{
+public:
+	using connection_type = ConnectionType;
+	using operations_map_type = typename connection_type::operations_map_type;
+	using allocator_type = typename connection_type::allocator_type;
+	using dynamic_buffer_type = typename connection_type::dynamic_buffer_type;
+	using clock_type = typename connection_type::clock_type;
+	using executor_type = typename connection_type::executor_type;
+	using package_allocator_type = typename connection_type::package_allocator_type;
+	using discovery_service_type = typename connection_type::discovery_service_type;
+
+	explicit cluster_connection(
+		boost::asio::io_context& ioc,
+		es::connection_settings const& settings,
+		read_routing routing = read_routing::least_outstanding
+	) : ioc_(ioc),
+		settings_(settings),
+		routing_(routing),
+		next_(0),
+		unpinned_(false),
+		following_(false),
+		master_storage_(std::make_unique<buffer_storage_type>()),
+		master_(std::make_shared<connection_type>(ioc, settings, boost::asio::dynamic_buffer(*master_storage_))),
+		followers_(std::make_shared<followers_type>())
+	{}
+
+	// connects to the master, handler is called once it is connected,
+	// the followers connect in the background and take reads as they become connected
+	template <class ConnectionResultHandler>
+	void async_connect(ConnectionResultHandler&& handler)
+	{
+		static_assert(
+			std::is_invocable_v<ConnectionResultHandler, boost::system::error_code, std::optional<connection_result>>,
+			"ConnectionResultHandler requirements not met, must have signature R(boost::system::error_code, std::optional<connection_result>)"
+		);
+
+		if constexpr (has_gossip_listeners<discovery_service_type, cluster_connection>::value)
+		{
+			boost::asio::use_service<discovery_service_type>(ioc_).add_gossip_listener(this->shared_from_this());
+		}
+
+		// connections call their connect handler as const
+		auto shared_handler = std::make_shared<std::decay_t<ConnectionResultHandler>>(std::forward<ConnectionResultHandler>(handler));
+		master_->async_connect(
+			[self = this->shared_from_this(), handler = std::move(shared_handler)]
+			(boost::system::error_code ec, std::optional<connection_result> result)
+		{
+			// authentication failures still leave the connection usable
+			if (!ec || ec == es::connection_errors::authentication_failed)
+			{
+				self->following_.store(true, std::memory_order_release);
+				self->connect_followers();
+			}
+			(*handler)(ec, std::move(result));
+		});
+	}
+
+	// called by the discovery service when members joined, left, died or changed state
+	void on_gossip_changed(std::vector<message::member_info> const& members)
+	{
+		if (!following_.load(std::memory_order_acquire)) return;
+		update_followers(members);
+	}
+
+	// send a tcp package to es server
+	void async_send(detail::tcp::tcp_package<>&& package)
+	{
+		auto followers = this->followers();
+		if (auto* follower = select_follower(*followers, package))
+		{
+			follower->connection->async_send(std::move(package));
+			return;
+		}
+
+		master_->async_send(std::move(package));
+	}
+
+	// send tcp package with notification, reads go to a follower chosen by the read routing policy
+	template <class PackageReceivedHandler>
+	void async_send(detail::tcp::tcp_package<>&& package, PackageReceivedHandler&& handler)
+	{
+		auto followers = this->followers();
+		auto* follower = select_follower(*followers, package);
+		if (follower == nullptr)
+		{
+			master_->async_send(std::move(package), std::forward<PackageReceivedHandler>(handler));
+			return;
+		}
+
+		// counted like the pool does, connections' own counters belong to their executor
+		auto outstanding = follower->outstanding;
+		outstanding->fetch_add(1, std::memory_order_relaxed);
+
+		follower->connection->async_send(
+			std::move(package),
+			[outstanding = std::move(outstanding), handler = std::forward<PackageReceivedHandler>(handler)]
+			(boost::system::error_code ec, detail::tcp::tcp_package_view view) mutable
+		{
+			outstanding->fetch_sub(1, std::memory_order_relaxed);
+			handler(ec, view);
+		}
+		);
+	}
+
+	// connection to the master, for writes and for subscriptions other than catch-up ones
+	std::shared_ptr<connection_type> const& master() const { return master_; }
+
+	// connection the next read without a stream would be sent to, catch-up subscriptions can be created on it
+	std::shared_ptr<connection_type> select_reader()
+	{
+		auto followers = this->followers();
+		if (auto* follower = select_follower(*followers, std::nullopt)) return follower->connection;
+		return master_;
+	}
+
+	// close every connection, operations waiting for a response complete with connection_closed
+	void close()
+	{
+		std::shared_ptr<followers_type const> followers;
+		{
+			// a gossip change being applied cannot connect followers anymore
+			std::lock_guard<std::mutex> lock(update_mutex_);
+			following_.store(false, std::memory_order_release);
+			followers = this->followers();
+		}
+		master_->close();
+		for (auto& follower : *followers) follower.connection->close();
+	}
+
+	// returns the io_context shared by the connections
+	boost::asio::io_context& get_io_context() { return ioc_; }
+	// returns the io_context's executor, each connection has its own
+	executor_type get_executor() const { return executor_type(ioc_.get_executor()); }
+	// get connection settings
+	es::connection_settings const& settings() const { return settings_; }
+	// the connections are built from the same settings, so they share their frame pool
+	package_allocator_type package_allocator() const { return master_->package_allocator(); }
+	// read routing policy
+	read_routing routing() const { return routing_; }
+
+	// number of follower connections, connected or not
+	std::size_t followers_size() const { return followers()->size(); }
+	// true if the master is connected
+	bool is_connected() const { return master_->is_connected(); }
+
+private:
+	using buffer_storage_type = std::vector<std::uint8_t, allocator_type>;
+
+	struct follower
+	{
+		boost::asio::ip::tcp::endpoint endpoint;
+		// dynamic buffers don't own their storage, the follower keeps it for its connection
+		std::shared_ptr<buffer_storage_type> storage;
+		std::shared_ptr<connection_type> connection;
+		std::shared_ptr<std::atomic<std::size_t>> outstanding;
+	};
+
+	using followers_type = std::vector<follower>;
+
+	std::shared_ptr<followers_type const> followers() const
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		return followers_;
+	}
+
+	void connect_followers()
+	{
+		std::vector<message::member_info> members;
+		if constexpr (has_gossip<discovery_service_type>::value)
+		{
+			members = boost::asio::use_service<discovery_service_type>(ioc_).gossip();
+		}
+		update_followers(members);
+	}
+
+	// keeps the followers that are still slaves, in the same order so that the pinned one stays
+	// first, connects to the new slaves and closes the connections to the nodes that are not anymore
+	void update_followers(std::vector<message::member_info> const& members)
+	{
+		std::lock_guard<std::mutex> update_lock(update_mutex_);
+		if (!following_.load(std::memory_order_acquire)) return;
+
+		std::vector<boost::asio::ip::tcp::endpoint> slaves;
+		for (auto const& member : members)
+		{
+			if (!member.is_alive() || member.state() != message::virtual_node_state::slave) continue;
+
+			boost::system::error_code ec;
+			auto address = boost::asio::ip::make_address(member.external_tcp_ip(), ec);
+			if (ec) continue;
+			slaves.emplace_back(address, member.external_tcp_port());
+		}
+
+		auto previous = followers();
+		auto is_slave = [&slaves](boost::asio::ip::tcp::endpoint const& endpoint)
+		{
+			return std::find(slaves.begin(), slaves.end(), endpoint) != slaves.end();
+		};
+
+		auto followers = std::make_shared<followers_type>();
+		std::vector<std::shared_ptr<connection_type>> removed;
+		for (auto const& follower : *previous)
+		{
+			if (is_slave(follower.endpoint)) followers->push_back(follower);
+			else removed.push_back(follower.connection);
+		}
+
+		std::size_t const kept = followers->size();
+		for (auto const& endpoint : slaves)
+		{
+			bool const known = std::any_of(followers->begin(), followers->begin() + kept, [&endpoint](follower const& f) { return f.endpoint == endpoint; });
+			if (known) continue;
+
+			follower f{ endpoint, std::make_shared<buffer_storage_type>(), nullptr, std::make_shared<std::atomic<std::size_t>>(0) };
+			f.connection = std::make_shared<connection_type>(ioc_, settings_, boost::asio::dynamic_buffer(*f.storage));
+			f.connection->set_node_endpoint(endpoint);
+			f.connection->async_connect([](boost::system::error_code ec, std::optional<connection_result>)
+			{
+				if (ec) ES_WARN("cluster_connection::update_followers : could not connect to follower, {}", ec.message());
+			});
+			followers->push_back(std::move(f));
+		}
+
+		if (removed.empty() && followers->size() == kept) return;
+
+		ES_DEBUG("cluster_connection::update_followers : {} followers, {} connected, {} closed", followers->size(), followers->size() - kept, removed.size());
+
+		// reads of a pinned follower that is gone go to the master, never to another follower
+		if (routing_ == read_routing::pinned && !previous->empty() && (followers->empty() || followers->front().connection != previous->front().connection))
+		{
+			unpinned_.store(true, std::memory_order_relaxed);
+		}
+
+		{
+			std::lock_guard<std::mutex> lock(mutex_);
+			followers_ = std::move(followers);
+		}
+		for (auto& connection : removed) connection->close();
+	}
+
+	// follower a read goes to, nullptr if it goes to the master
+	follower const* select_follower(followers_type const& followers, detail::tcp::tcp_package<> const& package)
+	{
+		auto view = static_cast<detail::tcp::tcp_package_view>(package);
+		if (!is_follower_read(view)) return nullptr;
+		return select_follower(followers, request_stream(view));
+	}
+
+	follower const* select_follower(followers_type const& followers, std::optional<std::string_view> stream)
+	{
+		if (followers.empty()) return nullptr;
+
+		if (routing_ == read_routing::pinned)
+		{
+			// the first follower is the pinned one
+			if (unpinned_.load(std::memory_order_relaxed)) return nullptr;
+			if (followers.front().connection->is_connected()) return &followers.front();
+			// only give up on a follower that was connected, one that is still connecting will be used
+			if (followers.front().connection->was_connected()) unpinned_.store(true, std::memory_order_relaxed);
+			return nullptr;
+		}
+
+		if (routing_ == read_routing::stream_affinity && stream.has_value())
+		{
+			auto const& follower = followers[std::hash<std::string_view>{}(*stream) % followers.size()];
+			return follower.connection->is_connected() ? &follower : nullptr;
+		}
+
+		std::size_t const size = followers.size();
+		// spread ties when the followers are idle
+		std::size_t const start = next_.fetch_add(1, std::memory_order_relaxed) % size;
+
+		follower const* best = nullptr;
+		std::size_t best_load = std::numeric_limits<std::size_t>::max();
+		for (std::size_t i = 0; i < size; ++i)
+		{
+			auto const& follower = followers[(start + i) % size];
+			if (!follower.connection->is_connected()) continue;
+
+			std::size_t const load = follower.outstanding->load(std::memory_order_relaxed);
+			if (load < best_load)
+			{
+				best = &follower;
+				best_load = load;
+			}
+		}
+
+		return best;
+	}
+
+	boost::asio::io_context& ioc_;
+	es::connection_settings settings_;
+	read_routing routing_;
+	std::atomic<std::size_t> next_;
+	std::atomic<bool> unpinned_;
+	// the master is connected and the followers follow the gossip, until closed
+	std::atomic<bool> following_;
+	// serializes the updates of the followers, gossip changes may be seen by several threads
+	std::mutex update_mutex_;
+	std::unique_ptr<buffer_storage_type> master_storage_;
+	std::shared_ptr<connection_type> master_;
+	mutable std::mutex mutex_;
+	// replaced as a whole, senders keep the followers they selected from alive
+	std::shared_ptr<followers_type const> followers_;
+};
+
+} // connection
+} // es
+
+#endif // ES_CLUSTER_CONNECTION_HPP
@@ -0,0 +1,358 @@
+#pragma once
+
+#ifndef ES_CONNECTION_POOL_HPP
+#define ES_CONNECTION_POOL_HPP
+
+#include <atomic>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <string_view>
+#include <vector>
+
+#include <boost/asio/dispatch.hpp>
+#include <boost/asio/io_context.hpp>
+
+#include "connection_result.hpp"
+#include "connection_settings.hpp"
+
+#include "error/error.hpp"
+#include "subscription/subscription_base.hpp"
+#include "tcp/tcp_commands.hpp"
+#include "tcp/tcp_package.hpp"
+#include "tcp/wire_format.hpp"
+
+namespace es {
+namespace connection {
+
+enum class pool_routing
+{
+	// each operation goes to the connection with the fewest operations in flight or queued
+	least_outstanding,
+	// operations on the same stream always go to the same connection, so they reach
+	// the server in the order they were sent, operations without a stream are
+	// routed by least outstanding requests
+	stream_affinity
+};
+
+// stream id of requests that target a single stream, it is the first field of all of them
+inline std::optional<std::string_view> request_stream(detail::tcp::tcp_package_view view)
+{
+	if (!view.is_valid()) return {};
+
+	switch (view.command())
+	{
+	case detail::tcp::tcp_command::write_events:
+	case detail::tcp::tcp_command::delete_stream:
+	case detail::tcp::tcp_command::transaction_start:
+	case detail::tcp::tcp_command::read_event:
+	case detail::tcp::tcp_command::read_stream_events_forward:
+	case detail::tcp::tcp_command::read_stream_events_backward:
+		return detail::tcp::find_bytes_field(
+			reinterpret_cast<std::byte const*>(view.data() + view.message_offset()),
+			view.message_size(),
+			1
+		);
+	default:
+		return {};
+	}
+}
+
+// requests that belong to a subscription, they must reach the connection the subscription lives on
+inline bool is_subscription_request(detail::tcp::tcp_package_view view)
+{
+	if (!view.is_valid()) return false;
+
+	switch (view.command())
+	{
+	case detail::tcp::tcp_command::subscribe_to_stream:
+	case detail::tcp::tcp_command::unsubscribe_from_stream:
+	case detail::tcp::tcp_command::connect_to_persistent_subscription:
+	case detail::tcp::tcp_command::persistent_subscription_ack_events:
+	case detail::tcp::tcp_command::persistent_subscription_nak_events:
+		return true;
+	default:
+		return false;
+	}
+}
+
+/*
+	Spreads operations across several connections to the same node. A single
+	connection writes everything through one socket, so one large read delays
+	every operation queued behind it and throughput is capped at what one tcp
+	stream can do.
+
+	The pool has the same async_connect/async_send/settings interface as a
+	connection, so the free functions (es::async_append_to_stream,
+	es::async_read_stream_events...) accept a pool in place of a connection.
+
+	Subscriptions can be created on the pool, they all live on its first
+	connection: subscription requests, acks and naks are sent through it and
+	the pool's executor is that connection's executor. The reads a catch-up
+	subscription makes to catch up are routed like any other operation, so
+	with strands enabled create catch-up subscriptions on subscription_connection()
+	for their reads to complete on the same strand as their live events.
+	Operations can be sent from any thread when the connections use strands.
+*/
+template <class ConnectionType>
+class connection_pool
+	: public std::enable_shared_from_this<connection_pool<ConnectionType>>
+{
+public:
+	using connection_type = ConnectionType;
+	using operations_map_type = typename connection_type::operations_map_type;
+	using allocator_type = typename connection_type::allocator_type;
+	using dynamic_buffer_type = typename connection_type::dynamic_buffer_type;
+	using clock_type = typename connection_type::clock_type;
+	using executor_type = typename connection_type::executor_type;
+	using package_allocator_type = typename connection_type::package_allocator_type;
+
+	explicit connection_pool(
+		boost::asio::io_context& ioc,
+		es::connection_settings const& settings,
+		std::size_t size,
+		pool_routing routing = pool_routing::least_outstanding
+	) : ioc_(ioc),
+		settings_(settings),
+		routing_(routing),
+		next_(0)
+	{
+		if (size == 0) size = 1;
+
+		storage_.reserve(size);
+		connections_.reserve(size);
+		outstanding_.reserve(size);
+		for (std::size_t i = 0; i < size; ++i)
+		{
+			// dynamic buffers don't own their storage, the pool keeps it for the connections
+			storage_.push_back(std::make_unique<buffer_storage_type>());
+			connections_.push_back(std::make_shared<connection_type>(ioc, settings, boost::asio::dynamic_buffer(*storage_.back())));
+			outstanding_.push_back(std::make_shared<std::atomic<std::size_t>>(0));
+		}
+	}
+
+	// connects every connection of the pool, handler is called once they have all
+	// completed, with the first error if any of them failed
+	template <class ConnectionResultHandler>
+	void async_connect(ConnectionResultHandler&& handler)
+	{
+		static_assert(
+			std::is_invocable_v<ConnectionResultHandler, boost::system::error_code, std::optional<connection_result>>,
+			"ConnectionResultHandler requirements not met, must have signature R(boost::system::error_code, std::optional<connection_result>)"
+		);
+
+		struct connect_state
+		{
+			std::decay_t<ConnectionResultHandler> handler;
+			std::size_t remaining;
+			boost::system::error_code ec;
+			std::optional<connection_result> result;
+		};
+
+		auto state = std::make_shared<connect_state>(connect_state{ std::move(handler), connections_.size(), {}, {} });
+
+		for (auto& connection : connections_)
+		{
+			connection->async_connect([state](boost::system::error_code ec, std::optional<connection_result> result)
+			{
+				if (ec && !state->ec) state->ec = ec;
+				if (!state->result.has_value() && result.has_value()) state->result = std::move(result);
+
+				if (--state->remaining != 0) return;
+
+				// authentication failures still leave the connections usable
+				bool const failed = state->ec && state->ec != es::connection_errors::authentication_failed;
+				state->handler(state->ec, failed ? std::optional<connection_result>() : std::move(state->result));
+			});
+		}
+	}
+
+	// send a tcp package to es server
+	void async_send(detail::tcp::tcp_package<>&& package)
+	{
+		auto& connection = select(package);
+		connection->async_send(std::move(package));
+	}
+
+	// send tcp package with notification through the connection chosen by the routing policy
+	template <class PackageReceivedHandler>
+	void async_send(detail::tcp::tcp_package<>&& package, PackageReceivedHandler&& handler)
+	{
+		std::size_t const index = select_index(package);
+
+		// the pool counts its operations itself, connections' own counters belong to their executor
+		auto outstanding = outstanding_[index];
+		outstanding->fetch_add(1, std::memory_order_relaxed);
+
+		connections_[index]->async_send(
+			std::move(package),
+			[outstanding = std::move(outstanding), handler = std::forward<PackageReceivedHandler>(handler)]
+			(boost::system::error_code ec, detail::tcp::tcp_package_view view) mutable
+		{
+			outstanding->fetch_sub(1, std::memory_order_relaxed);
+			handler(ec, view);
+		}
+		);
+	}
+
+	// connection the routing policy would send package to
+	std::shared_ptr<connection_type> const& select(detail::tcp::tcp_package<> const& package)
+	{
+		return connections_[select_index(package)];
+	}
+
+	// connection all operations on stream are sent to with stream affinity routing
+	std::shared_ptr<connection_type> const& select(std::string_view stream) const
+	{
+		return connections_[stream_index(stream)];
+	}
+
+	// least loaded connection, connected ones first
+	std::shared_ptr<connection_type> const& select()
+	{
+		return connections_[least_outstanding_index()];
+	}
+
+	// connection every subscription created on the pool lives on
+	std::shared_ptr<connection_type> const& subscription_connection() const { return connections_.front(); }
+
+	// send a subscription request through the subscription connection, which subscribes again after a reconnection
+	void async_subscribe(detail::tcp::tcp_package<>&& package)
+	{
+		subscription_connection()->async_subscribe(std::move(package));
+	}
+
+	// subscription events are received by the subscription connection
+	auto retain_frame(detail::tcp::tcp_package_view& view)
+	{
+		return subscription_connection()->retain_frame(view);
+	}
+
+	// close every connection, operations waiting for a response complete with connection_closed
+	void close()
+	{
+		for (auto& connection : connections_) connection->close();
+	}
+
+	// returns the io_context shared by the connections
+	boost::asio::io_context& get_io_context() { return ioc_; }
+	// returns the subscription connection's executor, the other connections have their own, see select()
+	executor_type get_executor() const { return subscription_connection()->get_executor(); }
+	// get connection settings
+	es::connection_settings const& settings() const { return settings_; }
+	// the connections are built from the same settings, so they share their frame pool
+	package_allocator_type package_allocator() const { return connections_.front()->package_allocator(); }
+	// routing policy
+	pool_routing routing() const { return routing_; }
+	// number of connections
+	std::size_t size() const { return connections_.size(); }
+	// connection at index
+	std::shared_ptr<connection_type> const& operator[](std::size_t index) const { return connections_[index]; }
+
+	// true if at least one connection is connected
+	bool is_connected() const
+	{
+		for (auto const& connection : connections_)
+		{
+			if (connection->is_connected()) return true;
+		}
+		return false;
+	}
+
+	// number of operations sent through the pool and waiting for a response or queued
+	std::size_t operations_outstanding() const
+	{
+		std::size_t count = 0;
+		for (auto const& outstanding : outstanding_) count += outstanding->load(std::memory_order_relaxed);
+		return count;
+	}
+
+private:
+	template <class T, class U>
+	friend class subscription::subscription_base;
+
+	using buffer_storage_type = std::vector<std::uint8_t, allocator_type>;
+
+	template <class SubscriptionHandler>
+	void register_subscription(es::guid_type const& key, SubscriptionHandler&& handler)
+	{
+		subscription_connection()->register_subscription(key, std::forward<SubscriptionHandler>(handler));
+	}
+
+	void drop_subscription(es::guid_type const& key, boost::system::error_code ec)
+	{
+		subscription_connection()->drop_subscription(key, ec);
+	}
+
+	void remove_subscription(es::guid_type const& key)
+	{
+		// connections remove subscriptions on their own executor, which is the pool's, so this runs inline
+		boost::asio::dispatch(
+			subscription_connection()->get_executor(),
+			[connection = subscription_connection(), key]() { connection->remove_subscription(key); }
+		);
+	}
+
+	std::size_t select_index(detail::tcp::tcp_package<> const& package)
+	{
+		auto view = static_cast<detail::tcp::tcp_package_view>(package);
+		if (is_subscription_request(view)) return 0;
+
+		if (routing_ == pool_routing::stream_affinity)
+		{
+			if (auto stream = request_stream(view))
+			{
+				return stream_index(*stream);
+			}
+		}
+
+		return least_outstanding_index();
+	}
+
+	std::size_t stream_index(std::string_view stream) const
+	{
+		return std::hash<std::string_view>{}(stream) % connections_.size();
+	}
+
+	std::size_t least_outstanding_index()
+	{
+		std::size_t const size = connections_.size();
+		// spread ties when the pool is idle
+		std::size_t const start = next_.fetch_add(1, std::memory_order_relaxed) % size;
+
+		std::size_t best = start;
+		std::size_t best_load = std::numeric_limits<std::size_t>::max();
+		bool best_connected = false;
+
+		for (std::size_t i = 0; i < size; ++i)
+		{
+			std::size_t const index = (start + i) % size;
+
+			bool const connected = connections_[index]->is_connected();
+			std::size_t const load = outstanding_[index]->load(std::memory_order_relaxed);
+
+			if ((connected && !best_connected) || (connected == best_connected && load < best_load))
+			{
+				best = index;
+				best_load = load;
+				best_connected = connected;
+			}
+		}
+
+		return best;
+	}
+
+	boost::asio::io_context& ioc_;
+	es::connection_settings settings_;
+	pool_routing routing_;
+	std::atomic<std::size_t> next_;
+	std::vector<std::unique_ptr<buffer_storage_type>> storage_;
+	std::vector<std::shared_ptr<connection_type>> connections_;
+	std::vector<std::shared_ptr<std::atomic<std::size_t>>> outstanding_;
+};
+
+} // connection
+} // es
+
+#endif // ES_CONNECTION_POOL_HPP
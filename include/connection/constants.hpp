@@ -13,6 +13,8 @@ namespace constants {
 inline const std::uint32_t kDefaultMaxQueueSize = 5000;
 inline const std::uint32_t kDefaultMaxConcurrentItems = 5000;
 inline const std::uint32_t kDefaultMaxOperationRetries = 10;
+inline const auto kDefaultRetryDelay = std::chrono::milliseconds(20);
+inline const auto kDefaultMaxRetryDelay = std::chrono::milliseconds(2000);
 inline const std::uint32_t kDefaultMaxReconnections = 10;
 inline const bool kDefaultRequireMaster = true;
 inline const auto kDefaultReconnectionDelay = std::chrono::milliseconds(100);
@@ -21,6 +23,12 @@ inline const auto kDefaultOperationTimeout = std::chrono::seconds(7);
 inline const auto kDefaultOperationTimeoutCheckPeriod = std::chrono::seconds(1);
 inline const auto kTimerPeriod = std::chrono::milliseconds(200);
 inline const std::uint32_t kMaxReadSize = 4096;
+inline const std::uint32_t kMinReadSize = 4096;
+inline const std::uint32_t kDefaultReceiveBufferSize = 64 * 1024;
+inline const bool kDefaultBatchedReceive = true;
+inline const bool kDefaultUseStrand = false;
+inline const std::uint32_t kDefaultMaxWriteBatchSize = 1024;
+inline const std::uint32_t kDefaultMaxWriteBatchBytes = 1024 * 1024;
 inline const std::uint32_t kDefaultMaxClusterDiscoverAttempts = 10;
 inline const std::uint32_t kDefaultClusterManagerExternalHttpPort = 30778;
 inline const std::uint32_t kCatchUpDefaultReadBatchSize = 500;
@@ -10,7 +10,9 @@ enum class node_preference
 {
     master,
     slave,
-    random
+    random,
+    // eligible node with the lowest measured round trip time
+    lowest_latency
 };
 
 }
@@ -0,0 +1,49 @@
+#pragma once
+
+#ifndef ES_SEND_STATISTICS_HPP
+#define ES_SEND_STATISTICS_HPP
+
+#include <cstdint>
+#include <algorithm>
+
+namespace es {
+namespace connection {
+
+// counters for the send loop of a tcp connection, every
+// completed socket write accounts for one batch of packages
+class send_statistics
+{
+public:
+	send_statistics() = default;
+
+	void record_batch(std::uint64_t packages, std::uint64_t bytes)
+	{
+		++batches_;
+		packages_ += packages;
+		bytes_ += bytes;
+		max_batch_size_ = std::max(max_batch_size_, packages);
+	}
+
+	void reset() { *this = send_statistics(); }
+
+	// number of socket writes
+	std::uint64_t batches() const { return batches_; }
+	// number of tcp packages written
+	std::uint64_t packages() const { return packages_; }
+	// number of bytes written
+	std::uint64_t bytes() const { return bytes_; }
+	// largest number of packages written by a single socket write
+	std::uint64_t max_batch_size() const { return max_batch_size_; }
+	double average_batch_size() const { return batches_ == 0 ? 0.0 : static_cast<double>(packages_) / batches_; }
+
+private:
+	std::uint64_t batches_ = 0;
+	std::uint64_t packages_ = 0;
+	std::uint64_t bytes_ = 0;
+	std::uint64_t max_batch_size_ = 0;
+};
+
+} // connection
+} // es
+
+#endif // ES_SEND_STATISTICS_HPP
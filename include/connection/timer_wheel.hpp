@@ -0,0 +1,152 @@
+#pragma once
+
+#ifndef ES_TIMER_WHEEL_HPP
+#define ES_TIMER_WHEEL_HPP
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace es {
+namespace connection {
+
+/*
+	Hierarchical timing wheel keyed by ticks. The owner decides how long a
+	tick is and calls advance() once per tick (or less often, it catches up).
+
+	Four levels of 64 slots cover 2^24 ticks, deadlines further away wait in
+	an overflow list. Scheduling is O(1) and never reads a clock: deadlines
+	are relative to the wheel's own tick counter. There is no cancellation,
+	callers are expected to ignore expired keys that have already completed,
+	which is cheaper than removing every entry whose response arrives in time.
+*/
+template <class Key, class Allocator = std::allocator<Key>>
+class timer_wheel
+{
+public:
+	using key_type = Key;
+	using tick_type = std::uint64_t;
+
+	explicit timer_wheel(Allocator const& alloc = Allocator())
+		: overflow_(entry_allocator_type(alloc)), scratch_(entry_allocator_type(alloc)), now_(0), size_(0)
+	{
+		for (auto& level : levels_)
+		{
+			for (auto& slot : level)
+			{
+				slot = slot_type(entry_allocator_type(alloc));
+			}
+		}
+	}
+
+	// current tick
+	tick_type now() const { return now_; }
+	// number of scheduled entries, including those whose key has already completed
+	std::size_t size() const { return size_; }
+	bool empty() const { return size_ == 0; }
+
+	// key expires when the wheel reaches now() + ticks, at least one tick from now
+	void schedule(Key const& key, tick_type ticks)
+	{
+		place(entry{ key, now_ + (ticks == 0 ? 1 : ticks) });
+		++size_;
+	}
+
+	// moves the wheel to tick, calling expired(key) for every entry whose deadline has passed
+	template <class ExpiredHandler>
+	void advance(tick_type tick, ExpiredHandler&& expired)
+	{
+		// nothing to expire, jump straight there
+		if (size_ == 0)
+		{
+			if (tick > now_) now_ = tick;
+			return;
+		}
+
+		while (now_ < tick)
+		{
+			++now_;
+			cascade();
+
+			slot_type& slot = levels_[0][now_ & kSlotMask];
+			if (slot.empty()) continue;
+
+			// swap with scratch storage to reuse allocations, handlers may schedule new entries meanwhile
+			scratch_.swap(slot);
+			for (auto& e : scratch_)
+			{
+				--size_;
+				expired(e.key);
+			}
+			scratch_.clear();
+
+			if (size_ == 0)
+			{
+				now_ = tick;
+				return;
+			}
+		}
+	}
+
+private:
+	static constexpr unsigned kSlotBits = 6;
+	static constexpr std::size_t kSlotCount = std::size_t(1) << kSlotBits;
+	static constexpr tick_type kSlotMask = kSlotCount - 1;
+	static constexpr std::size_t kLevelCount = 4;
+
+	struct entry
+	{
+		Key key;
+		tick_type deadline;
+	};
+
+	using entry_allocator_type = typename std::allocator_traits<Allocator>::template rebind_alloc<entry>;
+	using slot_type = std::vector<entry, entry_allocator_type>;
+
+	void place(entry&& e)
+	{
+		tick_type const delta = e.deadline > now_ ? e.deadline - now_ : 0;
+		// already due entries go in the slot expired on this tick
+		tick_type const deadline = now_ + delta;
+
+		for (std::size_t level = 0; level < kLevelCount; ++level)
+		{
+			if (delta < (tick_type(1) << (kSlotBits * (level + 1))))
+			{
+				levels_[level][(deadline >> (kSlotBits * level)) & kSlotMask].emplace_back(std::move(e));
+				return;
+			}
+		}
+
+		overflow_.emplace_back(std::move(e));
+	}
+
+	// when a lower level wraps around, the next slot of the level above is redistributed
+	void cascade()
+	{
+		for (std::size_t level = 1; level <= kLevelCount; ++level)
+		{
+			if ((now_ & ((tick_type(1) << (kSlotBits * level)) - 1)) != 0) return;
+
+			slot_type& slot = level < kLevelCount ? levels_[level][(now_ >> (kSlotBits * level)) & kSlotMask] : overflow_;
+			if (slot.empty()) continue;
+
+			scratch_.swap(slot);
+			for (auto& e : scratch_) place(std::move(e));
+			scratch_.clear();
+		}
+	}
+
+	std::array<std::array<slot_type, kSlotCount>, kLevelCount> levels_;
+	slot_type overflow_;
+	slot_type scratch_;
+	tick_type now_;
+	std::size_t size_;
+};
+
+} // connection
+} // es
+
+#endif // ES_TIMER_WHEEL_HPP
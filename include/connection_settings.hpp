@@ -3,10 +3,13 @@
 #ifndef CONNECTION_SETTINGS_HPP
 #define CONNECTION_SETTINGS_HPP
 
+#include <algorithm>
+#include <memory>
 #include <string>
 #include <vector>
 #include <chrono>
 
+#include "buffer/frame_pool.hpp"
 #include "connection/constants.hpp"
 #include "connection/node_preference.hpp"
 #include "tcp/gossip_seed.hpp"
@@ -27,6 +30,13 @@ public:
     std::uint32_t max_queue_size() const { return max_queue_size_; }
     std::uint32_t max_concurrent_items() const { return max_concurrent_items_; }
     std::uint32_t max_retries() const { return max_retries_; }
+    std::chrono::milliseconds retry_delay() const { return retry_delay_; }
+    std::chrono::milliseconds max_retry_delay() const { return max_retry_delay_; }
+    std::uint32_t max_write_batch_size() const { return max_write_batch_size_; }
+    std::uint32_t max_write_batch_bytes() const { return max_write_batch_bytes_; }
+    bool batched_receive() const { return batched_receive_; }
+    std::uint32_t receive_buffer_size() const { return receive_buffer_size_; }
+    bool use_strand() const { return use_strand_; }
     std::uint32_t max_reconnections() const { return max_reconnections_; }
     bool require_master() const { return require_master_; }
     std::chrono::milliseconds reconnection_delay() const { return reconnection_delay_; }
@@ -47,6 +57,7 @@ public:
     bool fail_on_no_server_response() const { return fail_on_no_server_response_; }
     std::string const& cluster_dns() const { return cluster_dns_; }
     std::vector<tcp::gossip_seed> const& gossip_seeds() const { return gossip_seeds_; }
+    std::shared_ptr<buffer::frame_pool> const& frame_pool() const { return frame_pool_; }
 
 private:
     explicit connection_settings() = default;
@@ -56,6 +67,13 @@ private:
     std::uint32_t max_queue_size_ = es::connection::constants::kDefaultMaxQueueSize;
     std::uint32_t max_concurrent_items_ = es::connection::constants::kDefaultMaxConcurrentItems;
     std::uint32_t max_retries_ = es::connection::constants::kDefaultMaxOperationRetries;
+    std::chrono::milliseconds retry_delay_ = es::connection::constants::kDefaultRetryDelay;
+    std::chrono::milliseconds max_retry_delay_ = es::connection::constants::kDefaultMaxRetryDelay;
+    std::uint32_t max_write_batch_size_ = es::connection::constants::kDefaultMaxWriteBatchSize;
+    std::uint32_t max_write_batch_bytes_ = es::connection::constants::kDefaultMaxWriteBatchBytes;
+    bool batched_receive_ = es::connection::constants::kDefaultBatchedReceive;
+    std::uint32_t receive_buffer_size_ = es::connection::constants::kDefaultReceiveBufferSize;
+    bool use_strand_ = es::connection::constants::kDefaultUseStrand;
     std::uint32_t max_reconnections_ = es::connection::constants::kDefaultMaxReconnections;
     bool require_master_ = es::connection::constants::kDefaultRequireMaster;
     std::chrono::milliseconds reconnection_delay_ = es::connection::constants::kDefaultReconnectionDelay;
@@ -79,6 +97,7 @@ private:
     std::string cluster_dns_;
 
     std::vector<tcp::gossip_seed> gossip_seeds_; 
+    std::shared_ptr<buffer::frame_pool> frame_pool_;
 };
 
 class connection_settings_builder
@@ -92,6 +111,27 @@ public:
     self_type& with_max_queue_size(std::uint32_t max_queue_size) { settings_.max_queue_size_ = max_queue_size; return *this; }
     self_type& with_max_concurrent_items(std::uint32_t max_concurrent_items) { settings_.max_concurrent_items_ = max_concurrent_items; return *this; }
     self_type& with_max_retries(std::uint32_t max_retries) { settings_.max_retries_ = max_retries; return *this; }
+    // retries wait for a jittered delay starting around initial and doubling up to max
+    self_type& with_retry_delay(std::chrono::milliseconds initial, std::chrono::milliseconds max) 
+    { 
+        settings_.retry_delay_ = initial; 
+        settings_.max_retry_delay_ = std::max(initial, max); 
+        return *this; 
+    }
+    // at least one package is written per socket write, even if it is larger than max_bytes
+    self_type& with_max_write_batch(std::uint32_t max_packages, std::uint32_t max_bytes) 
+    { 
+        settings_.max_write_batch_size_ = max_packages == 0 ? 1 : max_packages; 
+        settings_.max_write_batch_bytes_ = max_bytes; 
+        return *this; 
+    }
+    // read as many bytes as available and parse every complete frame per socket read,
+    // instead of reading each frame's length prefix and body separately
+    self_type& batched_receive(bool batched) { settings_.batched_receive_ = batched; return *this; }
+    self_type& with_receive_buffer_size(std::uint32_t size) { settings_.receive_buffer_size_ = size; return *this; }
+    // run each connection on its own strand, so that the io_context can be run by several
+    // threads and operations can be started from any thread
+    self_type& use_strand(bool use) { settings_.use_strand_ = use; return *this; }
     self_type& with_max_reconnections(std::uint32_t max_reconnections) { settings_.max_reconnections_ = max_reconnections; return *this; }
     self_type& require_master(bool require) { settings_.require_master_ = require; return *this; }
     self_type& with_reconnection_delay(std::chrono::milliseconds reconnection_delay) { settings_.reconnection_delay_ = reconnection_delay; return *this; }
@@ -106,6 +146,7 @@ public:
     self_type& with_gossip_timeout(std::chrono::seconds gossip_timeout) { settings_.gossip_timeout_ = gossip_timeout; return *this; }
     self_type& prefer_random_node() { settings_.node_preference_ = node_preference::random; return *this; }
 	self_type& prefer_slave_node() { settings_.node_preference_ = node_preference::slave; return *this; }
+    self_type& prefer_lowest_latency_node() { settings_.node_preference_ = node_preference::lowest_latency; return *this; }
     self_type& with_default_user_credentials(user::user_credentials const& creds) { settings_.default_user_credentials_ = creds; return *this; }
     self_type& use_ssl(bool use) { settings_.use_ssl_ = use; return *this; }
     self_type& with_target_host(std::string const& target_host) { settings_.target_host_ = target_host; return *this; }
@@ -128,6 +169,10 @@ public:
         return *this;
 	}
 
+    // allocate the frames of the connection's packages from pool instead of the default frame pool,
+    // a pool per connection tells how much memory each one uses
+    self_type& with_frame_pool(std::shared_ptr<buffer::frame_pool> pool) { settings_.frame_pool_ = std::move(pool); return *this; }
+
     connection_settings build()
     {
         return settings_;
@@ -14,6 +14,7 @@ Add user credentials parameter to have authentication per request
 
 #include "guid.hpp"
 #include "error/error.hpp"
+#include "tcp/decode_arena.hpp"
 #include "tcp/tcp_package.hpp"
 
 namespace es {
@@ -35,7 +36,6 @@ void async_delete_persistent_subscription(
 	request.set_event_stream_id(std::string(stream));
 	request.set_subscription_group_name(std::string(group));
 	
-	auto serialized = request.SerializeAsString();
 	auto corr_id = es::guid();
 	detail::tcp::tcp_package<> package;
 
@@ -45,8 +45,8 @@ void async_delete_persistent_subscription(
 			detail::tcp::tcp_command::delete_persistent_subscription,
 			detail::tcp::tcp_flags::none,
 			corr_id,
-			(std::byte*)serialized.data(),
-			serialized.size()
+			request,
+			connection->package_allocator()
 			));
 	}
 	else
@@ -57,8 +57,8 @@ void async_delete_persistent_subscription(
 			corr_id,
 			connection->settings().default_user_credentials().username(),
 			connection->settings().default_user_credentials().password(),
-			(std::byte*)serialized.data(),
-			serialized.size()
+			request,
+			connection->package_allocator()
 			));
 	}
 
@@ -78,8 +78,7 @@ void async_delete_persistent_subscription(
 			return;
 		}
 
-		message::DeletePersistentSubscriptionCompleted response;
-		response.ParseFromArray(view.data() + view.message_offset(), view.message_size());
+		auto& response = detail::tcp::decode<message::DeletePersistentSubscriptionCompleted>(view);
 		
 		switch (response.result())
 		{
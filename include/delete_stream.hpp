@@ -11,6 +11,7 @@
 #include "delete_stream_result.hpp"
 #include "guid.hpp"
 #include "error/error.hpp"
+#include "tcp/decode_arena.hpp"
 #include "tcp/tcp_package.hpp"
 
 namespace es {
@@ -35,7 +36,6 @@ void async_delete_stream(
 	request.set_hard_delete(hard_delete);
 	request.set_require_master(connection->settings().require_master());
 
-	auto serialized = request.SerializeAsString();
 	auto corr_id = es::guid();
 
 	detail::tcp::tcp_package<> package;
@@ -46,8 +46,8 @@ void async_delete_stream(
 			detail::tcp::tcp_command::delete_stream,
 			detail::tcp::tcp_flags::none,
 			corr_id,
-			(std::byte*)serialized.data(),
-			serialized.size()
+			request,
+			connection->package_allocator()
 			));
 	}
 	else
@@ -58,8 +58,8 @@ void async_delete_stream(
 			corr_id,
 			connection->settings().default_user_credentials().username(),
 			connection->settings().default_user_credentials().password(),
-			(std::byte*)serialized.data(),
-			serialized.size()
+			request,
+			connection->package_allocator()
 			));
 	}
 
@@ -78,21 +78,17 @@ void async_delete_stream(
 			return;
 		}
 
-		message::DeleteStreamCompleted response;
-		response.ParseFromArray(view.data() + view.message_offset(), view.message_size());
+		auto& response = detail::tcp::decode<message::DeleteStreamCompleted>(view);
 
 		switch (response.result())
 		{
 		case message::OperationResult::Success:
 			break;
 		case message::OperationResult::PrepareTimeout:
-			// retry
-			break;
 		case message::OperationResult::CommitTimeout:
-			// retry
-			break;
 		case message::OperationResult::ForwardTimeout:
-			// retry
+			// the connection retries these, they only get here once retries are exhausted
+			ec = make_error_code(connection_errors::max_operation_retries);
 			break;
 		case message::OperationResult::WrongExpectedVersion:
 			ec = make_error_code(stream_errors::wrong_expected_version);
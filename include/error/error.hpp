@@ -19,7 +19,11 @@ enum class connection_errors
 	endpoint_discovery = 7,
 	unexpected_response = 8,
 	connection_closed = 9,
-	authentication_timeout = 10
+	authentication_timeout = 10,
+	queue_overflow = 11,
+	queue_timeout = 12,
+	master_changed = 13,
+	not_master = 14
 };
 
 enum class communication_errors
@@ -91,6 +95,14 @@ struct connection_category : public boost::system::error_category
 			return "connection to server terminated";
 		case connection_errors::authentication_timeout:
 			return "authentication timed out";
+		case connection_errors::queue_overflow:
+			return "operation rejected, too many operations are waiting to be sent";
+		case connection_errors::queue_timeout:
+			return "operation timed out waiting to be sent";
+		case connection_errors::master_changed:
+			return "cluster elected another master, reconnecting to it";
+		case connection_errors::not_master:
+			return "node is not the master, reconnecting to the master it advertised";
 		default:
 			return "unknown error";
 		}
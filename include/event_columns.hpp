@@ -0,0 +1,144 @@
+#pragma once
+
+#ifndef ES_EVENT_COLUMNS_HPP
+#define ES_EVENT_COLUMNS_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "message/messages.pb.h"
+
+#include "guid.hpp"
+
+namespace es {
+
+/*
+	Events of a slice stored column by column, the i-th entry of every column
+	belongs to the i-th event. Stream ids and event types are stored once and
+	referred to by id, contents and metadata are packed in one payload buffer.
+	Each entry describes the event a link resolved to, or the record itself
+	if it is not a resolved link.
+*/
+class event_columns
+{
+public:
+	event_columns() = default;
+
+	// ResolvedEvents is a range of message::ResolvedEvent or message::ResolvedIndexedEvent
+	template <class ResolvedEvents>
+	explicit event_columns(ResolvedEvents const& events)
+	{
+		std::size_t payload_size = 0;
+		for (auto const& event : events)
+		{
+			auto const& record = event.has_event() ? event.event() : event.link();
+			payload_size += record.data().size() + record.metadata().size();
+		}
+
+		auto size = static_cast<std::size_t>(events.size());
+		stream_ids_.reserve(size);
+		event_numbers_.reserve(size);
+		type_ids_.reserve(size);
+		created_epochs_.reserve(size);
+		is_json_.reserve(size);
+		event_ids_.reserve(size);
+		payload_offsets_.reserve(2 * size + 1);
+		payload_.reserve(payload_size);
+
+		// the keys view the strings of the response, which outlives this constructor
+		std::unordered_map<std::string_view, std::uint32_t> stream_ids;
+		std::unordered_map<std::string_view, std::uint32_t> type_ids;
+
+		payload_offsets_.push_back(0);
+		for (auto const& event : events)
+		{
+			auto const& record = event.has_event() ? event.event() : event.link();
+
+			stream_ids_.push_back(id_of(record.event_stream_id(), stream_ids, streams_));
+			event_numbers_.push_back(record.event_number());
+			type_ids_.push_back(id_of(record.event_type(), type_ids, event_types_));
+			created_epochs_.push_back(record.created_epoch());
+			is_json_.push_back(record.data_content_type() == 1);
+			event_ids_.push_back(es::guid(record.event_id().data()));
+
+			payload_.append(record.data());
+			payload_offsets_.push_back(static_cast<std::uint32_t>(payload_.size()));
+			payload_.append(record.metadata());
+			payload_offsets_.push_back(static_cast<std::uint32_t>(payload_.size()));
+		}
+	}
+
+	std::size_t size() const { return event_numbers_.size(); }
+	bool empty() const { return event_numbers_.empty(); }
+
+	std::vector<std::uint32_t> const& stream_ids() const { return stream_ids_; }
+	std::vector<std::int64_t> const& event_numbers() const { return event_numbers_; }
+	std::vector<std::uint32_t> const& type_ids() const { return type_ids_; }
+	std::vector<std::int64_t> const& created_epochs() const { return created_epochs_; }
+	std::vector<std::uint8_t> const& is_json() const { return is_json_; }
+	std::vector<guid_type> const& event_ids() const { return event_ids_; }
+
+	// distinct stream ids and event types, indexed by the ids of the columns
+	std::vector<std::string> const& streams() const { return streams_; }
+	std::vector<std::string> const& event_types() const { return event_types_; }
+
+	std::string const& stream(std::size_t i) const { return streams_[stream_ids_[i]]; }
+	std::string const& event_type(std::size_t i) const { return event_types_[type_ids_[i]]; }
+
+	// id of type in the type_ids() column, if any event of the slice has that type
+	std::optional<std::uint32_t> type_id(std::string_view type) const
+	{
+		for (std::size_t id = 0; id < event_types_.size(); ++id)
+		{
+			if (event_types_[id] == type) return static_cast<std::uint32_t>(id);
+		}
+		return std::nullopt;
+	}
+
+	// content and metadata of the i-th event follow each other in the payload
+	std::string const& payload() const { return payload_; }
+	std::vector<std::uint32_t> const& payload_offsets() const { return payload_offsets_; }
+
+	std::string_view content(std::size_t i) const { return payload_range(2 * i); }
+	std::string_view metadata(std::size_t i) const { return payload_range(2 * i + 1); }
+
+private:
+	static std::uint32_t id_of(
+		std::string const& value,
+		std::unordered_map<std::string_view, std::uint32_t>& ids,
+		std::vector<std::string>& values
+	)
+	{
+		auto [it, inserted] = ids.try_emplace(value, static_cast<std::uint32_t>(values.size()));
+		if (inserted) values.push_back(value);
+		return it->second;
+	}
+
+	std::string_view payload_range(std::size_t offset) const
+	{
+		return std::string_view(payload_).substr(
+			payload_offsets_[offset],
+			payload_offsets_[offset + 1] - payload_offsets_[offset]
+		);
+	}
+
+	std::vector<std::uint32_t> stream_ids_;
+	std::vector<std::int64_t> event_numbers_;
+	std::vector<std::uint32_t> type_ids_;
+	std::vector<std::int64_t> created_epochs_;
+	std::vector<std::uint8_t> is_json_;
+	std::vector<guid_type> event_ids_;
+	std::vector<std::string> streams_;
+	std::vector<std::string> event_types_;
+	std::vector<std::uint32_t> payload_offsets_;
+	std::string payload_;
+};
+
+}
+
+#endif // ES_EVENT_COLUMNS_HPP
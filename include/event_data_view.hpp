@@ -0,0 +1,63 @@
+#pragma once
+
+#ifndef ES_EVENT_DATA_VIEW_HPP
+#define ES_EVENT_DATA_VIEW_HPP
+
+#include <optional>
+#include <string_view>
+
+#include "event_data.hpp"
+#include "guid.hpp"
+
+namespace es {
+
+/*
+	Non-owning counterpart of es::event_data, the viewed type, content and
+	metadata must stay alive until the append or transactional write that
+	takes them returns, they are copied once, straight into the request.
+*/
+class event_data_view
+{
+public:
+	event_data_view() = default;
+
+	explicit event_data_view(
+		guid_type const& event_id,
+		std::string_view type,
+		bool is_json,
+		std::string_view content,
+		std::optional<std::string_view> metadata = {}
+	) : event_id_(event_id),
+		type_(type),
+		is_json_(is_json),
+		content_(content),
+		metadata_(metadata)
+	{}
+
+	// views an event_data, which must outlive the view
+	explicit event_data_view(event_data const& event)
+		: event_id_(event.event_id()),
+		type_(event.type()),
+		is_json_(event.is_json()),
+		content_(event.content())
+	{
+		if (event.metadata().has_value()) metadata_ = *event.metadata();
+	}
+
+	guid_type const& event_id() const { return event_id_; }
+	std::string_view type() const { return type_; }
+	bool is_json() const { return is_json_; }
+	std::string_view content() const { return content_; }
+	std::optional<std::string_view> const& metadata() const { return metadata_; }
+
+private:
+	guid_type event_id_;
+	std::string_view type_;
+	bool is_json_ = false;
+	std::string_view content_;
+	std::optional<std::string_view> metadata_;
+};
+
+}
+
+#endif // ES_EVENT_DATA_VIEW_HPP
@@ -0,0 +1,294 @@
+#pragma once
+
+#ifndef ES_FLAT_GUID_MAP_HPP
+#define ES_FLAT_GUID_MAP_HPP
+
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define ES_FLAT_GUID_MAP_SSE2
+#include <emmintrin.h>
+#endif
+
+#include "guid.hpp"
+
+namespace es {
+namespace detail {
+
+// correlation ids are random guids, so we only need to fold and mix their bits
+inline std::uint64_t guid_hash(guid_type const& key)
+{
+	std::uint64_t lo, hi;
+	std::memcpy(&lo, key.data, 8);
+	std::memcpy(&hi, key.data + 8, 8);
+	return (lo ^ hi) * 0x9E3779B97F4A7C15ull;
+}
+
+inline bool guid_equal(guid_type const& lhs, guid_type const& rhs)
+{
+#ifdef ES_FLAT_GUID_MAP_SSE2
+	__m128i a = _mm_loadu_si128(reinterpret_cast<__m128i const*>(lhs.data));
+	__m128i b = _mm_loadu_si128(reinterpret_cast<__m128i const*>(rhs.data));
+	return _mm_movemask_epi8(_mm_cmpeq_epi8(a, b)) == 0xFFFF;
+#else
+	return std::memcmp(lhs.data, rhs.data, 16) == 0;
+#endif
+}
+
+} // detail
+
+/*
+	Open addressing hash table specialised for guid keys.
+
+	Slots only hold the 16 byte key and a 32 bit index, and are probed linearly,
+	so a lookup usually touches a single cache line. Values live in a chunked pool
+	and never move once inserted: references to them stay valid across rehashes and
+	erasure of other keys, which lets callers invoke a stored operation in place
+	while it registers new ones. Erased pool entries are recycled, so a map with a
+	steady number of entries stops allocating.
+*/
+template <class T, class Allocator = std::allocator<T>>
+class flat_guid_map
+{
+public:
+	using key_type = guid_type;
+	using mapped_type = T;
+	using size_type = std::size_t;
+	using allocator_type = Allocator;
+
+	explicit flat_guid_map(
+		Allocator const& alloc = Allocator(),
+		size_type initial_capacity = 0
+	) : slots_(slot_allocator_type(alloc)),
+		chunks_(chunk_pointer_allocator_type(alloc)),
+		free_(index_allocator_type(alloc)),
+		alloc_(alloc),
+		size_(0),
+		next_index_(0),
+		shift_(64)
+	{
+		reserve(initial_capacity);
+	}
+
+	flat_guid_map(flat_guid_map const&) = delete;
+	flat_guid_map& operator=(flat_guid_map const&) = delete;
+
+	~flat_guid_map()
+	{
+		clear();
+		for (auto* chunk : chunks_)
+		{
+			std::allocator_traits<chunk_allocator_type>::deallocate(alloc_, chunk, 1);
+		}
+	}
+
+	size_type size() const { return size_; }
+	bool empty() const { return size_ == 0; }
+	size_type capacity() const { return slots_.size(); }
+
+	// inserts value if key is not present, returns the stored value and whether it was inserted
+	template <class... Args>
+	std::pair<T*, bool> try_emplace(key_type const& key, Args&&... args)
+	{
+		if (T* existing = find(key)) return { existing, false };
+
+		if ((size_ + 1) * 4 > slots_.size() * 3) rehash(slots_.empty() ? kMinCapacity : slots_.size() * 2);
+
+		std::uint32_t index = acquire_index();
+		T* value = value_at(index);
+		new (value) T(std::forward<Args>(args)...);
+
+		slot* s = &slots_[home(key)];
+		while (s->index != kEmpty) s = next(s);
+		s->key = key;
+		s->index = index;
+		++size_;
+
+		return { value, true };
+	}
+
+	T* find(key_type const& key)
+	{
+		slot const* s = find_slot(key);
+		return s == nullptr ? nullptr : value_at(s->index);
+	}
+
+	T const* find(key_type const& key) const
+	{
+		slot const* s = find_slot(key);
+		return s == nullptr ? nullptr : value_at(s->index);
+	}
+
+	bool contains(key_type const& key) const { return find_slot(key) != nullptr; }
+
+	// moves the value out of the map and removes its key with a single probe sequence
+	std::optional<T> extract(key_type const& key)
+	{
+		slot* s = const_cast<slot*>(find_slot(key));
+		if (s == nullptr) return {};
+
+		T* value = value_at(s->index);
+		std::optional<T> result{ std::move(*value) };
+		remove(s);
+		return result;
+	}
+
+	bool erase(key_type const& key)
+	{
+		slot* s = const_cast<slot*>(find_slot(key));
+		if (s == nullptr) return false;
+		remove(s);
+		return true;
+	}
+
+	void clear()
+	{
+		for (auto& s : slots_)
+		{
+			if (s.index == kEmpty) continue;
+			value_at(s.index)->~T();
+			s.index = kEmpty;
+		}
+		size_ = 0;
+		next_index_ = 0;
+		free_.clear();
+	}
+
+	void reserve(size_type count)
+	{
+		size_type capacity = slots_.empty() ? kMinCapacity : slots_.size();
+		while (count * 4 > capacity * 3) capacity *= 2;
+		if (count != 0 && capacity > slots_.size()) rehash(capacity);
+	}
+
+	// calls f(key, value) for every entry, f must not insert or erase
+	template <class Func>
+	void for_each(Func&& f)
+	{
+		for (auto& s : slots_)
+		{
+			if (s.index != kEmpty) f(const_cast<key_type const&>(s.key), *value_at(s.index));
+		}
+	}
+
+private:
+	static constexpr std::uint32_t kEmpty = ~std::uint32_t(0);
+	static constexpr size_type kMinCapacity = 16;
+	static constexpr size_type kChunkSize = 64;
+
+	struct slot
+	{
+		key_type key;
+		std::uint32_t index = kEmpty;
+	};
+
+	struct chunk
+	{
+		alignas(T) unsigned char storage[sizeof(T) * kChunkSize];
+	};
+
+	using traits_type = std::allocator_traits<Allocator>;
+	using slot_allocator_type = typename traits_type::template rebind_alloc<slot>;
+	using chunk_allocator_type = typename traits_type::template rebind_alloc<chunk>;
+	using chunk_pointer_allocator_type = typename traits_type::template rebind_alloc<chunk*>;
+	using index_allocator_type = typename traits_type::template rebind_alloc<std::uint32_t>;
+
+	size_type home(key_type const& key) const { return static_cast<size_type>(detail::guid_hash(key) >> shift_); }
+	slot* next(slot* s) { return ++s == slots_.data() + slots_.size() ? slots_.data() : s; }
+	slot const* next(slot const* s) const { return ++s == slots_.data() + slots_.size() ? slots_.data() : s; }
+
+	slot const* find_slot(key_type const& key) const
+	{
+		if (size_ == 0) return nullptr;
+
+		// load factor is capped, so there is always an empty slot to stop at
+		for (slot const* s = &slots_[home(key)]; s->index != kEmpty; s = next(s))
+		{
+			if (detail::guid_equal(s->key, key)) return s;
+		}
+		return nullptr;
+	}
+
+	// backward shift deletion, keeps probe sequences short without tombstones
+	void remove(slot* s)
+	{
+		value_at(s->index)->~T();
+		free_.push_back(s->index);
+		--size_;
+
+		size_type const mask = slots_.size() - 1;
+		size_type hole = static_cast<size_type>(s - slots_.data());
+		size_type current = hole;
+		for (;;)
+		{
+			current = (current + 1) & mask;
+			slot& candidate = slots_[current];
+			if (candidate.index == kEmpty) break;
+
+			// distance from the candidate's home slot to where it is stored, and to the hole
+			size_type const candidate_home = home(candidate.key);
+			if (((current - candidate_home) & mask) >= ((current - hole) & mask))
+			{
+				slots_[hole] = candidate;
+				hole = current;
+			}
+		}
+		slots_[hole].index = kEmpty;
+	}
+
+	void rehash(size_type capacity)
+	{
+		std::vector<slot, slot_allocator_type> old(capacity, slot(), slots_.get_allocator());
+		old.swap(slots_);
+
+		int bits = 0;
+		while ((size_type(1) << bits) < capacity) ++bits;
+		shift_ = 64 - bits;
+
+		for (auto const& s : old)
+		{
+			if (s.index == kEmpty) continue;
+			slot* target = &slots_[home(s.key)];
+			while (target->index != kEmpty) target = next(target);
+			*target = s;
+		}
+	}
+
+	std::uint32_t acquire_index()
+	{
+		if (!free_.empty())
+		{
+			std::uint32_t index = free_.back();
+			free_.pop_back();
+			return index;
+		}
+
+		if (next_index_ == chunks_.size() * kChunkSize)
+		{
+			chunks_.push_back(std::allocator_traits<chunk_allocator_type>::allocate(alloc_, 1));
+		}
+		return next_index_++;
+	}
+
+	T* value_at(std::uint32_t index) const
+	{
+		return reinterpret_cast<T*>(chunks_[index / kChunkSize]->storage) + (index % kChunkSize);
+	}
+
+	std::vector<slot, slot_allocator_type> slots_;
+	std::vector<chunk*, chunk_pointer_allocator_type> chunks_;
+	std::vector<std::uint32_t, index_allocator_type> free_;
+	chunk_allocator_type alloc_;
+	size_type size_;
+	std::uint32_t next_index_;
+	int shift_;
+};
+
+} // es
+
+#endif // ES_FLAT_GUID_MAP_HPP
@@ -18,7 +18,8 @@ using guid_hasher_type = boost::hash<boost::uuids::uuid>;
 
 inline guid_type guid()
 {
-	static boost::uuids::random_generator gen;
+	// the generator is not thread safe, each thread gets its own
+	thread_local boost::uuids::random_generator gen;
 	return gen();
 }
 
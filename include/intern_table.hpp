@@ -0,0 +1,105 @@
+#pragma once
+
+#ifndef ES_INTERN_TABLE_HPP
+#define ES_INTERN_TABLE_HPP
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace es {
+
+/*
+	Handle to a string shared by every event interned with the same table,
+	such as the stream id and event type of the events of a slice. Handles
+	of the same interned string compare equal with a pointer compare.
+*/
+class interned_string
+{
+public:
+	interned_string() = default;
+
+	explicit interned_string(std::shared_ptr<std::string const> value)
+		: value_(std::move(value))
+	{}
+
+	std::string const& str() const
+	{
+		static std::string const empty;
+		return value_ == nullptr ? empty : *value_;
+	}
+
+	operator std::string_view() const { return str(); }
+
+	// equal pointers first, strings interned by different tables are compared by value
+	bool operator==(interned_string const& other) const { return value_ == other.value_ || str() == other.str(); }
+	bool operator!=(interned_string const& other) const { return !(*this == other); }
+
+private:
+	std::shared_ptr<std::string const> value_;
+};
+
+constexpr std::size_t kDefaultInternTableSize = 4096;
+
+/*
+	Deduplicates strings, interned strings are kept alive by the handles
+	given out, so forgetting them once the table is full only costs
+	duplicates from then on.
+*/
+class intern_table
+{
+public:
+	explicit intern_table(std::size_t max_size = kDefaultInternTableSize)
+		: max_size_(max_size)
+	{}
+
+	intern_table(intern_table const&) = delete;
+	intern_table& operator=(intern_table const&) = delete;
+	intern_table(intern_table&&) = default;
+	intern_table& operator=(intern_table&&) = default;
+
+	// value is moved into the table if it was not interned yet
+	interned_string intern(std::string&& value)
+	{
+		if (auto it = table_.find(value); it != table_.end()) return it->second;
+
+		return insert(std::make_shared<std::string const>(std::move(value)));
+	}
+
+	interned_string intern(std::string_view value)
+	{
+		if (auto it = table_.find(value); it != table_.end()) return it->second;
+
+		return insert(std::make_shared<std::string const>(value));
+	}
+
+	std::size_t size() const { return table_.size(); }
+	void clear() { table_.clear(); }
+
+private:
+	interned_string insert(std::shared_ptr<std::string const> value)
+	{
+		if (table_.size() >= max_size_) table_.clear();
+
+		// the key views the interned string, which lives as long as its entry
+		std::string_view key = *value;
+		return table_.emplace(key, interned_string(std::move(value))).first->second;
+	}
+
+	std::size_t max_size_;
+	std::unordered_map<std::string_view, interned_string> table_;
+};
+
+// interns value with table, or only shares it without a table
+inline interned_string intern(intern_table* table, std::string&& value)
+{
+	if (table != nullptr) return table->intern(std::move(value));
+
+	return interned_string(std::make_shared<std::string const>(std::move(value)));
+}
+
+}
+
+#endif // ES_INTERN_TABLE_HPP
@@ -8,12 +8,12 @@
 #include <string>
 
 #include <google/protobuf/port_def.inc>
-#if PROTOBUF_VERSION < 3009000
+#if PROTOBUF_VERSION < 3021000
 #error This file was generated by a newer version of protoc which is
 #error incompatible with your Protocol Buffer headers. Please update
 #error your headers.
 #endif
-#if 3009001 < PROTOBUF_MIN_PROTOC_VERSION
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
 #error This file was generated by an older version of protoc which is
 #error incompatible with your Protocol Buffer headers. Please
 #error regenerate this file with a newer version of protoc.
@@ -23,10 +23,9 @@
 #include <google/protobuf/io/coded_stream.h>
 #include <google/protobuf/arena.h>
 #include <google/protobuf/arenastring.h>
-#include <google/protobuf/generated_message_table_driven.h>
+#include <google/protobuf/generated_message_bases.h>
 #include <google/protobuf/generated_message_util.h>
-#include <google/protobuf/inlined_string_field.h>
-#include <google/protobuf/metadata.h>
+#include <google/protobuf/metadata_lite.h>
 #include <google/protobuf/generated_message_reflection.h>
 #include <google/protobuf/message.h>
 #include <google/protobuf/repeated_field.h>  // IWYU pragma: export
@@ -44,144 +43,136 @@ PROTOBUF_NAMESPACE_CLOSE
 
 // Internal implementation detail -- do not use these members.
 struct TableStruct_messages_2eproto {
-  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTableField entries[]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::AuxillaryParseTableField aux[]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTable schema[42]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::FieldMetadata field_metadata[];
-  static const ::PROTOBUF_NAMESPACE_ID::internal::SerializationTable serialization_table[];
-  static const ::PROTOBUF_NAMESPACE_ID::uint32 offsets[];
+  static const uint32_t offsets[];
 };
 extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_messages_2eproto;
 namespace es {
 namespace message {
 class ClientIdentified;
-class ClientIdentifiedDefaultTypeInternal;
+struct ClientIdentifiedDefaultTypeInternal;
 extern ClientIdentifiedDefaultTypeInternal _ClientIdentified_default_instance_;
 class ConnectToPersistentSubscription;
-class ConnectToPersistentSubscriptionDefaultTypeInternal;
+struct ConnectToPersistentSubscriptionDefaultTypeInternal;
 extern ConnectToPersistentSubscriptionDefaultTypeInternal _ConnectToPersistentSubscription_default_instance_;
 class CreatePersistentSubscription;
-class CreatePersistentSubscriptionDefaultTypeInternal;
+struct CreatePersistentSubscriptionDefaultTypeInternal;
 extern CreatePersistentSubscriptionDefaultTypeInternal _CreatePersistentSubscription_default_instance_;
 class CreatePersistentSubscriptionCompleted;
-class CreatePersistentSubscriptionCompletedDefaultTypeInternal;
+struct CreatePersistentSubscriptionCompletedDefaultTypeInternal;
 extern CreatePersistentSubscriptionCompletedDefaultTypeInternal _CreatePersistentSubscriptionCompleted_default_instance_;
 class DeletePersistentSubscription;
-class DeletePersistentSubscriptionDefaultTypeInternal;
+struct DeletePersistentSubscriptionDefaultTypeInternal;
 extern DeletePersistentSubscriptionDefaultTypeInternal _DeletePersistentSubscription_default_instance_;
 class DeletePersistentSubscriptionCompleted;
-class DeletePersistentSubscriptionCompletedDefaultTypeInternal;
+struct DeletePersistentSubscriptionCompletedDefaultTypeInternal;
 extern DeletePersistentSubscriptionCompletedDefaultTypeInternal _DeletePersistentSubscriptionCompleted_default_instance_;
 class DeleteStream;
-class DeleteStreamDefaultTypeInternal;
+struct DeleteStreamDefaultTypeInternal;
 extern DeleteStreamDefaultTypeInternal _DeleteStream_default_instance_;
 class DeleteStreamCompleted;
-class DeleteStreamCompletedDefaultTypeInternal;
+struct DeleteStreamCompletedDefaultTypeInternal;
 extern DeleteStreamCompletedDefaultTypeInternal _DeleteStreamCompleted_default_instance_;
 class EventRecord;
-class EventRecordDefaultTypeInternal;
+struct EventRecordDefaultTypeInternal;
 extern EventRecordDefaultTypeInternal _EventRecord_default_instance_;
 class IdentifyClient;
-class IdentifyClientDefaultTypeInternal;
+struct IdentifyClientDefaultTypeInternal;
 extern IdentifyClientDefaultTypeInternal _IdentifyClient_default_instance_;
 class NewEvent;
-class NewEventDefaultTypeInternal;
+struct NewEventDefaultTypeInternal;
 extern NewEventDefaultTypeInternal _NewEvent_default_instance_;
 class NotHandled;
-class NotHandledDefaultTypeInternal;
+struct NotHandledDefaultTypeInternal;
 extern NotHandledDefaultTypeInternal _NotHandled_default_instance_;
 class NotHandled_MasterInfo;
-class NotHandled_MasterInfoDefaultTypeInternal;
+struct NotHandled_MasterInfoDefaultTypeInternal;
 extern NotHandled_MasterInfoDefaultTypeInternal _NotHandled_MasterInfo_default_instance_;
 class PersistentSubscriptionAckEvents;
-class PersistentSubscriptionAckEventsDefaultTypeInternal;
+struct PersistentSubscriptionAckEventsDefaultTypeInternal;
 extern PersistentSubscriptionAckEventsDefaultTypeInternal _PersistentSubscriptionAckEvents_default_instance_;
 class PersistentSubscriptionConfirmation;
-class PersistentSubscriptionConfirmationDefaultTypeInternal;
+struct PersistentSubscriptionConfirmationDefaultTypeInternal;
 extern PersistentSubscriptionConfirmationDefaultTypeInternal _PersistentSubscriptionConfirmation_default_instance_;
 class PersistentSubscriptionNakEvents;
-class PersistentSubscriptionNakEventsDefaultTypeInternal;
+struct PersistentSubscriptionNakEventsDefaultTypeInternal;
 extern PersistentSubscriptionNakEventsDefaultTypeInternal _PersistentSubscriptionNakEvents_default_instance_;
 class PersistentSubscriptionStreamEventAppeared;
-class PersistentSubscriptionStreamEventAppearedDefaultTypeInternal;
+struct PersistentSubscriptionStreamEventAppearedDefaultTypeInternal;
 extern PersistentSubscriptionStreamEventAppearedDefaultTypeInternal _PersistentSubscriptionStreamEventAppeared_default_instance_;
 class ReadAllEvents;
-class ReadAllEventsDefaultTypeInternal;
+struct ReadAllEventsDefaultTypeInternal;
 extern ReadAllEventsDefaultTypeInternal _ReadAllEvents_default_instance_;
 class ReadAllEventsCompleted;
-class ReadAllEventsCompletedDefaultTypeInternal;
+struct ReadAllEventsCompletedDefaultTypeInternal;
 extern ReadAllEventsCompletedDefaultTypeInternal _ReadAllEventsCompleted_default_instance_;
 class ReadEvent;
-class ReadEventDefaultTypeInternal;
+struct ReadEventDefaultTypeInternal;
 extern ReadEventDefaultTypeInternal _ReadEvent_default_instance_;
 class ReadEventCompleted;
-class ReadEventCompletedDefaultTypeInternal;
+struct ReadEventCompletedDefaultTypeInternal;
 extern ReadEventCompletedDefaultTypeInternal _ReadEventCompleted_default_instance_;
 class ReadStreamEvents;
-class ReadStreamEventsDefaultTypeInternal;
+struct ReadStreamEventsDefaultTypeInternal;
 extern ReadStreamEventsDefaultTypeInternal _ReadStreamEvents_default_instance_;
 class ReadStreamEventsCompleted;
-class ReadStreamEventsCompletedDefaultTypeInternal;
+struct ReadStreamEventsCompletedDefaultTypeInternal;
 extern ReadStreamEventsCompletedDefaultTypeInternal _ReadStreamEventsCompleted_default_instance_;
 class ResolvedEvent;
-class ResolvedEventDefaultTypeInternal;
+struct ResolvedEventDefaultTypeInternal;
 extern ResolvedEventDefaultTypeInternal _ResolvedEvent_default_instance_;
 class ResolvedIndexedEvent;
-class ResolvedIndexedEventDefaultTypeInternal;
+struct ResolvedIndexedEventDefaultTypeInternal;
 extern ResolvedIndexedEventDefaultTypeInternal _ResolvedIndexedEvent_default_instance_;
 class ScavengeDatabase;
-class ScavengeDatabaseDefaultTypeInternal;
+struct ScavengeDatabaseDefaultTypeInternal;
 extern ScavengeDatabaseDefaultTypeInternal _ScavengeDatabase_default_instance_;
 class ScavengeDatabaseResponse;
-class ScavengeDatabaseResponseDefaultTypeInternal;
+struct ScavengeDatabaseResponseDefaultTypeInternal;
 extern ScavengeDatabaseResponseDefaultTypeInternal _ScavengeDatabaseResponse_default_instance_;
 class StreamEventAppeared;
-class StreamEventAppearedDefaultTypeInternal;
+struct StreamEventAppearedDefaultTypeInternal;
 extern StreamEventAppearedDefaultTypeInternal _StreamEventAppeared_default_instance_;
 class SubscribeToStream;
-class SubscribeToStreamDefaultTypeInternal;
+struct SubscribeToStreamDefaultTypeInternal;
 extern SubscribeToStreamDefaultTypeInternal _SubscribeToStream_default_instance_;
 class SubscriptionConfirmation;
-class SubscriptionConfirmationDefaultTypeInternal;
+struct SubscriptionConfirmationDefaultTypeInternal;
 extern SubscriptionConfirmationDefaultTypeInternal _SubscriptionConfirmation_default_instance_;
 class SubscriptionDropped;
-class SubscriptionDroppedDefaultTypeInternal;
+struct SubscriptionDroppedDefaultTypeInternal;
 extern SubscriptionDroppedDefaultTypeInternal _SubscriptionDropped_default_instance_;
 class TransactionCommit;
-class TransactionCommitDefaultTypeInternal;
+struct TransactionCommitDefaultTypeInternal;
 extern TransactionCommitDefaultTypeInternal _TransactionCommit_default_instance_;
 class TransactionCommitCompleted;
-class TransactionCommitCompletedDefaultTypeInternal;
+struct TransactionCommitCompletedDefaultTypeInternal;
 extern TransactionCommitCompletedDefaultTypeInternal _TransactionCommitCompleted_default_instance_;
 class TransactionStart;
-class TransactionStartDefaultTypeInternal;
+struct TransactionStartDefaultTypeInternal;
 extern TransactionStartDefaultTypeInternal _TransactionStart_default_instance_;
 class TransactionStartCompleted;
-class TransactionStartCompletedDefaultTypeInternal;
+struct TransactionStartCompletedDefaultTypeInternal;
 extern TransactionStartCompletedDefaultTypeInternal _TransactionStartCompleted_default_instance_;
 class TransactionWrite;
-class TransactionWriteDefaultTypeInternal;
+struct TransactionWriteDefaultTypeInternal;
 extern TransactionWriteDefaultTypeInternal _TransactionWrite_default_instance_;
 class TransactionWriteCompleted;
-class TransactionWriteCompletedDefaultTypeInternal;
+struct TransactionWriteCompletedDefaultTypeInternal;
 extern TransactionWriteCompletedDefaultTypeInternal _TransactionWriteCompleted_default_instance_;
 class UnsubscribeFromStream;
-class UnsubscribeFromStreamDefaultTypeInternal;
+struct UnsubscribeFromStreamDefaultTypeInternal;
 extern UnsubscribeFromStreamDefaultTypeInternal _UnsubscribeFromStream_default_instance_;
 class UpdatePersistentSubscription;
-class UpdatePersistentSubscriptionDefaultTypeInternal;
+struct UpdatePersistentSubscriptionDefaultTypeInternal;
 extern UpdatePersistentSubscriptionDefaultTypeInternal _UpdatePersistentSubscription_default_instance_;
 class UpdatePersistentSubscriptionCompleted;
-class UpdatePersistentSubscriptionCompletedDefaultTypeInternal;
+struct UpdatePersistentSubscriptionCompletedDefaultTypeInternal;
 extern UpdatePersistentSubscriptionCompletedDefaultTypeInternal _UpdatePersistentSubscriptionCompleted_default_instance_;
 class WriteEvents;
-class WriteEventsDefaultTypeInternal;
+struct WriteEventsDefaultTypeInternal;
 extern WriteEventsDefaultTypeInternal _WriteEvents_default_instance_;
 class WriteEventsCompleted;
-class WriteEventsCompletedDefaultTypeInternal;
+struct WriteEventsCompletedDefaultTypeInternal;
 extern WriteEventsCompletedDefaultTypeInternal _WriteEventsCompleted_default_instance_;
 }  // namespace message
 }  // namespace es
@@ -255,7 +246,7 @@ inline const std::string& ReadEventCompleted_ReadEventResult_Name(T enum_t_value
     ReadEventCompleted_ReadEventResult_descriptor(), enum_t_value);
 }
 inline bool ReadEventCompleted_ReadEventResult_Parse(
-    const std::string& name, ReadEventCompleted_ReadEventResult* value) {
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, ReadEventCompleted_ReadEventResult* value) {
   return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<ReadEventCompleted_ReadEventResult>(
     ReadEventCompleted_ReadEventResult_descriptor(), name, value);
 }
@@ -282,7 +273,7 @@ inline const std::string& ReadStreamEventsCompleted_ReadStreamResult_Name(T enum
     ReadStreamEventsCompleted_ReadStreamResult_descriptor(), enum_t_value);
 }
 inline bool ReadStreamEventsCompleted_ReadStreamResult_Parse(
-    const std::string& name, ReadStreamEventsCompleted_ReadStreamResult* value) {
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, ReadStreamEventsCompleted_ReadStreamResult* value) {
   return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<ReadStreamEventsCompleted_ReadStreamResult>(
     ReadStreamEventsCompleted_ReadStreamResult_descriptor(), name, value);
 }
@@ -307,7 +298,7 @@ inline const std::string& ReadAllEventsCompleted_ReadAllResult_Name(T enum_t_val
     ReadAllEventsCompleted_ReadAllResult_descriptor(), enum_t_value);
 }
 inline bool ReadAllEventsCompleted_ReadAllResult_Parse(
-    const std::string& name, ReadAllEventsCompleted_ReadAllResult* value) {
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, ReadAllEventsCompleted_ReadAllResult* value) {
   return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<ReadAllEventsCompleted_ReadAllResult>(
     ReadAllEventsCompleted_ReadAllResult_descriptor(), name, value);
 }
@@ -332,7 +323,7 @@ inline const std::string& UpdatePersistentSubscriptionCompleted_UpdatePersistent
     UpdatePersistentSubscriptionCompleted_UpdatePersistentSubscriptionResult_descriptor(), enum_t_value);
 }
 inline bool UpdatePersistentSubscriptionCompleted_UpdatePersistentSubscriptionResult_Parse(
-    const std::string& name, UpdatePersistentSubscriptionCompleted_UpdatePersistentSubscriptionResult* value) {
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, UpdatePersistentSubscriptionCompleted_UpdatePersistentSubscriptionResult* value) {
   return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<UpdatePersistentSubscriptionCompleted_UpdatePersistentSubscriptionResult>(
     UpdatePersistentSubscriptionCompleted_UpdatePersistentSubscriptionResult_descriptor(), name, value);
 }
@@ -357,7 +348,7 @@ inline const std::string& CreatePersistentSubscriptionCompleted_CreatePersistent
     CreatePersistentSubscriptionCompleted_CreatePersistentSubscriptionResult_descriptor(), enum_t_value);
 }
 inline bool CreatePersistentSubscriptionCompleted_CreatePersistentSubscriptionResult_Parse(
-    const std::string& name, CreatePersistentSubscriptionCompleted_CreatePersistentSubscriptionResult* value) {
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, CreatePersistentSubscriptionCompleted_CreatePersistentSubscriptionResult* value) {
   return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<CreatePersistentSubscriptionCompleted_CreatePersistentSubscriptionResult>(
     CreatePersistentSubscriptionCompleted_CreatePersistentSubscriptionResult_descriptor(), name, value);
 }
@@ -382,7 +373,7 @@ inline const std::string& DeletePersistentSubscriptionCompleted_DeletePersistent
     DeletePersistentSubscriptionCompleted_DeletePersistentSubscriptionResult_descriptor(), enum_t_value);
 }
 inline bool DeletePersistentSubscriptionCompleted_DeletePersistentSubscriptionResult_Parse(
-    const std::string& name, DeletePersistentSubscriptionCompleted_DeletePersistentSubscriptionResult* value) {
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, DeletePersistentSubscriptionCompleted_DeletePersistentSubscriptionResult* value) {
   return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<DeletePersistentSubscriptionCompleted_DeletePersistentSubscriptionResult>(
     DeletePersistentSubscriptionCompleted_DeletePersistentSubscriptionResult_descriptor(), name, value);
 }
@@ -408,7 +399,7 @@ inline const std::string& PersistentSubscriptionNakEvents_NakAction_Name(T enum_
     PersistentSubscriptionNakEvents_NakAction_descriptor(), enum_t_value);
 }
 inline bool PersistentSubscriptionNakEvents_NakAction_Parse(
-    const std::string& name, PersistentSubscriptionNakEvents_NakAction* value) {
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, PersistentSubscriptionNakEvents_NakAction* value) {
   return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<PersistentSubscriptionNakEvents_NakAction>(
     PersistentSubscriptionNakEvents_NakAction_descriptor(), name, value);
 }
@@ -434,7 +425,7 @@ inline const std::string& SubscriptionDropped_SubscriptionDropReason_Name(T enum
     SubscriptionDropped_SubscriptionDropReason_descriptor(), enum_t_value);
 }
 inline bool SubscriptionDropped_SubscriptionDropReason_Parse(
-    const std::string& name, SubscriptionDropped_SubscriptionDropReason* value) {
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, SubscriptionDropped_SubscriptionDropReason* value) {
   return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<SubscriptionDropped_SubscriptionDropReason>(
     SubscriptionDropped_SubscriptionDropReason_descriptor(), name, value);
 }
@@ -458,7 +449,7 @@ inline const std::string& NotHandled_NotHandledReason_Name(T enum_t_value) {
     NotHandled_NotHandledReason_descriptor(), enum_t_value);
 }
 inline bool NotHandled_NotHandledReason_Parse(
-    const std::string& name, NotHandled_NotHandledReason* value) {
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, NotHandled_NotHandledReason* value) {
   return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<NotHandled_NotHandledReason>(
     NotHandled_NotHandledReason_descriptor(), name, value);
 }
@@ -482,7 +473,7 @@ inline const std::string& ScavengeDatabaseResponse_ScavengeResult_Name(T enum_t_
     ScavengeDatabaseResponse_ScavengeResult_descriptor(), enum_t_value);
 }
 inline bool ScavengeDatabaseResponse_ScavengeResult_Parse(
-    const std::string& name, ScavengeDatabaseResponse_ScavengeResult* value) {
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, ScavengeDatabaseResponse_ScavengeResult* value) {
   return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<ScavengeDatabaseResponse_ScavengeResult>(
     ScavengeDatabaseResponse_ScavengeResult_descriptor(), name, value);
 }
@@ -511,17 +502,18 @@ inline const std::string& OperationResult_Name(T enum_t_value) {
     OperationResult_descriptor(), enum_t_value);
 }
 inline bool OperationResult_Parse(
-    const std::string& name, OperationResult* value) {
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, OperationResult* value) {
   return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<OperationResult>(
     OperationResult_descriptor(), name, value);
 }
 // ===================================================================
 
-class NewEvent :
+class NewEvent final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:es.message.NewEvent) */ {
  public:
-  NewEvent();
-  virtual ~NewEvent();
+  inline NewEvent() : NewEvent(nullptr) {}
+  ~NewEvent() override;
+  explicit PROTOBUF_CONSTEXPR NewEvent(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   NewEvent(const NewEvent& from);
   NewEvent(NewEvent&& from) noexcept
@@ -534,8 +526,13 @@ class NewEvent :
     return *this;
   }
   inline NewEvent& operator=(NewEvent&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -543,24 +540,24 @@ class NewEvent :
   }
 
   inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
-    return _internal_metadata_.unknown_fields();
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
   }
   inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
-    return _internal_metadata_.mutable_unknown_fields();
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const NewEvent& default_instance() {
+    return *internal_default_instance();
   }
-  static const NewEvent& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const NewEvent* internal_default_instance() {
     return reinterpret_cast<const NewEvent*>(
                &_NewEvent_default_instance_);
@@ -573,64 +570,66 @@ class NewEvent :
   }
   inline void Swap(NewEvent* other) {
     if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(NewEvent* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline NewEvent* New() const final {
-    return CreateMaybeMessage<NewEvent>(nullptr);
-  }
-
-  NewEvent* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  NewEvent* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<NewEvent>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const NewEvent& from);
-  void MergeFrom(const NewEvent& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const NewEvent& from) {
+    NewEvent::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  #else
-  bool MergePartialFromCodedStream(
-      ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) final;
-  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-  void SerializeWithCachedSizes(
-      ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* InternalSerializeWithCachedSizesToArray(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
-
-  private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(NewEvent* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "es.message.NewEvent";
   }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
-  }
+  protected:
+  explicit NewEvent(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_messages_2eproto);
-    return ::descriptor_table_messages_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -646,63 +645,101 @@ class NewEvent :
   };
   // required bytes event_id = 1;
   bool has_event_id() const;
+  private:
+  bool _internal_has_event_id() const;
+  public:
   void clear_event_id();
   const std::string& event_id() const;
-  void set_event_id(const std::string& value);
-  void set_event_id(std::string&& value);
-  void set_event_id(const char* value);
-  void set_event_id(const void* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_event_id(ArgT0&& arg0, ArgT... args);
   std::string* mutable_event_id();
-  std::string* release_event_id();
+  PROTOBUF_NODISCARD std::string* release_event_id();
   void set_allocated_event_id(std::string* event_id);
+  private:
+  const std::string& _internal_event_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_event_id(const std::string& value);
+  std::string* _internal_mutable_event_id();
+  public:
 
   // required string event_type = 2;
   bool has_event_type() const;
+  private:
+  bool _internal_has_event_type() const;
+  public:
   void clear_event_type();
   const std::string& event_type() const;
-  void set_event_type(const std::string& value);
-  void set_event_type(std::string&& value);
-  void set_event_type(const char* value);
-  void set_event_type(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_event_type(ArgT0&& arg0, ArgT... args);
   std::string* mutable_event_type();
-  std::string* release_event_type();
+  PROTOBUF_NODISCARD std::string* release_event_type();
   void set_allocated_event_type(std::string* event_type);
+  private:
+  const std::string& _internal_event_type() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_event_type(const std::string& value);
+  std::string* _internal_mutable_event_type();
+  public:
 
   // required bytes data = 5;
   bool has_data() const;
+  private:
+  bool _internal_has_data() const;
+  public:
   void clear_data();
   const std::string& data() const;
-  void set_data(const std::string& value);
-  void set_data(std::string&& value);
-  void set_data(const char* value);
-  void set_data(const void* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_data(ArgT0&& arg0, ArgT... args);
   std::string* mutable_data();
-  std::string* release_data();
+  PROTOBUF_NODISCARD std::string* release_data();
   void set_allocated_data(std::string* data);
+  private:
+  const std::string& _internal_data() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_data(const std::string& value);
+  std::string* _internal_mutable_data();
+  public:
 
   // optional bytes metadata = 6;
   bool has_metadata() const;
+  private:
+  bool _internal_has_metadata() const;
+  public:
   void clear_metadata();
   const std::string& metadata() const;
-  void set_metadata(const std::string& value);
-  void set_metadata(std::string&& value);
-  void set_metadata(const char* value);
-  void set_metadata(const void* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_metadata(ArgT0&& arg0, ArgT... args);
   std::string* mutable_metadata();
-  std::string* release_metadata();
+  PROTOBUF_NODISCARD std::string* release_metadata();
   void set_allocated_metadata(std::string* metadata);
+  private:
+  const std::string& _internal_metadata() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_metadata(const std::string& value);
+  std::string* _internal_mutable_metadata();
+  public:
 
   // required int32 data_content_type = 3;
   bool has_data_content_type() const;
+  private:
+  bool _internal_has_data_content_type() const;
+  public:
   void clear_data_content_type();
-  ::PROTOBUF_NAMESPACE_ID::int32 data_content_type() const;
-  void set_data_content_type(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t data_content_type() const;
+  void set_data_content_type(int32_t value);
+  private:
+  int32_t _internal_data_content_type() const;
+  void _internal_set_data_content_type(int32_t value);
+  public:
 
   // required int32 metadata_content_type = 4;
   bool has_metadata_content_type() const;
+  private:
+  bool _internal_has_metadata_content_type() const;
+  public:
   void clear_metadata_content_type();
-  ::PROTOBUF_NAMESPACE_ID::int32 metadata_content_type() const;
-  void set_metadata_content_type(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t metadata_content_type() const;
+  void set_metadata_content_type(int32_t value);
+  private:
+  int32_t _internal_metadata_content_type() const;
+  void _internal_set_metadata_content_type(int32_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:es.message.NewEvent)
  private:
@@ -711,24 +748,30 @@ class NewEvent :
   // helper for ByteSizeLong()
   size_t RequiredFieldsByteSizeFallback() const;
 
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr event_id_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr event_type_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr data_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr metadata_;
-  ::PROTOBUF_NAMESPACE_ID::int32 data_content_type_;
-  ::PROTOBUF_NAMESPACE_ID::int32 metadata_content_type_;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr event_id_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr event_type_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr data_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr metadata_;
+    int32_t data_content_type_;
+    int32_t metadata_content_type_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_messages_2eproto;
 };
 // -------------------------------------------------------------------
 
-class EventRecord :
+class EventRecord final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:es.message.EventRecord) */ {
  public:
-  EventRecord();
-  virtual ~EventRecord();
+  inline EventRecord() : EventRecord(nullptr) {}
+  ~EventRecord() override;
+  explicit PROTOBUF_CONSTEXPR EventRecord(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   EventRecord(const EventRecord& from);
   EventRecord(EventRecord&& from) noexcept
@@ -741,8 +784,13 @@ class EventRecord :
     return *this;
   }
   inline EventRecord& operator=(EventRecord&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -750,24 +798,24 @@ class EventRecord :
   }
 
   inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
-    return _internal_metadata_.unknown_fields();
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
   }
   inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
-    return _internal_metadata_.mutable_unknown_fields();
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const EventRecord& default_instance() {
+    return *internal_default_instance();
   }
-  static const EventRecord& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const EventRecord* internal_default_instance() {
     return reinterpret_cast<const EventRecord*>(
                &_EventRecord_default_instance_);
@@ -780,64 +828,66 @@ class EventRecord :
   }
   inline void Swap(EventRecord* other) {
     if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(EventRecord* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline EventRecord* New() const final {
-    return CreateMaybeMessage<EventRecord>(nullptr);
-  }
-
-  EventRecord* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  EventRecord* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<EventRecord>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const EventRecord& from);
-  void MergeFrom(const EventRecord& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const EventRecord& from) {
+    EventRecord::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  #else
-  bool MergePartialFromCodedStream(
-      ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) final;
-  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-  void SerializeWithCachedSizes(
-      ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* InternalSerializeWithCachedSizesToArray(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
-
-  private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(EventRecord* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "es.message.EventRecord";
   }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
-  }
+  protected:
+  explicit EventRecord(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_messages_2eproto);
-    return ::descriptor_table_messages_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -857,93 +907,158 @@ class EventRecord :
   };
   // required string event_stream_id = 1;
   bool has_event_stream_id() const;
+  private:
+  bool _internal_has_event_stream_id() const;
+  public:
   void clear_event_stream_id();
   const std::string& event_stream_id() const;
-  void set_event_stream_id(const std::string& value);
-  void set_event_stream_id(std::string&& value);
-  void set_event_stream_id(const char* value);
-  void set_event_stream_id(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_event_stream_id(ArgT0&& arg0, ArgT... args);
   std::string* mutable_event_stream_id();
-  std::string* release_event_stream_id();
+  PROTOBUF_NODISCARD std::string* release_event_stream_id();
   void set_allocated_event_stream_id(std::string* event_stream_id);
+  private:
+  const std::string& _internal_event_stream_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_event_stream_id(const std::string& value);
+  std::string* _internal_mutable_event_stream_id();
+  public:
 
   // required bytes event_id = 3;
   bool has_event_id() const;
+  private:
+  bool _internal_has_event_id() const;
+  public:
   void clear_event_id();
   const std::string& event_id() const;
-  void set_event_id(const std::string& value);
-  void set_event_id(std::string&& value);
-  void set_event_id(const char* value);
-  void set_event_id(const void* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_event_id(ArgT0&& arg0, ArgT... args);
   std::string* mutable_event_id();
-  std::string* release_event_id();
+  PROTOBUF_NODISCARD std::string* release_event_id();
   void set_allocated_event_id(std::string* event_id);
+  private:
+  const std::string& _internal_event_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_event_id(const std::string& value);
+  std::string* _internal_mutable_event_id();
+  public:
 
   // required string event_type = 4;
   bool has_event_type() const;
+  private:
+  bool _internal_has_event_type() const;
+  public:
   void clear_event_type();
   const std::string& event_type() const;
-  void set_event_type(const std::string& value);
-  void set_event_type(std::string&& value);
-  void set_event_type(const char* value);
-  void set_event_type(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_event_type(ArgT0&& arg0, ArgT... args);
   std::string* mutable_event_type();
-  std::string* release_event_type();
+  PROTOBUF_NODISCARD std::string* release_event_type();
   void set_allocated_event_type(std::string* event_type);
+  private:
+  const std::string& _internal_event_type() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_event_type(const std::string& value);
+  std::string* _internal_mutable_event_type();
+  public:
 
   // required bytes data = 7;
   bool has_data() const;
+  private:
+  bool _internal_has_data() const;
+  public:
   void clear_data();
   const std::string& data() const;
-  void set_data(const std::string& value);
-  void set_data(std::string&& value);
-  void set_data(const char* value);
-  void set_data(const void* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_data(ArgT0&& arg0, ArgT... args);
   std::string* mutable_data();
-  std::string* release_data();
+  PROTOBUF_NODISCARD std::string* release_data();
   void set_allocated_data(std::string* data);
+  private:
+  const std::string& _internal_data() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_data(const std::string& value);
+  std::string* _internal_mutable_data();
+  public:
 
   // optional bytes metadata = 8;
   bool has_metadata() const;
+  private:
+  bool _internal_has_metadata() const;
+  public:
   void clear_metadata();
   const std::string& metadata() const;
-  void set_metadata(const std::string& value);
-  void set_metadata(std::string&& value);
-  void set_metadata(const char* value);
-  void set_metadata(const void* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_metadata(ArgT0&& arg0, ArgT... args);
   std::string* mutable_metadata();
-  std::string* release_metadata();
+  PROTOBUF_NODISCARD std::string* release_metadata();
   void set_allocated_metadata(std::string* metadata);
+  private:
+  const std::string& _internal_metadata() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_metadata(const std::string& value);
+  std::string* _internal_mutable_metadata();
+  public:
 
   // required int64 event_number = 2;
   bool has_event_number() const;
+  private:
+  bool _internal_has_event_number() const;
+  public:
   void clear_event_number();
-  ::PROTOBUF_NAMESPACE_ID::int64 event_number() const;
-  void set_event_number(::PROTOBUF_NAMESPACE_ID::int64 value);
+  int64_t event_number() const;
+  void set_event_number(int64_t value);
+  private:
+  int64_t _internal_event_number() const;
+  void _internal_set_event_number(int64_t value);
+  public:
 
   // required int32 data_content_type = 5;
   bool has_data_content_type() const;
+  private:
+  bool _internal_has_data_content_type() const;
+  public:
   void clear_data_content_type();
-  ::PROTOBUF_NAMESPACE_ID::int32 data_content_type() const;
-  void set_data_content_type(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t data_content_type() const;
+  void set_data_content_type(int32_t value);
+  private:
+  int32_t _internal_data_content_type() const;
+  void _internal_set_data_content_type(int32_t value);
+  public:
 
   // required int32 metadata_content_type = 6;
   bool has_metadata_content_type() const;
+  private:
+  bool _internal_has_metadata_content_type() const;
+  public:
   void clear_metadata_content_type();
-  ::PROTOBUF_NAMESPACE_ID::int32 metadata_content_type() const;
-  void set_metadata_content_type(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t metadata_content_type() const;
+  void set_metadata_content_type(int32_t value);
+  private:
+  int32_t _internal_metadata_content_type() const;
+  void _internal_set_metadata_content_type(int32_t value);
+  public:
 
   // optional int64 created = 9;
   bool has_created() const;
+  private:
+  bool _internal_has_created() const;
+  public:
   void clear_created();
-  ::PROTOBUF_NAMESPACE_ID::int64 created() const;
-  void set_created(::PROTOBUF_NAMESPACE_ID::int64 value);
+  int64_t created() const;
+  void set_created(int64_t value);
+  private:
+  int64_t _internal_created() const;
+  void _internal_set_created(int64_t value);
+  public:
 
   // optional int64 created_epoch = 10;
   bool has_created_epoch() const;
+  private:
+  bool _internal_has_created_epoch() const;
+  public:
   void clear_created_epoch();
-  ::PROTOBUF_NAMESPACE_ID::int64 created_epoch() const;
-  void set_created_epoch(::PROTOBUF_NAMESPACE_ID::int64 value);
+  int64_t created_epoch() const;
+  void set_created_epoch(int64_t value);
+  private:
+  int64_t _internal_created_epoch() const;
+  void _internal_set_created_epoch(int64_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:es.message.EventRecord)
  private:
@@ -952,28 +1067,34 @@ class EventRecord :
   // helper for ByteSizeLong()
   size_t RequiredFieldsByteSizeFallback() const;
 
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr event_stream_id_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr event_id_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr event_type_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr data_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr metadata_;
-  ::PROTOBUF_NAMESPACE_ID::int64 event_number_;
-  ::PROTOBUF_NAMESPACE_ID::int32 data_content_type_;
-  ::PROTOBUF_NAMESPACE_ID::int32 metadata_content_type_;
-  ::PROTOBUF_NAMESPACE_ID::int64 created_;
-  ::PROTOBUF_NAMESPACE_ID::int64 created_epoch_;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr event_stream_id_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr event_id_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr event_type_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr data_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr metadata_;
+    int64_t event_number_;
+    int32_t data_content_type_;
+    int32_t metadata_content_type_;
+    int64_t created_;
+    int64_t created_epoch_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_messages_2eproto;
 };
 // -------------------------------------------------------------------
 
-class ResolvedIndexedEvent :
+class ResolvedIndexedEvent final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:es.message.ResolvedIndexedEvent) */ {
  public:
-  ResolvedIndexedEvent();
-  virtual ~ResolvedIndexedEvent();
+  inline ResolvedIndexedEvent() : ResolvedIndexedEvent(nullptr) {}
+  ~ResolvedIndexedEvent() override;
+  explicit PROTOBUF_CONSTEXPR ResolvedIndexedEvent(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   ResolvedIndexedEvent(const ResolvedIndexedEvent& from);
   ResolvedIndexedEvent(ResolvedIndexedEvent&& from) noexcept
@@ -986,8 +1107,13 @@ class ResolvedIndexedEvent :
     return *this;
   }
   inline ResolvedIndexedEvent& operator=(ResolvedIndexedEvent&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -995,24 +1121,24 @@ class ResolvedIndexedEvent :
   }
 
   inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
-    return _internal_metadata_.unknown_fields();
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
   }
   inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
-    return _internal_metadata_.mutable_unknown_fields();
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ResolvedIndexedEvent& default_instance() {
+    return *internal_default_instance();
   }
-  static const ResolvedIndexedEvent& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const ResolvedIndexedEvent* internal_default_instance() {
     return reinterpret_cast<const ResolvedIndexedEvent*>(
                &_ResolvedIndexedEvent_default_instance_);
@@ -1025,64 +1151,66 @@ class ResolvedIndexedEvent :
   }
   inline void Swap(ResolvedIndexedEvent* other) {
     if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ResolvedIndexedEvent* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline ResolvedIndexedEvent* New() const final {
-    return CreateMaybeMessage<ResolvedIndexedEvent>(nullptr);
-  }
-
-  ResolvedIndexedEvent* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  ResolvedIndexedEvent* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<ResolvedIndexedEvent>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const ResolvedIndexedEvent& from);
-  void MergeFrom(const ResolvedIndexedEvent& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ResolvedIndexedEvent& from) {
+    ResolvedIndexedEvent::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  #else
-  bool MergePartialFromCodedStream(
-      ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) final;
-  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-  void SerializeWithCachedSizes(
-      ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* InternalSerializeWithCachedSizesToArray(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
-
-  private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(ResolvedIndexedEvent* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "es.message.ResolvedIndexedEvent";
   }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
-  }
+  protected:
+  explicit ResolvedIndexedEvent(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_messages_2eproto);
-    return ::descriptor_table_messages_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -1094,38 +1222,64 @@ class ResolvedIndexedEvent :
   };
   // required .es.message.EventRecord event = 1;
   bool has_event() const;
+  private:
+  bool _internal_has_event() const;
+  public:
   void clear_event();
   const ::es::message::EventRecord& event() const;
-  ::es::message::EventRecord* release_event();
+  PROTOBUF_NODISCARD ::es::message::EventRecord* release_event();
   ::es::message::EventRecord* mutable_event();
   void set_allocated_event(::es::message::EventRecord* event);
+  private:
+  const ::es::message::EventRecord& _internal_event() const;
+  ::es::message::EventRecord* _internal_mutable_event();
+  public:
+  void unsafe_arena_set_allocated_event(
+      ::es::message::EventRecord* event);
+  ::es::message::EventRecord* unsafe_arena_release_event();
 
   // optional .es.message.EventRecord link = 2;
   bool has_link() const;
+  private:
+  bool _internal_has_link() const;
+  public:
   void clear_link();
   const ::es::message::EventRecord& link() const;
-  ::es::message::EventRecord* release_link();
+  PROTOBUF_NODISCARD ::es::message::EventRecord* release_link();
   ::es::message::EventRecord* mutable_link();
   void set_allocated_link(::es::message::EventRecord* link);
+  private:
+  const ::es::message::EventRecord& _internal_link() const;
+  ::es::message::EventRecord* _internal_mutable_link();
+  public:
+  void unsafe_arena_set_allocated_link(
+      ::es::message::EventRecord* link);
+  ::es::message::EventRecord* unsafe_arena_release_link();
 
   // @@protoc_insertion_point(class_scope:es.message.ResolvedIndexedEvent)
  private:
   class _Internal;
 
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  ::es::message::EventRecord* event_;
-  ::es::message::EventRecord* link_;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::es::message::EventRecord* event_;
+    ::es::message::EventRecord* link_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_messages_2eproto;
 };
 // -------------------------------------------------------------------
 
-class ResolvedEvent :
+class ResolvedEvent final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:es.message.ResolvedEvent) */ {
  public:
-  ResolvedEvent();
-  virtual ~ResolvedEvent();
+  inline ResolvedEvent() : ResolvedEvent(nullptr) {}
+  ~ResolvedEvent() override;
+  explicit PROTOBUF_CONSTEXPR ResolvedEvent(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   ResolvedEvent(const ResolvedEvent& from);
   ResolvedEvent(ResolvedEvent&& from) noexcept
@@ -1138,8 +1292,13 @@ class ResolvedEvent :
     return *this;
   }
   inline ResolvedEvent& operator=(ResolvedEvent&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -1147,24 +1306,24 @@ class ResolvedEvent :
   }
 
   inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
-    return _internal_metadata_.unknown_fields();
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
   }
   inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
-    return _internal_metadata_.mutable_unknown_fields();
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ResolvedEvent& default_instance() {
+    return *internal_default_instance();
   }
-  static const ResolvedEvent& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const ResolvedEvent* internal_default_instance() {
     return reinterpret_cast<const ResolvedEvent*>(
                &_ResolvedEvent_default_instance_);
@@ -1177,64 +1336,66 @@ class ResolvedEvent :
   }
   inline void Swap(ResolvedEvent* other) {
     if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ResolvedEvent* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline ResolvedEvent* New() const final {
-    return CreateMaybeMessage<ResolvedEvent>(nullptr);
-  }
-
-  ResolvedEvent* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  ResolvedEvent* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<ResolvedEvent>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const ResolvedEvent& from);
-  void MergeFrom(const ResolvedEvent& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ResolvedEvent& from) {
+    ResolvedEvent::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  #else
-  bool MergePartialFromCodedStream(
-      ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) final;
-  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-  void SerializeWithCachedSizes(
-      ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* InternalSerializeWithCachedSizesToArray(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
-
-  private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(ResolvedEvent* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "es.message.ResolvedEvent";
   }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
-  }
+  protected:
+  explicit ResolvedEvent(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_messages_2eproto);
-    return ::descriptor_table_messages_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -1248,31 +1409,65 @@ class ResolvedEvent :
   };
   // required .es.message.EventRecord event = 1;
   bool has_event() const;
+  private:
+  bool _internal_has_event() const;
+  public:
   void clear_event();
   const ::es::message::EventRecord& event() const;
-  ::es::message::EventRecord* release_event();
+  PROTOBUF_NODISCARD ::es::message::EventRecord* release_event();
   ::es::message::EventRecord* mutable_event();
   void set_allocated_event(::es::message::EventRecord* event);
+  private:
+  const ::es::message::EventRecord& _internal_event() const;
+  ::es::message::EventRecord* _internal_mutable_event();
+  public:
+  void unsafe_arena_set_allocated_event(
+      ::es::message::EventRecord* event);
+  ::es::message::EventRecord* unsafe_arena_release_event();
 
   // optional .es.message.EventRecord link = 2;
   bool has_link() const;
+  private:
+  bool _internal_has_link() const;
+  public:
   void clear_link();
   const ::es::message::EventRecord& link() const;
-  ::es::message::EventRecord* release_link();
+  PROTOBUF_NODISCARD ::es::message::EventRecord* release_link();
   ::es::message::EventRecord* mutable_link();
   void set_allocated_link(::es::message::EventRecord* link);
+  private:
+  const ::es::message::EventRecord& _internal_link() const;
+  ::es::message::EventRecord* _internal_mutable_link();
+  public:
+  void unsafe_arena_set_allocated_link(
+      ::es::message::EventRecord* link);
+  ::es::message::EventRecord* unsafe_arena_release_link();
 
   // required int64 commit_position = 3;
   bool has_commit_position() const;
+  private:
+  bool _internal_has_commit_position() const;
+  public:
   void clear_commit_position();
-  ::PROTOBUF_NAMESPACE_ID::int64 commit_position() const;
-  void set_commit_position(::PROTOBUF_NAMESPACE_ID::int64 value);
+  int64_t commit_position() const;
+  void set_commit_position(int64_t value);
+  private:
+  int64_t _internal_commit_position() const;
+  void _internal_set_commit_position(int64_t value);
+  public:
 
   // required int64 prepare_position = 4;
   bool has_prepare_position() const;
+  private:
+  bool _internal_has_prepare_position() const;
+  public:
   void clear_prepare_position();
-  ::PROTOBUF_NAMESPACE_ID::int64 prepare_position() const;
-  void set_prepare_position(::PROTOBUF_NAMESPACE_ID::int64 value);
+  int64_t prepare_position() const;
+  void set_prepare_position(int64_t value);
+  private:
+  int64_t _internal_prepare_position() const;
+  void _internal_set_prepare_position(int64_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:es.message.ResolvedEvent)
  private:
@@ -1281,22 +1476,28 @@ class ResolvedEvent :
   // helper for ByteSizeLong()
   size_t RequiredFieldsByteSizeFallback() const;
 
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  ::es::message::EventRecord* event_;
-  ::es::message::EventRecord* link_;
-  ::PROTOBUF_NAMESPACE_ID::int64 commit_position_;
-  ::PROTOBUF_NAMESPACE_ID::int64 prepare_position_;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::es::message::EventRecord* event_;
+    ::es::message::EventRecord* link_;
+    int64_t commit_position_;
+    int64_t prepare_position_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_messages_2eproto;
 };
 // -------------------------------------------------------------------
 
-class WriteEvents :
+class WriteEvents final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:es.message.WriteEvents) */ {
  public:
-  WriteEvents();
-  virtual ~WriteEvents();
+  inline WriteEvents() : WriteEvents(nullptr) {}
+  ~WriteEvents() override;
+  explicit PROTOBUF_CONSTEXPR WriteEvents(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   WriteEvents(const WriteEvents& from);
   WriteEvents(WriteEvents&& from) noexcept
@@ -1309,8 +1510,13 @@ class WriteEvents :
     return *this;
   }
   inline WriteEvents& operator=(WriteEvents&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -1318,24 +1524,24 @@ class WriteEvents :
   }
 
   inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
-    return _internal_metadata_.unknown_fields();
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
   }
   inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
-    return _internal_metadata_.mutable_unknown_fields();
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const WriteEvents& default_instance() {
+    return *internal_default_instance();
   }
-  static const WriteEvents& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const WriteEvents* internal_default_instance() {
     return reinterpret_cast<const WriteEvents*>(
                &_WriteEvents_default_instance_);
@@ -1348,64 +1554,66 @@ class WriteEvents :
   }
   inline void Swap(WriteEvents* other) {
     if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(WriteEvents* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline WriteEvents* New() const final {
-    return CreateMaybeMessage<WriteEvents>(nullptr);
-  }
-
-  WriteEvents* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  WriteEvents* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<WriteEvents>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const WriteEvents& from);
-  void MergeFrom(const WriteEvents& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const WriteEvents& from) {
+    WriteEvents::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  #else
-  bool MergePartialFromCodedStream(
-      ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) final;
-  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-  void SerializeWithCachedSizes(
-      ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* InternalSerializeWithCachedSizesToArray(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
-
-  private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(WriteEvents* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "es.message.WriteEvents";
   }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
-  }
+  protected:
+  explicit WriteEvents(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_messages_2eproto);
-    return ::descriptor_table_messages_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -1419,10 +1627,17 @@ class WriteEvents :
   };
   // repeated .es.message.NewEvent events = 3;
   int events_size() const;
+  private:
+  int _internal_events_size() const;
+  public:
   void clear_events();
   ::es::message::NewEvent* mutable_events(int index);
   ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::es::message::NewEvent >*
       mutable_events();
+  private:
+  const ::es::message::NewEvent& _internal_events(int index) const;
+  ::es::message::NewEvent* _internal_add_events();
+  public:
   const ::es::message::NewEvent& events(int index) const;
   ::es::message::NewEvent* add_events();
   const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::es::message::NewEvent >&
@@ -1430,27 +1645,47 @@ class WriteEvents :
 
   // required string event_stream_id = 1;
   bool has_event_stream_id() const;
+  private:
+  bool _internal_has_event_stream_id() const;
+  public:
   void clear_event_stream_id();
   const std::string& event_stream_id() const;
-  void set_event_stream_id(const std::string& value);
-  void set_event_stream_id(std::string&& value);
-  void set_event_stream_id(const char* value);
-  void set_event_stream_id(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_event_stream_id(ArgT0&& arg0, ArgT... args);
   std::string* mutable_event_stream_id();
-  std::string* release_event_stream_id();
+  PROTOBUF_NODISCARD std::string* release_event_stream_id();
   void set_allocated_event_stream_id(std::string* event_stream_id);
+  private:
+  const std::string& _internal_event_stream_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_event_stream_id(const std::string& value);
+  std::string* _internal_mutable_event_stream_id();
+  public:
 
   // required int64 expected_version = 2;
   bool has_expected_version() const;
+  private:
+  bool _internal_has_expected_version() const;
+  public:
   void clear_expected_version();
-  ::PROTOBUF_NAMESPACE_ID::int64 expected_version() const;
-  void set_expected_version(::PROTOBUF_NAMESPACE_ID::int64 value);
+  int64_t expected_version() const;
+  void set_expected_version(int64_t value);
+  private:
+  int64_t _internal_expected_version() const;
+  void _internal_set_expected_version(int64_t value);
+  public:
 
   // required bool require_master = 4;
   bool has_require_master() const;
+  private:
+  bool _internal_has_require_master() const;
+  public:
   void clear_require_master();
   bool require_master() const;
   void set_require_master(bool value);
+  private:
+  bool _internal_require_master() const;
+  void _internal_set_require_master(bool value);
+  public:
 
   // @@protoc_insertion_point(class_scope:es.message.WriteEvents)
  private:
@@ -1459,22 +1694,28 @@ class WriteEvents :
   // helper for ByteSizeLong()
   size_t RequiredFieldsByteSizeFallback() const;
 
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::es::message::NewEvent > events_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr event_stream_id_;
-  ::PROTOBUF_NAMESPACE_ID::int64 expected_version_;
-  bool require_master_;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::es::message::NewEvent > events_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr event_stream_id_;
+    int64_t expected_version_;
+    bool require_master_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_messages_2eproto;
 };
 // -------------------------------------------------------------------
 
-class WriteEventsCompleted :
+class WriteEventsCompleted final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:es.message.WriteEventsCompleted) */ {
  public:
-  WriteEventsCompleted();
-  virtual ~WriteEventsCompleted();
+  inline WriteEventsCompleted() : WriteEventsCompleted(nullptr) {}
+  ~WriteEventsCompleted() override;
+  explicit PROTOBUF_CONSTEXPR WriteEventsCompleted(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   WriteEventsCompleted(const WriteEventsCompleted& from);
   WriteEventsCompleted(WriteEventsCompleted&& from) noexcept
@@ -1487,8 +1728,13 @@ class WriteEventsCompleted :
     return *this;
   }
   inline WriteEventsCompleted& operator=(WriteEventsCompleted&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -1496,24 +1742,24 @@ class WriteEventsCompleted :
   }
 
   inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
-    return _internal_metadata_.unknown_fields();
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
   }
   inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
-    return _internal_metadata_.mutable_unknown_fields();
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const WriteEventsCompleted& default_instance() {
+    return *internal_default_instance();
   }
-  static const WriteEventsCompleted& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const WriteEventsCompleted* internal_default_instance() {
     return reinterpret_cast<const WriteEventsCompleted*>(
                &_WriteEventsCompleted_default_instance_);
@@ -1526,64 +1772,66 @@ class WriteEventsCompleted :
   }
   inline void Swap(WriteEventsCompleted* other) {
     if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(WriteEventsCompleted* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline WriteEventsCompleted* New() const final {
-    return CreateMaybeMessage<WriteEventsCompleted>(nullptr);
-  }
-
-  WriteEventsCompleted* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  WriteEventsCompleted* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<WriteEventsCompleted>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const WriteEventsCompleted& from);
-  void MergeFrom(const WriteEventsCompleted& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const WriteEventsCompleted& from) {
+    WriteEventsCompleted::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  #else
-  bool MergePartialFromCodedStream(
-      ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) final;
-  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-  void SerializeWithCachedSizes(
-      ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* InternalSerializeWithCachedSizesToArray(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
-
-  private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(WriteEventsCompleted* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "es.message.WriteEventsCompleted";
   }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
-  }
+  protected:
+  explicit WriteEventsCompleted(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_messages_2eproto);
-    return ::descriptor_table_messages_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -1600,51 +1848,99 @@ class WriteEventsCompleted :
   };
   // optional string message = 2;
   bool has_message() const;
+  private:
+  bool _internal_has_message() const;
+  public:
   void clear_message();
   const std::string& message() const;
-  void set_message(const std::string& value);
-  void set_message(std::string&& value);
-  void set_message(const char* value);
-  void set_message(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_message(ArgT0&& arg0, ArgT... args);
   std::string* mutable_message();
-  std::string* release_message();
+  PROTOBUF_NODISCARD std::string* release_message();
   void set_allocated_message(std::string* message);
+  private:
+  const std::string& _internal_message() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_message(const std::string& value);
+  std::string* _internal_mutable_message();
+  public:
 
   // required int64 first_event_number = 3;
   bool has_first_event_number() const;
+  private:
+  bool _internal_has_first_event_number() const;
+  public:
   void clear_first_event_number();
-  ::PROTOBUF_NAMESPACE_ID::int64 first_event_number() const;
-  void set_first_event_number(::PROTOBUF_NAMESPACE_ID::int64 value);
+  int64_t first_event_number() const;
+  void set_first_event_number(int64_t value);
+  private:
+  int64_t _internal_first_event_number() const;
+  void _internal_set_first_event_number(int64_t value);
+  public:
 
   // required int64 last_event_number = 4;
   bool has_last_event_number() const;
+  private:
+  bool _internal_has_last_event_number() const;
+  public:
   void clear_last_event_number();
-  ::PROTOBUF_NAMESPACE_ID::int64 last_event_number() const;
-  void set_last_event_number(::PROTOBUF_NAMESPACE_ID::int64 value);
+  int64_t last_event_number() const;
+  void set_last_event_number(int64_t value);
+  private:
+  int64_t _internal_last_event_number() const;
+  void _internal_set_last_event_number(int64_t value);
+  public:
 
   // optional int64 prepare_position = 5;
   bool has_prepare_position() const;
+  private:
+  bool _internal_has_prepare_position() const;
+  public:
   void clear_prepare_position();
-  ::PROTOBUF_NAMESPACE_ID::int64 prepare_position() const;
-  void set_prepare_position(::PROTOBUF_NAMESPACE_ID::int64 value);
+  int64_t prepare_position() const;
+  void set_prepare_position(int64_t value);
+  private:
+  int64_t _internal_prepare_position() const;
+  void _internal_set_prepare_position(int64_t value);
+  public:
 
   // optional int64 commit_position = 6;
   bool has_commit_position() const;
+  private:
+  bool _internal_has_commit_position() const;
+  public:
   void clear_commit_position();
-  ::PROTOBUF_NAMESPACE_ID::int64 commit_position() const;
-  void set_commit_position(::PROTOBUF_NAMESPACE_ID::int64 value);
+  int64_t commit_position() const;
+  void set_commit_position(int64_t value);
+  private:
+  int64_t _internal_commit_position() const;
+  void _internal_set_commit_position(int64_t value);
+  public:
 
   // optional int64 current_version = 7;
   bool has_current_version() const;
+  private:
+  bool _internal_has_current_version() const;
+  public:
   void clear_current_version();
-  ::PROTOBUF_NAMESPACE_ID::int64 current_version() const;
-  void set_current_version(::PROTOBUF_NAMESPACE_ID::int64 value);
+  int64_t current_version() const;
+  void set_current_version(int64_t value);
+  private:
+  int64_t _internal_current_version() const;
+  void _internal_set_current_version(int64_t value);
+  public:
 
   // required .es.message.OperationResult result = 1;
   bool has_result() const;
+  private:
+  bool _internal_has_result() const;
+  public:
   void clear_result();
   ::es::message::OperationResult result() const;
   void set_result(::es::message::OperationResult value);
+  private:
+  ::es::message::OperationResult _internal_result() const;
+  void _internal_set_result(::es::message::OperationResult value);
+  public:
 
   // @@protoc_insertion_point(class_scope:es.message.WriteEventsCompleted)
  private:
@@ -1653,25 +1949,31 @@ class WriteEventsCompleted :
   // helper for ByteSizeLong()
   size_t RequiredFieldsByteSizeFallback() const;
 
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr message_;
-  ::PROTOBUF_NAMESPACE_ID::int64 first_event_number_;
-  ::PROTOBUF_NAMESPACE_ID::int64 last_event_number_;
-  ::PROTOBUF_NAMESPACE_ID::int64 prepare_position_;
-  ::PROTOBUF_NAMESPACE_ID::int64 commit_position_;
-  ::PROTOBUF_NAMESPACE_ID::int64 current_version_;
-  int result_;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr message_;
+    int64_t first_event_number_;
+    int64_t last_event_number_;
+    int64_t prepare_position_;
+    int64_t commit_position_;
+    int64_t current_version_;
+    int result_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_messages_2eproto;
 };
 // -------------------------------------------------------------------
 
-class DeleteStream :
+class DeleteStream final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:es.message.DeleteStream) */ {
  public:
-  DeleteStream();
-  virtual ~DeleteStream();
+  inline DeleteStream() : DeleteStream(nullptr) {}
+  ~DeleteStream() override;
+  explicit PROTOBUF_CONSTEXPR DeleteStream(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   DeleteStream(const DeleteStream& from);
   DeleteStream(DeleteStream&& from) noexcept
@@ -1684,8 +1986,13 @@ class DeleteStream :
     return *this;
   }
   inline DeleteStream& operator=(DeleteStream&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -1693,24 +2000,24 @@ class DeleteStream :
   }
 
   inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
-    return _internal_metadata_.unknown_fields();
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
   }
   inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
-    return _internal_metadata_.mutable_unknown_fields();
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const DeleteStream& default_instance() {
+    return *internal_default_instance();
   }
-  static const DeleteStream& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const DeleteStream* internal_default_instance() {
     return reinterpret_cast<const DeleteStream*>(
                &_DeleteStream_default_instance_);
@@ -1723,64 +2030,66 @@ class DeleteStream :
   }
   inline void Swap(DeleteStream* other) {
     if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(DeleteStream* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline DeleteStream* New() const final {
-    return CreateMaybeMessage<DeleteStream>(nullptr);
-  }
-
-  DeleteStream* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  DeleteStream* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<DeleteStream>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const DeleteStream& from);
-  void MergeFrom(const DeleteStream& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const DeleteStream& from) {
+    DeleteStream::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  #else
-  bool MergePartialFromCodedStream(
-      ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) final;
-  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-  void SerializeWithCachedSizes(
-      ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* InternalSerializeWithCachedSizesToArray(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
-
-  private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(DeleteStream* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "es.message.DeleteStream";
   }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
-  }
+  protected:
+  explicit DeleteStream(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_messages_2eproto);
-    return ::descriptor_table_messages_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -1794,33 +2103,60 @@ class DeleteStream :
   };
   // required string event_stream_id = 1;
   bool has_event_stream_id() const;
+  private:
+  bool _internal_has_event_stream_id() const;
+  public:
   void clear_event_stream_id();
   const std::string& event_stream_id() const;
-  void set_event_stream_id(const std::string& value);
-  void set_event_stream_id(std::string&& value);
-  void set_event_stream_id(const char* value);
-  void set_event_stream_id(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_event_stream_id(ArgT0&& arg0, ArgT... args);
   std::string* mutable_event_stream_id();
-  std::string* release_event_stream_id();
+  PROTOBUF_NODISCARD std::string* release_event_stream_id();
   void set_allocated_event_stream_id(std::string* event_stream_id);
+  private:
+  const std::string& _internal_event_stream_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_event_stream_id(const std::string& value);
+  std::string* _internal_mutable_event_stream_id();
+  public:
 
   // required int64 expected_version = 2;
   bool has_expected_version() const;
+  private:
+  bool _internal_has_expected_version() const;
+  public:
   void clear_expected_version();
-  ::PROTOBUF_NAMESPACE_ID::int64 expected_version() const;
-  void set_expected_version(::PROTOBUF_NAMESPACE_ID::int64 value);
+  int64_t expected_version() const;
+  void set_expected_version(int64_t value);
+  private:
+  int64_t _internal_expected_version() const;
+  void _internal_set_expected_version(int64_t value);
+  public:
 
   // required bool require_master = 3;
   bool has_require_master() const;
+  private:
+  bool _internal_has_require_master() const;
+  public:
   void clear_require_master();
   bool require_master() const;
   void set_require_master(bool value);
+  private:
+  bool _internal_require_master() const;
+  void _internal_set_require_master(bool value);
+  public:
 
   // optional bool hard_delete = 4;
   bool has_hard_delete() const;
+  private:
+  bool _internal_has_hard_delete() const;
+  public:
   void clear_hard_delete();
   bool hard_delete() const;
   void set_hard_delete(bool value);
+  private:
+  bool _internal_hard_delete() const;
+  void _internal_set_hard_delete(bool value);
+  public:
 
   // @@protoc_insertion_point(class_scope:es.message.DeleteStream)
  private:
@@ -1829,22 +2165,28 @@ class DeleteStream :
   // helper for ByteSizeLong()
   size_t RequiredFieldsByteSizeFallback() const;
 
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr event_stream_id_;
-  ::PROTOBUF_NAMESPACE_ID::int64 expected_version_;
-  bool require_master_;
-  bool hard_delete_;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr event_stream_id_;
+    int64_t expected_version_;
+    bool require_master_;
+    bool hard_delete_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_messages_2eproto;
 };
 // -------------------------------------------------------------------
 
-class DeleteStreamCompleted :
+class DeleteStreamCompleted final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:es.message.DeleteStreamCompleted) */ {
  public:
-  DeleteStreamCompleted();
-  virtual ~DeleteStreamCompleted();
+  inline DeleteStreamCompleted() : DeleteStreamCompleted(nullptr) {}
+  ~DeleteStreamCompleted() override;
+  explicit PROTOBUF_CONSTEXPR DeleteStreamCompleted(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   DeleteStreamCompleted(const DeleteStreamCompleted& from);
   DeleteStreamCompleted(DeleteStreamCompleted&& from) noexcept
@@ -1857,8 +2199,13 @@ class DeleteStreamCompleted :
     return *this;
   }
   inline DeleteStreamCompleted& operator=(DeleteStreamCompleted&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -1866,24 +2213,24 @@ class DeleteStreamCompleted :
   }
 
   inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
-    return _internal_metadata_.unknown_fields();
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
   }
   inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
-    return _internal_metadata_.mutable_unknown_fields();
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const DeleteStreamCompleted& default_instance() {
+    return *internal_default_instance();
   }
-  static const DeleteStreamCompleted& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const DeleteStreamCompleted* internal_default_instance() {
     return reinterpret_cast<const DeleteStreamCompleted*>(
                &_DeleteStreamCompleted_default_instance_);
@@ -1896,64 +2243,66 @@ class DeleteStreamCompleted :
   }
   inline void Swap(DeleteStreamCompleted* other) {
     if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(DeleteStreamCompleted* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline DeleteStreamCompleted* New() const final {
-    return CreateMaybeMessage<DeleteStreamCompleted>(nullptr);
-  }
-
-  DeleteStreamCompleted* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  DeleteStreamCompleted* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<DeleteStreamCompleted>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const DeleteStreamCompleted& from);
-  void MergeFrom(const DeleteStreamCompleted& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const DeleteStreamCompleted& from) {
+    DeleteStreamCompleted::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  #else
-  bool MergePartialFromCodedStream(
-      ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) final;
-  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-  void SerializeWithCachedSizes(
-      ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* InternalSerializeWithCachedSizesToArray(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
-
-  private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(DeleteStreamCompleted* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "es.message.DeleteStreamCompleted";
   }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
-  }
+  protected:
+  explicit DeleteStreamCompleted(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_messages_2eproto);
-    return ::descriptor_table_messages_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -1967,54 +2316,87 @@ class DeleteStreamCompleted :
   };
   // optional string message = 2;
   bool has_message() const;
+  private:
+  bool _internal_has_message() const;
+  public:
   void clear_message();
   const std::string& message() const;
-  void set_message(const std::string& value);
-  void set_message(std::string&& value);
-  void set_message(const char* value);
-  void set_message(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_message(ArgT0&& arg0, ArgT... args);
   std::string* mutable_message();
-  std::string* release_message();
+  PROTOBUF_NODISCARD std::string* release_message();
   void set_allocated_message(std::string* message);
+  private:
+  const std::string& _internal_message() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_message(const std::string& value);
+  std::string* _internal_mutable_message();
+  public:
 
   // optional int64 prepare_position = 3;
   bool has_prepare_position() const;
+  private:
+  bool _internal_has_prepare_position() const;
+  public:
   void clear_prepare_position();
-  ::PROTOBUF_NAMESPACE_ID::int64 prepare_position() const;
-  void set_prepare_position(::PROTOBUF_NAMESPACE_ID::int64 value);
+  int64_t prepare_position() const;
+  void set_prepare_position(int64_t value);
+  private:
+  int64_t _internal_prepare_position() const;
+  void _internal_set_prepare_position(int64_t value);
+  public:
 
   // optional int64 commit_position = 4;
   bool has_commit_position() const;
+  private:
+  bool _internal_has_commit_position() const;
+  public:
   void clear_commit_position();
-  ::PROTOBUF_NAMESPACE_ID::int64 commit_position() const;
-  void set_commit_position(::PROTOBUF_NAMESPACE_ID::int64 value);
+  int64_t commit_position() const;
+  void set_commit_position(int64_t value);
+  private:
+  int64_t _internal_commit_position() const;
+  void _internal_set_commit_position(int64_t value);
+  public:
 
   // required .es.message.OperationResult result = 1;
   bool has_result() const;
+  private:
+  bool _internal_has_result() const;
+  public:
   void clear_result();
   ::es::message::OperationResult result() const;
   void set_result(::es::message::OperationResult value);
+  private:
+  ::es::message::OperationResult _internal_result() const;
+  void _internal_set_result(::es::message::OperationResult value);
+  public:
 
   // @@protoc_insertion_point(class_scope:es.message.DeleteStreamCompleted)
  private:
   class _Internal;
 
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr message_;
-  ::PROTOBUF_NAMESPACE_ID::int64 prepare_position_;
-  ::PROTOBUF_NAMESPACE_ID::int64 commit_position_;
-  int result_;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr message_;
+    int64_t prepare_position_;
+    int64_t commit_position_;
+    int result_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_messages_2eproto;
 };
 // -------------------------------------------------------------------
 
-class TransactionStart :
+class TransactionStart final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:es.message.TransactionStart) */ {
  public:
-  TransactionStart();
-  virtual ~TransactionStart();
+  inline TransactionStart() : TransactionStart(nullptr) {}
+  ~TransactionStart() override;
+  explicit PROTOBUF_CONSTEXPR TransactionStart(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   TransactionStart(const TransactionStart& from);
   TransactionStart(TransactionStart&& from) noexcept
@@ -2027,8 +2409,13 @@ class TransactionStart :
     return *this;
   }
   inline TransactionStart& operator=(TransactionStart&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -2036,24 +2423,24 @@ class TransactionStart :
   }
 
   inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
-    return _internal_metadata_.unknown_fields();
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
   }
   inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
-    return _internal_metadata_.mutable_unknown_fields();
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TransactionStart& default_instance() {
+    return *internal_default_instance();
   }
-  static const TransactionStart& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const TransactionStart* internal_default_instance() {
     return reinterpret_cast<const TransactionStart*>(
                &_TransactionStart_default_instance_);
@@ -2066,64 +2453,66 @@ class TransactionStart :
   }
   inline void Swap(TransactionStart* other) {
     if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TransactionStart* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline TransactionStart* New() const final {
-    return CreateMaybeMessage<TransactionStart>(nullptr);
-  }
-
-  TransactionStart* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  TransactionStart* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<TransactionStart>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const TransactionStart& from);
-  void MergeFrom(const TransactionStart& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TransactionStart& from) {
+    TransactionStart::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  #else
-  bool MergePartialFromCodedStream(
-      ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) final;
-  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-  void SerializeWithCachedSizes(
-      ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* InternalSerializeWithCachedSizesToArray(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
-
-  private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(TransactionStart* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "es.message.TransactionStart";
   }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
-  }
+  protected:
+  explicit TransactionStart(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_messages_2eproto);
-    return ::descriptor_table_messages_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -2136,27 +2525,47 @@ class TransactionStart :
   };
   // required string event_stream_id = 1;
   bool has_event_stream_id() const;
+  private:
+  bool _internal_has_event_stream_id() const;
+  public:
   void clear_event_stream_id();
   const std::string& event_stream_id() const;
-  void set_event_stream_id(const std::string& value);
-  void set_event_stream_id(std::string&& value);
-  void set_event_stream_id(const char* value);
-  void set_event_stream_id(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_event_stream_id(ArgT0&& arg0, ArgT... args);
   std::string* mutable_event_stream_id();
-  std::string* release_event_stream_id();
+  PROTOBUF_NODISCARD std::string* release_event_stream_id();
   void set_allocated_event_stream_id(std::string* event_stream_id);
+  private:
+  const std::string& _internal_event_stream_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_event_stream_id(const std::string& value);
+  std::string* _internal_mutable_event_stream_id();
+  public:
 
   // required int64 expected_version = 2;
   bool has_expected_version() const;
+  private:
+  bool _internal_has_expected_version() const;
+  public:
   void clear_expected_version();
-  ::PROTOBUF_NAMESPACE_ID::int64 expected_version() const;
-  void set_expected_version(::PROTOBUF_NAMESPACE_ID::int64 value);
+  int64_t expected_version() const;
+  void set_expected_version(int64_t value);
+  private:
+  int64_t _internal_expected_version() const;
+  void _internal_set_expected_version(int64_t value);
+  public:
 
   // required bool require_master = 3;
   bool has_require_master() const;
+  private:
+  bool _internal_has_require_master() const;
+  public:
   void clear_require_master();
   bool require_master() const;
   void set_require_master(bool value);
+  private:
+  bool _internal_require_master() const;
+  void _internal_set_require_master(bool value);
+  public:
 
   // @@protoc_insertion_point(class_scope:es.message.TransactionStart)
  private:
@@ -2165,21 +2574,27 @@ class TransactionStart :
   // helper for ByteSizeLong()
   size_t RequiredFieldsByteSizeFallback() const;
 
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr event_stream_id_;
-  ::PROTOBUF_NAMESPACE_ID::int64 expected_version_;
-  bool require_master_;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr event_stream_id_;
+    int64_t expected_version_;
+    bool require_master_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_messages_2eproto;
 };
 // -------------------------------------------------------------------
 
-class TransactionStartCompleted :
+class TransactionStartCompleted final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:es.message.TransactionStartCompleted) */ {
  public:
-  TransactionStartCompleted();
-  virtual ~TransactionStartCompleted();
+  inline TransactionStartCompleted() : TransactionStartCompleted(nullptr) {}
+  ~TransactionStartCompleted() override;
+  explicit PROTOBUF_CONSTEXPR TransactionStartCompleted(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   TransactionStartCompleted(const TransactionStartCompleted& from);
   TransactionStartCompleted(TransactionStartCompleted&& from) noexcept
@@ -2192,8 +2607,13 @@ class TransactionStartCompleted :
     return *this;
   }
   inline TransactionStartCompleted& operator=(TransactionStartCompleted&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -2201,24 +2621,24 @@ class TransactionStartCompleted :
   }
 
   inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
-    return _internal_metadata_.unknown_fields();
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
   }
   inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
-    return _internal_metadata_.mutable_unknown_fields();
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TransactionStartCompleted& default_instance() {
+    return *internal_default_instance();
   }
-  static const TransactionStartCompleted& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const TransactionStartCompleted* internal_default_instance() {
     return reinterpret_cast<const TransactionStartCompleted*>(
                &_TransactionStartCompleted_default_instance_);
@@ -2231,64 +2651,66 @@ class TransactionStartCompleted :
   }
   inline void Swap(TransactionStartCompleted* other) {
     if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TransactionStartCompleted* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline TransactionStartCompleted* New() const final {
-    return CreateMaybeMessage<TransactionStartCompleted>(nullptr);
-  }
-
-  TransactionStartCompleted* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  TransactionStartCompleted* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<TransactionStartCompleted>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const TransactionStartCompleted& from);
-  void MergeFrom(const TransactionStartCompleted& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TransactionStartCompleted& from) {
+    TransactionStartCompleted::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  #else
-  bool MergePartialFromCodedStream(
-      ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) final;
-  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-  void SerializeWithCachedSizes(
-      ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* InternalSerializeWithCachedSizesToArray(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
-
-  private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(TransactionStartCompleted* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "es.message.TransactionStartCompleted";
   }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
-  }
+  protected:
+  explicit TransactionStartCompleted(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_messages_2eproto);
-    return ::descriptor_table_messages_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -2301,27 +2723,47 @@ class TransactionStartCompleted :
   };
   // optional string message = 3;
   bool has_message() const;
+  private:
+  bool _internal_has_message() const;
+  public:
   void clear_message();
   const std::string& message() const;
-  void set_message(const std::string& value);
-  void set_message(std::string&& value);
-  void set_message(const char* value);
-  void set_message(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_message(ArgT0&& arg0, ArgT... args);
   std::string* mutable_message();
-  std::string* release_message();
+  PROTOBUF_NODISCARD std::string* release_message();
   void set_allocated_message(std::string* message);
+  private:
+  const std::string& _internal_message() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_message(const std::string& value);
+  std::string* _internal_mutable_message();
+  public:
 
   // required int64 transaction_id = 1;
   bool has_transaction_id() const;
+  private:
+  bool _internal_has_transaction_id() const;
+  public:
   void clear_transaction_id();
-  ::PROTOBUF_NAMESPACE_ID::int64 transaction_id() const;
-  void set_transaction_id(::PROTOBUF_NAMESPACE_ID::int64 value);
+  int64_t transaction_id() const;
+  void set_transaction_id(int64_t value);
+  private:
+  int64_t _internal_transaction_id() const;
+  void _internal_set_transaction_id(int64_t value);
+  public:
 
   // required .es.message.OperationResult result = 2;
   bool has_result() const;
+  private:
+  bool _internal_has_result() const;
+  public:
   void clear_result();
   ::es::message::OperationResult result() const;
   void set_result(::es::message::OperationResult value);
+  private:
+  ::es::message::OperationResult _internal_result() const;
+  void _internal_set_result(::es::message::OperationResult value);
+  public:
 
   // @@protoc_insertion_point(class_scope:es.message.TransactionStartCompleted)
  private:
@@ -2330,21 +2772,27 @@ class TransactionStartCompleted :
   // helper for ByteSizeLong()
   size_t RequiredFieldsByteSizeFallback() const;
 
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr message_;
-  ::PROTOBUF_NAMESPACE_ID::int64 transaction_id_;
-  int result_;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr message_;
+    int64_t transaction_id_;
+    int result_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_messages_2eproto;
 };
 // -------------------------------------------------------------------
 
-class TransactionWrite :
+class TransactionWrite final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:es.message.TransactionWrite) */ {
  public:
-  TransactionWrite();
-  virtual ~TransactionWrite();
+  inline TransactionWrite() : TransactionWrite(nullptr) {}
+  ~TransactionWrite() override;
+  explicit PROTOBUF_CONSTEXPR TransactionWrite(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   TransactionWrite(const TransactionWrite& from);
   TransactionWrite(TransactionWrite&& from) noexcept
@@ -2357,8 +2805,13 @@ class TransactionWrite :
     return *this;
   }
   inline TransactionWrite& operator=(TransactionWrite&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -2366,24 +2819,24 @@ class TransactionWrite :
   }
 
   inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
-    return _internal_metadata_.unknown_fields();
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
   }
   inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
-    return _internal_metadata_.mutable_unknown_fields();
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TransactionWrite& default_instance() {
+    return *internal_default_instance();
   }
-  static const TransactionWrite& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const TransactionWrite* internal_default_instance() {
     return reinterpret_cast<const TransactionWrite*>(
                &_TransactionWrite_default_instance_);
@@ -2396,64 +2849,66 @@ class TransactionWrite :
   }
   inline void Swap(TransactionWrite* other) {
     if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TransactionWrite* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline TransactionWrite* New() const final {
-    return CreateMaybeMessage<TransactionWrite>(nullptr);
-  }
-
-  TransactionWrite* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  TransactionWrite* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<TransactionWrite>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const TransactionWrite& from);
-  void MergeFrom(const TransactionWrite& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TransactionWrite& from) {
+    TransactionWrite::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  #else
-  bool MergePartialFromCodedStream(
-      ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) final;
-  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-  void SerializeWithCachedSizes(
-      ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* InternalSerializeWithCachedSizesToArray(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
-
-  private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(TransactionWrite* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "es.message.TransactionWrite";
   }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
-  }
+  protected:
+  explicit TransactionWrite(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_messages_2eproto);
-    return ::descriptor_table_messages_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -2466,10 +2921,17 @@ class TransactionWrite :
   };
   // repeated .es.message.NewEvent events = 2;
   int events_size() const;
+  private:
+  int _internal_events_size() const;
+  public:
   void clear_events();
   ::es::message::NewEvent* mutable_events(int index);
   ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::es::message::NewEvent >*
       mutable_events();
+  private:
+  const ::es::message::NewEvent& _internal_events(int index) const;
+  ::es::message::NewEvent* _internal_add_events();
+  public:
   const ::es::message::NewEvent& events(int index) const;
   ::es::message::NewEvent* add_events();
   const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::es::message::NewEvent >&
@@ -2477,15 +2939,29 @@ class TransactionWrite :
 
   // required int64 transaction_id = 1;
   bool has_transaction_id() const;
+  private:
+  bool _internal_has_transaction_id() const;
+  public:
   void clear_transaction_id();
-  ::PROTOBUF_NAMESPACE_ID::int64 transaction_id() const;
-  void set_transaction_id(::PROTOBUF_NAMESPACE_ID::int64 value);
+  int64_t transaction_id() const;
+  void set_transaction_id(int64_t value);
+  private:
+  int64_t _internal_transaction_id() const;
+  void _internal_set_transaction_id(int64_t value);
+  public:
 
   // required bool require_master = 3;
   bool has_require_master() const;
+  private:
+  bool _internal_has_require_master() const;
+  public:
   void clear_require_master();
   bool require_master() const;
   void set_require_master(bool value);
+  private:
+  bool _internal_require_master() const;
+  void _internal_set_require_master(bool value);
+  public:
 
   // @@protoc_insertion_point(class_scope:es.message.TransactionWrite)
  private:
@@ -2494,21 +2970,27 @@ class TransactionWrite :
   // helper for ByteSizeLong()
   size_t RequiredFieldsByteSizeFallback() const;
 
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::es::message::NewEvent > events_;
-  ::PROTOBUF_NAMESPACE_ID::int64 transaction_id_;
-  bool require_master_;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::es::message::NewEvent > events_;
+    int64_t transaction_id_;
+    bool require_master_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_messages_2eproto;
 };
 // -------------------------------------------------------------------
 
-class TransactionWriteCompleted :
+class TransactionWriteCompleted final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:es.message.TransactionWriteCompleted) */ {
  public:
-  TransactionWriteCompleted();
-  virtual ~TransactionWriteCompleted();
+  inline TransactionWriteCompleted() : TransactionWriteCompleted(nullptr) {}
+  ~TransactionWriteCompleted() override;
+  explicit PROTOBUF_CONSTEXPR TransactionWriteCompleted(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   TransactionWriteCompleted(const TransactionWriteCompleted& from);
   TransactionWriteCompleted(TransactionWriteCompleted&& from) noexcept
@@ -2521,8 +3003,13 @@ class TransactionWriteCompleted :
     return *this;
   }
   inline TransactionWriteCompleted& operator=(TransactionWriteCompleted&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -2530,24 +3017,24 @@ class TransactionWriteCompleted :
   }
 
   inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
-    return _internal_metadata_.unknown_fields();
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
   }
   inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
-    return _internal_metadata_.mutable_unknown_fields();
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TransactionWriteCompleted& default_instance() {
+    return *internal_default_instance();
   }
-  static const TransactionWriteCompleted& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const TransactionWriteCompleted* internal_default_instance() {
     return reinterpret_cast<const TransactionWriteCompleted*>(
                &_TransactionWriteCompleted_default_instance_);
@@ -2560,64 +3047,66 @@ class TransactionWriteCompleted :
   }
   inline void Swap(TransactionWriteCompleted* other) {
     if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TransactionWriteCompleted* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline TransactionWriteCompleted* New() const final {
-    return CreateMaybeMessage<TransactionWriteCompleted>(nullptr);
-  }
-
-  TransactionWriteCompleted* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  TransactionWriteCompleted* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<TransactionWriteCompleted>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const TransactionWriteCompleted& from);
-  void MergeFrom(const TransactionWriteCompleted& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TransactionWriteCompleted& from) {
+    TransactionWriteCompleted::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  #else
-  bool MergePartialFromCodedStream(
-      ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) final;
-  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-  void SerializeWithCachedSizes(
-      ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* InternalSerializeWithCachedSizesToArray(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
-
-  private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(TransactionWriteCompleted* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "es.message.TransactionWriteCompleted";
   }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
-  }
+  protected:
+  explicit TransactionWriteCompleted(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_messages_2eproto);
-    return ::descriptor_table_messages_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -2630,27 +3119,47 @@ class TransactionWriteCompleted :
   };
   // optional string message = 3;
   bool has_message() const;
+  private:
+  bool _internal_has_message() const;
+  public:
   void clear_message();
   const std::string& message() const;
-  void set_message(const std::string& value);
-  void set_message(std::string&& value);
-  void set_message(const char* value);
-  void set_message(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_message(ArgT0&& arg0, ArgT... args);
   std::string* mutable_message();
-  std::string* release_message();
+  PROTOBUF_NODISCARD std::string* release_message();
   void set_allocated_message(std::string* message);
+  private:
+  const std::string& _internal_message() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_message(const std::string& value);
+  std::string* _internal_mutable_message();
+  public:
 
   // required int64 transaction_id = 1;
   bool has_transaction_id() const;
+  private:
+  bool _internal_has_transaction_id() const;
+  public:
   void clear_transaction_id();
-  ::PROTOBUF_NAMESPACE_ID::int64 transaction_id() const;
-  void set_transaction_id(::PROTOBUF_NAMESPACE_ID::int64 value);
+  int64_t transaction_id() const;
+  void set_transaction_id(int64_t value);
+  private:
+  int64_t _internal_transaction_id() const;
+  void _internal_set_transaction_id(int64_t value);
+  public:
 
   // required .es.message.OperationResult result = 2;
   bool has_result() const;
+  private:
+  bool _internal_has_result() const;
+  public:
   void clear_result();
   ::es::message::OperationResult result() const;
   void set_result(::es::message::OperationResult value);
+  private:
+  ::es::message::OperationResult _internal_result() const;
+  void _internal_set_result(::es::message::OperationResult value);
+  public:
 
   // @@protoc_insertion_point(class_scope:es.message.TransactionWriteCompleted)
  private:
@@ -2659,21 +3168,27 @@ class TransactionWriteCompleted :
   // helper for ByteSizeLong()
   size_t RequiredFieldsByteSizeFallback() const;
 
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr message_;
-  ::PROTOBUF_NAMESPACE_ID::int64 transaction_id_;
-  int result_;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr message_;
+    int64_t transaction_id_;
+    int result_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_messages_2eproto;
 };
 // -------------------------------------------------------------------
 
-class TransactionCommit :
+class TransactionCommit final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:es.message.TransactionCommit) */ {
  public:
-  TransactionCommit();
-  virtual ~TransactionCommit();
+  inline TransactionCommit() : TransactionCommit(nullptr) {}
+  ~TransactionCommit() override;
+  explicit PROTOBUF_CONSTEXPR TransactionCommit(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   TransactionCommit(const TransactionCommit& from);
   TransactionCommit(TransactionCommit&& from) noexcept
@@ -2686,8 +3201,13 @@ class TransactionCommit :
     return *this;
   }
   inline TransactionCommit& operator=(TransactionCommit&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -2695,24 +3215,24 @@ class TransactionCommit :
   }
 
   inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
-    return _internal_metadata_.unknown_fields();
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
   }
   inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
-    return _internal_metadata_.mutable_unknown_fields();
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TransactionCommit& default_instance() {
+    return *internal_default_instance();
   }
-  static const TransactionCommit& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const TransactionCommit* internal_default_instance() {
     return reinterpret_cast<const TransactionCommit*>(
                &_TransactionCommit_default_instance_);
@@ -2725,64 +3245,66 @@ class TransactionCommit :
   }
   inline void Swap(TransactionCommit* other) {
     if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TransactionCommit* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline TransactionCommit* New() const final {
-    return CreateMaybeMessage<TransactionCommit>(nullptr);
-  }
-
-  TransactionCommit* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  TransactionCommit* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<TransactionCommit>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const TransactionCommit& from);
-  void MergeFrom(const TransactionCommit& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TransactionCommit& from) {
+    TransactionCommit::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  #else
-  bool MergePartialFromCodedStream(
-      ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) final;
-  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-  void SerializeWithCachedSizes(
-      ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* InternalSerializeWithCachedSizesToArray(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
-
-  private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(TransactionCommit* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "es.message.TransactionCommit";
   }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
-  }
+  protected:
+  explicit TransactionCommit(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_messages_2eproto);
-    return ::descriptor_table_messages_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -2794,15 +3316,29 @@ class TransactionCommit :
   };
   // required int64 transaction_id = 1;
   bool has_transaction_id() const;
+  private:
+  bool _internal_has_transaction_id() const;
+  public:
   void clear_transaction_id();
-  ::PROTOBUF_NAMESPACE_ID::int64 transaction_id() const;
-  void set_transaction_id(::PROTOBUF_NAMESPACE_ID::int64 value);
+  int64_t transaction_id() const;
+  void set_transaction_id(int64_t value);
+  private:
+  int64_t _internal_transaction_id() const;
+  void _internal_set_transaction_id(int64_t value);
+  public:
 
   // required bool require_master = 2;
   bool has_require_master() const;
+  private:
+  bool _internal_has_require_master() const;
+  public:
   void clear_require_master();
   bool require_master() const;
   void set_require_master(bool value);
+  private:
+  bool _internal_require_master() const;
+  void _internal_set_require_master(bool value);
+  public:
 
   // @@protoc_insertion_point(class_scope:es.message.TransactionCommit)
  private:
@@ -2811,20 +3347,26 @@ class TransactionCommit :
   // helper for ByteSizeLong()
   size_t RequiredFieldsByteSizeFallback() const;
 
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  ::PROTOBUF_NAMESPACE_ID::int64 transaction_id_;
-  bool require_master_;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    int64_t transaction_id_;
+    bool require_master_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_messages_2eproto;
 };
 // -------------------------------------------------------------------
 
-class TransactionCommitCompleted :
+class TransactionCommitCompleted final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:es.message.TransactionCommitCompleted) */ {
  public:
-  TransactionCommitCompleted();
-  virtual ~TransactionCommitCompleted();
+  inline TransactionCommitCompleted() : TransactionCommitCompleted(nullptr) {}
+  ~TransactionCommitCompleted() override;
+  explicit PROTOBUF_CONSTEXPR TransactionCommitCompleted(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   TransactionCommitCompleted(const TransactionCommitCompleted& from);
   TransactionCommitCompleted(TransactionCommitCompleted&& from) noexcept
@@ -2837,8 +3379,13 @@ class TransactionCommitCompleted :
     return *this;
   }
   inline TransactionCommitCompleted& operator=(TransactionCommitCompleted&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -2846,24 +3393,24 @@ class TransactionCommitCompleted :
   }
 
   inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
-    return _internal_metadata_.unknown_fields();
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
   }
   inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
-    return _internal_metadata_.mutable_unknown_fields();
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TransactionCommitCompleted& default_instance() {
+    return *internal_default_instance();
   }
-  static const TransactionCommitCompleted& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const TransactionCommitCompleted* internal_default_instance() {
     return reinterpret_cast<const TransactionCommitCompleted*>(
                &_TransactionCommitCompleted_default_instance_);
@@ -2876,64 +3423,66 @@ class TransactionCommitCompleted :
   }
   inline void Swap(TransactionCommitCompleted* other) {
     if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TransactionCommitCompleted* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline TransactionCommitCompleted* New() const final {
-    return CreateMaybeMessage<TransactionCommitCompleted>(nullptr);
-  }
-
-  TransactionCommitCompleted* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  TransactionCommitCompleted* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<TransactionCommitCompleted>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const TransactionCommitCompleted& from);
-  void MergeFrom(const TransactionCommitCompleted& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TransactionCommitCompleted& from) {
+    TransactionCommitCompleted::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  #else
-  bool MergePartialFromCodedStream(
-      ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) final;
-  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-  void SerializeWithCachedSizes(
-      ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* InternalSerializeWithCachedSizesToArray(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
-
-  private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(TransactionCommitCompleted* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "es.message.TransactionCommitCompleted";
   }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
-  }
+  protected:
+  explicit TransactionCommitCompleted(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_messages_2eproto);
-    return ::descriptor_table_messages_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -2950,51 +3499,99 @@ class TransactionCommitCompleted :
   };
   // optional string message = 3;
   bool has_message() const;
+  private:
+  bool _internal_has_message() const;
+  public:
   void clear_message();
   const std::string& message() const;
-  void set_message(const std::string& value);
-  void set_message(std::string&& value);
-  void set_message(const char* value);
-  void set_message(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_message(ArgT0&& arg0, ArgT... args);
   std::string* mutable_message();
-  std::string* release_message();
+  PROTOBUF_NODISCARD std::string* release_message();
   void set_allocated_message(std::string* message);
+  private:
+  const std::string& _internal_message() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_message(const std::string& value);
+  std::string* _internal_mutable_message();
+  public:
 
   // required int64 transaction_id = 1;
   bool has_transaction_id() const;
+  private:
+  bool _internal_has_transaction_id() const;
+  public:
   void clear_transaction_id();
-  ::PROTOBUF_NAMESPACE_ID::int64 transaction_id() const;
-  void set_transaction_id(::PROTOBUF_NAMESPACE_ID::int64 value);
+  int64_t transaction_id() const;
+  void set_transaction_id(int64_t value);
+  private:
+  int64_t _internal_transaction_id() const;
+  void _internal_set_transaction_id(int64_t value);
+  public:
 
   // required int64 first_event_number = 4;
   bool has_first_event_number() const;
+  private:
+  bool _internal_has_first_event_number() const;
+  public:
   void clear_first_event_number();
-  ::PROTOBUF_NAMESPACE_ID::int64 first_event_number() const;
-  void set_first_event_number(::PROTOBUF_NAMESPACE_ID::int64 value);
+  int64_t first_event_number() const;
+  void set_first_event_number(int64_t value);
+  private:
+  int64_t _internal_first_event_number() const;
+  void _internal_set_first_event_number(int64_t value);
+  public:
 
   // required int64 last_event_number = 5;
   bool has_last_event_number() const;
+  private:
+  bool _internal_has_last_event_number() const;
+  public:
   void clear_last_event_number();
-  ::PROTOBUF_NAMESPACE_ID::int64 last_event_number() const;
-  void set_last_event_number(::PROTOBUF_NAMESPACE_ID::int64 value);
+  int64_t last_event_number() const;
+  void set_last_event_number(int64_t value);
+  private:
+  int64_t _internal_last_event_number() const;
+  void _internal_set_last_event_number(int64_t value);
+  public:
 
   // optional int64 prepare_position = 6;
   bool has_prepare_position() const;
+  private:
+  bool _internal_has_prepare_position() const;
+  public:
   void clear_prepare_position();
-  ::PROTOBUF_NAMESPACE_ID::int64 prepare_position() const;
-  void set_prepare_position(::PROTOBUF_NAMESPACE_ID::int64 value);
+  int64_t prepare_position() const;
+  void set_prepare_position(int64_t value);
+  private:
+  int64_t _internal_prepare_position() const;
+  void _internal_set_prepare_position(int64_t value);
+  public:
 
   // optional int64 commit_position = 7;
   bool has_commit_position() const;
+  private:
+  bool _internal_has_commit_position() const;
+  public:
   void clear_commit_position();
-  ::PROTOBUF_NAMESPACE_ID::int64 commit_position() const;
-  void set_commit_position(::PROTOBUF_NAMESPACE_ID::int64 value);
+  int64_t commit_position() const;
+  void set_commit_position(int64_t value);
+  private:
+  int64_t _internal_commit_position() const;
+  void _internal_set_commit_position(int64_t value);
+  public:
 
   // required .es.message.OperationResult result = 2;
   bool has_result() const;
+  private:
+  bool _internal_has_result() const;
+  public:
   void clear_result();
   ::es::message::OperationResult result() const;
   void set_result(::es::message::OperationResult value);
+  private:
+  ::es::message::OperationResult _internal_result() const;
+  void _internal_set_result(::es::message::OperationResult value);
+  public:
 
   // @@protoc_insertion_point(class_scope:es.message.TransactionCommitCompleted)
  private:
@@ -3003,25 +3600,31 @@ class TransactionCommitCompleted :
   // helper for ByteSizeLong()
   size_t RequiredFieldsByteSizeFallback() const;
 
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr message_;
-  ::PROTOBUF_NAMESPACE_ID::int64 transaction_id_;
-  ::PROTOBUF_NAMESPACE_ID::int64 first_event_number_;
-  ::PROTOBUF_NAMESPACE_ID::int64 last_event_number_;
-  ::PROTOBUF_NAMESPACE_ID::int64 prepare_position_;
-  ::PROTOBUF_NAMESPACE_ID::int64 commit_position_;
-  int result_;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr message_;
+    int64_t transaction_id_;
+    int64_t first_event_number_;
+    int64_t last_event_number_;
+    int64_t prepare_position_;
+    int64_t commit_position_;
+    int result_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_messages_2eproto;
 };
 // -------------------------------------------------------------------
 
-class ReadEvent :
+class ReadEvent final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:es.message.ReadEvent) */ {
  public:
-  ReadEvent();
-  virtual ~ReadEvent();
+  inline ReadEvent() : ReadEvent(nullptr) {}
+  ~ReadEvent() override;
+  explicit PROTOBUF_CONSTEXPR ReadEvent(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   ReadEvent(const ReadEvent& from);
   ReadEvent(ReadEvent&& from) noexcept
@@ -3034,8 +3637,13 @@ class ReadEvent :
     return *this;
   }
   inline ReadEvent& operator=(ReadEvent&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -3043,24 +3651,24 @@ class ReadEvent :
   }
 
   inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
-    return _internal_metadata_.unknown_fields();
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
   }
   inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
-    return _internal_metadata_.mutable_unknown_fields();
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ReadEvent& default_instance() {
+    return *internal_default_instance();
   }
-  static const ReadEvent& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const ReadEvent* internal_default_instance() {
     return reinterpret_cast<const ReadEvent*>(
                &_ReadEvent_default_instance_);
@@ -3073,64 +3681,66 @@ class ReadEvent :
   }
   inline void Swap(ReadEvent* other) {
     if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ReadEvent* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline ReadEvent* New() const final {
-    return CreateMaybeMessage<ReadEvent>(nullptr);
-  }
-
-  ReadEvent* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  ReadEvent* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<ReadEvent>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const ReadEvent& from);
-  void MergeFrom(const ReadEvent& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ReadEvent& from) {
+    ReadEvent::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  #else
-  bool MergePartialFromCodedStream(
-      ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) final;
-  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-  void SerializeWithCachedSizes(
-      ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* InternalSerializeWithCachedSizesToArray(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
-
-  private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(ReadEvent* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "es.message.ReadEvent";
   }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
-  }
+  protected:
+  explicit ReadEvent(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_messages_2eproto);
-    return ::descriptor_table_messages_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -3144,33 +3754,60 @@ class ReadEvent :
   };
   // required string event_stream_id = 1;
   bool has_event_stream_id() const;
+  private:
+  bool _internal_has_event_stream_id() const;
+  public:
   void clear_event_stream_id();
   const std::string& event_stream_id() const;
-  void set_event_stream_id(const std::string& value);
-  void set_event_stream_id(std::string&& value);
-  void set_event_stream_id(const char* value);
-  void set_event_stream_id(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_event_stream_id(ArgT0&& arg0, ArgT... args);
   std::string* mutable_event_stream_id();
-  std::string* release_event_stream_id();
+  PROTOBUF_NODISCARD std::string* release_event_stream_id();
   void set_allocated_event_stream_id(std::string* event_stream_id);
+  private:
+  const std::string& _internal_event_stream_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_event_stream_id(const std::string& value);
+  std::string* _internal_mutable_event_stream_id();
+  public:
 
   // required int64 event_number = 2;
   bool has_event_number() const;
+  private:
+  bool _internal_has_event_number() const;
+  public:
   void clear_event_number();
-  ::PROTOBUF_NAMESPACE_ID::int64 event_number() const;
-  void set_event_number(::PROTOBUF_NAMESPACE_ID::int64 value);
+  int64_t event_number() const;
+  void set_event_number(int64_t value);
+  private:
+  int64_t _internal_event_number() const;
+  void _internal_set_event_number(int64_t value);
+  public:
 
   // required bool resolve_link_tos = 3;
   bool has_resolve_link_tos() const;
+  private:
+  bool _internal_has_resolve_link_tos() const;
+  public:
   void clear_resolve_link_tos();
   bool resolve_link_tos() const;
   void set_resolve_link_tos(bool value);
+  private:
+  bool _internal_resolve_link_tos() const;
+  void _internal_set_resolve_link_tos(bool value);
+  public:
 
   // required bool require_master = 4;
   bool has_require_master() const;
+  private:
+  bool _internal_has_require_master() const;
+  public:
   void clear_require_master();
   bool require_master() const;
   void set_require_master(bool value);
+  private:
+  bool _internal_require_master() const;
+  void _internal_set_require_master(bool value);
+  public:
 
   // @@protoc_insertion_point(class_scope:es.message.ReadEvent)
  private:
@@ -3179,22 +3816,28 @@ class ReadEvent :
   // helper for ByteSizeLong()
   size_t RequiredFieldsByteSizeFallback() const;
 
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr event_stream_id_;
-  ::PROTOBUF_NAMESPACE_ID::int64 event_number_;
-  bool resolve_link_tos_;
-  bool require_master_;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr event_stream_id_;
+    int64_t event_number_;
+    bool resolve_link_tos_;
+    bool require_master_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_messages_2eproto;
 };
 // -------------------------------------------------------------------
 
-class ReadEventCompleted :
+class ReadEventCompleted final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:es.message.ReadEventCompleted) */ {
  public:
-  ReadEventCompleted();
-  virtual ~ReadEventCompleted();
+  inline ReadEventCompleted() : ReadEventCompleted(nullptr) {}
+  ~ReadEventCompleted() override;
+  explicit PROTOBUF_CONSTEXPR ReadEventCompleted(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   ReadEventCompleted(const ReadEventCompleted& from);
   ReadEventCompleted(ReadEventCompleted&& from) noexcept
@@ -3207,8 +3850,13 @@ class ReadEventCompleted :
     return *this;
   }
   inline ReadEventCompleted& operator=(ReadEventCompleted&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -3216,24 +3864,24 @@ class ReadEventCompleted :
   }
 
   inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
-    return _internal_metadata_.unknown_fields();
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
   }
   inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
-    return _internal_metadata_.mutable_unknown_fields();
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ReadEventCompleted& default_instance() {
+    return *internal_default_instance();
   }
-  static const ReadEventCompleted& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const ReadEventCompleted* internal_default_instance() {
     return reinterpret_cast<const ReadEventCompleted*>(
                &_ReadEventCompleted_default_instance_);
@@ -3246,64 +3894,66 @@ class ReadEventCompleted :
   }
   inline void Swap(ReadEventCompleted* other) {
     if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ReadEventCompleted* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline ReadEventCompleted* New() const final {
-    return CreateMaybeMessage<ReadEventCompleted>(nullptr);
-  }
-
-  ReadEventCompleted* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  ReadEventCompleted* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<ReadEventCompleted>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const ReadEventCompleted& from);
-  void MergeFrom(const ReadEventCompleted& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ReadEventCompleted& from) {
+    ReadEventCompleted::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  #else
-  bool MergePartialFromCodedStream(
-      ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) final;
-  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-  void SerializeWithCachedSizes(
-      ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* InternalSerializeWithCachedSizesToArray(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
-
-  private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(ReadEventCompleted* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "es.message.ReadEventCompleted";
   }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
-  }
+  protected:
+  explicit ReadEventCompleted(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_messages_2eproto);
-    return ::descriptor_table_messages_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -3340,7 +3990,7 @@ class ReadEventCompleted :
       "Incorrect type passed to function ReadEventResult_Name.");
     return ReadEventCompleted_ReadEventResult_Name(enum_t_value);
   }
-  static inline bool ReadEventResult_Parse(const std::string& name,
+  static inline bool ReadEventResult_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
       ReadEventResult* value) {
     return ReadEventCompleted_ReadEventResult_Parse(name, value);
   }
@@ -3354,29 +4004,52 @@ class ReadEventCompleted :
   };
   // optional string error = 3;
   bool has_error() const;
+  private:
+  bool _internal_has_error() const;
+  public:
   void clear_error();
   const std::string& error() const;
-  void set_error(const std::string& value);
-  void set_error(std::string&& value);
-  void set_error(const char* value);
-  void set_error(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_error(ArgT0&& arg0, ArgT... args);
   std::string* mutable_error();
-  std::string* release_error();
+  PROTOBUF_NODISCARD std::string* release_error();
   void set_allocated_error(std::string* error);
+  private:
+  const std::string& _internal_error() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_error(const std::string& value);
+  std::string* _internal_mutable_error();
+  public:
 
   // required .es.message.ResolvedIndexedEvent event = 2;
   bool has_event() const;
+  private:
+  bool _internal_has_event() const;
+  public:
   void clear_event();
   const ::es::message::ResolvedIndexedEvent& event() const;
-  ::es::message::ResolvedIndexedEvent* release_event();
+  PROTOBUF_NODISCARD ::es::message::ResolvedIndexedEvent* release_event();
   ::es::message::ResolvedIndexedEvent* mutable_event();
   void set_allocated_event(::es::message::ResolvedIndexedEvent* event);
+  private:
+  const ::es::message::ResolvedIndexedEvent& _internal_event() const;
+  ::es::message::ResolvedIndexedEvent* _internal_mutable_event();
+  public:
+  void unsafe_arena_set_allocated_event(
+      ::es::message::ResolvedIndexedEvent* event);
+  ::es::message::ResolvedIndexedEvent* unsafe_arena_release_event();
 
   // required .es.message.ReadEventCompleted.ReadEventResult result = 1;
   bool has_result() const;
+  private:
+  bool _internal_has_result() const;
+  public:
   void clear_result();
   ::es::message::ReadEventCompleted_ReadEventResult result() const;
   void set_result(::es::message::ReadEventCompleted_ReadEventResult value);
+  private:
+  ::es::message::ReadEventCompleted_ReadEventResult _internal_result() const;
+  void _internal_set_result(::es::message::ReadEventCompleted_ReadEventResult value);
+  public:
 
   // @@protoc_insertion_point(class_scope:es.message.ReadEventCompleted)
  private:
@@ -3385,21 +4058,27 @@ class ReadEventCompleted :
   // helper for ByteSizeLong()
   size_t RequiredFieldsByteSizeFallback() const;
 
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr error_;
-  ::es::message::ResolvedIndexedEvent* event_;
-  int result_;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr error_;
+    ::es::message::ResolvedIndexedEvent* event_;
+    int result_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_messages_2eproto;
 };
 // -------------------------------------------------------------------
 
-class ReadStreamEvents :
+class ReadStreamEvents final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:es.message.ReadStreamEvents) */ {
  public:
-  ReadStreamEvents();
-  virtual ~ReadStreamEvents();
+  inline ReadStreamEvents() : ReadStreamEvents(nullptr) {}
+  ~ReadStreamEvents() override;
+  explicit PROTOBUF_CONSTEXPR ReadStreamEvents(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   ReadStreamEvents(const ReadStreamEvents& from);
   ReadStreamEvents(ReadStreamEvents&& from) noexcept
@@ -3412,8 +4091,13 @@ class ReadStreamEvents :
     return *this;
   }
   inline ReadStreamEvents& operator=(ReadStreamEvents&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -3421,24 +4105,24 @@ class ReadStreamEvents :
   }
 
   inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
-    return _internal_metadata_.unknown_fields();
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
   }
   inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
-    return _internal_metadata_.mutable_unknown_fields();
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ReadStreamEvents& default_instance() {
+    return *internal_default_instance();
   }
-  static const ReadStreamEvents& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const ReadStreamEvents* internal_default_instance() {
     return reinterpret_cast<const ReadStreamEvents*>(
                &_ReadStreamEvents_default_instance_);
@@ -3451,64 +4135,66 @@ class ReadStreamEvents :
   }
   inline void Swap(ReadStreamEvents* other) {
     if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ReadStreamEvents* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline ReadStreamEvents* New() const final {
-    return CreateMaybeMessage<ReadStreamEvents>(nullptr);
-  }
-
-  ReadStreamEvents* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  ReadStreamEvents* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<ReadStreamEvents>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const ReadStreamEvents& from);
-  void MergeFrom(const ReadStreamEvents& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ReadStreamEvents& from) {
+    ReadStreamEvents::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  #else
-  bool MergePartialFromCodedStream(
-      ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) final;
-  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-  void SerializeWithCachedSizes(
-      ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* InternalSerializeWithCachedSizesToArray(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
-
-  private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(ReadStreamEvents* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "es.message.ReadStreamEvents";
   }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
-  }
+  protected:
+  explicit ReadStreamEvents(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_messages_2eproto);
-    return ::descriptor_table_messages_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -3523,39 +4209,73 @@ class ReadStreamEvents :
   };
   // required string event_stream_id = 1;
   bool has_event_stream_id() const;
+  private:
+  bool _internal_has_event_stream_id() const;
+  public:
   void clear_event_stream_id();
   const std::string& event_stream_id() const;
-  void set_event_stream_id(const std::string& value);
-  void set_event_stream_id(std::string&& value);
-  void set_event_stream_id(const char* value);
-  void set_event_stream_id(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_event_stream_id(ArgT0&& arg0, ArgT... args);
   std::string* mutable_event_stream_id();
-  std::string* release_event_stream_id();
+  PROTOBUF_NODISCARD std::string* release_event_stream_id();
   void set_allocated_event_stream_id(std::string* event_stream_id);
+  private:
+  const std::string& _internal_event_stream_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_event_stream_id(const std::string& value);
+  std::string* _internal_mutable_event_stream_id();
+  public:
 
   // required int64 from_event_number = 2;
   bool has_from_event_number() const;
+  private:
+  bool _internal_has_from_event_number() const;
+  public:
   void clear_from_event_number();
-  ::PROTOBUF_NAMESPACE_ID::int64 from_event_number() const;
-  void set_from_event_number(::PROTOBUF_NAMESPACE_ID::int64 value);
+  int64_t from_event_number() const;
+  void set_from_event_number(int64_t value);
+  private:
+  int64_t _internal_from_event_number() const;
+  void _internal_set_from_event_number(int64_t value);
+  public:
 
   // required int32 max_count = 3;
   bool has_max_count() const;
+  private:
+  bool _internal_has_max_count() const;
+  public:
   void clear_max_count();
-  ::PROTOBUF_NAMESPACE_ID::int32 max_count() const;
-  void set_max_count(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t max_count() const;
+  void set_max_count(int32_t value);
+  private:
+  int32_t _internal_max_count() const;
+  void _internal_set_max_count(int32_t value);
+  public:
 
   // required bool resolve_link_tos = 4;
   bool has_resolve_link_tos() const;
+  private:
+  bool _internal_has_resolve_link_tos() const;
+  public:
   void clear_resolve_link_tos();
   bool resolve_link_tos() const;
   void set_resolve_link_tos(bool value);
+  private:
+  bool _internal_resolve_link_tos() const;
+  void _internal_set_resolve_link_tos(bool value);
+  public:
 
   // required bool require_master = 5;
   bool has_require_master() const;
+  private:
+  bool _internal_has_require_master() const;
+  public:
   void clear_require_master();
   bool require_master() const;
   void set_require_master(bool value);
+  private:
+  bool _internal_require_master() const;
+  void _internal_set_require_master(bool value);
+  public:
 
   // @@protoc_insertion_point(class_scope:es.message.ReadStreamEvents)
  private:
@@ -3564,23 +4284,29 @@ class ReadStreamEvents :
   // helper for ByteSizeLong()
   size_t RequiredFieldsByteSizeFallback() const;
 
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr event_stream_id_;
-  ::PROTOBUF_NAMESPACE_ID::int64 from_event_number_;
-  ::PROTOBUF_NAMESPACE_ID::int32 max_count_;
-  bool resolve_link_tos_;
-  bool require_master_;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr event_stream_id_;
+    int64_t from_event_number_;
+    int32_t max_count_;
+    bool resolve_link_tos_;
+    bool require_master_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_messages_2eproto;
 };
 // -------------------------------------------------------------------
 
-class ReadStreamEventsCompleted :
+class ReadStreamEventsCompleted final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:es.message.ReadStreamEventsCompleted) */ {
  public:
-  ReadStreamEventsCompleted();
-  virtual ~ReadStreamEventsCompleted();
+  inline ReadStreamEventsCompleted() : ReadStreamEventsCompleted(nullptr) {}
+  ~ReadStreamEventsCompleted() override;
+  explicit PROTOBUF_CONSTEXPR ReadStreamEventsCompleted(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   ReadStreamEventsCompleted(const ReadStreamEventsCompleted& from);
   ReadStreamEventsCompleted(ReadStreamEventsCompleted&& from) noexcept
@@ -3593,8 +4319,13 @@ class ReadStreamEventsCompleted :
     return *this;
   }
   inline ReadStreamEventsCompleted& operator=(ReadStreamEventsCompleted&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -3602,24 +4333,24 @@ class ReadStreamEventsCompleted :
   }
 
   inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
-    return _internal_metadata_.unknown_fields();
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
   }
   inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
-    return _internal_metadata_.mutable_unknown_fields();
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ReadStreamEventsCompleted& default_instance() {
+    return *internal_default_instance();
   }
-  static const ReadStreamEventsCompleted& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const ReadStreamEventsCompleted* internal_default_instance() {
     return reinterpret_cast<const ReadStreamEventsCompleted*>(
                &_ReadStreamEventsCompleted_default_instance_);
@@ -3632,64 +4363,66 @@ class ReadStreamEventsCompleted :
   }
   inline void Swap(ReadStreamEventsCompleted* other) {
     if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ReadStreamEventsCompleted* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline ReadStreamEventsCompleted* New() const final {
-    return CreateMaybeMessage<ReadStreamEventsCompleted>(nullptr);
-  }
-
-  ReadStreamEventsCompleted* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  ReadStreamEventsCompleted* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<ReadStreamEventsCompleted>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const ReadStreamEventsCompleted& from);
-  void MergeFrom(const ReadStreamEventsCompleted& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ReadStreamEventsCompleted& from) {
+    ReadStreamEventsCompleted::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  #else
-  bool MergePartialFromCodedStream(
-      ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) final;
-  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-  void SerializeWithCachedSizes(
-      ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* InternalSerializeWithCachedSizesToArray(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
-
-  private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(ReadStreamEventsCompleted* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "es.message.ReadStreamEventsCompleted";
   }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
-  }
+  protected:
+  explicit ReadStreamEventsCompleted(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_messages_2eproto);
-    return ::descriptor_table_messages_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -3726,7 +4459,7 @@ class ReadStreamEventsCompleted :
       "Incorrect type passed to function ReadStreamResult_Name.");
     return ReadStreamEventsCompleted_ReadStreamResult_Name(enum_t_value);
   }
-  static inline bool ReadStreamResult_Parse(const std::string& name,
+  static inline bool ReadStreamResult_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
       ReadStreamResult* value) {
     return ReadStreamEventsCompleted_ReadStreamResult_Parse(name, value);
   }
@@ -3744,10 +4477,17 @@ class ReadStreamEventsCompleted :
   };
   // repeated .es.message.ResolvedIndexedEvent events = 1;
   int events_size() const;
+  private:
+  int _internal_events_size() const;
+  public:
   void clear_events();
   ::es::message::ResolvedIndexedEvent* mutable_events(int index);
   ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::es::message::ResolvedIndexedEvent >*
       mutable_events();
+  private:
+  const ::es::message::ResolvedIndexedEvent& _internal_events(int index) const;
+  ::es::message::ResolvedIndexedEvent* _internal_add_events();
+  public:
   const ::es::message::ResolvedIndexedEvent& events(int index) const;
   ::es::message::ResolvedIndexedEvent* add_events();
   const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::es::message::ResolvedIndexedEvent >&
@@ -3755,45 +4495,86 @@ class ReadStreamEventsCompleted :
 
   // optional string error = 7;
   bool has_error() const;
+  private:
+  bool _internal_has_error() const;
+  public:
   void clear_error();
   const std::string& error() const;
-  void set_error(const std::string& value);
-  void set_error(std::string&& value);
-  void set_error(const char* value);
-  void set_error(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_error(ArgT0&& arg0, ArgT... args);
   std::string* mutable_error();
-  std::string* release_error();
+  PROTOBUF_NODISCARD std::string* release_error();
   void set_allocated_error(std::string* error);
+  private:
+  const std::string& _internal_error() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_error(const std::string& value);
+  std::string* _internal_mutable_error();
+  public:
 
   // required int64 next_event_number = 3;
   bool has_next_event_number() const;
+  private:
+  bool _internal_has_next_event_number() const;
+  public:
   void clear_next_event_number();
-  ::PROTOBUF_NAMESPACE_ID::int64 next_event_number() const;
-  void set_next_event_number(::PROTOBUF_NAMESPACE_ID::int64 value);
+  int64_t next_event_number() const;
+  void set_next_event_number(int64_t value);
+  private:
+  int64_t _internal_next_event_number() const;
+  void _internal_set_next_event_number(int64_t value);
+  public:
 
   // required .es.message.ReadStreamEventsCompleted.ReadStreamResult result = 2;
   bool has_result() const;
+  private:
+  bool _internal_has_result() const;
+  public:
   void clear_result();
   ::es::message::ReadStreamEventsCompleted_ReadStreamResult result() const;
   void set_result(::es::message::ReadStreamEventsCompleted_ReadStreamResult value);
+  private:
+  ::es::message::ReadStreamEventsCompleted_ReadStreamResult _internal_result() const;
+  void _internal_set_result(::es::message::ReadStreamEventsCompleted_ReadStreamResult value);
+  public:
 
   // required bool is_end_of_stream = 5;
   bool has_is_end_of_stream() const;
+  private:
+  bool _internal_has_is_end_of_stream() const;
+  public:
   void clear_is_end_of_stream();
   bool is_end_of_stream() const;
   void set_is_end_of_stream(bool value);
+  private:
+  bool _internal_is_end_of_stream() const;
+  void _internal_set_is_end_of_stream(bool value);
+  public:
 
   // required int64 last_event_number = 4;
   bool has_last_event_number() const;
+  private:
+  bool _internal_has_last_event_number() const;
+  public:
   void clear_last_event_number();
-  ::PROTOBUF_NAMESPACE_ID::int64 last_event_number() const;
-  void set_last_event_number(::PROTOBUF_NAMESPACE_ID::int64 value);
+  int64_t last_event_number() const;
+  void set_last_event_number(int64_t value);
+  private:
+  int64_t _internal_last_event_number() const;
+  void _internal_set_last_event_number(int64_t value);
+  public:
 
   // required int64 last_commit_position = 6;
   bool has_last_commit_position() const;
+  private:
+  bool _internal_has_last_commit_position() const;
+  public:
   void clear_last_commit_position();
-  ::PROTOBUF_NAMESPACE_ID::int64 last_commit_position() const;
-  void set_last_commit_position(::PROTOBUF_NAMESPACE_ID::int64 value);
+  int64_t last_commit_position() const;
+  void set_last_commit_position(int64_t value);
+  private:
+  int64_t _internal_last_commit_position() const;
+  void _internal_set_last_commit_position(int64_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:es.message.ReadStreamEventsCompleted)
  private:
@@ -3802,25 +4583,31 @@ class ReadStreamEventsCompleted :
   // helper for ByteSizeLong()
   size_t RequiredFieldsByteSizeFallback() const;
 
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::es::message::ResolvedIndexedEvent > events_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr error_;
-  ::PROTOBUF_NAMESPACE_ID::int64 next_event_number_;
-  int result_;
-  bool is_end_of_stream_;
-  ::PROTOBUF_NAMESPACE_ID::int64 last_event_number_;
-  ::PROTOBUF_NAMESPACE_ID::int64 last_commit_position_;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::es::message::ResolvedIndexedEvent > events_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr error_;
+    int64_t next_event_number_;
+    int result_;
+    bool is_end_of_stream_;
+    int64_t last_event_number_;
+    int64_t last_commit_position_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_messages_2eproto;
 };
 // -------------------------------------------------------------------
 
-class ReadAllEvents :
+class ReadAllEvents final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:es.message.ReadAllEvents) */ {
  public:
-  ReadAllEvents();
-  virtual ~ReadAllEvents();
+  inline ReadAllEvents() : ReadAllEvents(nullptr) {}
+  ~ReadAllEvents() override;
+  explicit PROTOBUF_CONSTEXPR ReadAllEvents(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   ReadAllEvents(const ReadAllEvents& from);
   ReadAllEvents(ReadAllEvents&& from) noexcept
@@ -3833,8 +4620,13 @@ class ReadAllEvents :
     return *this;
   }
   inline ReadAllEvents& operator=(ReadAllEvents&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -3842,24 +4634,24 @@ class ReadAllEvents :
   }
 
   inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
-    return _internal_metadata_.unknown_fields();
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
   }
   inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
-    return _internal_metadata_.mutable_unknown_fields();
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ReadAllEvents& default_instance() {
+    return *internal_default_instance();
   }
-  static const ReadAllEvents& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const ReadAllEvents* internal_default_instance() {
     return reinterpret_cast<const ReadAllEvents*>(
                &_ReadAllEvents_default_instance_);
@@ -3872,64 +4664,66 @@ class ReadAllEvents :
   }
   inline void Swap(ReadAllEvents* other) {
     if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ReadAllEvents* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline ReadAllEvents* New() const final {
-    return CreateMaybeMessage<ReadAllEvents>(nullptr);
-  }
-
-  ReadAllEvents* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  ReadAllEvents* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<ReadAllEvents>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const ReadAllEvents& from);
-  void MergeFrom(const ReadAllEvents& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ReadAllEvents& from) {
+    ReadAllEvents::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  #else
-  bool MergePartialFromCodedStream(
-      ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) final;
-  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-  void SerializeWithCachedSizes(
-      ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* InternalSerializeWithCachedSizesToArray(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
-
-  private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(ReadAllEvents* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "es.message.ReadAllEvents";
   }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
-  }
+  protected:
+  explicit ReadAllEvents(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_messages_2eproto);
-    return ::descriptor_table_messages_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -3944,33 +4738,68 @@ class ReadAllEvents :
   };
   // required int64 commit_position = 1;
   bool has_commit_position() const;
+  private:
+  bool _internal_has_commit_position() const;
+  public:
   void clear_commit_position();
-  ::PROTOBUF_NAMESPACE_ID::int64 commit_position() const;
-  void set_commit_position(::PROTOBUF_NAMESPACE_ID::int64 value);
+  int64_t commit_position() const;
+  void set_commit_position(int64_t value);
+  private:
+  int64_t _internal_commit_position() const;
+  void _internal_set_commit_position(int64_t value);
+  public:
 
   // required int64 prepare_position = 2;
   bool has_prepare_position() const;
+  private:
+  bool _internal_has_prepare_position() const;
+  public:
   void clear_prepare_position();
-  ::PROTOBUF_NAMESPACE_ID::int64 prepare_position() const;
-  void set_prepare_position(::PROTOBUF_NAMESPACE_ID::int64 value);
+  int64_t prepare_position() const;
+  void set_prepare_position(int64_t value);
+  private:
+  int64_t _internal_prepare_position() const;
+  void _internal_set_prepare_position(int64_t value);
+  public:
 
   // required int32 max_count = 3;
   bool has_max_count() const;
+  private:
+  bool _internal_has_max_count() const;
+  public:
   void clear_max_count();
-  ::PROTOBUF_NAMESPACE_ID::int32 max_count() const;
-  void set_max_count(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t max_count() const;
+  void set_max_count(int32_t value);
+  private:
+  int32_t _internal_max_count() const;
+  void _internal_set_max_count(int32_t value);
+  public:
 
   // required bool resolve_link_tos = 4;
   bool has_resolve_link_tos() const;
+  private:
+  bool _internal_has_resolve_link_tos() const;
+  public:
   void clear_resolve_link_tos();
   bool resolve_link_tos() const;
   void set_resolve_link_tos(bool value);
+  private:
+  bool _internal_resolve_link_tos() const;
+  void _internal_set_resolve_link_tos(bool value);
+  public:
 
   // required bool require_master = 5;
   bool has_require_master() const;
+  private:
+  bool _internal_has_require_master() const;
+  public:
   void clear_require_master();
   bool require_master() const;
   void set_require_master(bool value);
+  private:
+  bool _internal_require_master() const;
+  void _internal_set_require_master(bool value);
+  public:
 
   // @@protoc_insertion_point(class_scope:es.message.ReadAllEvents)
  private:
@@ -3979,23 +4808,29 @@ class ReadAllEvents :
   // helper for ByteSizeLong()
   size_t RequiredFieldsByteSizeFallback() const;
 
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  ::PROTOBUF_NAMESPACE_ID::int64 commit_position_;
-  ::PROTOBUF_NAMESPACE_ID::int64 prepare_position_;
-  ::PROTOBUF_NAMESPACE_ID::int32 max_count_;
-  bool resolve_link_tos_;
-  bool require_master_;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    int64_t commit_position_;
+    int64_t prepare_position_;
+    int32_t max_count_;
+    bool resolve_link_tos_;
+    bool require_master_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_messages_2eproto;
 };
 // -------------------------------------------------------------------
 
-class ReadAllEventsCompleted :
+class ReadAllEventsCompleted final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:es.message.ReadAllEventsCompleted) */ {
  public:
-  ReadAllEventsCompleted();
-  virtual ~ReadAllEventsCompleted();
+  inline ReadAllEventsCompleted() : ReadAllEventsCompleted(nullptr) {}
+  ~ReadAllEventsCompleted() override;
+  explicit PROTOBUF_CONSTEXPR ReadAllEventsCompleted(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   ReadAllEventsCompleted(const ReadAllEventsCompleted& from);
   ReadAllEventsCompleted(ReadAllEventsCompleted&& from) noexcept
@@ -4008,8 +4843,13 @@ class ReadAllEventsCompleted :
     return *this;
   }
   inline ReadAllEventsCompleted& operator=(ReadAllEventsCompleted&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -4017,24 +4857,24 @@ class ReadAllEventsCompleted :
   }
 
   inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
-    return _internal_metadata_.unknown_fields();
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
   }
   inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
-    return _internal_metadata_.mutable_unknown_fields();
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ReadAllEventsCompleted& default_instance() {
+    return *internal_default_instance();
   }
-  static const ReadAllEventsCompleted& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const ReadAllEventsCompleted* internal_default_instance() {
     return reinterpret_cast<const ReadAllEventsCompleted*>(
                &_ReadAllEventsCompleted_default_instance_);
@@ -4047,64 +4887,66 @@ class ReadAllEventsCompleted :
   }
   inline void Swap(ReadAllEventsCompleted* other) {
     if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ReadAllEventsCompleted* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline ReadAllEventsCompleted* New() const final {
-    return CreateMaybeMessage<ReadAllEventsCompleted>(nullptr);
-  }
-
-  ReadAllEventsCompleted* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  ReadAllEventsCompleted* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<ReadAllEventsCompleted>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const ReadAllEventsCompleted& from);
-  void MergeFrom(const ReadAllEventsCompleted& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ReadAllEventsCompleted& from) {
+    ReadAllEventsCompleted::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  #else
-  bool MergePartialFromCodedStream(
-      ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) final;
-  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-  void SerializeWithCachedSizes(
-      ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* InternalSerializeWithCachedSizesToArray(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
-
-  private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(ReadAllEventsCompleted* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "es.message.ReadAllEventsCompleted";
   }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
-  }
+  protected:
+  explicit ReadAllEventsCompleted(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_messages_2eproto);
-    return ::descriptor_table_messages_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -4137,7 +4979,7 @@ class ReadAllEventsCompleted :
       "Incorrect type passed to function ReadAllResult_Name.");
     return ReadAllEventsCompleted_ReadAllResult_Name(enum_t_value);
   }
-  static inline bool ReadAllResult_Parse(const std::string& name,
+  static inline bool ReadAllResult_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
       ReadAllResult* value) {
     return ReadAllEventsCompleted_ReadAllResult_Parse(name, value);
   }
@@ -4155,10 +4997,17 @@ class ReadAllEventsCompleted :
   };
   // repeated .es.message.ResolvedEvent events = 3;
   int events_size() const;
+  private:
+  int _internal_events_size() const;
+  public:
   void clear_events();
   ::es::message::ResolvedEvent* mutable_events(int index);
   ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::es::message::ResolvedEvent >*
       mutable_events();
+  private:
+  const ::es::message::ResolvedEvent& _internal_events(int index) const;
+  ::es::message::ResolvedEvent* _internal_add_events();
+  public:
   const ::es::message::ResolvedEvent& events(int index) const;
   ::es::message::ResolvedEvent* add_events();
   const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::es::message::ResolvedEvent >&
@@ -4166,45 +5015,86 @@ class ReadAllEventsCompleted :
 
   // optional string error = 7;
   bool has_error() const;
+  private:
+  bool _internal_has_error() const;
+  public:
   void clear_error();
   const std::string& error() const;
-  void set_error(const std::string& value);
-  void set_error(std::string&& value);
-  void set_error(const char* value);
-  void set_error(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_error(ArgT0&& arg0, ArgT... args);
   std::string* mutable_error();
-  std::string* release_error();
+  PROTOBUF_NODISCARD std::string* release_error();
   void set_allocated_error(std::string* error);
+  private:
+  const std::string& _internal_error() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_error(const std::string& value);
+  std::string* _internal_mutable_error();
+  public:
 
   // required int64 commit_position = 1;
   bool has_commit_position() const;
+  private:
+  bool _internal_has_commit_position() const;
+  public:
   void clear_commit_position();
-  ::PROTOBUF_NAMESPACE_ID::int64 commit_position() const;
-  void set_commit_position(::PROTOBUF_NAMESPACE_ID::int64 value);
+  int64_t commit_position() const;
+  void set_commit_position(int64_t value);
+  private:
+  int64_t _internal_commit_position() const;
+  void _internal_set_commit_position(int64_t value);
+  public:
 
   // required int64 prepare_position = 2;
   bool has_prepare_position() const;
+  private:
+  bool _internal_has_prepare_position() const;
+  public:
   void clear_prepare_position();
-  ::PROTOBUF_NAMESPACE_ID::int64 prepare_position() const;
-  void set_prepare_position(::PROTOBUF_NAMESPACE_ID::int64 value);
+  int64_t prepare_position() const;
+  void set_prepare_position(int64_t value);
+  private:
+  int64_t _internal_prepare_position() const;
+  void _internal_set_prepare_position(int64_t value);
+  public:
 
   // required int64 next_commit_position = 4;
   bool has_next_commit_position() const;
+  private:
+  bool _internal_has_next_commit_position() const;
+  public:
   void clear_next_commit_position();
-  ::PROTOBUF_NAMESPACE_ID::int64 next_commit_position() const;
-  void set_next_commit_position(::PROTOBUF_NAMESPACE_ID::int64 value);
+  int64_t next_commit_position() const;
+  void set_next_commit_position(int64_t value);
+  private:
+  int64_t _internal_next_commit_position() const;
+  void _internal_set_next_commit_position(int64_t value);
+  public:
 
   // required int64 next_prepare_position = 5;
   bool has_next_prepare_position() const;
+  private:
+  bool _internal_has_next_prepare_position() const;
+  public:
   void clear_next_prepare_position();
-  ::PROTOBUF_NAMESPACE_ID::int64 next_prepare_position() const;
-  void set_next_prepare_position(::PROTOBUF_NAMESPACE_ID::int64 value);
+  int64_t next_prepare_position() const;
+  void set_next_prepare_position(int64_t value);
+  private:
+  int64_t _internal_next_prepare_position() const;
+  void _internal_set_next_prepare_position(int64_t value);
+  public:
 
   // optional .es.message.ReadAllEventsCompleted.ReadAllResult result = 6;
   bool has_result() const;
+  private:
+  bool _internal_has_result() const;
+  public:
   void clear_result();
   ::es::message::ReadAllEventsCompleted_ReadAllResult result() const;
   void set_result(::es::message::ReadAllEventsCompleted_ReadAllResult value);
+  private:
+  ::es::message::ReadAllEventsCompleted_ReadAllResult _internal_result() const;
+  void _internal_set_result(::es::message::ReadAllEventsCompleted_ReadAllResult value);
+  public:
 
   // @@protoc_insertion_point(class_scope:es.message.ReadAllEventsCompleted)
  private:
@@ -4213,25 +5103,31 @@ class ReadAllEventsCompleted :
   // helper for ByteSizeLong()
   size_t RequiredFieldsByteSizeFallback() const;
 
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::es::message::ResolvedEvent > events_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr error_;
-  ::PROTOBUF_NAMESPACE_ID::int64 commit_position_;
-  ::PROTOBUF_NAMESPACE_ID::int64 prepare_position_;
-  ::PROTOBUF_NAMESPACE_ID::int64 next_commit_position_;
-  ::PROTOBUF_NAMESPACE_ID::int64 next_prepare_position_;
-  int result_;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::es::message::ResolvedEvent > events_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr error_;
+    int64_t commit_position_;
+    int64_t prepare_position_;
+    int64_t next_commit_position_;
+    int64_t next_prepare_position_;
+    int result_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_messages_2eproto;
 };
 // -------------------------------------------------------------------
 
-class CreatePersistentSubscription :
+class CreatePersistentSubscription final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:es.message.CreatePersistentSubscription) */ {
  public:
-  CreatePersistentSubscription();
-  virtual ~CreatePersistentSubscription();
+  inline CreatePersistentSubscription() : CreatePersistentSubscription(nullptr) {}
+  ~CreatePersistentSubscription() override;
+  explicit PROTOBUF_CONSTEXPR CreatePersistentSubscription(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   CreatePersistentSubscription(const CreatePersistentSubscription& from);
   CreatePersistentSubscription(CreatePersistentSubscription&& from) noexcept
@@ -4244,8 +5140,13 @@ class CreatePersistentSubscription :
     return *this;
   }
   inline CreatePersistentSubscription& operator=(CreatePersistentSubscription&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -4253,24 +5154,24 @@ class CreatePersistentSubscription :
   }
 
   inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
-    return _internal_metadata_.unknown_fields();
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
   }
   inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
-    return _internal_metadata_.mutable_unknown_fields();
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CreatePersistentSubscription& default_instance() {
+    return *internal_default_instance();
   }
-  static const CreatePersistentSubscription& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const CreatePersistentSubscription* internal_default_instance() {
     return reinterpret_cast<const CreatePersistentSubscription*>(
                &_CreatePersistentSubscription_default_instance_);
@@ -4283,64 +5184,66 @@ class CreatePersistentSubscription :
   }
   inline void Swap(CreatePersistentSubscription* other) {
     if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CreatePersistentSubscription* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline CreatePersistentSubscription* New() const final {
-    return CreateMaybeMessage<CreatePersistentSubscription>(nullptr);
-  }
-
-  CreatePersistentSubscription* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  CreatePersistentSubscription* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<CreatePersistentSubscription>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const CreatePersistentSubscription& from);
-  void MergeFrom(const CreatePersistentSubscription& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CreatePersistentSubscription& from) {
+    CreatePersistentSubscription::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  #else
-  bool MergePartialFromCodedStream(
-      ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) final;
-  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-  void SerializeWithCachedSizes(
-      ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* InternalSerializeWithCachedSizesToArray(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
-
-  private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(CreatePersistentSubscription* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "es.message.CreatePersistentSubscription";
   }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
-  }
+  protected:
+  explicit CreatePersistentSubscription(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_messages_2eproto);
-    return ::descriptor_table_messages_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -4366,117 +5269,226 @@ class CreatePersistentSubscription :
   };
   // required string subscription_group_name = 1;
   bool has_subscription_group_name() const;
+  private:
+  bool _internal_has_subscription_group_name() const;
+  public:
   void clear_subscription_group_name();
   const std::string& subscription_group_name() const;
-  void set_subscription_group_name(const std::string& value);
-  void set_subscription_group_name(std::string&& value);
-  void set_subscription_group_name(const char* value);
-  void set_subscription_group_name(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_subscription_group_name(ArgT0&& arg0, ArgT... args);
   std::string* mutable_subscription_group_name();
-  std::string* release_subscription_group_name();
+  PROTOBUF_NODISCARD std::string* release_subscription_group_name();
   void set_allocated_subscription_group_name(std::string* subscription_group_name);
+  private:
+  const std::string& _internal_subscription_group_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_subscription_group_name(const std::string& value);
+  std::string* _internal_mutable_subscription_group_name();
+  public:
 
   // required string event_stream_id = 2;
   bool has_event_stream_id() const;
+  private:
+  bool _internal_has_event_stream_id() const;
+  public:
   void clear_event_stream_id();
   const std::string& event_stream_id() const;
-  void set_event_stream_id(const std::string& value);
-  void set_event_stream_id(std::string&& value);
-  void set_event_stream_id(const char* value);
-  void set_event_stream_id(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_event_stream_id(ArgT0&& arg0, ArgT... args);
   std::string* mutable_event_stream_id();
-  std::string* release_event_stream_id();
+  PROTOBUF_NODISCARD std::string* release_event_stream_id();
   void set_allocated_event_stream_id(std::string* event_stream_id);
+  private:
+  const std::string& _internal_event_stream_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_event_stream_id(const std::string& value);
+  std::string* _internal_mutable_event_stream_id();
+  public:
 
   // optional string named_consumer_strategy = 16;
   bool has_named_consumer_strategy() const;
+  private:
+  bool _internal_has_named_consumer_strategy() const;
+  public:
   void clear_named_consumer_strategy();
   const std::string& named_consumer_strategy() const;
-  void set_named_consumer_strategy(const std::string& value);
-  void set_named_consumer_strategy(std::string&& value);
-  void set_named_consumer_strategy(const char* value);
-  void set_named_consumer_strategy(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_named_consumer_strategy(ArgT0&& arg0, ArgT... args);
   std::string* mutable_named_consumer_strategy();
-  std::string* release_named_consumer_strategy();
+  PROTOBUF_NODISCARD std::string* release_named_consumer_strategy();
   void set_allocated_named_consumer_strategy(std::string* named_consumer_strategy);
+  private:
+  const std::string& _internal_named_consumer_strategy() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_named_consumer_strategy(const std::string& value);
+  std::string* _internal_mutable_named_consumer_strategy();
+  public:
 
   // required int64 start_from = 4;
   bool has_start_from() const;
+  private:
+  bool _internal_has_start_from() const;
+  public:
   void clear_start_from();
-  ::PROTOBUF_NAMESPACE_ID::int64 start_from() const;
-  void set_start_from(::PROTOBUF_NAMESPACE_ID::int64 value);
+  int64_t start_from() const;
+  void set_start_from(int64_t value);
+  private:
+  int64_t _internal_start_from() const;
+  void _internal_set_start_from(int64_t value);
+  public:
 
   // required int32 message_timeout_milliseconds = 5;
   bool has_message_timeout_milliseconds() const;
+  private:
+  bool _internal_has_message_timeout_milliseconds() const;
+  public:
   void clear_message_timeout_milliseconds();
-  ::PROTOBUF_NAMESPACE_ID::int32 message_timeout_milliseconds() const;
-  void set_message_timeout_milliseconds(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t message_timeout_milliseconds() const;
+  void set_message_timeout_milliseconds(int32_t value);
+  private:
+  int32_t _internal_message_timeout_milliseconds() const;
+  void _internal_set_message_timeout_milliseconds(int32_t value);
+  public:
 
   // required bool resolve_link_tos = 3;
   bool has_resolve_link_tos() const;
+  private:
+  bool _internal_has_resolve_link_tos() const;
+  public:
   void clear_resolve_link_tos();
   bool resolve_link_tos() const;
   void set_resolve_link_tos(bool value);
+  private:
+  bool _internal_resolve_link_tos() const;
+  void _internal_set_resolve_link_tos(bool value);
+  public:
 
   // required bool record_statistics = 6;
   bool has_record_statistics() const;
+  private:
+  bool _internal_has_record_statistics() const;
+  public:
   void clear_record_statistics();
   bool record_statistics() const;
   void set_record_statistics(bool value);
+  private:
+  bool _internal_record_statistics() const;
+  void _internal_set_record_statistics(bool value);
+  public:
 
   // required bool prefer_round_robin = 11;
   bool has_prefer_round_robin() const;
+  private:
+  bool _internal_has_prefer_round_robin() const;
+  public:
   void clear_prefer_round_robin();
   bool prefer_round_robin() const;
   void set_prefer_round_robin(bool value);
+  private:
+  bool _internal_prefer_round_robin() const;
+  void _internal_set_prefer_round_robin(bool value);
+  public:
 
   // required int32 live_buffer_size = 7;
   bool has_live_buffer_size() const;
+  private:
+  bool _internal_has_live_buffer_size() const;
+  public:
   void clear_live_buffer_size();
-  ::PROTOBUF_NAMESPACE_ID::int32 live_buffer_size() const;
-  void set_live_buffer_size(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t live_buffer_size() const;
+  void set_live_buffer_size(int32_t value);
+  private:
+  int32_t _internal_live_buffer_size() const;
+  void _internal_set_live_buffer_size(int32_t value);
+  public:
 
   // required int32 read_batch_size = 8;
   bool has_read_batch_size() const;
+  private:
+  bool _internal_has_read_batch_size() const;
+  public:
   void clear_read_batch_size();
-  ::PROTOBUF_NAMESPACE_ID::int32 read_batch_size() const;
-  void set_read_batch_size(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t read_batch_size() const;
+  void set_read_batch_size(int32_t value);
+  private:
+  int32_t _internal_read_batch_size() const;
+  void _internal_set_read_batch_size(int32_t value);
+  public:
 
   // required int32 buffer_size = 9;
   bool has_buffer_size() const;
+  private:
+  bool _internal_has_buffer_size() const;
+  public:
   void clear_buffer_size();
-  ::PROTOBUF_NAMESPACE_ID::int32 buffer_size() const;
-  void set_buffer_size(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t buffer_size() const;
+  void set_buffer_size(int32_t value);
+  private:
+  int32_t _internal_buffer_size() const;
+  void _internal_set_buffer_size(int32_t value);
+  public:
 
   // required int32 max_retry_count = 10;
   bool has_max_retry_count() const;
+  private:
+  bool _internal_has_max_retry_count() const;
+  public:
   void clear_max_retry_count();
-  ::PROTOBUF_NAMESPACE_ID::int32 max_retry_count() const;
-  void set_max_retry_count(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t max_retry_count() const;
+  void set_max_retry_count(int32_t value);
+  private:
+  int32_t _internal_max_retry_count() const;
+  void _internal_set_max_retry_count(int32_t value);
+  public:
 
   // required int32 checkpoint_after_time = 12;
   bool has_checkpoint_after_time() const;
+  private:
+  bool _internal_has_checkpoint_after_time() const;
+  public:
   void clear_checkpoint_after_time();
-  ::PROTOBUF_NAMESPACE_ID::int32 checkpoint_after_time() const;
-  void set_checkpoint_after_time(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t checkpoint_after_time() const;
+  void set_checkpoint_after_time(int32_t value);
+  private:
+  int32_t _internal_checkpoint_after_time() const;
+  void _internal_set_checkpoint_after_time(int32_t value);
+  public:
 
   // required int32 checkpoint_max_count = 13;
   bool has_checkpoint_max_count() const;
+  private:
+  bool _internal_has_checkpoint_max_count() const;
+  public:
   void clear_checkpoint_max_count();
-  ::PROTOBUF_NAMESPACE_ID::int32 checkpoint_max_count() const;
-  void set_checkpoint_max_count(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t checkpoint_max_count() const;
+  void set_checkpoint_max_count(int32_t value);
+  private:
+  int32_t _internal_checkpoint_max_count() const;
+  void _internal_set_checkpoint_max_count(int32_t value);
+  public:
 
   // required int32 checkpoint_min_count = 14;
   bool has_checkpoint_min_count() const;
+  private:
+  bool _internal_has_checkpoint_min_count() const;
+  public:
   void clear_checkpoint_min_count();
-  ::PROTOBUF_NAMESPACE_ID::int32 checkpoint_min_count() const;
-  void set_checkpoint_min_count(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t checkpoint_min_count() const;
+  void set_checkpoint_min_count(int32_t value);
+  private:
+  int32_t _internal_checkpoint_min_count() const;
+  void _internal_set_checkpoint_min_count(int32_t value);
+  public:
 
   // required int32 subscriber_max_count = 15;
   bool has_subscriber_max_count() const;
+  private:
+  bool _internal_has_subscriber_max_count() const;
+  public:
   void clear_subscriber_max_count();
-  ::PROTOBUF_NAMESPACE_ID::int32 subscriber_max_count() const;
-  void set_subscriber_max_count(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t subscriber_max_count() const;
+  void set_subscriber_max_count(int32_t value);
+  private:
+  int32_t _internal_subscriber_max_count() const;
+  void _internal_set_subscriber_max_count(int32_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:es.message.CreatePersistentSubscription)
  private:
@@ -4485,34 +5497,40 @@ class CreatePersistentSubscription :
   // helper for ByteSizeLong()
   size_t RequiredFieldsByteSizeFallback() const;
 
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr subscription_group_name_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr event_stream_id_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr named_consumer_strategy_;
-  ::PROTOBUF_NAMESPACE_ID::int64 start_from_;
-  ::PROTOBUF_NAMESPACE_ID::int32 message_timeout_milliseconds_;
-  bool resolve_link_tos_;
-  bool record_statistics_;
-  bool prefer_round_robin_;
-  ::PROTOBUF_NAMESPACE_ID::int32 live_buffer_size_;
-  ::PROTOBUF_NAMESPACE_ID::int32 read_batch_size_;
-  ::PROTOBUF_NAMESPACE_ID::int32 buffer_size_;
-  ::PROTOBUF_NAMESPACE_ID::int32 max_retry_count_;
-  ::PROTOBUF_NAMESPACE_ID::int32 checkpoint_after_time_;
-  ::PROTOBUF_NAMESPACE_ID::int32 checkpoint_max_count_;
-  ::PROTOBUF_NAMESPACE_ID::int32 checkpoint_min_count_;
-  ::PROTOBUF_NAMESPACE_ID::int32 subscriber_max_count_;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr subscription_group_name_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr event_stream_id_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr named_consumer_strategy_;
+    int64_t start_from_;
+    int32_t message_timeout_milliseconds_;
+    bool resolve_link_tos_;
+    bool record_statistics_;
+    bool prefer_round_robin_;
+    int32_t live_buffer_size_;
+    int32_t read_batch_size_;
+    int32_t buffer_size_;
+    int32_t max_retry_count_;
+    int32_t checkpoint_after_time_;
+    int32_t checkpoint_max_count_;
+    int32_t checkpoint_min_count_;
+    int32_t subscriber_max_count_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_messages_2eproto;
 };
 // -------------------------------------------------------------------
 
-class DeletePersistentSubscription :
+class DeletePersistentSubscription final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:es.message.DeletePersistentSubscription) */ {
  public:
-  DeletePersistentSubscription();
-  virtual ~DeletePersistentSubscription();
+  inline DeletePersistentSubscription() : DeletePersistentSubscription(nullptr) {}
+  ~DeletePersistentSubscription() override;
+  explicit PROTOBUF_CONSTEXPR DeletePersistentSubscription(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   DeletePersistentSubscription(const DeletePersistentSubscription& from);
   DeletePersistentSubscription(DeletePersistentSubscription&& from) noexcept
@@ -4525,8 +5543,13 @@ class DeletePersistentSubscription :
     return *this;
   }
   inline DeletePersistentSubscription& operator=(DeletePersistentSubscription&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -4534,24 +5557,24 @@ class DeletePersistentSubscription :
   }
 
   inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
-    return _internal_metadata_.unknown_fields();
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
   }
   inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
-    return _internal_metadata_.mutable_unknown_fields();
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const DeletePersistentSubscription& default_instance() {
+    return *internal_default_instance();
   }
-  static const DeletePersistentSubscription& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const DeletePersistentSubscription* internal_default_instance() {
     return reinterpret_cast<const DeletePersistentSubscription*>(
                &_DeletePersistentSubscription_default_instance_);
@@ -4564,64 +5587,66 @@ class DeletePersistentSubscription :
   }
   inline void Swap(DeletePersistentSubscription* other) {
     if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(DeletePersistentSubscription* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline DeletePersistentSubscription* New() const final {
-    return CreateMaybeMessage<DeletePersistentSubscription>(nullptr);
-  }
-
-  DeletePersistentSubscription* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  DeletePersistentSubscription* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<DeletePersistentSubscription>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const DeletePersistentSubscription& from);
-  void MergeFrom(const DeletePersistentSubscription& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const DeletePersistentSubscription& from) {
+    DeletePersistentSubscription::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  #else
-  bool MergePartialFromCodedStream(
-      ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) final;
-  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-  void SerializeWithCachedSizes(
-      ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* InternalSerializeWithCachedSizesToArray(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
-
-  private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(DeletePersistentSubscription* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "es.message.DeletePersistentSubscription";
   }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
-  }
+  protected:
+  explicit DeletePersistentSubscription(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_messages_2eproto);
-    return ::descriptor_table_messages_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -4633,27 +5658,39 @@ class DeletePersistentSubscription :
   };
   // required string subscription_group_name = 1;
   bool has_subscription_group_name() const;
+  private:
+  bool _internal_has_subscription_group_name() const;
+  public:
   void clear_subscription_group_name();
   const std::string& subscription_group_name() const;
-  void set_subscription_group_name(const std::string& value);
-  void set_subscription_group_name(std::string&& value);
-  void set_subscription_group_name(const char* value);
-  void set_subscription_group_name(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_subscription_group_name(ArgT0&& arg0, ArgT... args);
   std::string* mutable_subscription_group_name();
-  std::string* release_subscription_group_name();
+  PROTOBUF_NODISCARD std::string* release_subscription_group_name();
   void set_allocated_subscription_group_name(std::string* subscription_group_name);
+  private:
+  const std::string& _internal_subscription_group_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_subscription_group_name(const std::string& value);
+  std::string* _internal_mutable_subscription_group_name();
+  public:
 
   // required string event_stream_id = 2;
   bool has_event_stream_id() const;
+  private:
+  bool _internal_has_event_stream_id() const;
+  public:
   void clear_event_stream_id();
   const std::string& event_stream_id() const;
-  void set_event_stream_id(const std::string& value);
-  void set_event_stream_id(std::string&& value);
-  void set_event_stream_id(const char* value);
-  void set_event_stream_id(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_event_stream_id(ArgT0&& arg0, ArgT... args);
   std::string* mutable_event_stream_id();
-  std::string* release_event_stream_id();
+  PROTOBUF_NODISCARD std::string* release_event_stream_id();
   void set_allocated_event_stream_id(std::string* event_stream_id);
+  private:
+  const std::string& _internal_event_stream_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_event_stream_id(const std::string& value);
+  std::string* _internal_mutable_event_stream_id();
+  public:
 
   // @@protoc_insertion_point(class_scope:es.message.DeletePersistentSubscription)
  private:
@@ -4662,20 +5699,26 @@ class DeletePersistentSubscription :
   // helper for ByteSizeLong()
   size_t RequiredFieldsByteSizeFallback() const;
 
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr subscription_group_name_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr event_stream_id_;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr subscription_group_name_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr event_stream_id_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_messages_2eproto;
 };
 // -------------------------------------------------------------------
 
-class UpdatePersistentSubscription :
+class UpdatePersistentSubscription final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:es.message.UpdatePersistentSubscription) */ {
  public:
-  UpdatePersistentSubscription();
-  virtual ~UpdatePersistentSubscription();
+  inline UpdatePersistentSubscription() : UpdatePersistentSubscription(nullptr) {}
+  ~UpdatePersistentSubscription() override;
+  explicit PROTOBUF_CONSTEXPR UpdatePersistentSubscription(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   UpdatePersistentSubscription(const UpdatePersistentSubscription& from);
   UpdatePersistentSubscription(UpdatePersistentSubscription&& from) noexcept
@@ -4688,8 +5731,13 @@ class UpdatePersistentSubscription :
     return *this;
   }
   inline UpdatePersistentSubscription& operator=(UpdatePersistentSubscription&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -4697,24 +5745,24 @@ class UpdatePersistentSubscription :
   }
 
   inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
-    return _internal_metadata_.unknown_fields();
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
   }
   inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
-    return _internal_metadata_.mutable_unknown_fields();
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const UpdatePersistentSubscription& default_instance() {
+    return *internal_default_instance();
   }
-  static const UpdatePersistentSubscription& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const UpdatePersistentSubscription* internal_default_instance() {
     return reinterpret_cast<const UpdatePersistentSubscription*>(
                &_UpdatePersistentSubscription_default_instance_);
@@ -4727,64 +5775,66 @@ class UpdatePersistentSubscription :
   }
   inline void Swap(UpdatePersistentSubscription* other) {
     if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(UpdatePersistentSubscription* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline UpdatePersistentSubscription* New() const final {
-    return CreateMaybeMessage<UpdatePersistentSubscription>(nullptr);
-  }
-
-  UpdatePersistentSubscription* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  UpdatePersistentSubscription* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<UpdatePersistentSubscription>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const UpdatePersistentSubscription& from);
-  void MergeFrom(const UpdatePersistentSubscription& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const UpdatePersistentSubscription& from) {
+    UpdatePersistentSubscription::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  #else
-  bool MergePartialFromCodedStream(
-      ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) final;
-  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-  void SerializeWithCachedSizes(
-      ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* InternalSerializeWithCachedSizesToArray(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
-
-  private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(UpdatePersistentSubscription* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "es.message.UpdatePersistentSubscription";
   }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
-  }
+  protected:
+  explicit UpdatePersistentSubscription(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_messages_2eproto);
-    return ::descriptor_table_messages_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -4810,117 +5860,226 @@ class UpdatePersistentSubscription :
   };
   // required string subscription_group_name = 1;
   bool has_subscription_group_name() const;
+  private:
+  bool _internal_has_subscription_group_name() const;
+  public:
   void clear_subscription_group_name();
   const std::string& subscription_group_name() const;
-  void set_subscription_group_name(const std::string& value);
-  void set_subscription_group_name(std::string&& value);
-  void set_subscription_group_name(const char* value);
-  void set_subscription_group_name(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_subscription_group_name(ArgT0&& arg0, ArgT... args);
   std::string* mutable_subscription_group_name();
-  std::string* release_subscription_group_name();
+  PROTOBUF_NODISCARD std::string* release_subscription_group_name();
   void set_allocated_subscription_group_name(std::string* subscription_group_name);
+  private:
+  const std::string& _internal_subscription_group_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_subscription_group_name(const std::string& value);
+  std::string* _internal_mutable_subscription_group_name();
+  public:
 
   // required string event_stream_id = 2;
   bool has_event_stream_id() const;
+  private:
+  bool _internal_has_event_stream_id() const;
+  public:
   void clear_event_stream_id();
   const std::string& event_stream_id() const;
-  void set_event_stream_id(const std::string& value);
-  void set_event_stream_id(std::string&& value);
-  void set_event_stream_id(const char* value);
-  void set_event_stream_id(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_event_stream_id(ArgT0&& arg0, ArgT... args);
   std::string* mutable_event_stream_id();
-  std::string* release_event_stream_id();
+  PROTOBUF_NODISCARD std::string* release_event_stream_id();
   void set_allocated_event_stream_id(std::string* event_stream_id);
+  private:
+  const std::string& _internal_event_stream_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_event_stream_id(const std::string& value);
+  std::string* _internal_mutable_event_stream_id();
+  public:
 
   // optional string named_consumer_strategy = 16;
   bool has_named_consumer_strategy() const;
+  private:
+  bool _internal_has_named_consumer_strategy() const;
+  public:
   void clear_named_consumer_strategy();
   const std::string& named_consumer_strategy() const;
-  void set_named_consumer_strategy(const std::string& value);
-  void set_named_consumer_strategy(std::string&& value);
-  void set_named_consumer_strategy(const char* value);
-  void set_named_consumer_strategy(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_named_consumer_strategy(ArgT0&& arg0, ArgT... args);
   std::string* mutable_named_consumer_strategy();
-  std::string* release_named_consumer_strategy();
+  PROTOBUF_NODISCARD std::string* release_named_consumer_strategy();
   void set_allocated_named_consumer_strategy(std::string* named_consumer_strategy);
+  private:
+  const std::string& _internal_named_consumer_strategy() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_named_consumer_strategy(const std::string& value);
+  std::string* _internal_mutable_named_consumer_strategy();
+  public:
 
   // required int64 start_from = 4;
   bool has_start_from() const;
+  private:
+  bool _internal_has_start_from() const;
+  public:
   void clear_start_from();
-  ::PROTOBUF_NAMESPACE_ID::int64 start_from() const;
-  void set_start_from(::PROTOBUF_NAMESPACE_ID::int64 value);
+  int64_t start_from() const;
+  void set_start_from(int64_t value);
+  private:
+  int64_t _internal_start_from() const;
+  void _internal_set_start_from(int64_t value);
+  public:
 
   // required int32 message_timeout_milliseconds = 5;
   bool has_message_timeout_milliseconds() const;
+  private:
+  bool _internal_has_message_timeout_milliseconds() const;
+  public:
   void clear_message_timeout_milliseconds();
-  ::PROTOBUF_NAMESPACE_ID::int32 message_timeout_milliseconds() const;
-  void set_message_timeout_milliseconds(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t message_timeout_milliseconds() const;
+  void set_message_timeout_milliseconds(int32_t value);
+  private:
+  int32_t _internal_message_timeout_milliseconds() const;
+  void _internal_set_message_timeout_milliseconds(int32_t value);
+  public:
 
   // required bool resolve_link_tos = 3;
   bool has_resolve_link_tos() const;
+  private:
+  bool _internal_has_resolve_link_tos() const;
+  public:
   void clear_resolve_link_tos();
   bool resolve_link_tos() const;
   void set_resolve_link_tos(bool value);
+  private:
+  bool _internal_resolve_link_tos() const;
+  void _internal_set_resolve_link_tos(bool value);
+  public:
 
   // required bool record_statistics = 6;
   bool has_record_statistics() const;
+  private:
+  bool _internal_has_record_statistics() const;
+  public:
   void clear_record_statistics();
   bool record_statistics() const;
   void set_record_statistics(bool value);
+  private:
+  bool _internal_record_statistics() const;
+  void _internal_set_record_statistics(bool value);
+  public:
 
   // required bool prefer_round_robin = 11;
   bool has_prefer_round_robin() const;
+  private:
+  bool _internal_has_prefer_round_robin() const;
+  public:
   void clear_prefer_round_robin();
   bool prefer_round_robin() const;
   void set_prefer_round_robin(bool value);
+  private:
+  bool _internal_prefer_round_robin() const;
+  void _internal_set_prefer_round_robin(bool value);
+  public:
 
   // required int32 live_buffer_size = 7;
   bool has_live_buffer_size() const;
+  private:
+  bool _internal_has_live_buffer_size() const;
+  public:
   void clear_live_buffer_size();
-  ::PROTOBUF_NAMESPACE_ID::int32 live_buffer_size() const;
-  void set_live_buffer_size(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t live_buffer_size() const;
+  void set_live_buffer_size(int32_t value);
+  private:
+  int32_t _internal_live_buffer_size() const;
+  void _internal_set_live_buffer_size(int32_t value);
+  public:
 
   // required int32 read_batch_size = 8;
   bool has_read_batch_size() const;
+  private:
+  bool _internal_has_read_batch_size() const;
+  public:
   void clear_read_batch_size();
-  ::PROTOBUF_NAMESPACE_ID::int32 read_batch_size() const;
-  void set_read_batch_size(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t read_batch_size() const;
+  void set_read_batch_size(int32_t value);
+  private:
+  int32_t _internal_read_batch_size() const;
+  void _internal_set_read_batch_size(int32_t value);
+  public:
 
   // required int32 buffer_size = 9;
   bool has_buffer_size() const;
+  private:
+  bool _internal_has_buffer_size() const;
+  public:
   void clear_buffer_size();
-  ::PROTOBUF_NAMESPACE_ID::int32 buffer_size() const;
-  void set_buffer_size(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t buffer_size() const;
+  void set_buffer_size(int32_t value);
+  private:
+  int32_t _internal_buffer_size() const;
+  void _internal_set_buffer_size(int32_t value);
+  public:
 
   // required int32 max_retry_count = 10;
   bool has_max_retry_count() const;
+  private:
+  bool _internal_has_max_retry_count() const;
+  public:
   void clear_max_retry_count();
-  ::PROTOBUF_NAMESPACE_ID::int32 max_retry_count() const;
-  void set_max_retry_count(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t max_retry_count() const;
+  void set_max_retry_count(int32_t value);
+  private:
+  int32_t _internal_max_retry_count() const;
+  void _internal_set_max_retry_count(int32_t value);
+  public:
 
   // required int32 checkpoint_after_time = 12;
   bool has_checkpoint_after_time() const;
+  private:
+  bool _internal_has_checkpoint_after_time() const;
+  public:
   void clear_checkpoint_after_time();
-  ::PROTOBUF_NAMESPACE_ID::int32 checkpoint_after_time() const;
-  void set_checkpoint_after_time(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t checkpoint_after_time() const;
+  void set_checkpoint_after_time(int32_t value);
+  private:
+  int32_t _internal_checkpoint_after_time() const;
+  void _internal_set_checkpoint_after_time(int32_t value);
+  public:
 
   // required int32 checkpoint_max_count = 13;
   bool has_checkpoint_max_count() const;
+  private:
+  bool _internal_has_checkpoint_max_count() const;
+  public:
   void clear_checkpoint_max_count();
-  ::PROTOBUF_NAMESPACE_ID::int32 checkpoint_max_count() const;
-  void set_checkpoint_max_count(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t checkpoint_max_count() const;
+  void set_checkpoint_max_count(int32_t value);
+  private:
+  int32_t _internal_checkpoint_max_count() const;
+  void _internal_set_checkpoint_max_count(int32_t value);
+  public:
 
   // required int32 checkpoint_min_count = 14;
   bool has_checkpoint_min_count() const;
+  private:
+  bool _internal_has_checkpoint_min_count() const;
+  public:
   void clear_checkpoint_min_count();
-  ::PROTOBUF_NAMESPACE_ID::int32 checkpoint_min_count() const;
-  void set_checkpoint_min_count(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t checkpoint_min_count() const;
+  void set_checkpoint_min_count(int32_t value);
+  private:
+  int32_t _internal_checkpoint_min_count() const;
+  void _internal_set_checkpoint_min_count(int32_t value);
+  public:
 
   // required int32 subscriber_max_count = 15;
   bool has_subscriber_max_count() const;
+  private:
+  bool _internal_has_subscriber_max_count() const;
+  public:
   void clear_subscriber_max_count();
-  ::PROTOBUF_NAMESPACE_ID::int32 subscriber_max_count() const;
-  void set_subscriber_max_count(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t subscriber_max_count() const;
+  void set_subscriber_max_count(int32_t value);
+  private:
+  int32_t _internal_subscriber_max_count() const;
+  void _internal_set_subscriber_max_count(int32_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:es.message.UpdatePersistentSubscription)
  private:
@@ -4929,34 +6088,40 @@ class UpdatePersistentSubscription :
   // helper for ByteSizeLong()
   size_t RequiredFieldsByteSizeFallback() const;
 
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr subscription_group_name_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr event_stream_id_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr named_consumer_strategy_;
-  ::PROTOBUF_NAMESPACE_ID::int64 start_from_;
-  ::PROTOBUF_NAMESPACE_ID::int32 message_timeout_milliseconds_;
-  bool resolve_link_tos_;
-  bool record_statistics_;
-  bool prefer_round_robin_;
-  ::PROTOBUF_NAMESPACE_ID::int32 live_buffer_size_;
-  ::PROTOBUF_NAMESPACE_ID::int32 read_batch_size_;
-  ::PROTOBUF_NAMESPACE_ID::int32 buffer_size_;
-  ::PROTOBUF_NAMESPACE_ID::int32 max_retry_count_;
-  ::PROTOBUF_NAMESPACE_ID::int32 checkpoint_after_time_;
-  ::PROTOBUF_NAMESPACE_ID::int32 checkpoint_max_count_;
-  ::PROTOBUF_NAMESPACE_ID::int32 checkpoint_min_count_;
-  ::PROTOBUF_NAMESPACE_ID::int32 subscriber_max_count_;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr subscription_group_name_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr event_stream_id_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr named_consumer_strategy_;
+    int64_t start_from_;
+    int32_t message_timeout_milliseconds_;
+    bool resolve_link_tos_;
+    bool record_statistics_;
+    bool prefer_round_robin_;
+    int32_t live_buffer_size_;
+    int32_t read_batch_size_;
+    int32_t buffer_size_;
+    int32_t max_retry_count_;
+    int32_t checkpoint_after_time_;
+    int32_t checkpoint_max_count_;
+    int32_t checkpoint_min_count_;
+    int32_t subscriber_max_count_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_messages_2eproto;
 };
 // -------------------------------------------------------------------
 
-class UpdatePersistentSubscriptionCompleted :
+class UpdatePersistentSubscriptionCompleted final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:es.message.UpdatePersistentSubscriptionCompleted) */ {
  public:
-  UpdatePersistentSubscriptionCompleted();
-  virtual ~UpdatePersistentSubscriptionCompleted();
+  inline UpdatePersistentSubscriptionCompleted() : UpdatePersistentSubscriptionCompleted(nullptr) {}
+  ~UpdatePersistentSubscriptionCompleted() override;
+  explicit PROTOBUF_CONSTEXPR UpdatePersistentSubscriptionCompleted(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   UpdatePersistentSubscriptionCompleted(const UpdatePersistentSubscriptionCompleted& from);
   UpdatePersistentSubscriptionCompleted(UpdatePersistentSubscriptionCompleted&& from) noexcept
@@ -4969,8 +6134,13 @@ class UpdatePersistentSubscriptionCompleted :
     return *this;
   }
   inline UpdatePersistentSubscriptionCompleted& operator=(UpdatePersistentSubscriptionCompleted&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -4978,24 +6148,24 @@ class UpdatePersistentSubscriptionCompleted :
   }
 
   inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
-    return _internal_metadata_.unknown_fields();
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
   }
   inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
-    return _internal_metadata_.mutable_unknown_fields();
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const UpdatePersistentSubscriptionCompleted& default_instance() {
+    return *internal_default_instance();
   }
-  static const UpdatePersistentSubscriptionCompleted& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const UpdatePersistentSubscriptionCompleted* internal_default_instance() {
     return reinterpret_cast<const UpdatePersistentSubscriptionCompleted*>(
                &_UpdatePersistentSubscriptionCompleted_default_instance_);
@@ -5008,64 +6178,66 @@ class UpdatePersistentSubscriptionCompleted :
   }
   inline void Swap(UpdatePersistentSubscriptionCompleted* other) {
     if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(UpdatePersistentSubscriptionCompleted* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline UpdatePersistentSubscriptionCompleted* New() const final {
-    return CreateMaybeMessage<UpdatePersistentSubscriptionCompleted>(nullptr);
-  }
-
-  UpdatePersistentSubscriptionCompleted* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  UpdatePersistentSubscriptionCompleted* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<UpdatePersistentSubscriptionCompleted>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const UpdatePersistentSubscriptionCompleted& from);
-  void MergeFrom(const UpdatePersistentSubscriptionCompleted& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const UpdatePersistentSubscriptionCompleted& from) {
+    UpdatePersistentSubscriptionCompleted::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  #else
-  bool MergePartialFromCodedStream(
-      ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) final;
-  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-  void SerializeWithCachedSizes(
-      ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* InternalSerializeWithCachedSizesToArray(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
-
-  private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(UpdatePersistentSubscriptionCompleted* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "es.message.UpdatePersistentSubscriptionCompleted";
   }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
-  }
+  protected:
+  explicit UpdatePersistentSubscriptionCompleted(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_messages_2eproto);
-    return ::descriptor_table_messages_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -5098,7 +6270,7 @@ class UpdatePersistentSubscriptionCompleted :
       "Incorrect type passed to function UpdatePersistentSubscriptionResult_Name.");
     return UpdatePersistentSubscriptionCompleted_UpdatePersistentSubscriptionResult_Name(enum_t_value);
   }
-  static inline bool UpdatePersistentSubscriptionResult_Parse(const std::string& name,
+  static inline bool UpdatePersistentSubscriptionResult_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
       UpdatePersistentSubscriptionResult* value) {
     return UpdatePersistentSubscriptionCompleted_UpdatePersistentSubscriptionResult_Parse(name, value);
   }
@@ -5111,40 +6283,59 @@ class UpdatePersistentSubscriptionCompleted :
   };
   // optional string reason = 2;
   bool has_reason() const;
+  private:
+  bool _internal_has_reason() const;
+  public:
   void clear_reason();
   const std::string& reason() const;
-  void set_reason(const std::string& value);
-  void set_reason(std::string&& value);
-  void set_reason(const char* value);
-  void set_reason(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_reason(ArgT0&& arg0, ArgT... args);
   std::string* mutable_reason();
-  std::string* release_reason();
+  PROTOBUF_NODISCARD std::string* release_reason();
   void set_allocated_reason(std::string* reason);
+  private:
+  const std::string& _internal_reason() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_reason(const std::string& value);
+  std::string* _internal_mutable_reason();
+  public:
 
   // required .es.message.UpdatePersistentSubscriptionCompleted.UpdatePersistentSubscriptionResult result = 1;
   bool has_result() const;
+  private:
+  bool _internal_has_result() const;
+  public:
   void clear_result();
   ::es::message::UpdatePersistentSubscriptionCompleted_UpdatePersistentSubscriptionResult result() const;
   void set_result(::es::message::UpdatePersistentSubscriptionCompleted_UpdatePersistentSubscriptionResult value);
+  private:
+  ::es::message::UpdatePersistentSubscriptionCompleted_UpdatePersistentSubscriptionResult _internal_result() const;
+  void _internal_set_result(::es::message::UpdatePersistentSubscriptionCompleted_UpdatePersistentSubscriptionResult value);
+  public:
 
   // @@protoc_insertion_point(class_scope:es.message.UpdatePersistentSubscriptionCompleted)
  private:
   class _Internal;
 
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr reason_;
-  int result_;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr reason_;
+    int result_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_messages_2eproto;
 };
 // -------------------------------------------------------------------
 
-class CreatePersistentSubscriptionCompleted :
+class CreatePersistentSubscriptionCompleted final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:es.message.CreatePersistentSubscriptionCompleted) */ {
  public:
-  CreatePersistentSubscriptionCompleted();
-  virtual ~CreatePersistentSubscriptionCompleted();
+  inline CreatePersistentSubscriptionCompleted() : CreatePersistentSubscriptionCompleted(nullptr) {}
+  ~CreatePersistentSubscriptionCompleted() override;
+  explicit PROTOBUF_CONSTEXPR CreatePersistentSubscriptionCompleted(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   CreatePersistentSubscriptionCompleted(const CreatePersistentSubscriptionCompleted& from);
   CreatePersistentSubscriptionCompleted(CreatePersistentSubscriptionCompleted&& from) noexcept
@@ -5157,8 +6348,13 @@ class CreatePersistentSubscriptionCompleted :
     return *this;
   }
   inline CreatePersistentSubscriptionCompleted& operator=(CreatePersistentSubscriptionCompleted&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -5166,24 +6362,24 @@ class CreatePersistentSubscriptionCompleted :
   }
 
   inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
-    return _internal_metadata_.unknown_fields();
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
   }
   inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
-    return _internal_metadata_.mutable_unknown_fields();
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CreatePersistentSubscriptionCompleted& default_instance() {
+    return *internal_default_instance();
   }
-  static const CreatePersistentSubscriptionCompleted& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const CreatePersistentSubscriptionCompleted* internal_default_instance() {
     return reinterpret_cast<const CreatePersistentSubscriptionCompleted*>(
                &_CreatePersistentSubscriptionCompleted_default_instance_);
@@ -5196,64 +6392,66 @@ class CreatePersistentSubscriptionCompleted :
   }
   inline void Swap(CreatePersistentSubscriptionCompleted* other) {
     if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CreatePersistentSubscriptionCompleted* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline CreatePersistentSubscriptionCompleted* New() const final {
-    return CreateMaybeMessage<CreatePersistentSubscriptionCompleted>(nullptr);
-  }
-
-  CreatePersistentSubscriptionCompleted* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  CreatePersistentSubscriptionCompleted* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<CreatePersistentSubscriptionCompleted>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const CreatePersistentSubscriptionCompleted& from);
-  void MergeFrom(const CreatePersistentSubscriptionCompleted& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CreatePersistentSubscriptionCompleted& from) {
+    CreatePersistentSubscriptionCompleted::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  #else
-  bool MergePartialFromCodedStream(
-      ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) final;
-  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-  void SerializeWithCachedSizes(
-      ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* InternalSerializeWithCachedSizesToArray(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
-
-  private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(CreatePersistentSubscriptionCompleted* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "es.message.CreatePersistentSubscriptionCompleted";
   }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
-  }
+  protected:
+  explicit CreatePersistentSubscriptionCompleted(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_messages_2eproto);
-    return ::descriptor_table_messages_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -5286,7 +6484,7 @@ class CreatePersistentSubscriptionCompleted :
       "Incorrect type passed to function CreatePersistentSubscriptionResult_Name.");
     return CreatePersistentSubscriptionCompleted_CreatePersistentSubscriptionResult_Name(enum_t_value);
   }
-  static inline bool CreatePersistentSubscriptionResult_Parse(const std::string& name,
+  static inline bool CreatePersistentSubscriptionResult_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
       CreatePersistentSubscriptionResult* value) {
     return CreatePersistentSubscriptionCompleted_CreatePersistentSubscriptionResult_Parse(name, value);
   }
@@ -5299,40 +6497,59 @@ class CreatePersistentSubscriptionCompleted :
   };
   // optional string reason = 2;
   bool has_reason() const;
+  private:
+  bool _internal_has_reason() const;
+  public:
   void clear_reason();
   const std::string& reason() const;
-  void set_reason(const std::string& value);
-  void set_reason(std::string&& value);
-  void set_reason(const char* value);
-  void set_reason(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_reason(ArgT0&& arg0, ArgT... args);
   std::string* mutable_reason();
-  std::string* release_reason();
+  PROTOBUF_NODISCARD std::string* release_reason();
   void set_allocated_reason(std::string* reason);
+  private:
+  const std::string& _internal_reason() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_reason(const std::string& value);
+  std::string* _internal_mutable_reason();
+  public:
 
   // required .es.message.CreatePersistentSubscriptionCompleted.CreatePersistentSubscriptionResult result = 1;
   bool has_result() const;
+  private:
+  bool _internal_has_result() const;
+  public:
   void clear_result();
   ::es::message::CreatePersistentSubscriptionCompleted_CreatePersistentSubscriptionResult result() const;
   void set_result(::es::message::CreatePersistentSubscriptionCompleted_CreatePersistentSubscriptionResult value);
+  private:
+  ::es::message::CreatePersistentSubscriptionCompleted_CreatePersistentSubscriptionResult _internal_result() const;
+  void _internal_set_result(::es::message::CreatePersistentSubscriptionCompleted_CreatePersistentSubscriptionResult value);
+  public:
 
   // @@protoc_insertion_point(class_scope:es.message.CreatePersistentSubscriptionCompleted)
  private:
   class _Internal;
 
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr reason_;
-  int result_;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr reason_;
+    int result_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_messages_2eproto;
 };
 // -------------------------------------------------------------------
 
-class DeletePersistentSubscriptionCompleted :
+class DeletePersistentSubscriptionCompleted final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:es.message.DeletePersistentSubscriptionCompleted) */ {
  public:
-  DeletePersistentSubscriptionCompleted();
-  virtual ~DeletePersistentSubscriptionCompleted();
+  inline DeletePersistentSubscriptionCompleted() : DeletePersistentSubscriptionCompleted(nullptr) {}
+  ~DeletePersistentSubscriptionCompleted() override;
+  explicit PROTOBUF_CONSTEXPR DeletePersistentSubscriptionCompleted(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   DeletePersistentSubscriptionCompleted(const DeletePersistentSubscriptionCompleted& from);
   DeletePersistentSubscriptionCompleted(DeletePersistentSubscriptionCompleted&& from) noexcept
@@ -5345,8 +6562,13 @@ class DeletePersistentSubscriptionCompleted :
     return *this;
   }
   inline DeletePersistentSubscriptionCompleted& operator=(DeletePersistentSubscriptionCompleted&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -5354,24 +6576,24 @@ class DeletePersistentSubscriptionCompleted :
   }
 
   inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
-    return _internal_metadata_.unknown_fields();
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
   }
   inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
-    return _internal_metadata_.mutable_unknown_fields();
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const DeletePersistentSubscriptionCompleted& default_instance() {
+    return *internal_default_instance();
   }
-  static const DeletePersistentSubscriptionCompleted& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const DeletePersistentSubscriptionCompleted* internal_default_instance() {
     return reinterpret_cast<const DeletePersistentSubscriptionCompleted*>(
                &_DeletePersistentSubscriptionCompleted_default_instance_);
@@ -5384,64 +6606,66 @@ class DeletePersistentSubscriptionCompleted :
   }
   inline void Swap(DeletePersistentSubscriptionCompleted* other) {
     if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(DeletePersistentSubscriptionCompleted* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline DeletePersistentSubscriptionCompleted* New() const final {
-    return CreateMaybeMessage<DeletePersistentSubscriptionCompleted>(nullptr);
-  }
-
-  DeletePersistentSubscriptionCompleted* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  DeletePersistentSubscriptionCompleted* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<DeletePersistentSubscriptionCompleted>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const DeletePersistentSubscriptionCompleted& from);
-  void MergeFrom(const DeletePersistentSubscriptionCompleted& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const DeletePersistentSubscriptionCompleted& from) {
+    DeletePersistentSubscriptionCompleted::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  #else
-  bool MergePartialFromCodedStream(
-      ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) final;
-  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-  void SerializeWithCachedSizes(
-      ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* InternalSerializeWithCachedSizesToArray(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
-
-  private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(DeletePersistentSubscriptionCompleted* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "es.message.DeletePersistentSubscriptionCompleted";
   }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
-  }
+  protected:
+  explicit DeletePersistentSubscriptionCompleted(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_messages_2eproto);
-    return ::descriptor_table_messages_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -5474,7 +6698,7 @@ class DeletePersistentSubscriptionCompleted :
       "Incorrect type passed to function DeletePersistentSubscriptionResult_Name.");
     return DeletePersistentSubscriptionCompleted_DeletePersistentSubscriptionResult_Name(enum_t_value);
   }
-  static inline bool DeletePersistentSubscriptionResult_Parse(const std::string& name,
+  static inline bool DeletePersistentSubscriptionResult_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
       DeletePersistentSubscriptionResult* value) {
     return DeletePersistentSubscriptionCompleted_DeletePersistentSubscriptionResult_Parse(name, value);
   }
@@ -5487,40 +6711,59 @@ class DeletePersistentSubscriptionCompleted :
   };
   // optional string reason = 2;
   bool has_reason() const;
+  private:
+  bool _internal_has_reason() const;
+  public:
   void clear_reason();
   const std::string& reason() const;
-  void set_reason(const std::string& value);
-  void set_reason(std::string&& value);
-  void set_reason(const char* value);
-  void set_reason(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_reason(ArgT0&& arg0, ArgT... args);
   std::string* mutable_reason();
-  std::string* release_reason();
+  PROTOBUF_NODISCARD std::string* release_reason();
   void set_allocated_reason(std::string* reason);
+  private:
+  const std::string& _internal_reason() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_reason(const std::string& value);
+  std::string* _internal_mutable_reason();
+  public:
 
   // required .es.message.DeletePersistentSubscriptionCompleted.DeletePersistentSubscriptionResult result = 1;
   bool has_result() const;
+  private:
+  bool _internal_has_result() const;
+  public:
   void clear_result();
   ::es::message::DeletePersistentSubscriptionCompleted_DeletePersistentSubscriptionResult result() const;
   void set_result(::es::message::DeletePersistentSubscriptionCompleted_DeletePersistentSubscriptionResult value);
+  private:
+  ::es::message::DeletePersistentSubscriptionCompleted_DeletePersistentSubscriptionResult _internal_result() const;
+  void _internal_set_result(::es::message::DeletePersistentSubscriptionCompleted_DeletePersistentSubscriptionResult value);
+  public:
 
   // @@protoc_insertion_point(class_scope:es.message.DeletePersistentSubscriptionCompleted)
  private:
   class _Internal;
 
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr reason_;
-  int result_;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr reason_;
+    int result_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_messages_2eproto;
 };
 // -------------------------------------------------------------------
 
-class ConnectToPersistentSubscription :
+class ConnectToPersistentSubscription final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:es.message.ConnectToPersistentSubscription) */ {
  public:
-  ConnectToPersistentSubscription();
-  virtual ~ConnectToPersistentSubscription();
+  inline ConnectToPersistentSubscription() : ConnectToPersistentSubscription(nullptr) {}
+  ~ConnectToPersistentSubscription() override;
+  explicit PROTOBUF_CONSTEXPR ConnectToPersistentSubscription(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   ConnectToPersistentSubscription(const ConnectToPersistentSubscription& from);
   ConnectToPersistentSubscription(ConnectToPersistentSubscription&& from) noexcept
@@ -5533,8 +6776,13 @@ class ConnectToPersistentSubscription :
     return *this;
   }
   inline ConnectToPersistentSubscription& operator=(ConnectToPersistentSubscription&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -5542,24 +6790,24 @@ class ConnectToPersistentSubscription :
   }
 
   inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
-    return _internal_metadata_.unknown_fields();
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
   }
   inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
-    return _internal_metadata_.mutable_unknown_fields();
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ConnectToPersistentSubscription& default_instance() {
+    return *internal_default_instance();
   }
-  static const ConnectToPersistentSubscription& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const ConnectToPersistentSubscription* internal_default_instance() {
     return reinterpret_cast<const ConnectToPersistentSubscription*>(
                &_ConnectToPersistentSubscription_default_instance_);
@@ -5572,64 +6820,66 @@ class ConnectToPersistentSubscription :
   }
   inline void Swap(ConnectToPersistentSubscription* other) {
     if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ConnectToPersistentSubscription* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline ConnectToPersistentSubscription* New() const final {
-    return CreateMaybeMessage<ConnectToPersistentSubscription>(nullptr);
-  }
-
-  ConnectToPersistentSubscription* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  ConnectToPersistentSubscription* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<ConnectToPersistentSubscription>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const ConnectToPersistentSubscription& from);
-  void MergeFrom(const ConnectToPersistentSubscription& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ConnectToPersistentSubscription& from) {
+    ConnectToPersistentSubscription::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  #else
-  bool MergePartialFromCodedStream(
-      ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) final;
-  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-  void SerializeWithCachedSizes(
-      ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* InternalSerializeWithCachedSizesToArray(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
-
-  private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(ConnectToPersistentSubscription* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "es.message.ConnectToPersistentSubscription";
   }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
-  }
+  protected:
+  explicit ConnectToPersistentSubscription(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_messages_2eproto);
-    return ::descriptor_table_messages_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -5642,33 +6892,52 @@ class ConnectToPersistentSubscription :
   };
   // required string subscription_id = 1;
   bool has_subscription_id() const;
+  private:
+  bool _internal_has_subscription_id() const;
+  public:
   void clear_subscription_id();
   const std::string& subscription_id() const;
-  void set_subscription_id(const std::string& value);
-  void set_subscription_id(std::string&& value);
-  void set_subscription_id(const char* value);
-  void set_subscription_id(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_subscription_id(ArgT0&& arg0, ArgT... args);
   std::string* mutable_subscription_id();
-  std::string* release_subscription_id();
+  PROTOBUF_NODISCARD std::string* release_subscription_id();
   void set_allocated_subscription_id(std::string* subscription_id);
+  private:
+  const std::string& _internal_subscription_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_subscription_id(const std::string& value);
+  std::string* _internal_mutable_subscription_id();
+  public:
 
   // required string event_stream_id = 2;
   bool has_event_stream_id() const;
+  private:
+  bool _internal_has_event_stream_id() const;
+  public:
   void clear_event_stream_id();
   const std::string& event_stream_id() const;
-  void set_event_stream_id(const std::string& value);
-  void set_event_stream_id(std::string&& value);
-  void set_event_stream_id(const char* value);
-  void set_event_stream_id(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_event_stream_id(ArgT0&& arg0, ArgT... args);
   std::string* mutable_event_stream_id();
-  std::string* release_event_stream_id();
+  PROTOBUF_NODISCARD std::string* release_event_stream_id();
   void set_allocated_event_stream_id(std::string* event_stream_id);
+  private:
+  const std::string& _internal_event_stream_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_event_stream_id(const std::string& value);
+  std::string* _internal_mutable_event_stream_id();
+  public:
 
   // required int32 allowed_in_flight_messages = 3;
   bool has_allowed_in_flight_messages() const;
+  private:
+  bool _internal_has_allowed_in_flight_messages() const;
+  public:
   void clear_allowed_in_flight_messages();
-  ::PROTOBUF_NAMESPACE_ID::int32 allowed_in_flight_messages() const;
-  void set_allowed_in_flight_messages(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t allowed_in_flight_messages() const;
+  void set_allowed_in_flight_messages(int32_t value);
+  private:
+  int32_t _internal_allowed_in_flight_messages() const;
+  void _internal_set_allowed_in_flight_messages(int32_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:es.message.ConnectToPersistentSubscription)
  private:
@@ -5677,21 +6946,27 @@ class ConnectToPersistentSubscription :
   // helper for ByteSizeLong()
   size_t RequiredFieldsByteSizeFallback() const;
 
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr subscription_id_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr event_stream_id_;
-  ::PROTOBUF_NAMESPACE_ID::int32 allowed_in_flight_messages_;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr subscription_id_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr event_stream_id_;
+    int32_t allowed_in_flight_messages_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_messages_2eproto;
 };
 // -------------------------------------------------------------------
 
-class PersistentSubscriptionAckEvents :
+class PersistentSubscriptionAckEvents final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:es.message.PersistentSubscriptionAckEvents) */ {
  public:
-  PersistentSubscriptionAckEvents();
-  virtual ~PersistentSubscriptionAckEvents();
+  inline PersistentSubscriptionAckEvents() : PersistentSubscriptionAckEvents(nullptr) {}
+  ~PersistentSubscriptionAckEvents() override;
+  explicit PROTOBUF_CONSTEXPR PersistentSubscriptionAckEvents(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   PersistentSubscriptionAckEvents(const PersistentSubscriptionAckEvents& from);
   PersistentSubscriptionAckEvents(PersistentSubscriptionAckEvents&& from) noexcept
@@ -5704,8 +6979,13 @@ class PersistentSubscriptionAckEvents :
     return *this;
   }
   inline PersistentSubscriptionAckEvents& operator=(PersistentSubscriptionAckEvents&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -5713,24 +6993,24 @@ class PersistentSubscriptionAckEvents :
   }
 
   inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
-    return _internal_metadata_.unknown_fields();
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
   }
   inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
-    return _internal_metadata_.mutable_unknown_fields();
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PersistentSubscriptionAckEvents& default_instance() {
+    return *internal_default_instance();
   }
-  static const PersistentSubscriptionAckEvents& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const PersistentSubscriptionAckEvents* internal_default_instance() {
     return reinterpret_cast<const PersistentSubscriptionAckEvents*>(
                &_PersistentSubscriptionAckEvents_default_instance_);
@@ -5743,64 +7023,66 @@ class PersistentSubscriptionAckEvents :
   }
   inline void Swap(PersistentSubscriptionAckEvents* other) {
     if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PersistentSubscriptionAckEvents* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline PersistentSubscriptionAckEvents* New() const final {
-    return CreateMaybeMessage<PersistentSubscriptionAckEvents>(nullptr);
-  }
-
-  PersistentSubscriptionAckEvents* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  PersistentSubscriptionAckEvents* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<PersistentSubscriptionAckEvents>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const PersistentSubscriptionAckEvents& from);
-  void MergeFrom(const PersistentSubscriptionAckEvents& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PersistentSubscriptionAckEvents& from) {
+    PersistentSubscriptionAckEvents::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  #else
-  bool MergePartialFromCodedStream(
-      ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) final;
-  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-  void SerializeWithCachedSizes(
-      ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* InternalSerializeWithCachedSizesToArray(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
-
-  private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(PersistentSubscriptionAckEvents* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "es.message.PersistentSubscriptionAckEvents";
   }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
-  }
+  protected:
+  explicit PersistentSubscriptionAckEvents(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_messages_2eproto);
-    return ::descriptor_table_messages_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -5812,6 +7094,9 @@ class PersistentSubscriptionAckEvents :
   };
   // repeated bytes processed_event_ids = 2;
   int processed_event_ids_size() const;
+  private:
+  int _internal_processed_event_ids_size() const;
+  public:
   void clear_processed_event_ids();
   const std::string& processed_event_ids(int index) const;
   std::string* mutable_processed_event_ids(int index);
@@ -5826,37 +7111,53 @@ class PersistentSubscriptionAckEvents :
   void add_processed_event_ids(const void* value, size_t size);
   const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& processed_event_ids() const;
   ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_processed_event_ids();
+  private:
+  const std::string& _internal_processed_event_ids(int index) const;
+  std::string* _internal_add_processed_event_ids();
+  public:
 
   // required string subscription_id = 1;
   bool has_subscription_id() const;
+  private:
+  bool _internal_has_subscription_id() const;
+  public:
   void clear_subscription_id();
   const std::string& subscription_id() const;
-  void set_subscription_id(const std::string& value);
-  void set_subscription_id(std::string&& value);
-  void set_subscription_id(const char* value);
-  void set_subscription_id(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_subscription_id(ArgT0&& arg0, ArgT... args);
   std::string* mutable_subscription_id();
-  std::string* release_subscription_id();
+  PROTOBUF_NODISCARD std::string* release_subscription_id();
   void set_allocated_subscription_id(std::string* subscription_id);
+  private:
+  const std::string& _internal_subscription_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_subscription_id(const std::string& value);
+  std::string* _internal_mutable_subscription_id();
+  public:
 
   // @@protoc_insertion_point(class_scope:es.message.PersistentSubscriptionAckEvents)
  private:
   class _Internal;
 
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> processed_event_ids_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr subscription_id_;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> processed_event_ids_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr subscription_id_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_messages_2eproto;
 };
 // -------------------------------------------------------------------
 
-class PersistentSubscriptionNakEvents :
+class PersistentSubscriptionNakEvents final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:es.message.PersistentSubscriptionNakEvents) */ {
  public:
-  PersistentSubscriptionNakEvents();
-  virtual ~PersistentSubscriptionNakEvents();
+  inline PersistentSubscriptionNakEvents() : PersistentSubscriptionNakEvents(nullptr) {}
+  ~PersistentSubscriptionNakEvents() override;
+  explicit PROTOBUF_CONSTEXPR PersistentSubscriptionNakEvents(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   PersistentSubscriptionNakEvents(const PersistentSubscriptionNakEvents& from);
   PersistentSubscriptionNakEvents(PersistentSubscriptionNakEvents&& from) noexcept
@@ -5869,8 +7170,13 @@ class PersistentSubscriptionNakEvents :
     return *this;
   }
   inline PersistentSubscriptionNakEvents& operator=(PersistentSubscriptionNakEvents&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -5878,24 +7184,24 @@ class PersistentSubscriptionNakEvents :
   }
 
   inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
-    return _internal_metadata_.unknown_fields();
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
   }
   inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
-    return _internal_metadata_.mutable_unknown_fields();
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PersistentSubscriptionNakEvents& default_instance() {
+    return *internal_default_instance();
   }
-  static const PersistentSubscriptionNakEvents& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const PersistentSubscriptionNakEvents* internal_default_instance() {
     return reinterpret_cast<const PersistentSubscriptionNakEvents*>(
                &_PersistentSubscriptionNakEvents_default_instance_);
@@ -5908,64 +7214,66 @@ class PersistentSubscriptionNakEvents :
   }
   inline void Swap(PersistentSubscriptionNakEvents* other) {
     if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PersistentSubscriptionNakEvents* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline PersistentSubscriptionNakEvents* New() const final {
-    return CreateMaybeMessage<PersistentSubscriptionNakEvents>(nullptr);
-  }
-
-  PersistentSubscriptionNakEvents* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  PersistentSubscriptionNakEvents* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<PersistentSubscriptionNakEvents>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const PersistentSubscriptionNakEvents& from);
-  void MergeFrom(const PersistentSubscriptionNakEvents& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PersistentSubscriptionNakEvents& from) {
+    PersistentSubscriptionNakEvents::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  #else
-  bool MergePartialFromCodedStream(
-      ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) final;
-  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-  void SerializeWithCachedSizes(
-      ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* InternalSerializeWithCachedSizesToArray(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
-
-  private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(PersistentSubscriptionNakEvents* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "es.message.PersistentSubscriptionNakEvents";
   }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
-  }
+  protected:
+  explicit PersistentSubscriptionNakEvents(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_messages_2eproto);
-    return ::descriptor_table_messages_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -6000,7 +7308,7 @@ class PersistentSubscriptionNakEvents :
       "Incorrect type passed to function NakAction_Name.");
     return PersistentSubscriptionNakEvents_NakAction_Name(enum_t_value);
   }
-  static inline bool NakAction_Parse(const std::string& name,
+  static inline bool NakAction_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
       NakAction* value) {
     return PersistentSubscriptionNakEvents_NakAction_Parse(name, value);
   }
@@ -6015,6 +7323,9 @@ class PersistentSubscriptionNakEvents :
   };
   // repeated bytes processed_event_ids = 2;
   int processed_event_ids_size() const;
+  private:
+  int _internal_processed_event_ids_size() const;
+  public:
   void clear_processed_event_ids();
   const std::string& processed_event_ids(int index) const;
   std::string* mutable_processed_event_ids(int index);
@@ -6029,36 +7340,59 @@ class PersistentSubscriptionNakEvents :
   void add_processed_event_ids(const void* value, size_t size);
   const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& processed_event_ids() const;
   ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_processed_event_ids();
+  private:
+  const std::string& _internal_processed_event_ids(int index) const;
+  std::string* _internal_add_processed_event_ids();
+  public:
 
   // required string subscription_id = 1;
   bool has_subscription_id() const;
+  private:
+  bool _internal_has_subscription_id() const;
+  public:
   void clear_subscription_id();
   const std::string& subscription_id() const;
-  void set_subscription_id(const std::string& value);
-  void set_subscription_id(std::string&& value);
-  void set_subscription_id(const char* value);
-  void set_subscription_id(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_subscription_id(ArgT0&& arg0, ArgT... args);
   std::string* mutable_subscription_id();
-  std::string* release_subscription_id();
+  PROTOBUF_NODISCARD std::string* release_subscription_id();
   void set_allocated_subscription_id(std::string* subscription_id);
+  private:
+  const std::string& _internal_subscription_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_subscription_id(const std::string& value);
+  std::string* _internal_mutable_subscription_id();
+  public:
 
   // optional string message = 3;
   bool has_message() const;
+  private:
+  bool _internal_has_message() const;
+  public:
   void clear_message();
   const std::string& message() const;
-  void set_message(const std::string& value);
-  void set_message(std::string&& value);
-  void set_message(const char* value);
-  void set_message(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_message(ArgT0&& arg0, ArgT... args);
   std::string* mutable_message();
-  std::string* release_message();
+  PROTOBUF_NODISCARD std::string* release_message();
   void set_allocated_message(std::string* message);
+  private:
+  const std::string& _internal_message() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_message(const std::string& value);
+  std::string* _internal_mutable_message();
+  public:
 
   // required .es.message.PersistentSubscriptionNakEvents.NakAction action = 4;
   bool has_action() const;
+  private:
+  bool _internal_has_action() const;
+  public:
   void clear_action();
   ::es::message::PersistentSubscriptionNakEvents_NakAction action() const;
   void set_action(::es::message::PersistentSubscriptionNakEvents_NakAction value);
+  private:
+  ::es::message::PersistentSubscriptionNakEvents_NakAction _internal_action() const;
+  void _internal_set_action(::es::message::PersistentSubscriptionNakEvents_NakAction value);
+  public:
 
   // @@protoc_insertion_point(class_scope:es.message.PersistentSubscriptionNakEvents)
  private:
@@ -6067,22 +7401,28 @@ class PersistentSubscriptionNakEvents :
   // helper for ByteSizeLong()
   size_t RequiredFieldsByteSizeFallback() const;
 
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> processed_event_ids_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr subscription_id_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr message_;
-  int action_;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> processed_event_ids_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr subscription_id_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr message_;
+    int action_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_messages_2eproto;
 };
 // -------------------------------------------------------------------
 
-class PersistentSubscriptionConfirmation :
+class PersistentSubscriptionConfirmation final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:es.message.PersistentSubscriptionConfirmation) */ {
  public:
-  PersistentSubscriptionConfirmation();
-  virtual ~PersistentSubscriptionConfirmation();
+  inline PersistentSubscriptionConfirmation() : PersistentSubscriptionConfirmation(nullptr) {}
+  ~PersistentSubscriptionConfirmation() override;
+  explicit PROTOBUF_CONSTEXPR PersistentSubscriptionConfirmation(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   PersistentSubscriptionConfirmation(const PersistentSubscriptionConfirmation& from);
   PersistentSubscriptionConfirmation(PersistentSubscriptionConfirmation&& from) noexcept
@@ -6095,8 +7435,13 @@ class PersistentSubscriptionConfirmation :
     return *this;
   }
   inline PersistentSubscriptionConfirmation& operator=(PersistentSubscriptionConfirmation&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -6104,24 +7449,24 @@ class PersistentSubscriptionConfirmation :
   }
 
   inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
-    return _internal_metadata_.unknown_fields();
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
   }
   inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
-    return _internal_metadata_.mutable_unknown_fields();
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PersistentSubscriptionConfirmation& default_instance() {
+    return *internal_default_instance();
   }
-  static const PersistentSubscriptionConfirmation& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const PersistentSubscriptionConfirmation* internal_default_instance() {
     return reinterpret_cast<const PersistentSubscriptionConfirmation*>(
                &_PersistentSubscriptionConfirmation_default_instance_);
@@ -6134,64 +7479,66 @@ class PersistentSubscriptionConfirmation :
   }
   inline void Swap(PersistentSubscriptionConfirmation* other) {
     if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PersistentSubscriptionConfirmation* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline PersistentSubscriptionConfirmation* New() const final {
-    return CreateMaybeMessage<PersistentSubscriptionConfirmation>(nullptr);
-  }
-
-  PersistentSubscriptionConfirmation* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  PersistentSubscriptionConfirmation* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<PersistentSubscriptionConfirmation>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const PersistentSubscriptionConfirmation& from);
-  void MergeFrom(const PersistentSubscriptionConfirmation& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PersistentSubscriptionConfirmation& from) {
+    PersistentSubscriptionConfirmation::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  #else
-  bool MergePartialFromCodedStream(
-      ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) final;
-  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-  void SerializeWithCachedSizes(
-      ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* InternalSerializeWithCachedSizesToArray(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
-
-  private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(PersistentSubscriptionConfirmation* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "es.message.PersistentSubscriptionConfirmation";
   }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
-  }
+  protected:
+  explicit PersistentSubscriptionConfirmation(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_messages_2eproto);
-    return ::descriptor_table_messages_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -6204,27 +7551,47 @@ class PersistentSubscriptionConfirmation :
   };
   // required string subscription_id = 2;
   bool has_subscription_id() const;
+  private:
+  bool _internal_has_subscription_id() const;
+  public:
   void clear_subscription_id();
   const std::string& subscription_id() const;
-  void set_subscription_id(const std::string& value);
-  void set_subscription_id(std::string&& value);
-  void set_subscription_id(const char* value);
-  void set_subscription_id(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_subscription_id(ArgT0&& arg0, ArgT... args);
   std::string* mutable_subscription_id();
-  std::string* release_subscription_id();
+  PROTOBUF_NODISCARD std::string* release_subscription_id();
   void set_allocated_subscription_id(std::string* subscription_id);
+  private:
+  const std::string& _internal_subscription_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_subscription_id(const std::string& value);
+  std::string* _internal_mutable_subscription_id();
+  public:
 
   // required int64 last_commit_position = 1;
   bool has_last_commit_position() const;
+  private:
+  bool _internal_has_last_commit_position() const;
+  public:
   void clear_last_commit_position();
-  ::PROTOBUF_NAMESPACE_ID::int64 last_commit_position() const;
-  void set_last_commit_position(::PROTOBUF_NAMESPACE_ID::int64 value);
+  int64_t last_commit_position() const;
+  void set_last_commit_position(int64_t value);
+  private:
+  int64_t _internal_last_commit_position() const;
+  void _internal_set_last_commit_position(int64_t value);
+  public:
 
   // optional int64 last_event_number = 3;
   bool has_last_event_number() const;
+  private:
+  bool _internal_has_last_event_number() const;
+  public:
   void clear_last_event_number();
-  ::PROTOBUF_NAMESPACE_ID::int64 last_event_number() const;
-  void set_last_event_number(::PROTOBUF_NAMESPACE_ID::int64 value);
+  int64_t last_event_number() const;
+  void set_last_event_number(int64_t value);
+  private:
+  int64_t _internal_last_event_number() const;
+  void _internal_set_last_event_number(int64_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:es.message.PersistentSubscriptionConfirmation)
  private:
@@ -6233,21 +7600,27 @@ class PersistentSubscriptionConfirmation :
   // helper for ByteSizeLong()
   size_t RequiredFieldsByteSizeFallback() const;
 
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr subscription_id_;
-  ::PROTOBUF_NAMESPACE_ID::int64 last_commit_position_;
-  ::PROTOBUF_NAMESPACE_ID::int64 last_event_number_;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr subscription_id_;
+    int64_t last_commit_position_;
+    int64_t last_event_number_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_messages_2eproto;
 };
 // -------------------------------------------------------------------
 
-class PersistentSubscriptionStreamEventAppeared :
+class PersistentSubscriptionStreamEventAppeared final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:es.message.PersistentSubscriptionStreamEventAppeared) */ {
  public:
-  PersistentSubscriptionStreamEventAppeared();
-  virtual ~PersistentSubscriptionStreamEventAppeared();
+  inline PersistentSubscriptionStreamEventAppeared() : PersistentSubscriptionStreamEventAppeared(nullptr) {}
+  ~PersistentSubscriptionStreamEventAppeared() override;
+  explicit PROTOBUF_CONSTEXPR PersistentSubscriptionStreamEventAppeared(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   PersistentSubscriptionStreamEventAppeared(const PersistentSubscriptionStreamEventAppeared& from);
   PersistentSubscriptionStreamEventAppeared(PersistentSubscriptionStreamEventAppeared&& from) noexcept
@@ -6260,8 +7633,13 @@ class PersistentSubscriptionStreamEventAppeared :
     return *this;
   }
   inline PersistentSubscriptionStreamEventAppeared& operator=(PersistentSubscriptionStreamEventAppeared&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -6269,24 +7647,24 @@ class PersistentSubscriptionStreamEventAppeared :
   }
 
   inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
-    return _internal_metadata_.unknown_fields();
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
   }
   inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
-    return _internal_metadata_.mutable_unknown_fields();
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PersistentSubscriptionStreamEventAppeared& default_instance() {
+    return *internal_default_instance();
   }
-  static const PersistentSubscriptionStreamEventAppeared& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const PersistentSubscriptionStreamEventAppeared* internal_default_instance() {
     return reinterpret_cast<const PersistentSubscriptionStreamEventAppeared*>(
                &_PersistentSubscriptionStreamEventAppeared_default_instance_);
@@ -6299,64 +7677,66 @@ class PersistentSubscriptionStreamEventAppeared :
   }
   inline void Swap(PersistentSubscriptionStreamEventAppeared* other) {
     if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PersistentSubscriptionStreamEventAppeared* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline PersistentSubscriptionStreamEventAppeared* New() const final {
-    return CreateMaybeMessage<PersistentSubscriptionStreamEventAppeared>(nullptr);
-  }
-
-  PersistentSubscriptionStreamEventAppeared* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  PersistentSubscriptionStreamEventAppeared* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<PersistentSubscriptionStreamEventAppeared>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const PersistentSubscriptionStreamEventAppeared& from);
-  void MergeFrom(const PersistentSubscriptionStreamEventAppeared& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PersistentSubscriptionStreamEventAppeared& from) {
+    PersistentSubscriptionStreamEventAppeared::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  #else
-  bool MergePartialFromCodedStream(
-      ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) final;
-  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-  void SerializeWithCachedSizes(
-      ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* InternalSerializeWithCachedSizesToArray(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
-
-  private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(PersistentSubscriptionStreamEventAppeared* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "es.message.PersistentSubscriptionStreamEventAppeared";
   }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
-  }
+  protected:
+  explicit PersistentSubscriptionStreamEventAppeared(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_messages_2eproto);
-    return ::descriptor_table_messages_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -6368,36 +7748,59 @@ class PersistentSubscriptionStreamEventAppeared :
   };
   // required .es.message.ResolvedIndexedEvent event = 1;
   bool has_event() const;
+  private:
+  bool _internal_has_event() const;
+  public:
   void clear_event();
   const ::es::message::ResolvedIndexedEvent& event() const;
-  ::es::message::ResolvedIndexedEvent* release_event();
+  PROTOBUF_NODISCARD ::es::message::ResolvedIndexedEvent* release_event();
   ::es::message::ResolvedIndexedEvent* mutable_event();
   void set_allocated_event(::es::message::ResolvedIndexedEvent* event);
+  private:
+  const ::es::message::ResolvedIndexedEvent& _internal_event() const;
+  ::es::message::ResolvedIndexedEvent* _internal_mutable_event();
+  public:
+  void unsafe_arena_set_allocated_event(
+      ::es::message::ResolvedIndexedEvent* event);
+  ::es::message::ResolvedIndexedEvent* unsafe_arena_release_event();
 
   // optional int32 retryCount = 2;
   bool has_retrycount() const;
+  private:
+  bool _internal_has_retrycount() const;
+  public:
   void clear_retrycount();
-  ::PROTOBUF_NAMESPACE_ID::int32 retrycount() const;
-  void set_retrycount(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t retrycount() const;
+  void set_retrycount(int32_t value);
+  private:
+  int32_t _internal_retrycount() const;
+  void _internal_set_retrycount(int32_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:es.message.PersistentSubscriptionStreamEventAppeared)
  private:
   class _Internal;
 
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  ::es::message::ResolvedIndexedEvent* event_;
-  ::PROTOBUF_NAMESPACE_ID::int32 retrycount_;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::es::message::ResolvedIndexedEvent* event_;
+    int32_t retrycount_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_messages_2eproto;
 };
 // -------------------------------------------------------------------
 
-class SubscribeToStream :
+class SubscribeToStream final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:es.message.SubscribeToStream) */ {
  public:
-  SubscribeToStream();
-  virtual ~SubscribeToStream();
+  inline SubscribeToStream() : SubscribeToStream(nullptr) {}
+  ~SubscribeToStream() override;
+  explicit PROTOBUF_CONSTEXPR SubscribeToStream(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   SubscribeToStream(const SubscribeToStream& from);
   SubscribeToStream(SubscribeToStream&& from) noexcept
@@ -6410,8 +7813,13 @@ class SubscribeToStream :
     return *this;
   }
   inline SubscribeToStream& operator=(SubscribeToStream&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -6419,24 +7827,24 @@ class SubscribeToStream :
   }
 
   inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
-    return _internal_metadata_.unknown_fields();
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
   }
   inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
-    return _internal_metadata_.mutable_unknown_fields();
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SubscribeToStream& default_instance() {
+    return *internal_default_instance();
   }
-  static const SubscribeToStream& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const SubscribeToStream* internal_default_instance() {
     return reinterpret_cast<const SubscribeToStream*>(
                &_SubscribeToStream_default_instance_);
@@ -6449,64 +7857,66 @@ class SubscribeToStream :
   }
   inline void Swap(SubscribeToStream* other) {
     if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SubscribeToStream* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline SubscribeToStream* New() const final {
-    return CreateMaybeMessage<SubscribeToStream>(nullptr);
-  }
-
-  SubscribeToStream* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  SubscribeToStream* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<SubscribeToStream>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const SubscribeToStream& from);
-  void MergeFrom(const SubscribeToStream& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SubscribeToStream& from) {
+    SubscribeToStream::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  #else
-  bool MergePartialFromCodedStream(
-      ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) final;
-  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-  void SerializeWithCachedSizes(
-      ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* InternalSerializeWithCachedSizesToArray(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
-
-  private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(SubscribeToStream* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "es.message.SubscribeToStream";
   }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
-  }
+  protected:
+  explicit SubscribeToStream(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_messages_2eproto);
-    return ::descriptor_table_messages_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -6518,21 +7928,34 @@ class SubscribeToStream :
   };
   // required string event_stream_id = 1;
   bool has_event_stream_id() const;
+  private:
+  bool _internal_has_event_stream_id() const;
+  public:
   void clear_event_stream_id();
   const std::string& event_stream_id() const;
-  void set_event_stream_id(const std::string& value);
-  void set_event_stream_id(std::string&& value);
-  void set_event_stream_id(const char* value);
-  void set_event_stream_id(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_event_stream_id(ArgT0&& arg0, ArgT... args);
   std::string* mutable_event_stream_id();
-  std::string* release_event_stream_id();
+  PROTOBUF_NODISCARD std::string* release_event_stream_id();
   void set_allocated_event_stream_id(std::string* event_stream_id);
+  private:
+  const std::string& _internal_event_stream_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_event_stream_id(const std::string& value);
+  std::string* _internal_mutable_event_stream_id();
+  public:
 
   // required bool resolve_link_tos = 2;
   bool has_resolve_link_tos() const;
+  private:
+  bool _internal_has_resolve_link_tos() const;
+  public:
   void clear_resolve_link_tos();
   bool resolve_link_tos() const;
   void set_resolve_link_tos(bool value);
+  private:
+  bool _internal_resolve_link_tos() const;
+  void _internal_set_resolve_link_tos(bool value);
+  public:
 
   // @@protoc_insertion_point(class_scope:es.message.SubscribeToStream)
  private:
@@ -6541,20 +7964,26 @@ class SubscribeToStream :
   // helper for ByteSizeLong()
   size_t RequiredFieldsByteSizeFallback() const;
 
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr event_stream_id_;
-  bool resolve_link_tos_;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr event_stream_id_;
+    bool resolve_link_tos_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_messages_2eproto;
 };
 // -------------------------------------------------------------------
 
-class SubscriptionConfirmation :
+class SubscriptionConfirmation final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:es.message.SubscriptionConfirmation) */ {
  public:
-  SubscriptionConfirmation();
-  virtual ~SubscriptionConfirmation();
+  inline SubscriptionConfirmation() : SubscriptionConfirmation(nullptr) {}
+  ~SubscriptionConfirmation() override;
+  explicit PROTOBUF_CONSTEXPR SubscriptionConfirmation(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   SubscriptionConfirmation(const SubscriptionConfirmation& from);
   SubscriptionConfirmation(SubscriptionConfirmation&& from) noexcept
@@ -6567,8 +7996,13 @@ class SubscriptionConfirmation :
     return *this;
   }
   inline SubscriptionConfirmation& operator=(SubscriptionConfirmation&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -6576,24 +8010,24 @@ class SubscriptionConfirmation :
   }
 
   inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
-    return _internal_metadata_.unknown_fields();
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
   }
   inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
-    return _internal_metadata_.mutable_unknown_fields();
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SubscriptionConfirmation& default_instance() {
+    return *internal_default_instance();
   }
-  static const SubscriptionConfirmation& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const SubscriptionConfirmation* internal_default_instance() {
     return reinterpret_cast<const SubscriptionConfirmation*>(
                &_SubscriptionConfirmation_default_instance_);
@@ -6606,64 +8040,66 @@ class SubscriptionConfirmation :
   }
   inline void Swap(SubscriptionConfirmation* other) {
     if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SubscriptionConfirmation* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline SubscriptionConfirmation* New() const final {
-    return CreateMaybeMessage<SubscriptionConfirmation>(nullptr);
-  }
-
-  SubscriptionConfirmation* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  SubscriptionConfirmation* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<SubscriptionConfirmation>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const SubscriptionConfirmation& from);
-  void MergeFrom(const SubscriptionConfirmation& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SubscriptionConfirmation& from) {
+    SubscriptionConfirmation::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  #else
-  bool MergePartialFromCodedStream(
-      ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) final;
-  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-  void SerializeWithCachedSizes(
-      ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* InternalSerializeWithCachedSizesToArray(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
-
-  private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(SubscriptionConfirmation* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "es.message.SubscriptionConfirmation";
   }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
-  }
+  protected:
+  explicit SubscriptionConfirmation(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_messages_2eproto);
-    return ::descriptor_table_messages_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -6675,34 +8111,54 @@ class SubscriptionConfirmation :
   };
   // required int64 last_commit_position = 1;
   bool has_last_commit_position() const;
+  private:
+  bool _internal_has_last_commit_position() const;
+  public:
   void clear_last_commit_position();
-  ::PROTOBUF_NAMESPACE_ID::int64 last_commit_position() const;
-  void set_last_commit_position(::PROTOBUF_NAMESPACE_ID::int64 value);
+  int64_t last_commit_position() const;
+  void set_last_commit_position(int64_t value);
+  private:
+  int64_t _internal_last_commit_position() const;
+  void _internal_set_last_commit_position(int64_t value);
+  public:
 
   // optional int64 last_event_number = 2;
   bool has_last_event_number() const;
+  private:
+  bool _internal_has_last_event_number() const;
+  public:
   void clear_last_event_number();
-  ::PROTOBUF_NAMESPACE_ID::int64 last_event_number() const;
-  void set_last_event_number(::PROTOBUF_NAMESPACE_ID::int64 value);
+  int64_t last_event_number() const;
+  void set_last_event_number(int64_t value);
+  private:
+  int64_t _internal_last_event_number() const;
+  void _internal_set_last_event_number(int64_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:es.message.SubscriptionConfirmation)
  private:
   class _Internal;
 
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  ::PROTOBUF_NAMESPACE_ID::int64 last_commit_position_;
-  ::PROTOBUF_NAMESPACE_ID::int64 last_event_number_;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    int64_t last_commit_position_;
+    int64_t last_event_number_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_messages_2eproto;
 };
 // -------------------------------------------------------------------
 
-class StreamEventAppeared :
+class StreamEventAppeared final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:es.message.StreamEventAppeared) */ {
  public:
-  StreamEventAppeared();
-  virtual ~StreamEventAppeared();
+  inline StreamEventAppeared() : StreamEventAppeared(nullptr) {}
+  ~StreamEventAppeared() override;
+  explicit PROTOBUF_CONSTEXPR StreamEventAppeared(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   StreamEventAppeared(const StreamEventAppeared& from);
   StreamEventAppeared(StreamEventAppeared&& from) noexcept
@@ -6715,8 +8171,13 @@ class StreamEventAppeared :
     return *this;
   }
   inline StreamEventAppeared& operator=(StreamEventAppeared&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -6724,24 +8185,24 @@ class StreamEventAppeared :
   }
 
   inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
-    return _internal_metadata_.unknown_fields();
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
   }
   inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
-    return _internal_metadata_.mutable_unknown_fields();
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const StreamEventAppeared& default_instance() {
+    return *internal_default_instance();
   }
-  static const StreamEventAppeared& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const StreamEventAppeared* internal_default_instance() {
     return reinterpret_cast<const StreamEventAppeared*>(
                &_StreamEventAppeared_default_instance_);
@@ -6754,64 +8215,66 @@ class StreamEventAppeared :
   }
   inline void Swap(StreamEventAppeared* other) {
     if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(StreamEventAppeared* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline StreamEventAppeared* New() const final {
-    return CreateMaybeMessage<StreamEventAppeared>(nullptr);
-  }
-
-  StreamEventAppeared* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  StreamEventAppeared* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<StreamEventAppeared>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const StreamEventAppeared& from);
-  void MergeFrom(const StreamEventAppeared& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const StreamEventAppeared& from) {
+    StreamEventAppeared::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  #else
-  bool MergePartialFromCodedStream(
-      ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) final;
-  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-  void SerializeWithCachedSizes(
-      ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* InternalSerializeWithCachedSizesToArray(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
-
-  private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(StreamEventAppeared* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "es.message.StreamEventAppeared";
   }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
-  }
+  protected:
+  explicit StreamEventAppeared(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_messages_2eproto);
-    return ::descriptor_table_messages_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -6822,29 +8285,44 @@ class StreamEventAppeared :
   };
   // required .es.message.ResolvedEvent event = 1;
   bool has_event() const;
+  private:
+  bool _internal_has_event() const;
+  public:
   void clear_event();
   const ::es::message::ResolvedEvent& event() const;
-  ::es::message::ResolvedEvent* release_event();
+  PROTOBUF_NODISCARD ::es::message::ResolvedEvent* release_event();
   ::es::message::ResolvedEvent* mutable_event();
   void set_allocated_event(::es::message::ResolvedEvent* event);
+  private:
+  const ::es::message::ResolvedEvent& _internal_event() const;
+  ::es::message::ResolvedEvent* _internal_mutable_event();
+  public:
+  void unsafe_arena_set_allocated_event(
+      ::es::message::ResolvedEvent* event);
+  ::es::message::ResolvedEvent* unsafe_arena_release_event();
 
   // @@protoc_insertion_point(class_scope:es.message.StreamEventAppeared)
  private:
   class _Internal;
 
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  ::es::message::ResolvedEvent* event_;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::es::message::ResolvedEvent* event_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_messages_2eproto;
 };
 // -------------------------------------------------------------------
 
-class UnsubscribeFromStream :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:es.message.UnsubscribeFromStream) */ {
+class UnsubscribeFromStream final :
+    public ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase /* @@protoc_insertion_point(class_definition:es.message.UnsubscribeFromStream) */ {
  public:
-  UnsubscribeFromStream();
-  virtual ~UnsubscribeFromStream();
+  inline UnsubscribeFromStream() : UnsubscribeFromStream(nullptr) {}
+  explicit PROTOBUF_CONSTEXPR UnsubscribeFromStream(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   UnsubscribeFromStream(const UnsubscribeFromStream& from);
   UnsubscribeFromStream(UnsubscribeFromStream&& from) noexcept
@@ -6857,8 +8335,13 @@ class UnsubscribeFromStream :
     return *this;
   }
   inline UnsubscribeFromStream& operator=(UnsubscribeFromStream&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -6866,24 +8349,24 @@ class UnsubscribeFromStream :
   }
 
   inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
-    return _internal_metadata_.unknown_fields();
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
   }
   inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
-    return _internal_metadata_.mutable_unknown_fields();
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const UnsubscribeFromStream& default_instance() {
+    return *internal_default_instance();
   }
-  static const UnsubscribeFromStream& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const UnsubscribeFromStream* internal_default_instance() {
     return reinterpret_cast<const UnsubscribeFromStream*>(
                &_UnsubscribeFromStream_default_instance_);
@@ -6896,64 +8379,52 @@ class UnsubscribeFromStream :
   }
   inline void Swap(UnsubscribeFromStream* other) {
     if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(UnsubscribeFromStream* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline UnsubscribeFromStream* New() const final {
-    return CreateMaybeMessage<UnsubscribeFromStream>(nullptr);
-  }
-
-  UnsubscribeFromStream* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  UnsubscribeFromStream* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<UnsubscribeFromStream>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void CopyFrom(const UnsubscribeFromStream& from);
-  void MergeFrom(const UnsubscribeFromStream& from);
-  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
-  bool IsInitialized() const final;
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyFrom;
+  inline void CopyFrom(const UnsubscribeFromStream& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl(*this, from);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeFrom;
+  void MergeFrom(const UnsubscribeFromStream& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl(*this, from);
+  }
+  public:
 
-  size_t ByteSizeLong() const final;
-  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  #else
-  bool MergePartialFromCodedStream(
-      ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) final;
-  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-  void SerializeWithCachedSizes(
-      ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* InternalSerializeWithCachedSizesToArray(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
-
-  private:
-  inline void SharedCtor();
-  inline void SharedDtor();
-  void SetCachedSize(int size) const final;
-  void InternalSwap(UnsubscribeFromStream* other);
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "es.message.UnsubscribeFromStream";
   }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
-  }
+  protected:
+  explicit UnsubscribeFromStream(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_messages_2eproto);
-    return ::descriptor_table_messages_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -6963,18 +8434,21 @@ class UnsubscribeFromStream :
  private:
   class _Internal;
 
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+  };
   friend struct ::TableStruct_messages_2eproto;
 };
 // -------------------------------------------------------------------
 
-class SubscriptionDropped :
+class SubscriptionDropped final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:es.message.SubscriptionDropped) */ {
  public:
-  SubscriptionDropped();
-  virtual ~SubscriptionDropped();
+  inline SubscriptionDropped() : SubscriptionDropped(nullptr) {}
+  ~SubscriptionDropped() override;
+  explicit PROTOBUF_CONSTEXPR SubscriptionDropped(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   SubscriptionDropped(const SubscriptionDropped& from);
   SubscriptionDropped(SubscriptionDropped&& from) noexcept
@@ -6987,8 +8461,13 @@ class SubscriptionDropped :
     return *this;
   }
   inline SubscriptionDropped& operator=(SubscriptionDropped&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -6996,24 +8475,24 @@ class SubscriptionDropped :
   }
 
   inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
-    return _internal_metadata_.unknown_fields();
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
   }
   inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
-    return _internal_metadata_.mutable_unknown_fields();
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SubscriptionDropped& default_instance() {
+    return *internal_default_instance();
   }
-  static const SubscriptionDropped& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const SubscriptionDropped* internal_default_instance() {
     return reinterpret_cast<const SubscriptionDropped*>(
                &_SubscriptionDropped_default_instance_);
@@ -7026,64 +8505,66 @@ class SubscriptionDropped :
   }
   inline void Swap(SubscriptionDropped* other) {
     if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SubscriptionDropped* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline SubscriptionDropped* New() const final {
-    return CreateMaybeMessage<SubscriptionDropped>(nullptr);
-  }
-
-  SubscriptionDropped* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  SubscriptionDropped* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<SubscriptionDropped>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const SubscriptionDropped& from);
-  void MergeFrom(const SubscriptionDropped& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SubscriptionDropped& from) {
+    SubscriptionDropped::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  #else
-  bool MergePartialFromCodedStream(
-      ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) final;
-  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-  void SerializeWithCachedSizes(
-      ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* InternalSerializeWithCachedSizesToArray(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
-
-  private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(SubscriptionDropped* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "es.message.SubscriptionDropped";
   }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
-  }
+  protected:
+  explicit SubscriptionDropped(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_messages_2eproto);
-    return ::descriptor_table_messages_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -7118,7 +8599,7 @@ class SubscriptionDropped :
       "Incorrect type passed to function SubscriptionDropReason_Name.");
     return SubscriptionDropped_SubscriptionDropReason_Name(enum_t_value);
   }
-  static inline bool SubscriptionDropReason_Parse(const std::string& name,
+  static inline bool SubscriptionDropReason_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
       SubscriptionDropReason* value) {
     return SubscriptionDropped_SubscriptionDropReason_Parse(name, value);
   }
@@ -7130,27 +8611,40 @@ class SubscriptionDropped :
   };
   // optional .es.message.SubscriptionDropped.SubscriptionDropReason reason = 1;
   bool has_reason() const;
+  private:
+  bool _internal_has_reason() const;
+  public:
   void clear_reason();
   ::es::message::SubscriptionDropped_SubscriptionDropReason reason() const;
   void set_reason(::es::message::SubscriptionDropped_SubscriptionDropReason value);
+  private:
+  ::es::message::SubscriptionDropped_SubscriptionDropReason _internal_reason() const;
+  void _internal_set_reason(::es::message::SubscriptionDropped_SubscriptionDropReason value);
+  public:
 
   // @@protoc_insertion_point(class_scope:es.message.SubscriptionDropped)
  private:
   class _Internal;
 
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  int reason_;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    int reason_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_messages_2eproto;
 };
 // -------------------------------------------------------------------
 
-class NotHandled_MasterInfo :
+class NotHandled_MasterInfo final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:es.message.NotHandled.MasterInfo) */ {
  public:
-  NotHandled_MasterInfo();
-  virtual ~NotHandled_MasterInfo();
+  inline NotHandled_MasterInfo() : NotHandled_MasterInfo(nullptr) {}
+  ~NotHandled_MasterInfo() override;
+  explicit PROTOBUF_CONSTEXPR NotHandled_MasterInfo(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   NotHandled_MasterInfo(const NotHandled_MasterInfo& from);
   NotHandled_MasterInfo(NotHandled_MasterInfo&& from) noexcept
@@ -7163,8 +8657,13 @@ class NotHandled_MasterInfo :
     return *this;
   }
   inline NotHandled_MasterInfo& operator=(NotHandled_MasterInfo&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -7172,24 +8671,24 @@ class NotHandled_MasterInfo :
   }
 
   inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
-    return _internal_metadata_.unknown_fields();
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
   }
   inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
-    return _internal_metadata_.mutable_unknown_fields();
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const NotHandled_MasterInfo& default_instance() {
+    return *internal_default_instance();
   }
-  static const NotHandled_MasterInfo& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const NotHandled_MasterInfo* internal_default_instance() {
     return reinterpret_cast<const NotHandled_MasterInfo*>(
                &_NotHandled_MasterInfo_default_instance_);
@@ -7202,64 +8701,66 @@ class NotHandled_MasterInfo :
   }
   inline void Swap(NotHandled_MasterInfo* other) {
     if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(NotHandled_MasterInfo* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline NotHandled_MasterInfo* New() const final {
-    return CreateMaybeMessage<NotHandled_MasterInfo>(nullptr);
-  }
-
-  NotHandled_MasterInfo* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  NotHandled_MasterInfo* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<NotHandled_MasterInfo>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const NotHandled_MasterInfo& from);
-  void MergeFrom(const NotHandled_MasterInfo& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const NotHandled_MasterInfo& from) {
+    NotHandled_MasterInfo::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  #else
-  bool MergePartialFromCodedStream(
-      ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) final;
-  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-  void SerializeWithCachedSizes(
-      ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* InternalSerializeWithCachedSizesToArray(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
-
-  private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(NotHandled_MasterInfo* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "es.message.NotHandled.MasterInfo";
   }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
-  }
+  protected:
+  explicit NotHandled_MasterInfo(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_messages_2eproto);
-    return ::descriptor_table_messages_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -7275,57 +8776,96 @@ class NotHandled_MasterInfo :
   };
   // required string external_tcp_address = 1;
   bool has_external_tcp_address() const;
+  private:
+  bool _internal_has_external_tcp_address() const;
+  public:
   void clear_external_tcp_address();
   const std::string& external_tcp_address() const;
-  void set_external_tcp_address(const std::string& value);
-  void set_external_tcp_address(std::string&& value);
-  void set_external_tcp_address(const char* value);
-  void set_external_tcp_address(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_external_tcp_address(ArgT0&& arg0, ArgT... args);
   std::string* mutable_external_tcp_address();
-  std::string* release_external_tcp_address();
+  PROTOBUF_NODISCARD std::string* release_external_tcp_address();
   void set_allocated_external_tcp_address(std::string* external_tcp_address);
+  private:
+  const std::string& _internal_external_tcp_address() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_external_tcp_address(const std::string& value);
+  std::string* _internal_mutable_external_tcp_address();
+  public:
 
   // required string external_http_address = 3;
   bool has_external_http_address() const;
+  private:
+  bool _internal_has_external_http_address() const;
+  public:
   void clear_external_http_address();
   const std::string& external_http_address() const;
-  void set_external_http_address(const std::string& value);
-  void set_external_http_address(std::string&& value);
-  void set_external_http_address(const char* value);
-  void set_external_http_address(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_external_http_address(ArgT0&& arg0, ArgT... args);
   std::string* mutable_external_http_address();
-  std::string* release_external_http_address();
+  PROTOBUF_NODISCARD std::string* release_external_http_address();
   void set_allocated_external_http_address(std::string* external_http_address);
+  private:
+  const std::string& _internal_external_http_address() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_external_http_address(const std::string& value);
+  std::string* _internal_mutable_external_http_address();
+  public:
 
   // optional string external_secure_tcp_address = 5;
   bool has_external_secure_tcp_address() const;
+  private:
+  bool _internal_has_external_secure_tcp_address() const;
+  public:
   void clear_external_secure_tcp_address();
   const std::string& external_secure_tcp_address() const;
-  void set_external_secure_tcp_address(const std::string& value);
-  void set_external_secure_tcp_address(std::string&& value);
-  void set_external_secure_tcp_address(const char* value);
-  void set_external_secure_tcp_address(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_external_secure_tcp_address(ArgT0&& arg0, ArgT... args);
   std::string* mutable_external_secure_tcp_address();
-  std::string* release_external_secure_tcp_address();
+  PROTOBUF_NODISCARD std::string* release_external_secure_tcp_address();
   void set_allocated_external_secure_tcp_address(std::string* external_secure_tcp_address);
+  private:
+  const std::string& _internal_external_secure_tcp_address() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_external_secure_tcp_address(const std::string& value);
+  std::string* _internal_mutable_external_secure_tcp_address();
+  public:
 
   // required int32 external_tcp_port = 2;
   bool has_external_tcp_port() const;
+  private:
+  bool _internal_has_external_tcp_port() const;
+  public:
   void clear_external_tcp_port();
-  ::PROTOBUF_NAMESPACE_ID::int32 external_tcp_port() const;
-  void set_external_tcp_port(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t external_tcp_port() const;
+  void set_external_tcp_port(int32_t value);
+  private:
+  int32_t _internal_external_tcp_port() const;
+  void _internal_set_external_tcp_port(int32_t value);
+  public:
 
   // required int32 external_http_port = 4;
   bool has_external_http_port() const;
+  private:
+  bool _internal_has_external_http_port() const;
+  public:
   void clear_external_http_port();
-  ::PROTOBUF_NAMESPACE_ID::int32 external_http_port() const;
-  void set_external_http_port(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t external_http_port() const;
+  void set_external_http_port(int32_t value);
+  private:
+  int32_t _internal_external_http_port() const;
+  void _internal_set_external_http_port(int32_t value);
+  public:
 
   // optional int32 external_secure_tcp_port = 6;
   bool has_external_secure_tcp_port() const;
+  private:
+  bool _internal_has_external_secure_tcp_port() const;
+  public:
   void clear_external_secure_tcp_port();
-  ::PROTOBUF_NAMESPACE_ID::int32 external_secure_tcp_port() const;
-  void set_external_secure_tcp_port(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t external_secure_tcp_port() const;
+  void set_external_secure_tcp_port(int32_t value);
+  private:
+  int32_t _internal_external_secure_tcp_port() const;
+  void _internal_set_external_secure_tcp_port(int32_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:es.message.NotHandled.MasterInfo)
  private:
@@ -7334,24 +8874,30 @@ class NotHandled_MasterInfo :
   // helper for ByteSizeLong()
   size_t RequiredFieldsByteSizeFallback() const;
 
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr external_tcp_address_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr external_http_address_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr external_secure_tcp_address_;
-  ::PROTOBUF_NAMESPACE_ID::int32 external_tcp_port_;
-  ::PROTOBUF_NAMESPACE_ID::int32 external_http_port_;
-  ::PROTOBUF_NAMESPACE_ID::int32 external_secure_tcp_port_;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr external_tcp_address_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr external_http_address_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr external_secure_tcp_address_;
+    int32_t external_tcp_port_;
+    int32_t external_http_port_;
+    int32_t external_secure_tcp_port_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_messages_2eproto;
 };
 // -------------------------------------------------------------------
 
-class NotHandled :
+class NotHandled final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:es.message.NotHandled) */ {
  public:
-  NotHandled();
-  virtual ~NotHandled();
+  inline NotHandled() : NotHandled(nullptr) {}
+  ~NotHandled() override;
+  explicit PROTOBUF_CONSTEXPR NotHandled(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   NotHandled(const NotHandled& from);
   NotHandled(NotHandled&& from) noexcept
@@ -7364,8 +8910,13 @@ class NotHandled :
     return *this;
   }
   inline NotHandled& operator=(NotHandled&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -7373,24 +8924,24 @@ class NotHandled :
   }
 
   inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
-    return _internal_metadata_.unknown_fields();
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
   }
   inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
-    return _internal_metadata_.mutable_unknown_fields();
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const NotHandled& default_instance() {
+    return *internal_default_instance();
   }
-  static const NotHandled& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const NotHandled* internal_default_instance() {
     return reinterpret_cast<const NotHandled*>(
                &_NotHandled_default_instance_);
@@ -7403,64 +8954,66 @@ class NotHandled :
   }
   inline void Swap(NotHandled* other) {
     if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(NotHandled* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline NotHandled* New() const final {
-    return CreateMaybeMessage<NotHandled>(nullptr);
-  }
-
-  NotHandled* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  NotHandled* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<NotHandled>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const NotHandled& from);
-  void MergeFrom(const NotHandled& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const NotHandled& from) {
+    NotHandled::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  #else
-  bool MergePartialFromCodedStream(
-      ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) final;
-  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-  void SerializeWithCachedSizes(
-      ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* InternalSerializeWithCachedSizesToArray(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
-
-  private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(NotHandled* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "es.message.NotHandled";
   }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
-  }
+  protected:
+  explicit NotHandled(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_messages_2eproto);
-    return ::descriptor_table_messages_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -7493,7 +9046,7 @@ class NotHandled :
       "Incorrect type passed to function NotHandledReason_Name.");
     return NotHandled_NotHandledReason_Name(enum_t_value);
   }
-  static inline bool NotHandledReason_Parse(const std::string& name,
+  static inline bool NotHandledReason_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
       NotHandledReason* value) {
     return NotHandled_NotHandledReason_Parse(name, value);
   }
@@ -7506,40 +9059,58 @@ class NotHandled :
   };
   // optional bytes additional_info = 2;
   bool has_additional_info() const;
+  private:
+  bool _internal_has_additional_info() const;
+  public:
   void clear_additional_info();
   const std::string& additional_info() const;
-  void set_additional_info(const std::string& value);
-  void set_additional_info(std::string&& value);
-  void set_additional_info(const char* value);
-  void set_additional_info(const void* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_additional_info(ArgT0&& arg0, ArgT... args);
   std::string* mutable_additional_info();
-  std::string* release_additional_info();
+  PROTOBUF_NODISCARD std::string* release_additional_info();
   void set_allocated_additional_info(std::string* additional_info);
+  private:
+  const std::string& _internal_additional_info() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_additional_info(const std::string& value);
+  std::string* _internal_mutable_additional_info();
+  public:
 
   // required .es.message.NotHandled.NotHandledReason reason = 1;
   bool has_reason() const;
+  private:
+  bool _internal_has_reason() const;
+  public:
   void clear_reason();
   ::es::message::NotHandled_NotHandledReason reason() const;
   void set_reason(::es::message::NotHandled_NotHandledReason value);
+  private:
+  ::es::message::NotHandled_NotHandledReason _internal_reason() const;
+  void _internal_set_reason(::es::message::NotHandled_NotHandledReason value);
+  public:
 
   // @@protoc_insertion_point(class_scope:es.message.NotHandled)
  private:
   class _Internal;
 
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr additional_info_;
-  int reason_;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr additional_info_;
+    int reason_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_messages_2eproto;
 };
 // -------------------------------------------------------------------
 
-class ScavengeDatabase :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:es.message.ScavengeDatabase) */ {
+class ScavengeDatabase final :
+    public ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase /* @@protoc_insertion_point(class_definition:es.message.ScavengeDatabase) */ {
  public:
-  ScavengeDatabase();
-  virtual ~ScavengeDatabase();
+  inline ScavengeDatabase() : ScavengeDatabase(nullptr) {}
+  explicit PROTOBUF_CONSTEXPR ScavengeDatabase(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   ScavengeDatabase(const ScavengeDatabase& from);
   ScavengeDatabase(ScavengeDatabase&& from) noexcept
@@ -7552,8 +9123,13 @@ class ScavengeDatabase :
     return *this;
   }
   inline ScavengeDatabase& operator=(ScavengeDatabase&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -7561,24 +9137,24 @@ class ScavengeDatabase :
   }
 
   inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
-    return _internal_metadata_.unknown_fields();
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
   }
   inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
-    return _internal_metadata_.mutable_unknown_fields();
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ScavengeDatabase& default_instance() {
+    return *internal_default_instance();
   }
-  static const ScavengeDatabase& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const ScavengeDatabase* internal_default_instance() {
     return reinterpret_cast<const ScavengeDatabase*>(
                &_ScavengeDatabase_default_instance_);
@@ -7591,64 +9167,52 @@ class ScavengeDatabase :
   }
   inline void Swap(ScavengeDatabase* other) {
     if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ScavengeDatabase* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline ScavengeDatabase* New() const final {
-    return CreateMaybeMessage<ScavengeDatabase>(nullptr);
-  }
-
-  ScavengeDatabase* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  ScavengeDatabase* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<ScavengeDatabase>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void CopyFrom(const ScavengeDatabase& from);
-  void MergeFrom(const ScavengeDatabase& from);
-  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
-  bool IsInitialized() const final;
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyFrom;
+  inline void CopyFrom(const ScavengeDatabase& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl(*this, from);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeFrom;
+  void MergeFrom(const ScavengeDatabase& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl(*this, from);
+  }
+  public:
 
-  size_t ByteSizeLong() const final;
-  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  #else
-  bool MergePartialFromCodedStream(
-      ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) final;
-  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-  void SerializeWithCachedSizes(
-      ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* InternalSerializeWithCachedSizesToArray(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
-
-  private:
-  inline void SharedCtor();
-  inline void SharedDtor();
-  void SetCachedSize(int size) const final;
-  void InternalSwap(ScavengeDatabase* other);
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "es.message.ScavengeDatabase";
   }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
-  }
+  protected:
+  explicit ScavengeDatabase(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_messages_2eproto);
-    return ::descriptor_table_messages_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -7658,18 +9222,21 @@ class ScavengeDatabase :
  private:
   class _Internal;
 
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+  };
   friend struct ::TableStruct_messages_2eproto;
 };
 // -------------------------------------------------------------------
 
-class ScavengeDatabaseResponse :
+class ScavengeDatabaseResponse final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:es.message.ScavengeDatabaseResponse) */ {
  public:
-  ScavengeDatabaseResponse();
-  virtual ~ScavengeDatabaseResponse();
+  inline ScavengeDatabaseResponse() : ScavengeDatabaseResponse(nullptr) {}
+  ~ScavengeDatabaseResponse() override;
+  explicit PROTOBUF_CONSTEXPR ScavengeDatabaseResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   ScavengeDatabaseResponse(const ScavengeDatabaseResponse& from);
   ScavengeDatabaseResponse(ScavengeDatabaseResponse&& from) noexcept
@@ -7682,8 +9249,13 @@ class ScavengeDatabaseResponse :
     return *this;
   }
   inline ScavengeDatabaseResponse& operator=(ScavengeDatabaseResponse&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -7691,24 +9263,24 @@ class ScavengeDatabaseResponse :
   }
 
   inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
-    return _internal_metadata_.unknown_fields();
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
   }
   inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
-    return _internal_metadata_.mutable_unknown_fields();
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ScavengeDatabaseResponse& default_instance() {
+    return *internal_default_instance();
   }
-  static const ScavengeDatabaseResponse& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const ScavengeDatabaseResponse* internal_default_instance() {
     return reinterpret_cast<const ScavengeDatabaseResponse*>(
                &_ScavengeDatabaseResponse_default_instance_);
@@ -7721,64 +9293,66 @@ class ScavengeDatabaseResponse :
   }
   inline void Swap(ScavengeDatabaseResponse* other) {
     if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ScavengeDatabaseResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline ScavengeDatabaseResponse* New() const final {
-    return CreateMaybeMessage<ScavengeDatabaseResponse>(nullptr);
-  }
-
-  ScavengeDatabaseResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  ScavengeDatabaseResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<ScavengeDatabaseResponse>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const ScavengeDatabaseResponse& from);
-  void MergeFrom(const ScavengeDatabaseResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ScavengeDatabaseResponse& from) {
+    ScavengeDatabaseResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  #else
-  bool MergePartialFromCodedStream(
-      ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) final;
-  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-  void SerializeWithCachedSizes(
-      ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* InternalSerializeWithCachedSizesToArray(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
-
-  private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(ScavengeDatabaseResponse* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "es.message.ScavengeDatabaseResponse";
   }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
-  }
+  protected:
+  explicit ScavengeDatabaseResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_messages_2eproto);
-    return ::descriptor_table_messages_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -7809,7 +9383,7 @@ class ScavengeDatabaseResponse :
       "Incorrect type passed to function ScavengeResult_Name.");
     return ScavengeDatabaseResponse_ScavengeResult_Name(enum_t_value);
   }
-  static inline bool ScavengeResult_Parse(const std::string& name,
+  static inline bool ScavengeResult_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
       ScavengeResult* value) {
     return ScavengeDatabaseResponse_ScavengeResult_Parse(name, value);
   }
@@ -7822,40 +9396,59 @@ class ScavengeDatabaseResponse :
   };
   // optional string scavengeId = 2;
   bool has_scavengeid() const;
+  private:
+  bool _internal_has_scavengeid() const;
+  public:
   void clear_scavengeid();
   const std::string& scavengeid() const;
-  void set_scavengeid(const std::string& value);
-  void set_scavengeid(std::string&& value);
-  void set_scavengeid(const char* value);
-  void set_scavengeid(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_scavengeid(ArgT0&& arg0, ArgT... args);
   std::string* mutable_scavengeid();
-  std::string* release_scavengeid();
+  PROTOBUF_NODISCARD std::string* release_scavengeid();
   void set_allocated_scavengeid(std::string* scavengeid);
+  private:
+  const std::string& _internal_scavengeid() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_scavengeid(const std::string& value);
+  std::string* _internal_mutable_scavengeid();
+  public:
 
   // required .es.message.ScavengeDatabaseResponse.ScavengeResult result = 1;
   bool has_result() const;
+  private:
+  bool _internal_has_result() const;
+  public:
   void clear_result();
   ::es::message::ScavengeDatabaseResponse_ScavengeResult result() const;
   void set_result(::es::message::ScavengeDatabaseResponse_ScavengeResult value);
+  private:
+  ::es::message::ScavengeDatabaseResponse_ScavengeResult _internal_result() const;
+  void _internal_set_result(::es::message::ScavengeDatabaseResponse_ScavengeResult value);
+  public:
 
   // @@protoc_insertion_point(class_scope:es.message.ScavengeDatabaseResponse)
  private:
   class _Internal;
 
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr scavengeid_;
-  int result_;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr scavengeid_;
+    int result_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_messages_2eproto;
 };
 // -------------------------------------------------------------------
 
-class IdentifyClient :
+class IdentifyClient final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:es.message.IdentifyClient) */ {
  public:
-  IdentifyClient();
-  virtual ~IdentifyClient();
+  inline IdentifyClient() : IdentifyClient(nullptr) {}
+  ~IdentifyClient() override;
+  explicit PROTOBUF_CONSTEXPR IdentifyClient(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   IdentifyClient(const IdentifyClient& from);
   IdentifyClient(IdentifyClient&& from) noexcept
@@ -7868,8 +9461,13 @@ class IdentifyClient :
     return *this;
   }
   inline IdentifyClient& operator=(IdentifyClient&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -7877,24 +9475,24 @@ class IdentifyClient :
   }
 
   inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
-    return _internal_metadata_.unknown_fields();
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
   }
   inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
-    return _internal_metadata_.mutable_unknown_fields();
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const IdentifyClient& default_instance() {
+    return *internal_default_instance();
   }
-  static const IdentifyClient& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const IdentifyClient* internal_default_instance() {
     return reinterpret_cast<const IdentifyClient*>(
                &_IdentifyClient_default_instance_);
@@ -7907,64 +9505,66 @@ class IdentifyClient :
   }
   inline void Swap(IdentifyClient* other) {
     if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(IdentifyClient* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline IdentifyClient* New() const final {
-    return CreateMaybeMessage<IdentifyClient>(nullptr);
-  }
-
-  IdentifyClient* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  IdentifyClient* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<IdentifyClient>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const IdentifyClient& from);
-  void MergeFrom(const IdentifyClient& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const IdentifyClient& from) {
+    IdentifyClient::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  #else
-  bool MergePartialFromCodedStream(
-      ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) final;
-  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-  void SerializeWithCachedSizes(
-      ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* InternalSerializeWithCachedSizesToArray(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
-
-  private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(IdentifyClient* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "es.message.IdentifyClient";
   }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
-  }
+  protected:
+  explicit IdentifyClient(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_messages_2eproto);
-    return ::descriptor_table_messages_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -7976,40 +9576,58 @@ class IdentifyClient :
   };
   // optional string connection_name = 2;
   bool has_connection_name() const;
+  private:
+  bool _internal_has_connection_name() const;
+  public:
   void clear_connection_name();
   const std::string& connection_name() const;
-  void set_connection_name(const std::string& value);
-  void set_connection_name(std::string&& value);
-  void set_connection_name(const char* value);
-  void set_connection_name(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_connection_name(ArgT0&& arg0, ArgT... args);
   std::string* mutable_connection_name();
-  std::string* release_connection_name();
+  PROTOBUF_NODISCARD std::string* release_connection_name();
   void set_allocated_connection_name(std::string* connection_name);
+  private:
+  const std::string& _internal_connection_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_connection_name(const std::string& value);
+  std::string* _internal_mutable_connection_name();
+  public:
 
   // required int32 version = 1;
   bool has_version() const;
+  private:
+  bool _internal_has_version() const;
+  public:
   void clear_version();
-  ::PROTOBUF_NAMESPACE_ID::int32 version() const;
-  void set_version(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t version() const;
+  void set_version(int32_t value);
+  private:
+  int32_t _internal_version() const;
+  void _internal_set_version(int32_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:es.message.IdentifyClient)
  private:
   class _Internal;
 
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr connection_name_;
-  ::PROTOBUF_NAMESPACE_ID::int32 version_;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr connection_name_;
+    int32_t version_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_messages_2eproto;
 };
 // -------------------------------------------------------------------
 
-class ClientIdentified :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:es.message.ClientIdentified) */ {
+class ClientIdentified final :
+    public ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase /* @@protoc_insertion_point(class_definition:es.message.ClientIdentified) */ {
  public:
-  ClientIdentified();
-  virtual ~ClientIdentified();
+  inline ClientIdentified() : ClientIdentified(nullptr) {}
+  explicit PROTOBUF_CONSTEXPR ClientIdentified(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   ClientIdentified(const ClientIdentified& from);
   ClientIdentified(ClientIdentified&& from) noexcept
@@ -8022,8 +9640,13 @@ class ClientIdentified :
     return *this;
   }
   inline ClientIdentified& operator=(ClientIdentified&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -8031,24 +9654,24 @@ class ClientIdentified :
   }
 
   inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
-    return _internal_metadata_.unknown_fields();
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
   }
   inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
-    return _internal_metadata_.mutable_unknown_fields();
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ClientIdentified& default_instance() {
+    return *internal_default_instance();
   }
-  static const ClientIdentified& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const ClientIdentified* internal_default_instance() {
     return reinterpret_cast<const ClientIdentified*>(
                &_ClientIdentified_default_instance_);
@@ -8061,64 +9684,52 @@ class ClientIdentified :
   }
   inline void Swap(ClientIdentified* other) {
     if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ClientIdentified* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline ClientIdentified* New() const final {
-    return CreateMaybeMessage<ClientIdentified>(nullptr);
-  }
-
-  ClientIdentified* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  ClientIdentified* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<ClientIdentified>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void CopyFrom(const ClientIdentified& from);
-  void MergeFrom(const ClientIdentified& from);
-  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
-  bool IsInitialized() const final;
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyFrom;
+  inline void CopyFrom(const ClientIdentified& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl(*this, from);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeFrom;
+  void MergeFrom(const ClientIdentified& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl(*this, from);
+  }
+  public:
 
-  size_t ByteSizeLong() const final;
-  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  #else
-  bool MergePartialFromCodedStream(
-      ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) final;
-  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-  void SerializeWithCachedSizes(
-      ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* InternalSerializeWithCachedSizesToArray(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
-
-  private:
-  inline void SharedCtor();
-  inline void SharedDtor();
-  void SetCachedSize(int size) const final;
-  void InternalSwap(ClientIdentified* other);
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "es.message.ClientIdentified";
   }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
-  }
+  protected:
+  explicit ClientIdentified(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_messages_2eproto);
-    return ::descriptor_table_messages_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -8128,9 +9739,11 @@ class ClientIdentified :
  private:
   class _Internal;
 
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+  };
   friend struct ::TableStruct_messages_2eproto;
 };
 // ===================================================================
@@ -8145,270 +9758,330 @@ class ClientIdentified :
 // NewEvent
 
 // required bytes event_id = 1;
+inline bool NewEvent::_internal_has_event_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
 inline bool NewEvent::has_event_id() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+  return _internal_has_event_id();
 }
 inline void NewEvent::clear_event_id() {
-  event_id_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  _has_bits_[0] &= ~0x00000001u;
+  _impl_.event_id_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
 }
 inline const std::string& NewEvent::event_id() const {
   // @@protoc_insertion_point(field_get:es.message.NewEvent.event_id)
-  return event_id_.GetNoArena();
+  return _internal_event_id();
 }
-inline void NewEvent::set_event_id(const std::string& value) {
-  _has_bits_[0] |= 0x00000001u;
-  event_id_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void NewEvent::set_event_id(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.event_id_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:es.message.NewEvent.event_id)
 }
-inline void NewEvent::set_event_id(std::string&& value) {
-  _has_bits_[0] |= 0x00000001u;
-  event_id_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:es.message.NewEvent.event_id)
+inline std::string* NewEvent::mutable_event_id() {
+  std::string* _s = _internal_mutable_event_id();
+  // @@protoc_insertion_point(field_mutable:es.message.NewEvent.event_id)
+  return _s;
 }
-inline void NewEvent::set_event_id(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  _has_bits_[0] |= 0x00000001u;
-  event_id_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:es.message.NewEvent.event_id)
+inline const std::string& NewEvent::_internal_event_id() const {
+  return _impl_.event_id_.Get();
 }
-inline void NewEvent::set_event_id(const void* value, size_t size) {
-  _has_bits_[0] |= 0x00000001u;
-  event_id_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:es.message.NewEvent.event_id)
+inline void NewEvent::_internal_set_event_id(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.event_id_.Set(value, GetArenaForAllocation());
 }
-inline std::string* NewEvent::mutable_event_id() {
-  _has_bits_[0] |= 0x00000001u;
-  // @@protoc_insertion_point(field_mutable:es.message.NewEvent.event_id)
-  return event_id_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline std::string* NewEvent::_internal_mutable_event_id() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.event_id_.Mutable(GetArenaForAllocation());
 }
 inline std::string* NewEvent::release_event_id() {
   // @@protoc_insertion_point(field_release:es.message.NewEvent.event_id)
-  if (!has_event_id()) {
+  if (!_internal_has_event_id()) {
     return nullptr;
   }
-  _has_bits_[0] &= ~0x00000001u;
-  return event_id_.ReleaseNonDefaultNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.event_id_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.event_id_.IsDefault()) {
+    _impl_.event_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
 }
 inline void NewEvent::set_allocated_event_id(std::string* event_id) {
   if (event_id != nullptr) {
-    _has_bits_[0] |= 0x00000001u;
+    _impl_._has_bits_[0] |= 0x00000001u;
   } else {
-    _has_bits_[0] &= ~0x00000001u;
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.event_id_.SetAllocated(event_id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.event_id_.IsDefault()) {
+    _impl_.event_id_.Set("", GetArenaForAllocation());
   }
-  event_id_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), event_id);
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:es.message.NewEvent.event_id)
 }
 
 // required string event_type = 2;
+inline bool NewEvent::_internal_has_event_type() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
 inline bool NewEvent::has_event_type() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
+  return _internal_has_event_type();
 }
 inline void NewEvent::clear_event_type() {
-  event_type_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  _has_bits_[0] &= ~0x00000002u;
+  _impl_.event_type_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
 }
 inline const std::string& NewEvent::event_type() const {
   // @@protoc_insertion_point(field_get:es.message.NewEvent.event_type)
-  return event_type_.GetNoArena();
+  return _internal_event_type();
 }
-inline void NewEvent::set_event_type(const std::string& value) {
-  _has_bits_[0] |= 0x00000002u;
-  event_type_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void NewEvent::set_event_type(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.event_type_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:es.message.NewEvent.event_type)
 }
-inline void NewEvent::set_event_type(std::string&& value) {
-  _has_bits_[0] |= 0x00000002u;
-  event_type_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:es.message.NewEvent.event_type)
+inline std::string* NewEvent::mutable_event_type() {
+  std::string* _s = _internal_mutable_event_type();
+  // @@protoc_insertion_point(field_mutable:es.message.NewEvent.event_type)
+  return _s;
 }
-inline void NewEvent::set_event_type(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  _has_bits_[0] |= 0x00000002u;
-  event_type_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:es.message.NewEvent.event_type)
+inline const std::string& NewEvent::_internal_event_type() const {
+  return _impl_.event_type_.Get();
 }
-inline void NewEvent::set_event_type(const char* value, size_t size) {
-  _has_bits_[0] |= 0x00000002u;
-  event_type_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:es.message.NewEvent.event_type)
+inline void NewEvent::_internal_set_event_type(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.event_type_.Set(value, GetArenaForAllocation());
 }
-inline std::string* NewEvent::mutable_event_type() {
-  _has_bits_[0] |= 0x00000002u;
-  // @@protoc_insertion_point(field_mutable:es.message.NewEvent.event_type)
-  return event_type_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline std::string* NewEvent::_internal_mutable_event_type() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.event_type_.Mutable(GetArenaForAllocation());
 }
 inline std::string* NewEvent::release_event_type() {
   // @@protoc_insertion_point(field_release:es.message.NewEvent.event_type)
-  if (!has_event_type()) {
+  if (!_internal_has_event_type()) {
     return nullptr;
   }
-  _has_bits_[0] &= ~0x00000002u;
-  return event_type_.ReleaseNonDefaultNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.event_type_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.event_type_.IsDefault()) {
+    _impl_.event_type_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
 }
 inline void NewEvent::set_allocated_event_type(std::string* event_type) {
   if (event_type != nullptr) {
-    _has_bits_[0] |= 0x00000002u;
+    _impl_._has_bits_[0] |= 0x00000002u;
   } else {
-    _has_bits_[0] &= ~0x00000002u;
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.event_type_.SetAllocated(event_type, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.event_type_.IsDefault()) {
+    _impl_.event_type_.Set("", GetArenaForAllocation());
   }
-  event_type_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), event_type);
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:es.message.NewEvent.event_type)
 }
 
 // required int32 data_content_type = 3;
+inline bool NewEvent::_internal_has_data_content_type() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
 inline bool NewEvent::has_data_content_type() const {
-  return (_has_bits_[0] & 0x00000010u) != 0;
+  return _internal_has_data_content_type();
 }
 inline void NewEvent::clear_data_content_type() {
-  data_content_type_ = 0;
-  _has_bits_[0] &= ~0x00000010u;
+  _impl_.data_content_type_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline int32_t NewEvent::_internal_data_content_type() const {
+  return _impl_.data_content_type_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 NewEvent::data_content_type() const {
+inline int32_t NewEvent::data_content_type() const {
   // @@protoc_insertion_point(field_get:es.message.NewEvent.data_content_type)
-  return data_content_type_;
+  return _internal_data_content_type();
 }
-inline void NewEvent::set_data_content_type(::PROTOBUF_NAMESPACE_ID::int32 value) {
-  _has_bits_[0] |= 0x00000010u;
-  data_content_type_ = value;
+inline void NewEvent::_internal_set_data_content_type(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.data_content_type_ = value;
+}
+inline void NewEvent::set_data_content_type(int32_t value) {
+  _internal_set_data_content_type(value);
   // @@protoc_insertion_point(field_set:es.message.NewEvent.data_content_type)
 }
 
 // required int32 metadata_content_type = 4;
+inline bool NewEvent::_internal_has_metadata_content_type() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
 inline bool NewEvent::has_metadata_content_type() const {
-  return (_has_bits_[0] & 0x00000020u) != 0;
+  return _internal_has_metadata_content_type();
 }
 inline void NewEvent::clear_metadata_content_type() {
-  metadata_content_type_ = 0;
-  _has_bits_[0] &= ~0x00000020u;
+  _impl_.metadata_content_type_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000020u;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 NewEvent::metadata_content_type() const {
+inline int32_t NewEvent::_internal_metadata_content_type() const {
+  return _impl_.metadata_content_type_;
+}
+inline int32_t NewEvent::metadata_content_type() const {
   // @@protoc_insertion_point(field_get:es.message.NewEvent.metadata_content_type)
-  return metadata_content_type_;
+  return _internal_metadata_content_type();
+}
+inline void NewEvent::_internal_set_metadata_content_type(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.metadata_content_type_ = value;
 }
-inline void NewEvent::set_metadata_content_type(::PROTOBUF_NAMESPACE_ID::int32 value) {
-  _has_bits_[0] |= 0x00000020u;
-  metadata_content_type_ = value;
+inline void NewEvent::set_metadata_content_type(int32_t value) {
+  _internal_set_metadata_content_type(value);
   // @@protoc_insertion_point(field_set:es.message.NewEvent.metadata_content_type)
 }
 
 // required bytes data = 5;
+inline bool NewEvent::_internal_has_data() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
 inline bool NewEvent::has_data() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
+  return _internal_has_data();
 }
 inline void NewEvent::clear_data() {
-  data_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  _has_bits_[0] &= ~0x00000004u;
+  _impl_.data_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000004u;
 }
 inline const std::string& NewEvent::data() const {
   // @@protoc_insertion_point(field_get:es.message.NewEvent.data)
-  return data_.GetNoArena();
+  return _internal_data();
 }
-inline void NewEvent::set_data(const std::string& value) {
-  _has_bits_[0] |= 0x00000004u;
-  data_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void NewEvent::set_data(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000004u;
+ _impl_.data_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:es.message.NewEvent.data)
 }
-inline void NewEvent::set_data(std::string&& value) {
-  _has_bits_[0] |= 0x00000004u;
-  data_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:es.message.NewEvent.data)
+inline std::string* NewEvent::mutable_data() {
+  std::string* _s = _internal_mutable_data();
+  // @@protoc_insertion_point(field_mutable:es.message.NewEvent.data)
+  return _s;
 }
-inline void NewEvent::set_data(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  _has_bits_[0] |= 0x00000004u;
-  data_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:es.message.NewEvent.data)
+inline const std::string& NewEvent::_internal_data() const {
+  return _impl_.data_.Get();
 }
-inline void NewEvent::set_data(const void* value, size_t size) {
-  _has_bits_[0] |= 0x00000004u;
-  data_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:es.message.NewEvent.data)
+inline void NewEvent::_internal_set_data(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.data_.Set(value, GetArenaForAllocation());
 }
-inline std::string* NewEvent::mutable_data() {
-  _has_bits_[0] |= 0x00000004u;
-  // @@protoc_insertion_point(field_mutable:es.message.NewEvent.data)
-  return data_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline std::string* NewEvent::_internal_mutable_data() {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  return _impl_.data_.Mutable(GetArenaForAllocation());
 }
 inline std::string* NewEvent::release_data() {
   // @@protoc_insertion_point(field_release:es.message.NewEvent.data)
-  if (!has_data()) {
+  if (!_internal_has_data()) {
     return nullptr;
   }
-  _has_bits_[0] &= ~0x00000004u;
-  return data_.ReleaseNonDefaultNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  auto* p = _impl_.data_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.data_.IsDefault()) {
+    _impl_.data_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
 }
 inline void NewEvent::set_allocated_data(std::string* data) {
   if (data != nullptr) {
-    _has_bits_[0] |= 0x00000004u;
+    _impl_._has_bits_[0] |= 0x00000004u;
   } else {
-    _has_bits_[0] &= ~0x00000004u;
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  _impl_.data_.SetAllocated(data, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.data_.IsDefault()) {
+    _impl_.data_.Set("", GetArenaForAllocation());
   }
-  data_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), data);
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:es.message.NewEvent.data)
 }
 
 // optional bytes metadata = 6;
+inline bool NewEvent::_internal_has_metadata() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
 inline bool NewEvent::has_metadata() const {
-  return (_has_bits_[0] & 0x00000008u) != 0;
+  return _internal_has_metadata();
 }
 inline void NewEvent::clear_metadata() {
-  metadata_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  _has_bits_[0] &= ~0x00000008u;
+  _impl_.metadata_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000008u;
 }
 inline const std::string& NewEvent::metadata() const {
   // @@protoc_insertion_point(field_get:es.message.NewEvent.metadata)
-  return metadata_.GetNoArena();
+  return _internal_metadata();
 }
-inline void NewEvent::set_metadata(const std::string& value) {
-  _has_bits_[0] |= 0x00000008u;
-  metadata_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void NewEvent::set_metadata(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000008u;
+ _impl_.metadata_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:es.message.NewEvent.metadata)
 }
-inline void NewEvent::set_metadata(std::string&& value) {
-  _has_bits_[0] |= 0x00000008u;
-  metadata_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:es.message.NewEvent.metadata)
+inline std::string* NewEvent::mutable_metadata() {
+  std::string* _s = _internal_mutable_metadata();
+  // @@protoc_insertion_point(field_mutable:es.message.NewEvent.metadata)
+  return _s;
 }
-inline void NewEvent::set_metadata(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  _has_bits_[0] |= 0x00000008u;
-  metadata_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:es.message.NewEvent.metadata)
+inline const std::string& NewEvent::_internal_metadata() const {
+  return _impl_.metadata_.Get();
 }
-inline void NewEvent::set_metadata(const void* value, size_t size) {
-  _has_bits_[0] |= 0x00000008u;
-  metadata_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:es.message.NewEvent.metadata)
+inline void NewEvent::_internal_set_metadata(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.metadata_.Set(value, GetArenaForAllocation());
 }
-inline std::string* NewEvent::mutable_metadata() {
-  _has_bits_[0] |= 0x00000008u;
-  // @@protoc_insertion_point(field_mutable:es.message.NewEvent.metadata)
-  return metadata_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline std::string* NewEvent::_internal_mutable_metadata() {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  return _impl_.metadata_.Mutable(GetArenaForAllocation());
 }
 inline std::string* NewEvent::release_metadata() {
   // @@protoc_insertion_point(field_release:es.message.NewEvent.metadata)
-  if (!has_metadata()) {
+  if (!_internal_has_metadata()) {
     return nullptr;
   }
-  _has_bits_[0] &= ~0x00000008u;
-  return metadata_.ReleaseNonDefaultNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  auto* p = _impl_.metadata_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.metadata_.IsDefault()) {
+    _impl_.metadata_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
 }
 inline void NewEvent::set_allocated_metadata(std::string* metadata) {
   if (metadata != nullptr) {
-    _has_bits_[0] |= 0x00000008u;
+    _impl_._has_bits_[0] |= 0x00000008u;
   } else {
-    _has_bits_[0] &= ~0x00000008u;
+    _impl_._has_bits_[0] &= ~0x00000008u;
+  }
+  _impl_.metadata_.SetAllocated(metadata, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.metadata_.IsDefault()) {
+    _impl_.metadata_.Set("", GetArenaForAllocation());
   }
-  metadata_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), metadata);
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:es.message.NewEvent.metadata)
 }
 
@@ -8417,382 +10090,482 @@ inline void NewEvent::set_allocated_metadata(std::string* metadata) {
 // EventRecord
 
 // required string event_stream_id = 1;
+inline bool EventRecord::_internal_has_event_stream_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
 inline bool EventRecord::has_event_stream_id() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+  return _internal_has_event_stream_id();
 }
 inline void EventRecord::clear_event_stream_id() {
-  event_stream_id_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  _has_bits_[0] &= ~0x00000001u;
+  _impl_.event_stream_id_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
 }
 inline const std::string& EventRecord::event_stream_id() const {
   // @@protoc_insertion_point(field_get:es.message.EventRecord.event_stream_id)
-  return event_stream_id_.GetNoArena();
+  return _internal_event_stream_id();
 }
-inline void EventRecord::set_event_stream_id(const std::string& value) {
-  _has_bits_[0] |= 0x00000001u;
-  event_stream_id_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void EventRecord::set_event_stream_id(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.event_stream_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:es.message.EventRecord.event_stream_id)
 }
-inline void EventRecord::set_event_stream_id(std::string&& value) {
-  _has_bits_[0] |= 0x00000001u;
-  event_stream_id_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:es.message.EventRecord.event_stream_id)
+inline std::string* EventRecord::mutable_event_stream_id() {
+  std::string* _s = _internal_mutable_event_stream_id();
+  // @@protoc_insertion_point(field_mutable:es.message.EventRecord.event_stream_id)
+  return _s;
 }
-inline void EventRecord::set_event_stream_id(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  _has_bits_[0] |= 0x00000001u;
-  event_stream_id_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:es.message.EventRecord.event_stream_id)
+inline const std::string& EventRecord::_internal_event_stream_id() const {
+  return _impl_.event_stream_id_.Get();
 }
-inline void EventRecord::set_event_stream_id(const char* value, size_t size) {
-  _has_bits_[0] |= 0x00000001u;
-  event_stream_id_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:es.message.EventRecord.event_stream_id)
+inline void EventRecord::_internal_set_event_stream_id(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.event_stream_id_.Set(value, GetArenaForAllocation());
 }
-inline std::string* EventRecord::mutable_event_stream_id() {
-  _has_bits_[0] |= 0x00000001u;
-  // @@protoc_insertion_point(field_mutable:es.message.EventRecord.event_stream_id)
-  return event_stream_id_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline std::string* EventRecord::_internal_mutable_event_stream_id() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.event_stream_id_.Mutable(GetArenaForAllocation());
 }
 inline std::string* EventRecord::release_event_stream_id() {
   // @@protoc_insertion_point(field_release:es.message.EventRecord.event_stream_id)
-  if (!has_event_stream_id()) {
+  if (!_internal_has_event_stream_id()) {
     return nullptr;
   }
-  _has_bits_[0] &= ~0x00000001u;
-  return event_stream_id_.ReleaseNonDefaultNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.event_stream_id_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.event_stream_id_.IsDefault()) {
+    _impl_.event_stream_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
 }
 inline void EventRecord::set_allocated_event_stream_id(std::string* event_stream_id) {
   if (event_stream_id != nullptr) {
-    _has_bits_[0] |= 0x00000001u;
+    _impl_._has_bits_[0] |= 0x00000001u;
   } else {
-    _has_bits_[0] &= ~0x00000001u;
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.event_stream_id_.SetAllocated(event_stream_id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.event_stream_id_.IsDefault()) {
+    _impl_.event_stream_id_.Set("", GetArenaForAllocation());
   }
-  event_stream_id_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), event_stream_id);
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:es.message.EventRecord.event_stream_id)
 }
 
 // required int64 event_number = 2;
+inline bool EventRecord::_internal_has_event_number() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
 inline bool EventRecord::has_event_number() const {
-  return (_has_bits_[0] & 0x00000020u) != 0;
+  return _internal_has_event_number();
 }
 inline void EventRecord::clear_event_number() {
-  event_number_ = PROTOBUF_LONGLONG(0);
-  _has_bits_[0] &= ~0x00000020u;
+  _impl_.event_number_ = int64_t{0};
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline int64_t EventRecord::_internal_event_number() const {
+  return _impl_.event_number_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int64 EventRecord::event_number() const {
+inline int64_t EventRecord::event_number() const {
   // @@protoc_insertion_point(field_get:es.message.EventRecord.event_number)
-  return event_number_;
+  return _internal_event_number();
 }
-inline void EventRecord::set_event_number(::PROTOBUF_NAMESPACE_ID::int64 value) {
-  _has_bits_[0] |= 0x00000020u;
-  event_number_ = value;
+inline void EventRecord::_internal_set_event_number(int64_t value) {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.event_number_ = value;
+}
+inline void EventRecord::set_event_number(int64_t value) {
+  _internal_set_event_number(value);
   // @@protoc_insertion_point(field_set:es.message.EventRecord.event_number)
 }
 
 // required bytes event_id = 3;
+inline bool EventRecord::_internal_has_event_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
 inline bool EventRecord::has_event_id() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
+  return _internal_has_event_id();
 }
 inline void EventRecord::clear_event_id() {
-  event_id_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  _has_bits_[0] &= ~0x00000002u;
+  _impl_.event_id_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
 }
 inline const std::string& EventRecord::event_id() const {
   // @@protoc_insertion_point(field_get:es.message.EventRecord.event_id)
-  return event_id_.GetNoArena();
+  return _internal_event_id();
 }
-inline void EventRecord::set_event_id(const std::string& value) {
-  _has_bits_[0] |= 0x00000002u;
-  event_id_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void EventRecord::set_event_id(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.event_id_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:es.message.EventRecord.event_id)
 }
-inline void EventRecord::set_event_id(std::string&& value) {
-  _has_bits_[0] |= 0x00000002u;
-  event_id_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:es.message.EventRecord.event_id)
+inline std::string* EventRecord::mutable_event_id() {
+  std::string* _s = _internal_mutable_event_id();
+  // @@protoc_insertion_point(field_mutable:es.message.EventRecord.event_id)
+  return _s;
 }
-inline void EventRecord::set_event_id(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  _has_bits_[0] |= 0x00000002u;
-  event_id_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:es.message.EventRecord.event_id)
+inline const std::string& EventRecord::_internal_event_id() const {
+  return _impl_.event_id_.Get();
 }
-inline void EventRecord::set_event_id(const void* value, size_t size) {
-  _has_bits_[0] |= 0x00000002u;
-  event_id_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:es.message.EventRecord.event_id)
+inline void EventRecord::_internal_set_event_id(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.event_id_.Set(value, GetArenaForAllocation());
 }
-inline std::string* EventRecord::mutable_event_id() {
-  _has_bits_[0] |= 0x00000002u;
-  // @@protoc_insertion_point(field_mutable:es.message.EventRecord.event_id)
-  return event_id_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline std::string* EventRecord::_internal_mutable_event_id() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.event_id_.Mutable(GetArenaForAllocation());
 }
 inline std::string* EventRecord::release_event_id() {
   // @@protoc_insertion_point(field_release:es.message.EventRecord.event_id)
-  if (!has_event_id()) {
+  if (!_internal_has_event_id()) {
     return nullptr;
   }
-  _has_bits_[0] &= ~0x00000002u;
-  return event_id_.ReleaseNonDefaultNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.event_id_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.event_id_.IsDefault()) {
+    _impl_.event_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
 }
 inline void EventRecord::set_allocated_event_id(std::string* event_id) {
   if (event_id != nullptr) {
-    _has_bits_[0] |= 0x00000002u;
+    _impl_._has_bits_[0] |= 0x00000002u;
   } else {
-    _has_bits_[0] &= ~0x00000002u;
+    _impl_._has_bits_[0] &= ~0x00000002u;
   }
-  event_id_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), event_id);
+  _impl_.event_id_.SetAllocated(event_id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.event_id_.IsDefault()) {
+    _impl_.event_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:es.message.EventRecord.event_id)
 }
 
 // required string event_type = 4;
+inline bool EventRecord::_internal_has_event_type() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
 inline bool EventRecord::has_event_type() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
+  return _internal_has_event_type();
 }
 inline void EventRecord::clear_event_type() {
-  event_type_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  _has_bits_[0] &= ~0x00000004u;
+  _impl_.event_type_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000004u;
 }
 inline const std::string& EventRecord::event_type() const {
   // @@protoc_insertion_point(field_get:es.message.EventRecord.event_type)
-  return event_type_.GetNoArena();
+  return _internal_event_type();
 }
-inline void EventRecord::set_event_type(const std::string& value) {
-  _has_bits_[0] |= 0x00000004u;
-  event_type_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void EventRecord::set_event_type(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000004u;
+ _impl_.event_type_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:es.message.EventRecord.event_type)
 }
-inline void EventRecord::set_event_type(std::string&& value) {
-  _has_bits_[0] |= 0x00000004u;
-  event_type_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:es.message.EventRecord.event_type)
+inline std::string* EventRecord::mutable_event_type() {
+  std::string* _s = _internal_mutable_event_type();
+  // @@protoc_insertion_point(field_mutable:es.message.EventRecord.event_type)
+  return _s;
 }
-inline void EventRecord::set_event_type(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  _has_bits_[0] |= 0x00000004u;
-  event_type_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:es.message.EventRecord.event_type)
+inline const std::string& EventRecord::_internal_event_type() const {
+  return _impl_.event_type_.Get();
 }
-inline void EventRecord::set_event_type(const char* value, size_t size) {
-  _has_bits_[0] |= 0x00000004u;
-  event_type_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:es.message.EventRecord.event_type)
+inline void EventRecord::_internal_set_event_type(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.event_type_.Set(value, GetArenaForAllocation());
 }
-inline std::string* EventRecord::mutable_event_type() {
-  _has_bits_[0] |= 0x00000004u;
-  // @@protoc_insertion_point(field_mutable:es.message.EventRecord.event_type)
-  return event_type_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline std::string* EventRecord::_internal_mutable_event_type() {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  return _impl_.event_type_.Mutable(GetArenaForAllocation());
 }
 inline std::string* EventRecord::release_event_type() {
   // @@protoc_insertion_point(field_release:es.message.EventRecord.event_type)
-  if (!has_event_type()) {
+  if (!_internal_has_event_type()) {
     return nullptr;
   }
-  _has_bits_[0] &= ~0x00000004u;
-  return event_type_.ReleaseNonDefaultNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  auto* p = _impl_.event_type_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.event_type_.IsDefault()) {
+    _impl_.event_type_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
 }
 inline void EventRecord::set_allocated_event_type(std::string* event_type) {
   if (event_type != nullptr) {
-    _has_bits_[0] |= 0x00000004u;
+    _impl_._has_bits_[0] |= 0x00000004u;
   } else {
-    _has_bits_[0] &= ~0x00000004u;
+    _impl_._has_bits_[0] &= ~0x00000004u;
   }
-  event_type_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), event_type);
+  _impl_.event_type_.SetAllocated(event_type, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.event_type_.IsDefault()) {
+    _impl_.event_type_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:es.message.EventRecord.event_type)
 }
 
 // required int32 data_content_type = 5;
+inline bool EventRecord::_internal_has_data_content_type() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  return value;
+}
 inline bool EventRecord::has_data_content_type() const {
-  return (_has_bits_[0] & 0x00000040u) != 0;
+  return _internal_has_data_content_type();
 }
 inline void EventRecord::clear_data_content_type() {
-  data_content_type_ = 0;
-  _has_bits_[0] &= ~0x00000040u;
+  _impl_.data_content_type_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000040u;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 EventRecord::data_content_type() const {
+inline int32_t EventRecord::_internal_data_content_type() const {
+  return _impl_.data_content_type_;
+}
+inline int32_t EventRecord::data_content_type() const {
   // @@protoc_insertion_point(field_get:es.message.EventRecord.data_content_type)
-  return data_content_type_;
+  return _internal_data_content_type();
+}
+inline void EventRecord::_internal_set_data_content_type(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000040u;
+  _impl_.data_content_type_ = value;
 }
-inline void EventRecord::set_data_content_type(::PROTOBUF_NAMESPACE_ID::int32 value) {
-  _has_bits_[0] |= 0x00000040u;
-  data_content_type_ = value;
+inline void EventRecord::set_data_content_type(int32_t value) {
+  _internal_set_data_content_type(value);
   // @@protoc_insertion_point(field_set:es.message.EventRecord.data_content_type)
 }
 
 // required int32 metadata_content_type = 6;
+inline bool EventRecord::_internal_has_metadata_content_type() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000080u) != 0;
+  return value;
+}
 inline bool EventRecord::has_metadata_content_type() const {
-  return (_has_bits_[0] & 0x00000080u) != 0;
+  return _internal_has_metadata_content_type();
 }
 inline void EventRecord::clear_metadata_content_type() {
-  metadata_content_type_ = 0;
-  _has_bits_[0] &= ~0x00000080u;
+  _impl_.metadata_content_type_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000080u;
+}
+inline int32_t EventRecord::_internal_metadata_content_type() const {
+  return _impl_.metadata_content_type_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 EventRecord::metadata_content_type() const {
+inline int32_t EventRecord::metadata_content_type() const {
   // @@protoc_insertion_point(field_get:es.message.EventRecord.metadata_content_type)
-  return metadata_content_type_;
+  return _internal_metadata_content_type();
 }
-inline void EventRecord::set_metadata_content_type(::PROTOBUF_NAMESPACE_ID::int32 value) {
-  _has_bits_[0] |= 0x00000080u;
-  metadata_content_type_ = value;
+inline void EventRecord::_internal_set_metadata_content_type(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000080u;
+  _impl_.metadata_content_type_ = value;
+}
+inline void EventRecord::set_metadata_content_type(int32_t value) {
+  _internal_set_metadata_content_type(value);
   // @@protoc_insertion_point(field_set:es.message.EventRecord.metadata_content_type)
 }
 
 // required bytes data = 7;
+inline bool EventRecord::_internal_has_data() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
 inline bool EventRecord::has_data() const {
-  return (_has_bits_[0] & 0x00000008u) != 0;
+  return _internal_has_data();
 }
 inline void EventRecord::clear_data() {
-  data_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  _has_bits_[0] &= ~0x00000008u;
+  _impl_.data_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000008u;
 }
 inline const std::string& EventRecord::data() const {
   // @@protoc_insertion_point(field_get:es.message.EventRecord.data)
-  return data_.GetNoArena();
+  return _internal_data();
 }
-inline void EventRecord::set_data(const std::string& value) {
-  _has_bits_[0] |= 0x00000008u;
-  data_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void EventRecord::set_data(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000008u;
+ _impl_.data_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:es.message.EventRecord.data)
 }
-inline void EventRecord::set_data(std::string&& value) {
-  _has_bits_[0] |= 0x00000008u;
-  data_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:es.message.EventRecord.data)
+inline std::string* EventRecord::mutable_data() {
+  std::string* _s = _internal_mutable_data();
+  // @@protoc_insertion_point(field_mutable:es.message.EventRecord.data)
+  return _s;
 }
-inline void EventRecord::set_data(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  _has_bits_[0] |= 0x00000008u;
-  data_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:es.message.EventRecord.data)
+inline const std::string& EventRecord::_internal_data() const {
+  return _impl_.data_.Get();
 }
-inline void EventRecord::set_data(const void* value, size_t size) {
-  _has_bits_[0] |= 0x00000008u;
-  data_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:es.message.EventRecord.data)
+inline void EventRecord::_internal_set_data(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.data_.Set(value, GetArenaForAllocation());
 }
-inline std::string* EventRecord::mutable_data() {
-  _has_bits_[0] |= 0x00000008u;
-  // @@protoc_insertion_point(field_mutable:es.message.EventRecord.data)
-  return data_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline std::string* EventRecord::_internal_mutable_data() {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  return _impl_.data_.Mutable(GetArenaForAllocation());
 }
 inline std::string* EventRecord::release_data() {
   // @@protoc_insertion_point(field_release:es.message.EventRecord.data)
-  if (!has_data()) {
+  if (!_internal_has_data()) {
     return nullptr;
   }
-  _has_bits_[0] &= ~0x00000008u;
-  return data_.ReleaseNonDefaultNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  auto* p = _impl_.data_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.data_.IsDefault()) {
+    _impl_.data_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
 }
 inline void EventRecord::set_allocated_data(std::string* data) {
   if (data != nullptr) {
-    _has_bits_[0] |= 0x00000008u;
+    _impl_._has_bits_[0] |= 0x00000008u;
   } else {
-    _has_bits_[0] &= ~0x00000008u;
+    _impl_._has_bits_[0] &= ~0x00000008u;
   }
-  data_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), data);
+  _impl_.data_.SetAllocated(data, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.data_.IsDefault()) {
+    _impl_.data_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:es.message.EventRecord.data)
 }
 
 // optional bytes metadata = 8;
+inline bool EventRecord::_internal_has_metadata() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
 inline bool EventRecord::has_metadata() const {
-  return (_has_bits_[0] & 0x00000010u) != 0;
+  return _internal_has_metadata();
 }
 inline void EventRecord::clear_metadata() {
-  metadata_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  _has_bits_[0] &= ~0x00000010u;
+  _impl_.metadata_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000010u;
 }
 inline const std::string& EventRecord::metadata() const {
   // @@protoc_insertion_point(field_get:es.message.EventRecord.metadata)
-  return metadata_.GetNoArena();
+  return _internal_metadata();
 }
-inline void EventRecord::set_metadata(const std::string& value) {
-  _has_bits_[0] |= 0x00000010u;
-  metadata_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void EventRecord::set_metadata(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000010u;
+ _impl_.metadata_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:es.message.EventRecord.metadata)
 }
-inline void EventRecord::set_metadata(std::string&& value) {
-  _has_bits_[0] |= 0x00000010u;
-  metadata_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:es.message.EventRecord.metadata)
+inline std::string* EventRecord::mutable_metadata() {
+  std::string* _s = _internal_mutable_metadata();
+  // @@protoc_insertion_point(field_mutable:es.message.EventRecord.metadata)
+  return _s;
 }
-inline void EventRecord::set_metadata(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  _has_bits_[0] |= 0x00000010u;
-  metadata_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:es.message.EventRecord.metadata)
+inline const std::string& EventRecord::_internal_metadata() const {
+  return _impl_.metadata_.Get();
 }
-inline void EventRecord::set_metadata(const void* value, size_t size) {
-  _has_bits_[0] |= 0x00000010u;
-  metadata_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:es.message.EventRecord.metadata)
+inline void EventRecord::_internal_set_metadata(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.metadata_.Set(value, GetArenaForAllocation());
 }
-inline std::string* EventRecord::mutable_metadata() {
-  _has_bits_[0] |= 0x00000010u;
-  // @@protoc_insertion_point(field_mutable:es.message.EventRecord.metadata)
-  return metadata_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline std::string* EventRecord::_internal_mutable_metadata() {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  return _impl_.metadata_.Mutable(GetArenaForAllocation());
 }
 inline std::string* EventRecord::release_metadata() {
   // @@protoc_insertion_point(field_release:es.message.EventRecord.metadata)
-  if (!has_metadata()) {
+  if (!_internal_has_metadata()) {
     return nullptr;
   }
-  _has_bits_[0] &= ~0x00000010u;
-  return metadata_.ReleaseNonDefaultNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_._has_bits_[0] &= ~0x00000010u;
+  auto* p = _impl_.metadata_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.metadata_.IsDefault()) {
+    _impl_.metadata_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
 }
 inline void EventRecord::set_allocated_metadata(std::string* metadata) {
   if (metadata != nullptr) {
-    _has_bits_[0] |= 0x00000010u;
+    _impl_._has_bits_[0] |= 0x00000010u;
   } else {
-    _has_bits_[0] &= ~0x00000010u;
+    _impl_._has_bits_[0] &= ~0x00000010u;
   }
-  metadata_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), metadata);
+  _impl_.metadata_.SetAllocated(metadata, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.metadata_.IsDefault()) {
+    _impl_.metadata_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:es.message.EventRecord.metadata)
 }
 
 // optional int64 created = 9;
+inline bool EventRecord::_internal_has_created() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000100u) != 0;
+  return value;
+}
 inline bool EventRecord::has_created() const {
-  return (_has_bits_[0] & 0x00000100u) != 0;
+  return _internal_has_created();
 }
 inline void EventRecord::clear_created() {
-  created_ = PROTOBUF_LONGLONG(0);
-  _has_bits_[0] &= ~0x00000100u;
+  _impl_.created_ = int64_t{0};
+  _impl_._has_bits_[0] &= ~0x00000100u;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int64 EventRecord::created() const {
+inline int64_t EventRecord::_internal_created() const {
+  return _impl_.created_;
+}
+inline int64_t EventRecord::created() const {
   // @@protoc_insertion_point(field_get:es.message.EventRecord.created)
-  return created_;
+  return _internal_created();
+}
+inline void EventRecord::_internal_set_created(int64_t value) {
+  _impl_._has_bits_[0] |= 0x00000100u;
+  _impl_.created_ = value;
 }
-inline void EventRecord::set_created(::PROTOBUF_NAMESPACE_ID::int64 value) {
-  _has_bits_[0] |= 0x00000100u;
-  created_ = value;
+inline void EventRecord::set_created(int64_t value) {
+  _internal_set_created(value);
   // @@protoc_insertion_point(field_set:es.message.EventRecord.created)
 }
 
 // optional int64 created_epoch = 10;
+inline bool EventRecord::_internal_has_created_epoch() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000200u) != 0;
+  return value;
+}
 inline bool EventRecord::has_created_epoch() const {
-  return (_has_bits_[0] & 0x00000200u) != 0;
+  return _internal_has_created_epoch();
 }
 inline void EventRecord::clear_created_epoch() {
-  created_epoch_ = PROTOBUF_LONGLONG(0);
-  _has_bits_[0] &= ~0x00000200u;
+  _impl_.created_epoch_ = int64_t{0};
+  _impl_._has_bits_[0] &= ~0x00000200u;
+}
+inline int64_t EventRecord::_internal_created_epoch() const {
+  return _impl_.created_epoch_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int64 EventRecord::created_epoch() const {
+inline int64_t EventRecord::created_epoch() const {
   // @@protoc_insertion_point(field_get:es.message.EventRecord.created_epoch)
-  return created_epoch_;
+  return _internal_created_epoch();
 }
-inline void EventRecord::set_created_epoch(::PROTOBUF_NAMESPACE_ID::int64 value) {
-  _has_bits_[0] |= 0x00000200u;
-  created_epoch_ = value;
+inline void EventRecord::_internal_set_created_epoch(int64_t value) {
+  _impl_._has_bits_[0] |= 0x00000200u;
+  _impl_.created_epoch_ = value;
+}
+inline void EventRecord::set_created_epoch(int64_t value) {
+  _internal_set_created_epoch(value);
   // @@protoc_insertion_point(field_set:es.message.EventRecord.created_epoch)
 }
 
@@ -8801,100 +10574,182 @@ inline void EventRecord::set_created_epoch(::PROTOBUF_NAMESPACE_ID::int64 value)
 // ResolvedIndexedEvent
 
 // required .es.message.EventRecord event = 1;
+inline bool ResolvedIndexedEvent::_internal_has_event() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.event_ != nullptr);
+  return value;
+}
 inline bool ResolvedIndexedEvent::has_event() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+  return _internal_has_event();
 }
 inline void ResolvedIndexedEvent::clear_event() {
-  if (event_ != nullptr) event_->Clear();
-  _has_bits_[0] &= ~0x00000001u;
+  if (_impl_.event_ != nullptr) _impl_.event_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const ::es::message::EventRecord& ResolvedIndexedEvent::_internal_event() const {
+  const ::es::message::EventRecord* p = _impl_.event_;
+  return p != nullptr ? *p : reinterpret_cast<const ::es::message::EventRecord&>(
+      ::es::message::_EventRecord_default_instance_);
 }
 inline const ::es::message::EventRecord& ResolvedIndexedEvent::event() const {
-  const ::es::message::EventRecord* p = event_;
   // @@protoc_insertion_point(field_get:es.message.ResolvedIndexedEvent.event)
-  return p != nullptr ? *p : *reinterpret_cast<const ::es::message::EventRecord*>(
-      &::es::message::_EventRecord_default_instance_);
+  return _internal_event();
+}
+inline void ResolvedIndexedEvent::unsafe_arena_set_allocated_event(
+    ::es::message::EventRecord* event) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.event_);
+  }
+  _impl_.event_ = event;
+  if (event) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:es.message.ResolvedIndexedEvent.event)
 }
 inline ::es::message::EventRecord* ResolvedIndexedEvent::release_event() {
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::es::message::EventRecord* temp = _impl_.event_;
+  _impl_.event_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::es::message::EventRecord* ResolvedIndexedEvent::unsafe_arena_release_event() {
   // @@protoc_insertion_point(field_release:es.message.ResolvedIndexedEvent.event)
-  _has_bits_[0] &= ~0x00000001u;
-  ::es::message::EventRecord* temp = event_;
-  event_ = nullptr;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::es::message::EventRecord* temp = _impl_.event_;
+  _impl_.event_ = nullptr;
   return temp;
 }
-inline ::es::message::EventRecord* ResolvedIndexedEvent::mutable_event() {
-  _has_bits_[0] |= 0x00000001u;
-  if (event_ == nullptr) {
-    auto* p = CreateMaybeMessage<::es::message::EventRecord>(GetArenaNoVirtual());
-    event_ = p;
+inline ::es::message::EventRecord* ResolvedIndexedEvent::_internal_mutable_event() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.event_ == nullptr) {
+    auto* p = CreateMaybeMessage<::es::message::EventRecord>(GetArenaForAllocation());
+    _impl_.event_ = p;
   }
+  return _impl_.event_;
+}
+inline ::es::message::EventRecord* ResolvedIndexedEvent::mutable_event() {
+  ::es::message::EventRecord* _msg = _internal_mutable_event();
   // @@protoc_insertion_point(field_mutable:es.message.ResolvedIndexedEvent.event)
-  return event_;
+  return _msg;
 }
 inline void ResolvedIndexedEvent::set_allocated_event(::es::message::EventRecord* event) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete event_;
+    delete _impl_.event_;
   }
   if (event) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(event);
     if (message_arena != submessage_arena) {
       event = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, event, submessage_arena);
     }
-    _has_bits_[0] |= 0x00000001u;
+    _impl_._has_bits_[0] |= 0x00000001u;
   } else {
-    _has_bits_[0] &= ~0x00000001u;
+    _impl_._has_bits_[0] &= ~0x00000001u;
   }
-  event_ = event;
+  _impl_.event_ = event;
   // @@protoc_insertion_point(field_set_allocated:es.message.ResolvedIndexedEvent.event)
 }
 
 // optional .es.message.EventRecord link = 2;
+inline bool ResolvedIndexedEvent::_internal_has_link() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.link_ != nullptr);
+  return value;
+}
 inline bool ResolvedIndexedEvent::has_link() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
+  return _internal_has_link();
 }
 inline void ResolvedIndexedEvent::clear_link() {
-  if (link_ != nullptr) link_->Clear();
-  _has_bits_[0] &= ~0x00000002u;
+  if (_impl_.link_ != nullptr) _impl_.link_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const ::es::message::EventRecord& ResolvedIndexedEvent::_internal_link() const {
+  const ::es::message::EventRecord* p = _impl_.link_;
+  return p != nullptr ? *p : reinterpret_cast<const ::es::message::EventRecord&>(
+      ::es::message::_EventRecord_default_instance_);
 }
 inline const ::es::message::EventRecord& ResolvedIndexedEvent::link() const {
-  const ::es::message::EventRecord* p = link_;
   // @@protoc_insertion_point(field_get:es.message.ResolvedIndexedEvent.link)
-  return p != nullptr ? *p : *reinterpret_cast<const ::es::message::EventRecord*>(
-      &::es::message::_EventRecord_default_instance_);
+  return _internal_link();
+}
+inline void ResolvedIndexedEvent::unsafe_arena_set_allocated_link(
+    ::es::message::EventRecord* link) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.link_);
+  }
+  _impl_.link_ = link;
+  if (link) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:es.message.ResolvedIndexedEvent.link)
 }
 inline ::es::message::EventRecord* ResolvedIndexedEvent::release_link() {
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::es::message::EventRecord* temp = _impl_.link_;
+  _impl_.link_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::es::message::EventRecord* ResolvedIndexedEvent::unsafe_arena_release_link() {
   // @@protoc_insertion_point(field_release:es.message.ResolvedIndexedEvent.link)
-  _has_bits_[0] &= ~0x00000002u;
-  ::es::message::EventRecord* temp = link_;
-  link_ = nullptr;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::es::message::EventRecord* temp = _impl_.link_;
+  _impl_.link_ = nullptr;
   return temp;
 }
-inline ::es::message::EventRecord* ResolvedIndexedEvent::mutable_link() {
-  _has_bits_[0] |= 0x00000002u;
-  if (link_ == nullptr) {
-    auto* p = CreateMaybeMessage<::es::message::EventRecord>(GetArenaNoVirtual());
-    link_ = p;
+inline ::es::message::EventRecord* ResolvedIndexedEvent::_internal_mutable_link() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  if (_impl_.link_ == nullptr) {
+    auto* p = CreateMaybeMessage<::es::message::EventRecord>(GetArenaForAllocation());
+    _impl_.link_ = p;
   }
+  return _impl_.link_;
+}
+inline ::es::message::EventRecord* ResolvedIndexedEvent::mutable_link() {
+  ::es::message::EventRecord* _msg = _internal_mutable_link();
   // @@protoc_insertion_point(field_mutable:es.message.ResolvedIndexedEvent.link)
-  return link_;
+  return _msg;
 }
 inline void ResolvedIndexedEvent::set_allocated_link(::es::message::EventRecord* link) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete link_;
+    delete _impl_.link_;
   }
   if (link) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(link);
     if (message_arena != submessage_arena) {
       link = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, link, submessage_arena);
     }
-    _has_bits_[0] |= 0x00000002u;
+    _impl_._has_bits_[0] |= 0x00000002u;
   } else {
-    _has_bits_[0] &= ~0x00000002u;
+    _impl_._has_bits_[0] &= ~0x00000002u;
   }
-  link_ = link;
+  _impl_.link_ = link;
   // @@protoc_insertion_point(field_set_allocated:es.message.ResolvedIndexedEvent.link)
 }
 
@@ -8903,136 +10758,238 @@ inline void ResolvedIndexedEvent::set_allocated_link(::es::message::EventRecord*
 // ResolvedEvent
 
 // required .es.message.EventRecord event = 1;
+inline bool ResolvedEvent::_internal_has_event() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.event_ != nullptr);
+  return value;
+}
 inline bool ResolvedEvent::has_event() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+  return _internal_has_event();
 }
 inline void ResolvedEvent::clear_event() {
-  if (event_ != nullptr) event_->Clear();
-  _has_bits_[0] &= ~0x00000001u;
+  if (_impl_.event_ != nullptr) _impl_.event_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const ::es::message::EventRecord& ResolvedEvent::_internal_event() const {
+  const ::es::message::EventRecord* p = _impl_.event_;
+  return p != nullptr ? *p : reinterpret_cast<const ::es::message::EventRecord&>(
+      ::es::message::_EventRecord_default_instance_);
 }
 inline const ::es::message::EventRecord& ResolvedEvent::event() const {
-  const ::es::message::EventRecord* p = event_;
   // @@protoc_insertion_point(field_get:es.message.ResolvedEvent.event)
-  return p != nullptr ? *p : *reinterpret_cast<const ::es::message::EventRecord*>(
-      &::es::message::_EventRecord_default_instance_);
+  return _internal_event();
+}
+inline void ResolvedEvent::unsafe_arena_set_allocated_event(
+    ::es::message::EventRecord* event) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.event_);
+  }
+  _impl_.event_ = event;
+  if (event) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:es.message.ResolvedEvent.event)
 }
 inline ::es::message::EventRecord* ResolvedEvent::release_event() {
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::es::message::EventRecord* temp = _impl_.event_;
+  _impl_.event_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::es::message::EventRecord* ResolvedEvent::unsafe_arena_release_event() {
   // @@protoc_insertion_point(field_release:es.message.ResolvedEvent.event)
-  _has_bits_[0] &= ~0x00000001u;
-  ::es::message::EventRecord* temp = event_;
-  event_ = nullptr;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::es::message::EventRecord* temp = _impl_.event_;
+  _impl_.event_ = nullptr;
   return temp;
 }
-inline ::es::message::EventRecord* ResolvedEvent::mutable_event() {
-  _has_bits_[0] |= 0x00000001u;
-  if (event_ == nullptr) {
-    auto* p = CreateMaybeMessage<::es::message::EventRecord>(GetArenaNoVirtual());
-    event_ = p;
+inline ::es::message::EventRecord* ResolvedEvent::_internal_mutable_event() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.event_ == nullptr) {
+    auto* p = CreateMaybeMessage<::es::message::EventRecord>(GetArenaForAllocation());
+    _impl_.event_ = p;
   }
+  return _impl_.event_;
+}
+inline ::es::message::EventRecord* ResolvedEvent::mutable_event() {
+  ::es::message::EventRecord* _msg = _internal_mutable_event();
   // @@protoc_insertion_point(field_mutable:es.message.ResolvedEvent.event)
-  return event_;
+  return _msg;
 }
 inline void ResolvedEvent::set_allocated_event(::es::message::EventRecord* event) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete event_;
+    delete _impl_.event_;
   }
   if (event) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(event);
     if (message_arena != submessage_arena) {
       event = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, event, submessage_arena);
     }
-    _has_bits_[0] |= 0x00000001u;
+    _impl_._has_bits_[0] |= 0x00000001u;
   } else {
-    _has_bits_[0] &= ~0x00000001u;
+    _impl_._has_bits_[0] &= ~0x00000001u;
   }
-  event_ = event;
+  _impl_.event_ = event;
   // @@protoc_insertion_point(field_set_allocated:es.message.ResolvedEvent.event)
 }
 
 // optional .es.message.EventRecord link = 2;
+inline bool ResolvedEvent::_internal_has_link() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.link_ != nullptr);
+  return value;
+}
 inline bool ResolvedEvent::has_link() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
+  return _internal_has_link();
 }
 inline void ResolvedEvent::clear_link() {
-  if (link_ != nullptr) link_->Clear();
-  _has_bits_[0] &= ~0x00000002u;
+  if (_impl_.link_ != nullptr) _impl_.link_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const ::es::message::EventRecord& ResolvedEvent::_internal_link() const {
+  const ::es::message::EventRecord* p = _impl_.link_;
+  return p != nullptr ? *p : reinterpret_cast<const ::es::message::EventRecord&>(
+      ::es::message::_EventRecord_default_instance_);
 }
 inline const ::es::message::EventRecord& ResolvedEvent::link() const {
-  const ::es::message::EventRecord* p = link_;
   // @@protoc_insertion_point(field_get:es.message.ResolvedEvent.link)
-  return p != nullptr ? *p : *reinterpret_cast<const ::es::message::EventRecord*>(
-      &::es::message::_EventRecord_default_instance_);
+  return _internal_link();
+}
+inline void ResolvedEvent::unsafe_arena_set_allocated_link(
+    ::es::message::EventRecord* link) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.link_);
+  }
+  _impl_.link_ = link;
+  if (link) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:es.message.ResolvedEvent.link)
 }
 inline ::es::message::EventRecord* ResolvedEvent::release_link() {
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::es::message::EventRecord* temp = _impl_.link_;
+  _impl_.link_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::es::message::EventRecord* ResolvedEvent::unsafe_arena_release_link() {
   // @@protoc_insertion_point(field_release:es.message.ResolvedEvent.link)
-  _has_bits_[0] &= ~0x00000002u;
-  ::es::message::EventRecord* temp = link_;
-  link_ = nullptr;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::es::message::EventRecord* temp = _impl_.link_;
+  _impl_.link_ = nullptr;
   return temp;
 }
-inline ::es::message::EventRecord* ResolvedEvent::mutable_link() {
-  _has_bits_[0] |= 0x00000002u;
-  if (link_ == nullptr) {
-    auto* p = CreateMaybeMessage<::es::message::EventRecord>(GetArenaNoVirtual());
-    link_ = p;
+inline ::es::message::EventRecord* ResolvedEvent::_internal_mutable_link() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  if (_impl_.link_ == nullptr) {
+    auto* p = CreateMaybeMessage<::es::message::EventRecord>(GetArenaForAllocation());
+    _impl_.link_ = p;
   }
+  return _impl_.link_;
+}
+inline ::es::message::EventRecord* ResolvedEvent::mutable_link() {
+  ::es::message::EventRecord* _msg = _internal_mutable_link();
   // @@protoc_insertion_point(field_mutable:es.message.ResolvedEvent.link)
-  return link_;
+  return _msg;
 }
 inline void ResolvedEvent::set_allocated_link(::es::message::EventRecord* link) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete link_;
+    delete _impl_.link_;
   }
   if (link) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(link);
     if (message_arena != submessage_arena) {
       link = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, link, submessage_arena);
     }
-    _has_bits_[0] |= 0x00000002u;
+    _impl_._has_bits_[0] |= 0x00000002u;
   } else {
-    _has_bits_[0] &= ~0x00000002u;
+    _impl_._has_bits_[0] &= ~0x00000002u;
   }
-  link_ = link;
+  _impl_.link_ = link;
   // @@protoc_insertion_point(field_set_allocated:es.message.ResolvedEvent.link)
 }
 
 // required int64 commit_position = 3;
+inline bool ResolvedEvent::_internal_has_commit_position() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
 inline bool ResolvedEvent::has_commit_position() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
+  return _internal_has_commit_position();
 }
 inline void ResolvedEvent::clear_commit_position() {
-  commit_position_ = PROTOBUF_LONGLONG(0);
-  _has_bits_[0] &= ~0x00000004u;
+  _impl_.commit_position_ = int64_t{0};
+  _impl_._has_bits_[0] &= ~0x00000004u;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int64 ResolvedEvent::commit_position() const {
+inline int64_t ResolvedEvent::_internal_commit_position() const {
+  return _impl_.commit_position_;
+}
+inline int64_t ResolvedEvent::commit_position() const {
   // @@protoc_insertion_point(field_get:es.message.ResolvedEvent.commit_position)
-  return commit_position_;
+  return _internal_commit_position();
+}
+inline void ResolvedEvent::_internal_set_commit_position(int64_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.commit_position_ = value;
 }
-inline void ResolvedEvent::set_commit_position(::PROTOBUF_NAMESPACE_ID::int64 value) {
-  _has_bits_[0] |= 0x00000004u;
-  commit_position_ = value;
+inline void ResolvedEvent::set_commit_position(int64_t value) {
+  _internal_set_commit_position(value);
   // @@protoc_insertion_point(field_set:es.message.ResolvedEvent.commit_position)
 }
 
 // required int64 prepare_position = 4;
+inline bool ResolvedEvent::_internal_has_prepare_position() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
 inline bool ResolvedEvent::has_prepare_position() const {
-  return (_has_bits_[0] & 0x00000008u) != 0;
+  return _internal_has_prepare_position();
 }
 inline void ResolvedEvent::clear_prepare_position() {
-  prepare_position_ = PROTOBUF_LONGLONG(0);
-  _has_bits_[0] &= ~0x00000008u;
+  _impl_.prepare_position_ = int64_t{0};
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline int64_t ResolvedEvent::_internal_prepare_position() const {
+  return _impl_.prepare_position_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int64 ResolvedEvent::prepare_position() const {
+inline int64_t ResolvedEvent::prepare_position() const {
   // @@protoc_insertion_point(field_get:es.message.ResolvedEvent.prepare_position)
-  return prepare_position_;
+  return _internal_prepare_position();
 }
-inline void ResolvedEvent::set_prepare_position(::PROTOBUF_NAMESPACE_ID::int64 value) {
-  _has_bits_[0] |= 0x00000008u;
-  prepare_position_ = value;
+inline void ResolvedEvent::_internal_set_prepare_position(int64_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.prepare_position_ = value;
+}
+inline void ResolvedEvent::set_prepare_position(int64_t value) {
+  _internal_set_prepare_position(value);
   // @@protoc_insertion_point(field_set:es.message.ResolvedEvent.prepare_position)
 }
 
@@ -9041,126 +10998,166 @@ inline void ResolvedEvent::set_prepare_position(::PROTOBUF_NAMESPACE_ID::int64 v
 // WriteEvents
 
 // required string event_stream_id = 1;
+inline bool WriteEvents::_internal_has_event_stream_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
 inline bool WriteEvents::has_event_stream_id() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+  return _internal_has_event_stream_id();
 }
 inline void WriteEvents::clear_event_stream_id() {
-  event_stream_id_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  _has_bits_[0] &= ~0x00000001u;
+  _impl_.event_stream_id_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
 }
 inline const std::string& WriteEvents::event_stream_id() const {
   // @@protoc_insertion_point(field_get:es.message.WriteEvents.event_stream_id)
-  return event_stream_id_.GetNoArena();
+  return _internal_event_stream_id();
 }
-inline void WriteEvents::set_event_stream_id(const std::string& value) {
-  _has_bits_[0] |= 0x00000001u;
-  event_stream_id_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void WriteEvents::set_event_stream_id(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.event_stream_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:es.message.WriteEvents.event_stream_id)
 }
-inline void WriteEvents::set_event_stream_id(std::string&& value) {
-  _has_bits_[0] |= 0x00000001u;
-  event_stream_id_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:es.message.WriteEvents.event_stream_id)
+inline std::string* WriteEvents::mutable_event_stream_id() {
+  std::string* _s = _internal_mutable_event_stream_id();
+  // @@protoc_insertion_point(field_mutable:es.message.WriteEvents.event_stream_id)
+  return _s;
 }
-inline void WriteEvents::set_event_stream_id(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  _has_bits_[0] |= 0x00000001u;
-  event_stream_id_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:es.message.WriteEvents.event_stream_id)
+inline const std::string& WriteEvents::_internal_event_stream_id() const {
+  return _impl_.event_stream_id_.Get();
 }
-inline void WriteEvents::set_event_stream_id(const char* value, size_t size) {
-  _has_bits_[0] |= 0x00000001u;
-  event_stream_id_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:es.message.WriteEvents.event_stream_id)
+inline void WriteEvents::_internal_set_event_stream_id(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.event_stream_id_.Set(value, GetArenaForAllocation());
 }
-inline std::string* WriteEvents::mutable_event_stream_id() {
-  _has_bits_[0] |= 0x00000001u;
-  // @@protoc_insertion_point(field_mutable:es.message.WriteEvents.event_stream_id)
-  return event_stream_id_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline std::string* WriteEvents::_internal_mutable_event_stream_id() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.event_stream_id_.Mutable(GetArenaForAllocation());
 }
 inline std::string* WriteEvents::release_event_stream_id() {
   // @@protoc_insertion_point(field_release:es.message.WriteEvents.event_stream_id)
-  if (!has_event_stream_id()) {
+  if (!_internal_has_event_stream_id()) {
     return nullptr;
   }
-  _has_bits_[0] &= ~0x00000001u;
-  return event_stream_id_.ReleaseNonDefaultNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.event_stream_id_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.event_stream_id_.IsDefault()) {
+    _impl_.event_stream_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
 }
 inline void WriteEvents::set_allocated_event_stream_id(std::string* event_stream_id) {
   if (event_stream_id != nullptr) {
-    _has_bits_[0] |= 0x00000001u;
+    _impl_._has_bits_[0] |= 0x00000001u;
   } else {
-    _has_bits_[0] &= ~0x00000001u;
+    _impl_._has_bits_[0] &= ~0x00000001u;
   }
-  event_stream_id_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), event_stream_id);
+  _impl_.event_stream_id_.SetAllocated(event_stream_id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.event_stream_id_.IsDefault()) {
+    _impl_.event_stream_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:es.message.WriteEvents.event_stream_id)
 }
 
 // required int64 expected_version = 2;
+inline bool WriteEvents::_internal_has_expected_version() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
 inline bool WriteEvents::has_expected_version() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
+  return _internal_has_expected_version();
 }
 inline void WriteEvents::clear_expected_version() {
-  expected_version_ = PROTOBUF_LONGLONG(0);
-  _has_bits_[0] &= ~0x00000002u;
+  _impl_.expected_version_ = int64_t{0};
+  _impl_._has_bits_[0] &= ~0x00000002u;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int64 WriteEvents::expected_version() const {
+inline int64_t WriteEvents::_internal_expected_version() const {
+  return _impl_.expected_version_;
+}
+inline int64_t WriteEvents::expected_version() const {
   // @@protoc_insertion_point(field_get:es.message.WriteEvents.expected_version)
-  return expected_version_;
+  return _internal_expected_version();
+}
+inline void WriteEvents::_internal_set_expected_version(int64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.expected_version_ = value;
 }
-inline void WriteEvents::set_expected_version(::PROTOBUF_NAMESPACE_ID::int64 value) {
-  _has_bits_[0] |= 0x00000002u;
-  expected_version_ = value;
+inline void WriteEvents::set_expected_version(int64_t value) {
+  _internal_set_expected_version(value);
   // @@protoc_insertion_point(field_set:es.message.WriteEvents.expected_version)
 }
 
 // repeated .es.message.NewEvent events = 3;
+inline int WriteEvents::_internal_events_size() const {
+  return _impl_.events_.size();
+}
 inline int WriteEvents::events_size() const {
-  return events_.size();
+  return _internal_events_size();
 }
 inline void WriteEvents::clear_events() {
-  events_.Clear();
+  _impl_.events_.Clear();
 }
 inline ::es::message::NewEvent* WriteEvents::mutable_events(int index) {
   // @@protoc_insertion_point(field_mutable:es.message.WriteEvents.events)
-  return events_.Mutable(index);
+  return _impl_.events_.Mutable(index);
 }
 inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::es::message::NewEvent >*
 WriteEvents::mutable_events() {
   // @@protoc_insertion_point(field_mutable_list:es.message.WriteEvents.events)
-  return &events_;
+  return &_impl_.events_;
+}
+inline const ::es::message::NewEvent& WriteEvents::_internal_events(int index) const {
+  return _impl_.events_.Get(index);
 }
 inline const ::es::message::NewEvent& WriteEvents::events(int index) const {
   // @@protoc_insertion_point(field_get:es.message.WriteEvents.events)
-  return events_.Get(index);
+  return _internal_events(index);
+}
+inline ::es::message::NewEvent* WriteEvents::_internal_add_events() {
+  return _impl_.events_.Add();
 }
 inline ::es::message::NewEvent* WriteEvents::add_events() {
+  ::es::message::NewEvent* _add = _internal_add_events();
   // @@protoc_insertion_point(field_add:es.message.WriteEvents.events)
-  return events_.Add();
+  return _add;
 }
 inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::es::message::NewEvent >&
 WriteEvents::events() const {
   // @@protoc_insertion_point(field_list:es.message.WriteEvents.events)
-  return events_;
+  return _impl_.events_;
 }
 
 // required bool require_master = 4;
+inline bool WriteEvents::_internal_has_require_master() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
 inline bool WriteEvents::has_require_master() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
+  return _internal_has_require_master();
 }
 inline void WriteEvents::clear_require_master() {
-  require_master_ = false;
-  _has_bits_[0] &= ~0x00000004u;
+  _impl_.require_master_ = false;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline bool WriteEvents::_internal_require_master() const {
+  return _impl_.require_master_;
 }
 inline bool WriteEvents::require_master() const {
   // @@protoc_insertion_point(field_get:es.message.WriteEvents.require_master)
-  return require_master_;
+  return _internal_require_master();
+}
+inline void WriteEvents::_internal_set_require_master(bool value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.require_master_ = value;
 }
 inline void WriteEvents::set_require_master(bool value) {
-  _has_bits_[0] |= 0x00000004u;
-  require_master_ = value;
+  _internal_set_require_master(value);
   // @@protoc_insertion_point(field_set:es.message.WriteEvents.require_master)
 }
 
@@ -9169,169 +11166,239 @@ inline void WriteEvents::set_require_master(bool value) {
 // WriteEventsCompleted
 
 // required .es.message.OperationResult result = 1;
+inline bool WriteEventsCompleted::_internal_has_result() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  return value;
+}
 inline bool WriteEventsCompleted::has_result() const {
-  return (_has_bits_[0] & 0x00000040u) != 0;
+  return _internal_has_result();
 }
 inline void WriteEventsCompleted::clear_result() {
-  result_ = 0;
-  _has_bits_[0] &= ~0x00000040u;
+  _impl_.result_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000040u;
+}
+inline ::es::message::OperationResult WriteEventsCompleted::_internal_result() const {
+  return static_cast< ::es::message::OperationResult >(_impl_.result_);
 }
 inline ::es::message::OperationResult WriteEventsCompleted::result() const {
   // @@protoc_insertion_point(field_get:es.message.WriteEventsCompleted.result)
-  return static_cast< ::es::message::OperationResult >(result_);
+  return _internal_result();
 }
-inline void WriteEventsCompleted::set_result(::es::message::OperationResult value) {
+inline void WriteEventsCompleted::_internal_set_result(::es::message::OperationResult value) {
   assert(::es::message::OperationResult_IsValid(value));
-  _has_bits_[0] |= 0x00000040u;
-  result_ = value;
+  _impl_._has_bits_[0] |= 0x00000040u;
+  _impl_.result_ = value;
+}
+inline void WriteEventsCompleted::set_result(::es::message::OperationResult value) {
+  _internal_set_result(value);
   // @@protoc_insertion_point(field_set:es.message.WriteEventsCompleted.result)
 }
 
 // optional string message = 2;
+inline bool WriteEventsCompleted::_internal_has_message() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
 inline bool WriteEventsCompleted::has_message() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+  return _internal_has_message();
 }
 inline void WriteEventsCompleted::clear_message() {
-  message_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  _has_bits_[0] &= ~0x00000001u;
+  _impl_.message_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
 }
 inline const std::string& WriteEventsCompleted::message() const {
   // @@protoc_insertion_point(field_get:es.message.WriteEventsCompleted.message)
-  return message_.GetNoArena();
+  return _internal_message();
 }
-inline void WriteEventsCompleted::set_message(const std::string& value) {
-  _has_bits_[0] |= 0x00000001u;
-  message_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void WriteEventsCompleted::set_message(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.message_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:es.message.WriteEventsCompleted.message)
 }
-inline void WriteEventsCompleted::set_message(std::string&& value) {
-  _has_bits_[0] |= 0x00000001u;
-  message_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:es.message.WriteEventsCompleted.message)
+inline std::string* WriteEventsCompleted::mutable_message() {
+  std::string* _s = _internal_mutable_message();
+  // @@protoc_insertion_point(field_mutable:es.message.WriteEventsCompleted.message)
+  return _s;
 }
-inline void WriteEventsCompleted::set_message(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  _has_bits_[0] |= 0x00000001u;
-  message_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:es.message.WriteEventsCompleted.message)
+inline const std::string& WriteEventsCompleted::_internal_message() const {
+  return _impl_.message_.Get();
 }
-inline void WriteEventsCompleted::set_message(const char* value, size_t size) {
-  _has_bits_[0] |= 0x00000001u;
-  message_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:es.message.WriteEventsCompleted.message)
+inline void WriteEventsCompleted::_internal_set_message(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.message_.Set(value, GetArenaForAllocation());
 }
-inline std::string* WriteEventsCompleted::mutable_message() {
-  _has_bits_[0] |= 0x00000001u;
-  // @@protoc_insertion_point(field_mutable:es.message.WriteEventsCompleted.message)
-  return message_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline std::string* WriteEventsCompleted::_internal_mutable_message() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.message_.Mutable(GetArenaForAllocation());
 }
 inline std::string* WriteEventsCompleted::release_message() {
   // @@protoc_insertion_point(field_release:es.message.WriteEventsCompleted.message)
-  if (!has_message()) {
+  if (!_internal_has_message()) {
     return nullptr;
   }
-  _has_bits_[0] &= ~0x00000001u;
-  return message_.ReleaseNonDefaultNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.message_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.message_.IsDefault()) {
+    _impl_.message_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
 }
 inline void WriteEventsCompleted::set_allocated_message(std::string* message) {
   if (message != nullptr) {
-    _has_bits_[0] |= 0x00000001u;
+    _impl_._has_bits_[0] |= 0x00000001u;
   } else {
-    _has_bits_[0] &= ~0x00000001u;
+    _impl_._has_bits_[0] &= ~0x00000001u;
   }
-  message_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), message);
+  _impl_.message_.SetAllocated(message, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.message_.IsDefault()) {
+    _impl_.message_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:es.message.WriteEventsCompleted.message)
 }
 
 // required int64 first_event_number = 3;
+inline bool WriteEventsCompleted::_internal_has_first_event_number() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
 inline bool WriteEventsCompleted::has_first_event_number() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
+  return _internal_has_first_event_number();
 }
 inline void WriteEventsCompleted::clear_first_event_number() {
-  first_event_number_ = PROTOBUF_LONGLONG(0);
-  _has_bits_[0] &= ~0x00000002u;
+  _impl_.first_event_number_ = int64_t{0};
+  _impl_._has_bits_[0] &= ~0x00000002u;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int64 WriteEventsCompleted::first_event_number() const {
+inline int64_t WriteEventsCompleted::_internal_first_event_number() const {
+  return _impl_.first_event_number_;
+}
+inline int64_t WriteEventsCompleted::first_event_number() const {
   // @@protoc_insertion_point(field_get:es.message.WriteEventsCompleted.first_event_number)
-  return first_event_number_;
+  return _internal_first_event_number();
+}
+inline void WriteEventsCompleted::_internal_set_first_event_number(int64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.first_event_number_ = value;
 }
-inline void WriteEventsCompleted::set_first_event_number(::PROTOBUF_NAMESPACE_ID::int64 value) {
-  _has_bits_[0] |= 0x00000002u;
-  first_event_number_ = value;
+inline void WriteEventsCompleted::set_first_event_number(int64_t value) {
+  _internal_set_first_event_number(value);
   // @@protoc_insertion_point(field_set:es.message.WriteEventsCompleted.first_event_number)
 }
 
 // required int64 last_event_number = 4;
+inline bool WriteEventsCompleted::_internal_has_last_event_number() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
 inline bool WriteEventsCompleted::has_last_event_number() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
+  return _internal_has_last_event_number();
 }
 inline void WriteEventsCompleted::clear_last_event_number() {
-  last_event_number_ = PROTOBUF_LONGLONG(0);
-  _has_bits_[0] &= ~0x00000004u;
+  _impl_.last_event_number_ = int64_t{0};
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline int64_t WriteEventsCompleted::_internal_last_event_number() const {
+  return _impl_.last_event_number_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int64 WriteEventsCompleted::last_event_number() const {
+inline int64_t WriteEventsCompleted::last_event_number() const {
   // @@protoc_insertion_point(field_get:es.message.WriteEventsCompleted.last_event_number)
-  return last_event_number_;
+  return _internal_last_event_number();
 }
-inline void WriteEventsCompleted::set_last_event_number(::PROTOBUF_NAMESPACE_ID::int64 value) {
-  _has_bits_[0] |= 0x00000004u;
-  last_event_number_ = value;
+inline void WriteEventsCompleted::_internal_set_last_event_number(int64_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.last_event_number_ = value;
+}
+inline void WriteEventsCompleted::set_last_event_number(int64_t value) {
+  _internal_set_last_event_number(value);
   // @@protoc_insertion_point(field_set:es.message.WriteEventsCompleted.last_event_number)
 }
 
 // optional int64 prepare_position = 5;
+inline bool WriteEventsCompleted::_internal_has_prepare_position() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
 inline bool WriteEventsCompleted::has_prepare_position() const {
-  return (_has_bits_[0] & 0x00000008u) != 0;
+  return _internal_has_prepare_position();
 }
 inline void WriteEventsCompleted::clear_prepare_position() {
-  prepare_position_ = PROTOBUF_LONGLONG(0);
-  _has_bits_[0] &= ~0x00000008u;
+  _impl_.prepare_position_ = int64_t{0};
+  _impl_._has_bits_[0] &= ~0x00000008u;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int64 WriteEventsCompleted::prepare_position() const {
+inline int64_t WriteEventsCompleted::_internal_prepare_position() const {
+  return _impl_.prepare_position_;
+}
+inline int64_t WriteEventsCompleted::prepare_position() const {
   // @@protoc_insertion_point(field_get:es.message.WriteEventsCompleted.prepare_position)
-  return prepare_position_;
+  return _internal_prepare_position();
+}
+inline void WriteEventsCompleted::_internal_set_prepare_position(int64_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.prepare_position_ = value;
 }
-inline void WriteEventsCompleted::set_prepare_position(::PROTOBUF_NAMESPACE_ID::int64 value) {
-  _has_bits_[0] |= 0x00000008u;
-  prepare_position_ = value;
+inline void WriteEventsCompleted::set_prepare_position(int64_t value) {
+  _internal_set_prepare_position(value);
   // @@protoc_insertion_point(field_set:es.message.WriteEventsCompleted.prepare_position)
 }
 
 // optional int64 commit_position = 6;
+inline bool WriteEventsCompleted::_internal_has_commit_position() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
 inline bool WriteEventsCompleted::has_commit_position() const {
-  return (_has_bits_[0] & 0x00000010u) != 0;
+  return _internal_has_commit_position();
 }
 inline void WriteEventsCompleted::clear_commit_position() {
-  commit_position_ = PROTOBUF_LONGLONG(0);
-  _has_bits_[0] &= ~0x00000010u;
+  _impl_.commit_position_ = int64_t{0};
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline int64_t WriteEventsCompleted::_internal_commit_position() const {
+  return _impl_.commit_position_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int64 WriteEventsCompleted::commit_position() const {
+inline int64_t WriteEventsCompleted::commit_position() const {
   // @@protoc_insertion_point(field_get:es.message.WriteEventsCompleted.commit_position)
-  return commit_position_;
+  return _internal_commit_position();
 }
-inline void WriteEventsCompleted::set_commit_position(::PROTOBUF_NAMESPACE_ID::int64 value) {
-  _has_bits_[0] |= 0x00000010u;
-  commit_position_ = value;
+inline void WriteEventsCompleted::_internal_set_commit_position(int64_t value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.commit_position_ = value;
+}
+inline void WriteEventsCompleted::set_commit_position(int64_t value) {
+  _internal_set_commit_position(value);
   // @@protoc_insertion_point(field_set:es.message.WriteEventsCompleted.commit_position)
 }
 
 // optional int64 current_version = 7;
+inline bool WriteEventsCompleted::_internal_has_current_version() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
 inline bool WriteEventsCompleted::has_current_version() const {
-  return (_has_bits_[0] & 0x00000020u) != 0;
+  return _internal_has_current_version();
 }
 inline void WriteEventsCompleted::clear_current_version() {
-  current_version_ = PROTOBUF_LONGLONG(0);
-  _has_bits_[0] &= ~0x00000020u;
+  _impl_.current_version_ = int64_t{0};
+  _impl_._has_bits_[0] &= ~0x00000020u;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int64 WriteEventsCompleted::current_version() const {
+inline int64_t WriteEventsCompleted::_internal_current_version() const {
+  return _impl_.current_version_;
+}
+inline int64_t WriteEventsCompleted::current_version() const {
   // @@protoc_insertion_point(field_get:es.message.WriteEventsCompleted.current_version)
-  return current_version_;
+  return _internal_current_version();
+}
+inline void WriteEventsCompleted::_internal_set_current_version(int64_t value) {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.current_version_ = value;
 }
-inline void WriteEventsCompleted::set_current_version(::PROTOBUF_NAMESPACE_ID::int64 value) {
-  _has_bits_[0] |= 0x00000020u;
-  current_version_ = value;
+inline void WriteEventsCompleted::set_current_version(int64_t value) {
+  _internal_set_current_version(value);
   // @@protoc_insertion_point(field_set:es.message.WriteEventsCompleted.current_version)
 }
 
@@ -9340,114 +11407,154 @@ inline void WriteEventsCompleted::set_current_version(::PROTOBUF_NAMESPACE_ID::i
 // DeleteStream
 
 // required string event_stream_id = 1;
+inline bool DeleteStream::_internal_has_event_stream_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
 inline bool DeleteStream::has_event_stream_id() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+  return _internal_has_event_stream_id();
 }
 inline void DeleteStream::clear_event_stream_id() {
-  event_stream_id_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  _has_bits_[0] &= ~0x00000001u;
+  _impl_.event_stream_id_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
 }
 inline const std::string& DeleteStream::event_stream_id() const {
   // @@protoc_insertion_point(field_get:es.message.DeleteStream.event_stream_id)
-  return event_stream_id_.GetNoArena();
+  return _internal_event_stream_id();
 }
-inline void DeleteStream::set_event_stream_id(const std::string& value) {
-  _has_bits_[0] |= 0x00000001u;
-  event_stream_id_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void DeleteStream::set_event_stream_id(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.event_stream_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:es.message.DeleteStream.event_stream_id)
 }
-inline void DeleteStream::set_event_stream_id(std::string&& value) {
-  _has_bits_[0] |= 0x00000001u;
-  event_stream_id_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:es.message.DeleteStream.event_stream_id)
+inline std::string* DeleteStream::mutable_event_stream_id() {
+  std::string* _s = _internal_mutable_event_stream_id();
+  // @@protoc_insertion_point(field_mutable:es.message.DeleteStream.event_stream_id)
+  return _s;
 }
-inline void DeleteStream::set_event_stream_id(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  _has_bits_[0] |= 0x00000001u;
-  event_stream_id_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:es.message.DeleteStream.event_stream_id)
+inline const std::string& DeleteStream::_internal_event_stream_id() const {
+  return _impl_.event_stream_id_.Get();
 }
-inline void DeleteStream::set_event_stream_id(const char* value, size_t size) {
-  _has_bits_[0] |= 0x00000001u;
-  event_stream_id_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:es.message.DeleteStream.event_stream_id)
+inline void DeleteStream::_internal_set_event_stream_id(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.event_stream_id_.Set(value, GetArenaForAllocation());
 }
-inline std::string* DeleteStream::mutable_event_stream_id() {
-  _has_bits_[0] |= 0x00000001u;
-  // @@protoc_insertion_point(field_mutable:es.message.DeleteStream.event_stream_id)
-  return event_stream_id_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline std::string* DeleteStream::_internal_mutable_event_stream_id() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.event_stream_id_.Mutable(GetArenaForAllocation());
 }
 inline std::string* DeleteStream::release_event_stream_id() {
   // @@protoc_insertion_point(field_release:es.message.DeleteStream.event_stream_id)
-  if (!has_event_stream_id()) {
+  if (!_internal_has_event_stream_id()) {
     return nullptr;
   }
-  _has_bits_[0] &= ~0x00000001u;
-  return event_stream_id_.ReleaseNonDefaultNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.event_stream_id_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.event_stream_id_.IsDefault()) {
+    _impl_.event_stream_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
 }
 inline void DeleteStream::set_allocated_event_stream_id(std::string* event_stream_id) {
   if (event_stream_id != nullptr) {
-    _has_bits_[0] |= 0x00000001u;
+    _impl_._has_bits_[0] |= 0x00000001u;
   } else {
-    _has_bits_[0] &= ~0x00000001u;
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.event_stream_id_.SetAllocated(event_stream_id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.event_stream_id_.IsDefault()) {
+    _impl_.event_stream_id_.Set("", GetArenaForAllocation());
   }
-  event_stream_id_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), event_stream_id);
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:es.message.DeleteStream.event_stream_id)
 }
 
 // required int64 expected_version = 2;
+inline bool DeleteStream::_internal_has_expected_version() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
 inline bool DeleteStream::has_expected_version() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
+  return _internal_has_expected_version();
 }
 inline void DeleteStream::clear_expected_version() {
-  expected_version_ = PROTOBUF_LONGLONG(0);
-  _has_bits_[0] &= ~0x00000002u;
+  _impl_.expected_version_ = int64_t{0};
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline int64_t DeleteStream::_internal_expected_version() const {
+  return _impl_.expected_version_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int64 DeleteStream::expected_version() const {
+inline int64_t DeleteStream::expected_version() const {
   // @@protoc_insertion_point(field_get:es.message.DeleteStream.expected_version)
-  return expected_version_;
+  return _internal_expected_version();
 }
-inline void DeleteStream::set_expected_version(::PROTOBUF_NAMESPACE_ID::int64 value) {
-  _has_bits_[0] |= 0x00000002u;
-  expected_version_ = value;
+inline void DeleteStream::_internal_set_expected_version(int64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.expected_version_ = value;
+}
+inline void DeleteStream::set_expected_version(int64_t value) {
+  _internal_set_expected_version(value);
   // @@protoc_insertion_point(field_set:es.message.DeleteStream.expected_version)
 }
 
 // required bool require_master = 3;
+inline bool DeleteStream::_internal_has_require_master() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
 inline bool DeleteStream::has_require_master() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
+  return _internal_has_require_master();
 }
 inline void DeleteStream::clear_require_master() {
-  require_master_ = false;
-  _has_bits_[0] &= ~0x00000004u;
+  _impl_.require_master_ = false;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline bool DeleteStream::_internal_require_master() const {
+  return _impl_.require_master_;
 }
 inline bool DeleteStream::require_master() const {
   // @@protoc_insertion_point(field_get:es.message.DeleteStream.require_master)
-  return require_master_;
+  return _internal_require_master();
+}
+inline void DeleteStream::_internal_set_require_master(bool value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.require_master_ = value;
 }
 inline void DeleteStream::set_require_master(bool value) {
-  _has_bits_[0] |= 0x00000004u;
-  require_master_ = value;
+  _internal_set_require_master(value);
   // @@protoc_insertion_point(field_set:es.message.DeleteStream.require_master)
 }
 
 // optional bool hard_delete = 4;
+inline bool DeleteStream::_internal_has_hard_delete() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
 inline bool DeleteStream::has_hard_delete() const {
-  return (_has_bits_[0] & 0x00000008u) != 0;
+  return _internal_has_hard_delete();
 }
 inline void DeleteStream::clear_hard_delete() {
-  hard_delete_ = false;
-  _has_bits_[0] &= ~0x00000008u;
+  _impl_.hard_delete_ = false;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline bool DeleteStream::_internal_hard_delete() const {
+  return _impl_.hard_delete_;
 }
 inline bool DeleteStream::hard_delete() const {
   // @@protoc_insertion_point(field_get:es.message.DeleteStream.hard_delete)
-  return hard_delete_;
+  return _internal_hard_delete();
+}
+inline void DeleteStream::_internal_set_hard_delete(bool value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.hard_delete_ = value;
 }
 inline void DeleteStream::set_hard_delete(bool value) {
-  _has_bits_[0] |= 0x00000008u;
-  hard_delete_ = value;
+  _internal_set_hard_delete(value);
   // @@protoc_insertion_point(field_set:es.message.DeleteStream.hard_delete)
 }
 
@@ -9456,115 +11563,155 @@ inline void DeleteStream::set_hard_delete(bool value) {
 // DeleteStreamCompleted
 
 // required .es.message.OperationResult result = 1;
+inline bool DeleteStreamCompleted::_internal_has_result() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
 inline bool DeleteStreamCompleted::has_result() const {
-  return (_has_bits_[0] & 0x00000008u) != 0;
+  return _internal_has_result();
 }
 inline void DeleteStreamCompleted::clear_result() {
-  result_ = 0;
-  _has_bits_[0] &= ~0x00000008u;
+  _impl_.result_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline ::es::message::OperationResult DeleteStreamCompleted::_internal_result() const {
+  return static_cast< ::es::message::OperationResult >(_impl_.result_);
 }
 inline ::es::message::OperationResult DeleteStreamCompleted::result() const {
   // @@protoc_insertion_point(field_get:es.message.DeleteStreamCompleted.result)
-  return static_cast< ::es::message::OperationResult >(result_);
+  return _internal_result();
 }
-inline void DeleteStreamCompleted::set_result(::es::message::OperationResult value) {
+inline void DeleteStreamCompleted::_internal_set_result(::es::message::OperationResult value) {
   assert(::es::message::OperationResult_IsValid(value));
-  _has_bits_[0] |= 0x00000008u;
-  result_ = value;
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.result_ = value;
+}
+inline void DeleteStreamCompleted::set_result(::es::message::OperationResult value) {
+  _internal_set_result(value);
   // @@protoc_insertion_point(field_set:es.message.DeleteStreamCompleted.result)
 }
 
 // optional string message = 2;
+inline bool DeleteStreamCompleted::_internal_has_message() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
 inline bool DeleteStreamCompleted::has_message() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+  return _internal_has_message();
 }
 inline void DeleteStreamCompleted::clear_message() {
-  message_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  _has_bits_[0] &= ~0x00000001u;
+  _impl_.message_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
 }
 inline const std::string& DeleteStreamCompleted::message() const {
   // @@protoc_insertion_point(field_get:es.message.DeleteStreamCompleted.message)
-  return message_.GetNoArena();
+  return _internal_message();
 }
-inline void DeleteStreamCompleted::set_message(const std::string& value) {
-  _has_bits_[0] |= 0x00000001u;
-  message_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void DeleteStreamCompleted::set_message(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.message_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:es.message.DeleteStreamCompleted.message)
 }
-inline void DeleteStreamCompleted::set_message(std::string&& value) {
-  _has_bits_[0] |= 0x00000001u;
-  message_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:es.message.DeleteStreamCompleted.message)
+inline std::string* DeleteStreamCompleted::mutable_message() {
+  std::string* _s = _internal_mutable_message();
+  // @@protoc_insertion_point(field_mutable:es.message.DeleteStreamCompleted.message)
+  return _s;
 }
-inline void DeleteStreamCompleted::set_message(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  _has_bits_[0] |= 0x00000001u;
-  message_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:es.message.DeleteStreamCompleted.message)
+inline const std::string& DeleteStreamCompleted::_internal_message() const {
+  return _impl_.message_.Get();
 }
-inline void DeleteStreamCompleted::set_message(const char* value, size_t size) {
-  _has_bits_[0] |= 0x00000001u;
-  message_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:es.message.DeleteStreamCompleted.message)
+inline void DeleteStreamCompleted::_internal_set_message(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.message_.Set(value, GetArenaForAllocation());
 }
-inline std::string* DeleteStreamCompleted::mutable_message() {
-  _has_bits_[0] |= 0x00000001u;
-  // @@protoc_insertion_point(field_mutable:es.message.DeleteStreamCompleted.message)
-  return message_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline std::string* DeleteStreamCompleted::_internal_mutable_message() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.message_.Mutable(GetArenaForAllocation());
 }
 inline std::string* DeleteStreamCompleted::release_message() {
   // @@protoc_insertion_point(field_release:es.message.DeleteStreamCompleted.message)
-  if (!has_message()) {
+  if (!_internal_has_message()) {
     return nullptr;
   }
-  _has_bits_[0] &= ~0x00000001u;
-  return message_.ReleaseNonDefaultNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.message_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.message_.IsDefault()) {
+    _impl_.message_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
 }
 inline void DeleteStreamCompleted::set_allocated_message(std::string* message) {
   if (message != nullptr) {
-    _has_bits_[0] |= 0x00000001u;
+    _impl_._has_bits_[0] |= 0x00000001u;
   } else {
-    _has_bits_[0] &= ~0x00000001u;
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.message_.SetAllocated(message, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.message_.IsDefault()) {
+    _impl_.message_.Set("", GetArenaForAllocation());
   }
-  message_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), message);
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:es.message.DeleteStreamCompleted.message)
 }
 
 // optional int64 prepare_position = 3;
+inline bool DeleteStreamCompleted::_internal_has_prepare_position() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
 inline bool DeleteStreamCompleted::has_prepare_position() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
+  return _internal_has_prepare_position();
 }
 inline void DeleteStreamCompleted::clear_prepare_position() {
-  prepare_position_ = PROTOBUF_LONGLONG(0);
-  _has_bits_[0] &= ~0x00000002u;
+  _impl_.prepare_position_ = int64_t{0};
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline int64_t DeleteStreamCompleted::_internal_prepare_position() const {
+  return _impl_.prepare_position_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int64 DeleteStreamCompleted::prepare_position() const {
+inline int64_t DeleteStreamCompleted::prepare_position() const {
   // @@protoc_insertion_point(field_get:es.message.DeleteStreamCompleted.prepare_position)
-  return prepare_position_;
+  return _internal_prepare_position();
 }
-inline void DeleteStreamCompleted::set_prepare_position(::PROTOBUF_NAMESPACE_ID::int64 value) {
-  _has_bits_[0] |= 0x00000002u;
-  prepare_position_ = value;
+inline void DeleteStreamCompleted::_internal_set_prepare_position(int64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.prepare_position_ = value;
+}
+inline void DeleteStreamCompleted::set_prepare_position(int64_t value) {
+  _internal_set_prepare_position(value);
   // @@protoc_insertion_point(field_set:es.message.DeleteStreamCompleted.prepare_position)
 }
 
 // optional int64 commit_position = 4;
+inline bool DeleteStreamCompleted::_internal_has_commit_position() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
 inline bool DeleteStreamCompleted::has_commit_position() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
+  return _internal_has_commit_position();
 }
 inline void DeleteStreamCompleted::clear_commit_position() {
-  commit_position_ = PROTOBUF_LONGLONG(0);
-  _has_bits_[0] &= ~0x00000004u;
+  _impl_.commit_position_ = int64_t{0};
+  _impl_._has_bits_[0] &= ~0x00000004u;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int64 DeleteStreamCompleted::commit_position() const {
+inline int64_t DeleteStreamCompleted::_internal_commit_position() const {
+  return _impl_.commit_position_;
+}
+inline int64_t DeleteStreamCompleted::commit_position() const {
   // @@protoc_insertion_point(field_get:es.message.DeleteStreamCompleted.commit_position)
-  return commit_position_;
+  return _internal_commit_position();
+}
+inline void DeleteStreamCompleted::_internal_set_commit_position(int64_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.commit_position_ = value;
 }
-inline void DeleteStreamCompleted::set_commit_position(::PROTOBUF_NAMESPACE_ID::int64 value) {
-  _has_bits_[0] |= 0x00000004u;
-  commit_position_ = value;
+inline void DeleteStreamCompleted::set_commit_position(int64_t value) {
+  _internal_set_commit_position(value);
   // @@protoc_insertion_point(field_set:es.message.DeleteStreamCompleted.commit_position)
 }
 
@@ -9573,96 +11720,126 @@ inline void DeleteStreamCompleted::set_commit_position(::PROTOBUF_NAMESPACE_ID::
 // TransactionStart
 
 // required string event_stream_id = 1;
+inline bool TransactionStart::_internal_has_event_stream_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
 inline bool TransactionStart::has_event_stream_id() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+  return _internal_has_event_stream_id();
 }
 inline void TransactionStart::clear_event_stream_id() {
-  event_stream_id_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  _has_bits_[0] &= ~0x00000001u;
+  _impl_.event_stream_id_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
 }
 inline const std::string& TransactionStart::event_stream_id() const {
   // @@protoc_insertion_point(field_get:es.message.TransactionStart.event_stream_id)
-  return event_stream_id_.GetNoArena();
+  return _internal_event_stream_id();
 }
-inline void TransactionStart::set_event_stream_id(const std::string& value) {
-  _has_bits_[0] |= 0x00000001u;
-  event_stream_id_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void TransactionStart::set_event_stream_id(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.event_stream_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:es.message.TransactionStart.event_stream_id)
 }
-inline void TransactionStart::set_event_stream_id(std::string&& value) {
-  _has_bits_[0] |= 0x00000001u;
-  event_stream_id_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:es.message.TransactionStart.event_stream_id)
+inline std::string* TransactionStart::mutable_event_stream_id() {
+  std::string* _s = _internal_mutable_event_stream_id();
+  // @@protoc_insertion_point(field_mutable:es.message.TransactionStart.event_stream_id)
+  return _s;
 }
-inline void TransactionStart::set_event_stream_id(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  _has_bits_[0] |= 0x00000001u;
-  event_stream_id_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:es.message.TransactionStart.event_stream_id)
+inline const std::string& TransactionStart::_internal_event_stream_id() const {
+  return _impl_.event_stream_id_.Get();
 }
-inline void TransactionStart::set_event_stream_id(const char* value, size_t size) {
-  _has_bits_[0] |= 0x00000001u;
-  event_stream_id_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:es.message.TransactionStart.event_stream_id)
+inline void TransactionStart::_internal_set_event_stream_id(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.event_stream_id_.Set(value, GetArenaForAllocation());
 }
-inline std::string* TransactionStart::mutable_event_stream_id() {
-  _has_bits_[0] |= 0x00000001u;
-  // @@protoc_insertion_point(field_mutable:es.message.TransactionStart.event_stream_id)
-  return event_stream_id_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline std::string* TransactionStart::_internal_mutable_event_stream_id() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.event_stream_id_.Mutable(GetArenaForAllocation());
 }
 inline std::string* TransactionStart::release_event_stream_id() {
   // @@protoc_insertion_point(field_release:es.message.TransactionStart.event_stream_id)
-  if (!has_event_stream_id()) {
+  if (!_internal_has_event_stream_id()) {
     return nullptr;
   }
-  _has_bits_[0] &= ~0x00000001u;
-  return event_stream_id_.ReleaseNonDefaultNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.event_stream_id_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.event_stream_id_.IsDefault()) {
+    _impl_.event_stream_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
 }
 inline void TransactionStart::set_allocated_event_stream_id(std::string* event_stream_id) {
   if (event_stream_id != nullptr) {
-    _has_bits_[0] |= 0x00000001u;
+    _impl_._has_bits_[0] |= 0x00000001u;
   } else {
-    _has_bits_[0] &= ~0x00000001u;
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.event_stream_id_.SetAllocated(event_stream_id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.event_stream_id_.IsDefault()) {
+    _impl_.event_stream_id_.Set("", GetArenaForAllocation());
   }
-  event_stream_id_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), event_stream_id);
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:es.message.TransactionStart.event_stream_id)
 }
 
 // required int64 expected_version = 2;
+inline bool TransactionStart::_internal_has_expected_version() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
 inline bool TransactionStart::has_expected_version() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
+  return _internal_has_expected_version();
 }
 inline void TransactionStart::clear_expected_version() {
-  expected_version_ = PROTOBUF_LONGLONG(0);
-  _has_bits_[0] &= ~0x00000002u;
+  _impl_.expected_version_ = int64_t{0};
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline int64_t TransactionStart::_internal_expected_version() const {
+  return _impl_.expected_version_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int64 TransactionStart::expected_version() const {
+inline int64_t TransactionStart::expected_version() const {
   // @@protoc_insertion_point(field_get:es.message.TransactionStart.expected_version)
-  return expected_version_;
+  return _internal_expected_version();
 }
-inline void TransactionStart::set_expected_version(::PROTOBUF_NAMESPACE_ID::int64 value) {
-  _has_bits_[0] |= 0x00000002u;
-  expected_version_ = value;
+inline void TransactionStart::_internal_set_expected_version(int64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.expected_version_ = value;
+}
+inline void TransactionStart::set_expected_version(int64_t value) {
+  _internal_set_expected_version(value);
   // @@protoc_insertion_point(field_set:es.message.TransactionStart.expected_version)
 }
 
 // required bool require_master = 3;
+inline bool TransactionStart::_internal_has_require_master() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
 inline bool TransactionStart::has_require_master() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
+  return _internal_has_require_master();
 }
 inline void TransactionStart::clear_require_master() {
-  require_master_ = false;
-  _has_bits_[0] &= ~0x00000004u;
+  _impl_.require_master_ = false;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline bool TransactionStart::_internal_require_master() const {
+  return _impl_.require_master_;
 }
 inline bool TransactionStart::require_master() const {
   // @@protoc_insertion_point(field_get:es.message.TransactionStart.require_master)
-  return require_master_;
+  return _internal_require_master();
+}
+inline void TransactionStart::_internal_set_require_master(bool value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.require_master_ = value;
 }
 inline void TransactionStart::set_require_master(bool value) {
-  _has_bits_[0] |= 0x00000004u;
-  require_master_ = value;
+  _internal_set_require_master(value);
   // @@protoc_insertion_point(field_set:es.message.TransactionStart.require_master)
 }
 
@@ -9671,97 +11848,127 @@ inline void TransactionStart::set_require_master(bool value) {
 // TransactionStartCompleted
 
 // required int64 transaction_id = 1;
+inline bool TransactionStartCompleted::_internal_has_transaction_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
 inline bool TransactionStartCompleted::has_transaction_id() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
+  return _internal_has_transaction_id();
 }
 inline void TransactionStartCompleted::clear_transaction_id() {
-  transaction_id_ = PROTOBUF_LONGLONG(0);
-  _has_bits_[0] &= ~0x00000002u;
+  _impl_.transaction_id_ = int64_t{0};
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline int64_t TransactionStartCompleted::_internal_transaction_id() const {
+  return _impl_.transaction_id_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int64 TransactionStartCompleted::transaction_id() const {
+inline int64_t TransactionStartCompleted::transaction_id() const {
   // @@protoc_insertion_point(field_get:es.message.TransactionStartCompleted.transaction_id)
-  return transaction_id_;
+  return _internal_transaction_id();
 }
-inline void TransactionStartCompleted::set_transaction_id(::PROTOBUF_NAMESPACE_ID::int64 value) {
-  _has_bits_[0] |= 0x00000002u;
-  transaction_id_ = value;
+inline void TransactionStartCompleted::_internal_set_transaction_id(int64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.transaction_id_ = value;
+}
+inline void TransactionStartCompleted::set_transaction_id(int64_t value) {
+  _internal_set_transaction_id(value);
   // @@protoc_insertion_point(field_set:es.message.TransactionStartCompleted.transaction_id)
 }
 
 // required .es.message.OperationResult result = 2;
+inline bool TransactionStartCompleted::_internal_has_result() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
 inline bool TransactionStartCompleted::has_result() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
+  return _internal_has_result();
 }
 inline void TransactionStartCompleted::clear_result() {
-  result_ = 0;
-  _has_bits_[0] &= ~0x00000004u;
+  _impl_.result_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline ::es::message::OperationResult TransactionStartCompleted::_internal_result() const {
+  return static_cast< ::es::message::OperationResult >(_impl_.result_);
 }
 inline ::es::message::OperationResult TransactionStartCompleted::result() const {
   // @@protoc_insertion_point(field_get:es.message.TransactionStartCompleted.result)
-  return static_cast< ::es::message::OperationResult >(result_);
+  return _internal_result();
 }
-inline void TransactionStartCompleted::set_result(::es::message::OperationResult value) {
+inline void TransactionStartCompleted::_internal_set_result(::es::message::OperationResult value) {
   assert(::es::message::OperationResult_IsValid(value));
-  _has_bits_[0] |= 0x00000004u;
-  result_ = value;
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.result_ = value;
+}
+inline void TransactionStartCompleted::set_result(::es::message::OperationResult value) {
+  _internal_set_result(value);
   // @@protoc_insertion_point(field_set:es.message.TransactionStartCompleted.result)
 }
 
 // optional string message = 3;
+inline bool TransactionStartCompleted::_internal_has_message() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
 inline bool TransactionStartCompleted::has_message() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+  return _internal_has_message();
 }
 inline void TransactionStartCompleted::clear_message() {
-  message_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  _has_bits_[0] &= ~0x00000001u;
+  _impl_.message_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
 }
 inline const std::string& TransactionStartCompleted::message() const {
   // @@protoc_insertion_point(field_get:es.message.TransactionStartCompleted.message)
-  return message_.GetNoArena();
+  return _internal_message();
 }
-inline void TransactionStartCompleted::set_message(const std::string& value) {
-  _has_bits_[0] |= 0x00000001u;
-  message_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void TransactionStartCompleted::set_message(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.message_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:es.message.TransactionStartCompleted.message)
 }
-inline void TransactionStartCompleted::set_message(std::string&& value) {
-  _has_bits_[0] |= 0x00000001u;
-  message_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:es.message.TransactionStartCompleted.message)
+inline std::string* TransactionStartCompleted::mutable_message() {
+  std::string* _s = _internal_mutable_message();
+  // @@protoc_insertion_point(field_mutable:es.message.TransactionStartCompleted.message)
+  return _s;
 }
-inline void TransactionStartCompleted::set_message(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  _has_bits_[0] |= 0x00000001u;
-  message_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:es.message.TransactionStartCompleted.message)
+inline const std::string& TransactionStartCompleted::_internal_message() const {
+  return _impl_.message_.Get();
 }
-inline void TransactionStartCompleted::set_message(const char* value, size_t size) {
-  _has_bits_[0] |= 0x00000001u;
-  message_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:es.message.TransactionStartCompleted.message)
+inline void TransactionStartCompleted::_internal_set_message(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.message_.Set(value, GetArenaForAllocation());
 }
-inline std::string* TransactionStartCompleted::mutable_message() {
-  _has_bits_[0] |= 0x00000001u;
-  // @@protoc_insertion_point(field_mutable:es.message.TransactionStartCompleted.message)
-  return message_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline std::string* TransactionStartCompleted::_internal_mutable_message() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.message_.Mutable(GetArenaForAllocation());
 }
 inline std::string* TransactionStartCompleted::release_message() {
   // @@protoc_insertion_point(field_release:es.message.TransactionStartCompleted.message)
-  if (!has_message()) {
+  if (!_internal_has_message()) {
     return nullptr;
   }
-  _has_bits_[0] &= ~0x00000001u;
-  return message_.ReleaseNonDefaultNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.message_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.message_.IsDefault()) {
+    _impl_.message_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
 }
 inline void TransactionStartCompleted::set_allocated_message(std::string* message) {
   if (message != nullptr) {
-    _has_bits_[0] |= 0x00000001u;
+    _impl_._has_bits_[0] |= 0x00000001u;
   } else {
-    _has_bits_[0] &= ~0x00000001u;
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.message_.SetAllocated(message, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.message_.IsDefault()) {
+    _impl_.message_.Set("", GetArenaForAllocation());
   }
-  message_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), message);
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:es.message.TransactionStartCompleted.message)
 }
 
@@ -9770,68 +11977,98 @@ inline void TransactionStartCompleted::set_allocated_message(std::string* messag
 // TransactionWrite
 
 // required int64 transaction_id = 1;
+inline bool TransactionWrite::_internal_has_transaction_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
 inline bool TransactionWrite::has_transaction_id() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+  return _internal_has_transaction_id();
 }
 inline void TransactionWrite::clear_transaction_id() {
-  transaction_id_ = PROTOBUF_LONGLONG(0);
-  _has_bits_[0] &= ~0x00000001u;
+  _impl_.transaction_id_ = int64_t{0};
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline int64_t TransactionWrite::_internal_transaction_id() const {
+  return _impl_.transaction_id_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int64 TransactionWrite::transaction_id() const {
+inline int64_t TransactionWrite::transaction_id() const {
   // @@protoc_insertion_point(field_get:es.message.TransactionWrite.transaction_id)
-  return transaction_id_;
+  return _internal_transaction_id();
 }
-inline void TransactionWrite::set_transaction_id(::PROTOBUF_NAMESPACE_ID::int64 value) {
-  _has_bits_[0] |= 0x00000001u;
-  transaction_id_ = value;
+inline void TransactionWrite::_internal_set_transaction_id(int64_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.transaction_id_ = value;
+}
+inline void TransactionWrite::set_transaction_id(int64_t value) {
+  _internal_set_transaction_id(value);
   // @@protoc_insertion_point(field_set:es.message.TransactionWrite.transaction_id)
 }
 
 // repeated .es.message.NewEvent events = 2;
+inline int TransactionWrite::_internal_events_size() const {
+  return _impl_.events_.size();
+}
 inline int TransactionWrite::events_size() const {
-  return events_.size();
+  return _internal_events_size();
 }
 inline void TransactionWrite::clear_events() {
-  events_.Clear();
+  _impl_.events_.Clear();
 }
 inline ::es::message::NewEvent* TransactionWrite::mutable_events(int index) {
   // @@protoc_insertion_point(field_mutable:es.message.TransactionWrite.events)
-  return events_.Mutable(index);
+  return _impl_.events_.Mutable(index);
 }
 inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::es::message::NewEvent >*
 TransactionWrite::mutable_events() {
   // @@protoc_insertion_point(field_mutable_list:es.message.TransactionWrite.events)
-  return &events_;
+  return &_impl_.events_;
+}
+inline const ::es::message::NewEvent& TransactionWrite::_internal_events(int index) const {
+  return _impl_.events_.Get(index);
 }
 inline const ::es::message::NewEvent& TransactionWrite::events(int index) const {
   // @@protoc_insertion_point(field_get:es.message.TransactionWrite.events)
-  return events_.Get(index);
+  return _internal_events(index);
+}
+inline ::es::message::NewEvent* TransactionWrite::_internal_add_events() {
+  return _impl_.events_.Add();
 }
 inline ::es::message::NewEvent* TransactionWrite::add_events() {
+  ::es::message::NewEvent* _add = _internal_add_events();
   // @@protoc_insertion_point(field_add:es.message.TransactionWrite.events)
-  return events_.Add();
+  return _add;
 }
 inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::es::message::NewEvent >&
 TransactionWrite::events() const {
   // @@protoc_insertion_point(field_list:es.message.TransactionWrite.events)
-  return events_;
+  return _impl_.events_;
 }
 
 // required bool require_master = 3;
+inline bool TransactionWrite::_internal_has_require_master() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
 inline bool TransactionWrite::has_require_master() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
+  return _internal_has_require_master();
 }
 inline void TransactionWrite::clear_require_master() {
-  require_master_ = false;
-  _has_bits_[0] &= ~0x00000002u;
+  _impl_.require_master_ = false;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline bool TransactionWrite::_internal_require_master() const {
+  return _impl_.require_master_;
 }
 inline bool TransactionWrite::require_master() const {
   // @@protoc_insertion_point(field_get:es.message.TransactionWrite.require_master)
-  return require_master_;
+  return _internal_require_master();
+}
+inline void TransactionWrite::_internal_set_require_master(bool value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.require_master_ = value;
 }
 inline void TransactionWrite::set_require_master(bool value) {
-  _has_bits_[0] |= 0x00000002u;
-  require_master_ = value;
+  _internal_set_require_master(value);
   // @@protoc_insertion_point(field_set:es.message.TransactionWrite.require_master)
 }
 
@@ -9840,97 +12077,127 @@ inline void TransactionWrite::set_require_master(bool value) {
 // TransactionWriteCompleted
 
 // required int64 transaction_id = 1;
+inline bool TransactionWriteCompleted::_internal_has_transaction_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
 inline bool TransactionWriteCompleted::has_transaction_id() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
+  return _internal_has_transaction_id();
 }
 inline void TransactionWriteCompleted::clear_transaction_id() {
-  transaction_id_ = PROTOBUF_LONGLONG(0);
-  _has_bits_[0] &= ~0x00000002u;
+  _impl_.transaction_id_ = int64_t{0};
+  _impl_._has_bits_[0] &= ~0x00000002u;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int64 TransactionWriteCompleted::transaction_id() const {
+inline int64_t TransactionWriteCompleted::_internal_transaction_id() const {
+  return _impl_.transaction_id_;
+}
+inline int64_t TransactionWriteCompleted::transaction_id() const {
   // @@protoc_insertion_point(field_get:es.message.TransactionWriteCompleted.transaction_id)
-  return transaction_id_;
+  return _internal_transaction_id();
+}
+inline void TransactionWriteCompleted::_internal_set_transaction_id(int64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.transaction_id_ = value;
 }
-inline void TransactionWriteCompleted::set_transaction_id(::PROTOBUF_NAMESPACE_ID::int64 value) {
-  _has_bits_[0] |= 0x00000002u;
-  transaction_id_ = value;
+inline void TransactionWriteCompleted::set_transaction_id(int64_t value) {
+  _internal_set_transaction_id(value);
   // @@protoc_insertion_point(field_set:es.message.TransactionWriteCompleted.transaction_id)
 }
 
 // required .es.message.OperationResult result = 2;
+inline bool TransactionWriteCompleted::_internal_has_result() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
 inline bool TransactionWriteCompleted::has_result() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
+  return _internal_has_result();
 }
 inline void TransactionWriteCompleted::clear_result() {
-  result_ = 0;
-  _has_bits_[0] &= ~0x00000004u;
+  _impl_.result_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline ::es::message::OperationResult TransactionWriteCompleted::_internal_result() const {
+  return static_cast< ::es::message::OperationResult >(_impl_.result_);
 }
 inline ::es::message::OperationResult TransactionWriteCompleted::result() const {
   // @@protoc_insertion_point(field_get:es.message.TransactionWriteCompleted.result)
-  return static_cast< ::es::message::OperationResult >(result_);
+  return _internal_result();
 }
-inline void TransactionWriteCompleted::set_result(::es::message::OperationResult value) {
+inline void TransactionWriteCompleted::_internal_set_result(::es::message::OperationResult value) {
   assert(::es::message::OperationResult_IsValid(value));
-  _has_bits_[0] |= 0x00000004u;
-  result_ = value;
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.result_ = value;
+}
+inline void TransactionWriteCompleted::set_result(::es::message::OperationResult value) {
+  _internal_set_result(value);
   // @@protoc_insertion_point(field_set:es.message.TransactionWriteCompleted.result)
 }
 
 // optional string message = 3;
+inline bool TransactionWriteCompleted::_internal_has_message() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
 inline bool TransactionWriteCompleted::has_message() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+  return _internal_has_message();
 }
 inline void TransactionWriteCompleted::clear_message() {
-  message_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  _has_bits_[0] &= ~0x00000001u;
+  _impl_.message_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
 }
 inline const std::string& TransactionWriteCompleted::message() const {
   // @@protoc_insertion_point(field_get:es.message.TransactionWriteCompleted.message)
-  return message_.GetNoArena();
+  return _internal_message();
 }
-inline void TransactionWriteCompleted::set_message(const std::string& value) {
-  _has_bits_[0] |= 0x00000001u;
-  message_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void TransactionWriteCompleted::set_message(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.message_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:es.message.TransactionWriteCompleted.message)
 }
-inline void TransactionWriteCompleted::set_message(std::string&& value) {
-  _has_bits_[0] |= 0x00000001u;
-  message_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:es.message.TransactionWriteCompleted.message)
+inline std::string* TransactionWriteCompleted::mutable_message() {
+  std::string* _s = _internal_mutable_message();
+  // @@protoc_insertion_point(field_mutable:es.message.TransactionWriteCompleted.message)
+  return _s;
 }
-inline void TransactionWriteCompleted::set_message(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  _has_bits_[0] |= 0x00000001u;
-  message_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:es.message.TransactionWriteCompleted.message)
+inline const std::string& TransactionWriteCompleted::_internal_message() const {
+  return _impl_.message_.Get();
 }
-inline void TransactionWriteCompleted::set_message(const char* value, size_t size) {
-  _has_bits_[0] |= 0x00000001u;
-  message_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:es.message.TransactionWriteCompleted.message)
+inline void TransactionWriteCompleted::_internal_set_message(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.message_.Set(value, GetArenaForAllocation());
 }
-inline std::string* TransactionWriteCompleted::mutable_message() {
-  _has_bits_[0] |= 0x00000001u;
-  // @@protoc_insertion_point(field_mutable:es.message.TransactionWriteCompleted.message)
-  return message_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline std::string* TransactionWriteCompleted::_internal_mutable_message() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.message_.Mutable(GetArenaForAllocation());
 }
 inline std::string* TransactionWriteCompleted::release_message() {
   // @@protoc_insertion_point(field_release:es.message.TransactionWriteCompleted.message)
-  if (!has_message()) {
+  if (!_internal_has_message()) {
     return nullptr;
   }
-  _has_bits_[0] &= ~0x00000001u;
-  return message_.ReleaseNonDefaultNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.message_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.message_.IsDefault()) {
+    _impl_.message_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
 }
 inline void TransactionWriteCompleted::set_allocated_message(std::string* message) {
   if (message != nullptr) {
-    _has_bits_[0] |= 0x00000001u;
+    _impl_._has_bits_[0] |= 0x00000001u;
   } else {
-    _has_bits_[0] &= ~0x00000001u;
+    _impl_._has_bits_[0] &= ~0x00000001u;
   }
-  message_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), message);
+  _impl_.message_.SetAllocated(message, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.message_.IsDefault()) {
+    _impl_.message_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:es.message.TransactionWriteCompleted.message)
 }
 
@@ -9939,38 +12206,58 @@ inline void TransactionWriteCompleted::set_allocated_message(std::string* messag
 // TransactionCommit
 
 // required int64 transaction_id = 1;
+inline bool TransactionCommit::_internal_has_transaction_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
 inline bool TransactionCommit::has_transaction_id() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+  return _internal_has_transaction_id();
 }
 inline void TransactionCommit::clear_transaction_id() {
-  transaction_id_ = PROTOBUF_LONGLONG(0);
-  _has_bits_[0] &= ~0x00000001u;
+  _impl_.transaction_id_ = int64_t{0};
+  _impl_._has_bits_[0] &= ~0x00000001u;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int64 TransactionCommit::transaction_id() const {
+inline int64_t TransactionCommit::_internal_transaction_id() const {
+  return _impl_.transaction_id_;
+}
+inline int64_t TransactionCommit::transaction_id() const {
   // @@protoc_insertion_point(field_get:es.message.TransactionCommit.transaction_id)
-  return transaction_id_;
+  return _internal_transaction_id();
+}
+inline void TransactionCommit::_internal_set_transaction_id(int64_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.transaction_id_ = value;
 }
-inline void TransactionCommit::set_transaction_id(::PROTOBUF_NAMESPACE_ID::int64 value) {
-  _has_bits_[0] |= 0x00000001u;
-  transaction_id_ = value;
+inline void TransactionCommit::set_transaction_id(int64_t value) {
+  _internal_set_transaction_id(value);
   // @@protoc_insertion_point(field_set:es.message.TransactionCommit.transaction_id)
 }
 
 // required bool require_master = 2;
+inline bool TransactionCommit::_internal_has_require_master() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
 inline bool TransactionCommit::has_require_master() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
+  return _internal_has_require_master();
 }
 inline void TransactionCommit::clear_require_master() {
-  require_master_ = false;
-  _has_bits_[0] &= ~0x00000002u;
+  _impl_.require_master_ = false;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline bool TransactionCommit::_internal_require_master() const {
+  return _impl_.require_master_;
 }
 inline bool TransactionCommit::require_master() const {
   // @@protoc_insertion_point(field_get:es.message.TransactionCommit.require_master)
-  return require_master_;
+  return _internal_require_master();
+}
+inline void TransactionCommit::_internal_set_require_master(bool value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.require_master_ = value;
 }
 inline void TransactionCommit::set_require_master(bool value) {
-  _has_bits_[0] |= 0x00000002u;
-  require_master_ = value;
+  _internal_set_require_master(value);
   // @@protoc_insertion_point(field_set:es.message.TransactionCommit.require_master)
 }
 
@@ -9979,169 +12266,239 @@ inline void TransactionCommit::set_require_master(bool value) {
 // TransactionCommitCompleted
 
 // required int64 transaction_id = 1;
+inline bool TransactionCommitCompleted::_internal_has_transaction_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
 inline bool TransactionCommitCompleted::has_transaction_id() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
+  return _internal_has_transaction_id();
 }
 inline void TransactionCommitCompleted::clear_transaction_id() {
-  transaction_id_ = PROTOBUF_LONGLONG(0);
-  _has_bits_[0] &= ~0x00000002u;
+  _impl_.transaction_id_ = int64_t{0};
+  _impl_._has_bits_[0] &= ~0x00000002u;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int64 TransactionCommitCompleted::transaction_id() const {
+inline int64_t TransactionCommitCompleted::_internal_transaction_id() const {
+  return _impl_.transaction_id_;
+}
+inline int64_t TransactionCommitCompleted::transaction_id() const {
   // @@protoc_insertion_point(field_get:es.message.TransactionCommitCompleted.transaction_id)
-  return transaction_id_;
+  return _internal_transaction_id();
+}
+inline void TransactionCommitCompleted::_internal_set_transaction_id(int64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.transaction_id_ = value;
 }
-inline void TransactionCommitCompleted::set_transaction_id(::PROTOBUF_NAMESPACE_ID::int64 value) {
-  _has_bits_[0] |= 0x00000002u;
-  transaction_id_ = value;
+inline void TransactionCommitCompleted::set_transaction_id(int64_t value) {
+  _internal_set_transaction_id(value);
   // @@protoc_insertion_point(field_set:es.message.TransactionCommitCompleted.transaction_id)
 }
 
 // required .es.message.OperationResult result = 2;
+inline bool TransactionCommitCompleted::_internal_has_result() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  return value;
+}
 inline bool TransactionCommitCompleted::has_result() const {
-  return (_has_bits_[0] & 0x00000040u) != 0;
+  return _internal_has_result();
 }
 inline void TransactionCommitCompleted::clear_result() {
-  result_ = 0;
-  _has_bits_[0] &= ~0x00000040u;
+  _impl_.result_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000040u;
+}
+inline ::es::message::OperationResult TransactionCommitCompleted::_internal_result() const {
+  return static_cast< ::es::message::OperationResult >(_impl_.result_);
 }
 inline ::es::message::OperationResult TransactionCommitCompleted::result() const {
   // @@protoc_insertion_point(field_get:es.message.TransactionCommitCompleted.result)
-  return static_cast< ::es::message::OperationResult >(result_);
+  return _internal_result();
 }
-inline void TransactionCommitCompleted::set_result(::es::message::OperationResult value) {
+inline void TransactionCommitCompleted::_internal_set_result(::es::message::OperationResult value) {
   assert(::es::message::OperationResult_IsValid(value));
-  _has_bits_[0] |= 0x00000040u;
-  result_ = value;
+  _impl_._has_bits_[0] |= 0x00000040u;
+  _impl_.result_ = value;
+}
+inline void TransactionCommitCompleted::set_result(::es::message::OperationResult value) {
+  _internal_set_result(value);
   // @@protoc_insertion_point(field_set:es.message.TransactionCommitCompleted.result)
 }
 
 // optional string message = 3;
+inline bool TransactionCommitCompleted::_internal_has_message() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
 inline bool TransactionCommitCompleted::has_message() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+  return _internal_has_message();
 }
 inline void TransactionCommitCompleted::clear_message() {
-  message_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  _has_bits_[0] &= ~0x00000001u;
+  _impl_.message_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
 }
 inline const std::string& TransactionCommitCompleted::message() const {
   // @@protoc_insertion_point(field_get:es.message.TransactionCommitCompleted.message)
-  return message_.GetNoArena();
+  return _internal_message();
 }
-inline void TransactionCommitCompleted::set_message(const std::string& value) {
-  _has_bits_[0] |= 0x00000001u;
-  message_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void TransactionCommitCompleted::set_message(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.message_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:es.message.TransactionCommitCompleted.message)
 }
-inline void TransactionCommitCompleted::set_message(std::string&& value) {
-  _has_bits_[0] |= 0x00000001u;
-  message_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:es.message.TransactionCommitCompleted.message)
+inline std::string* TransactionCommitCompleted::mutable_message() {
+  std::string* _s = _internal_mutable_message();
+  // @@protoc_insertion_point(field_mutable:es.message.TransactionCommitCompleted.message)
+  return _s;
 }
-inline void TransactionCommitCompleted::set_message(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  _has_bits_[0] |= 0x00000001u;
-  message_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:es.message.TransactionCommitCompleted.message)
+inline const std::string& TransactionCommitCompleted::_internal_message() const {
+  return _impl_.message_.Get();
 }
-inline void TransactionCommitCompleted::set_message(const char* value, size_t size) {
-  _has_bits_[0] |= 0x00000001u;
-  message_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:es.message.TransactionCommitCompleted.message)
+inline void TransactionCommitCompleted::_internal_set_message(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.message_.Set(value, GetArenaForAllocation());
 }
-inline std::string* TransactionCommitCompleted::mutable_message() {
-  _has_bits_[0] |= 0x00000001u;
-  // @@protoc_insertion_point(field_mutable:es.message.TransactionCommitCompleted.message)
-  return message_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline std::string* TransactionCommitCompleted::_internal_mutable_message() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.message_.Mutable(GetArenaForAllocation());
 }
 inline std::string* TransactionCommitCompleted::release_message() {
   // @@protoc_insertion_point(field_release:es.message.TransactionCommitCompleted.message)
-  if (!has_message()) {
+  if (!_internal_has_message()) {
     return nullptr;
   }
-  _has_bits_[0] &= ~0x00000001u;
-  return message_.ReleaseNonDefaultNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.message_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.message_.IsDefault()) {
+    _impl_.message_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
 }
 inline void TransactionCommitCompleted::set_allocated_message(std::string* message) {
   if (message != nullptr) {
-    _has_bits_[0] |= 0x00000001u;
+    _impl_._has_bits_[0] |= 0x00000001u;
   } else {
-    _has_bits_[0] &= ~0x00000001u;
+    _impl_._has_bits_[0] &= ~0x00000001u;
   }
-  message_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), message);
+  _impl_.message_.SetAllocated(message, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.message_.IsDefault()) {
+    _impl_.message_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:es.message.TransactionCommitCompleted.message)
 }
 
 // required int64 first_event_number = 4;
+inline bool TransactionCommitCompleted::_internal_has_first_event_number() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
 inline bool TransactionCommitCompleted::has_first_event_number() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
+  return _internal_has_first_event_number();
 }
 inline void TransactionCommitCompleted::clear_first_event_number() {
-  first_event_number_ = PROTOBUF_LONGLONG(0);
-  _has_bits_[0] &= ~0x00000004u;
+  _impl_.first_event_number_ = int64_t{0};
+  _impl_._has_bits_[0] &= ~0x00000004u;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int64 TransactionCommitCompleted::first_event_number() const {
+inline int64_t TransactionCommitCompleted::_internal_first_event_number() const {
+  return _impl_.first_event_number_;
+}
+inline int64_t TransactionCommitCompleted::first_event_number() const {
   // @@protoc_insertion_point(field_get:es.message.TransactionCommitCompleted.first_event_number)
-  return first_event_number_;
+  return _internal_first_event_number();
+}
+inline void TransactionCommitCompleted::_internal_set_first_event_number(int64_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.first_event_number_ = value;
 }
-inline void TransactionCommitCompleted::set_first_event_number(::PROTOBUF_NAMESPACE_ID::int64 value) {
-  _has_bits_[0] |= 0x00000004u;
-  first_event_number_ = value;
+inline void TransactionCommitCompleted::set_first_event_number(int64_t value) {
+  _internal_set_first_event_number(value);
   // @@protoc_insertion_point(field_set:es.message.TransactionCommitCompleted.first_event_number)
 }
 
 // required int64 last_event_number = 5;
+inline bool TransactionCommitCompleted::_internal_has_last_event_number() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
 inline bool TransactionCommitCompleted::has_last_event_number() const {
-  return (_has_bits_[0] & 0x00000008u) != 0;
+  return _internal_has_last_event_number();
 }
 inline void TransactionCommitCompleted::clear_last_event_number() {
-  last_event_number_ = PROTOBUF_LONGLONG(0);
-  _has_bits_[0] &= ~0x00000008u;
+  _impl_.last_event_number_ = int64_t{0};
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline int64_t TransactionCommitCompleted::_internal_last_event_number() const {
+  return _impl_.last_event_number_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int64 TransactionCommitCompleted::last_event_number() const {
+inline int64_t TransactionCommitCompleted::last_event_number() const {
   // @@protoc_insertion_point(field_get:es.message.TransactionCommitCompleted.last_event_number)
-  return last_event_number_;
+  return _internal_last_event_number();
 }
-inline void TransactionCommitCompleted::set_last_event_number(::PROTOBUF_NAMESPACE_ID::int64 value) {
-  _has_bits_[0] |= 0x00000008u;
-  last_event_number_ = value;
+inline void TransactionCommitCompleted::_internal_set_last_event_number(int64_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.last_event_number_ = value;
+}
+inline void TransactionCommitCompleted::set_last_event_number(int64_t value) {
+  _internal_set_last_event_number(value);
   // @@protoc_insertion_point(field_set:es.message.TransactionCommitCompleted.last_event_number)
 }
 
 // optional int64 prepare_position = 6;
+inline bool TransactionCommitCompleted::_internal_has_prepare_position() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
 inline bool TransactionCommitCompleted::has_prepare_position() const {
-  return (_has_bits_[0] & 0x00000010u) != 0;
+  return _internal_has_prepare_position();
 }
 inline void TransactionCommitCompleted::clear_prepare_position() {
-  prepare_position_ = PROTOBUF_LONGLONG(0);
-  _has_bits_[0] &= ~0x00000010u;
+  _impl_.prepare_position_ = int64_t{0};
+  _impl_._has_bits_[0] &= ~0x00000010u;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int64 TransactionCommitCompleted::prepare_position() const {
+inline int64_t TransactionCommitCompleted::_internal_prepare_position() const {
+  return _impl_.prepare_position_;
+}
+inline int64_t TransactionCommitCompleted::prepare_position() const {
   // @@protoc_insertion_point(field_get:es.message.TransactionCommitCompleted.prepare_position)
-  return prepare_position_;
+  return _internal_prepare_position();
+}
+inline void TransactionCommitCompleted::_internal_set_prepare_position(int64_t value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.prepare_position_ = value;
 }
-inline void TransactionCommitCompleted::set_prepare_position(::PROTOBUF_NAMESPACE_ID::int64 value) {
-  _has_bits_[0] |= 0x00000010u;
-  prepare_position_ = value;
+inline void TransactionCommitCompleted::set_prepare_position(int64_t value) {
+  _internal_set_prepare_position(value);
   // @@protoc_insertion_point(field_set:es.message.TransactionCommitCompleted.prepare_position)
 }
 
 // optional int64 commit_position = 7;
+inline bool TransactionCommitCompleted::_internal_has_commit_position() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
 inline bool TransactionCommitCompleted::has_commit_position() const {
-  return (_has_bits_[0] & 0x00000020u) != 0;
+  return _internal_has_commit_position();
 }
 inline void TransactionCommitCompleted::clear_commit_position() {
-  commit_position_ = PROTOBUF_LONGLONG(0);
-  _has_bits_[0] &= ~0x00000020u;
+  _impl_.commit_position_ = int64_t{0};
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline int64_t TransactionCommitCompleted::_internal_commit_position() const {
+  return _impl_.commit_position_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int64 TransactionCommitCompleted::commit_position() const {
+inline int64_t TransactionCommitCompleted::commit_position() const {
   // @@protoc_insertion_point(field_get:es.message.TransactionCommitCompleted.commit_position)
-  return commit_position_;
+  return _internal_commit_position();
 }
-inline void TransactionCommitCompleted::set_commit_position(::PROTOBUF_NAMESPACE_ID::int64 value) {
-  _has_bits_[0] |= 0x00000020u;
-  commit_position_ = value;
+inline void TransactionCommitCompleted::_internal_set_commit_position(int64_t value) {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.commit_position_ = value;
+}
+inline void TransactionCommitCompleted::set_commit_position(int64_t value) {
+  _internal_set_commit_position(value);
   // @@protoc_insertion_point(field_set:es.message.TransactionCommitCompleted.commit_position)
 }
 
@@ -10150,114 +12507,154 @@ inline void TransactionCommitCompleted::set_commit_position(::PROTOBUF_NAMESPACE
 // ReadEvent
 
 // required string event_stream_id = 1;
+inline bool ReadEvent::_internal_has_event_stream_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
 inline bool ReadEvent::has_event_stream_id() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+  return _internal_has_event_stream_id();
 }
 inline void ReadEvent::clear_event_stream_id() {
-  event_stream_id_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  _has_bits_[0] &= ~0x00000001u;
+  _impl_.event_stream_id_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
 }
 inline const std::string& ReadEvent::event_stream_id() const {
   // @@protoc_insertion_point(field_get:es.message.ReadEvent.event_stream_id)
-  return event_stream_id_.GetNoArena();
+  return _internal_event_stream_id();
 }
-inline void ReadEvent::set_event_stream_id(const std::string& value) {
-  _has_bits_[0] |= 0x00000001u;
-  event_stream_id_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ReadEvent::set_event_stream_id(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.event_stream_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:es.message.ReadEvent.event_stream_id)
 }
-inline void ReadEvent::set_event_stream_id(std::string&& value) {
-  _has_bits_[0] |= 0x00000001u;
-  event_stream_id_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:es.message.ReadEvent.event_stream_id)
+inline std::string* ReadEvent::mutable_event_stream_id() {
+  std::string* _s = _internal_mutable_event_stream_id();
+  // @@protoc_insertion_point(field_mutable:es.message.ReadEvent.event_stream_id)
+  return _s;
 }
-inline void ReadEvent::set_event_stream_id(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  _has_bits_[0] |= 0x00000001u;
-  event_stream_id_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:es.message.ReadEvent.event_stream_id)
+inline const std::string& ReadEvent::_internal_event_stream_id() const {
+  return _impl_.event_stream_id_.Get();
 }
-inline void ReadEvent::set_event_stream_id(const char* value, size_t size) {
-  _has_bits_[0] |= 0x00000001u;
-  event_stream_id_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:es.message.ReadEvent.event_stream_id)
+inline void ReadEvent::_internal_set_event_stream_id(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.event_stream_id_.Set(value, GetArenaForAllocation());
 }
-inline std::string* ReadEvent::mutable_event_stream_id() {
-  _has_bits_[0] |= 0x00000001u;
-  // @@protoc_insertion_point(field_mutable:es.message.ReadEvent.event_stream_id)
-  return event_stream_id_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline std::string* ReadEvent::_internal_mutable_event_stream_id() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.event_stream_id_.Mutable(GetArenaForAllocation());
 }
 inline std::string* ReadEvent::release_event_stream_id() {
   // @@protoc_insertion_point(field_release:es.message.ReadEvent.event_stream_id)
-  if (!has_event_stream_id()) {
+  if (!_internal_has_event_stream_id()) {
     return nullptr;
   }
-  _has_bits_[0] &= ~0x00000001u;
-  return event_stream_id_.ReleaseNonDefaultNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.event_stream_id_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.event_stream_id_.IsDefault()) {
+    _impl_.event_stream_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
 }
 inline void ReadEvent::set_allocated_event_stream_id(std::string* event_stream_id) {
   if (event_stream_id != nullptr) {
-    _has_bits_[0] |= 0x00000001u;
+    _impl_._has_bits_[0] |= 0x00000001u;
   } else {
-    _has_bits_[0] &= ~0x00000001u;
+    _impl_._has_bits_[0] &= ~0x00000001u;
   }
-  event_stream_id_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), event_stream_id);
+  _impl_.event_stream_id_.SetAllocated(event_stream_id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.event_stream_id_.IsDefault()) {
+    _impl_.event_stream_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:es.message.ReadEvent.event_stream_id)
 }
 
 // required int64 event_number = 2;
+inline bool ReadEvent::_internal_has_event_number() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
 inline bool ReadEvent::has_event_number() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
+  return _internal_has_event_number();
 }
 inline void ReadEvent::clear_event_number() {
-  event_number_ = PROTOBUF_LONGLONG(0);
-  _has_bits_[0] &= ~0x00000002u;
+  _impl_.event_number_ = int64_t{0};
+  _impl_._has_bits_[0] &= ~0x00000002u;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int64 ReadEvent::event_number() const {
+inline int64_t ReadEvent::_internal_event_number() const {
+  return _impl_.event_number_;
+}
+inline int64_t ReadEvent::event_number() const {
   // @@protoc_insertion_point(field_get:es.message.ReadEvent.event_number)
-  return event_number_;
+  return _internal_event_number();
+}
+inline void ReadEvent::_internal_set_event_number(int64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.event_number_ = value;
 }
-inline void ReadEvent::set_event_number(::PROTOBUF_NAMESPACE_ID::int64 value) {
-  _has_bits_[0] |= 0x00000002u;
-  event_number_ = value;
+inline void ReadEvent::set_event_number(int64_t value) {
+  _internal_set_event_number(value);
   // @@protoc_insertion_point(field_set:es.message.ReadEvent.event_number)
 }
 
 // required bool resolve_link_tos = 3;
+inline bool ReadEvent::_internal_has_resolve_link_tos() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
 inline bool ReadEvent::has_resolve_link_tos() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
+  return _internal_has_resolve_link_tos();
 }
 inline void ReadEvent::clear_resolve_link_tos() {
-  resolve_link_tos_ = false;
-  _has_bits_[0] &= ~0x00000004u;
+  _impl_.resolve_link_tos_ = false;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline bool ReadEvent::_internal_resolve_link_tos() const {
+  return _impl_.resolve_link_tos_;
 }
 inline bool ReadEvent::resolve_link_tos() const {
   // @@protoc_insertion_point(field_get:es.message.ReadEvent.resolve_link_tos)
-  return resolve_link_tos_;
+  return _internal_resolve_link_tos();
+}
+inline void ReadEvent::_internal_set_resolve_link_tos(bool value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.resolve_link_tos_ = value;
 }
 inline void ReadEvent::set_resolve_link_tos(bool value) {
-  _has_bits_[0] |= 0x00000004u;
-  resolve_link_tos_ = value;
+  _internal_set_resolve_link_tos(value);
   // @@protoc_insertion_point(field_set:es.message.ReadEvent.resolve_link_tos)
 }
 
 // required bool require_master = 4;
+inline bool ReadEvent::_internal_has_require_master() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
 inline bool ReadEvent::has_require_master() const {
-  return (_has_bits_[0] & 0x00000008u) != 0;
+  return _internal_has_require_master();
 }
 inline void ReadEvent::clear_require_master() {
-  require_master_ = false;
-  _has_bits_[0] &= ~0x00000008u;
+  _impl_.require_master_ = false;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline bool ReadEvent::_internal_require_master() const {
+  return _impl_.require_master_;
 }
 inline bool ReadEvent::require_master() const {
   // @@protoc_insertion_point(field_get:es.message.ReadEvent.require_master)
-  return require_master_;
+  return _internal_require_master();
+}
+inline void ReadEvent::_internal_set_require_master(bool value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.require_master_ = value;
 }
 inline void ReadEvent::set_require_master(bool value) {
-  _has_bits_[0] |= 0x00000008u;
-  require_master_ = value;
+  _internal_set_require_master(value);
   // @@protoc_insertion_point(field_set:es.message.ReadEvent.require_master)
 }
 
@@ -10266,128 +12663,189 @@ inline void ReadEvent::set_require_master(bool value) {
 // ReadEventCompleted
 
 // required .es.message.ReadEventCompleted.ReadEventResult result = 1;
+inline bool ReadEventCompleted::_internal_has_result() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
 inline bool ReadEventCompleted::has_result() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
+  return _internal_has_result();
 }
 inline void ReadEventCompleted::clear_result() {
-  result_ = 0;
-  _has_bits_[0] &= ~0x00000004u;
+  _impl_.result_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline ::es::message::ReadEventCompleted_ReadEventResult ReadEventCompleted::_internal_result() const {
+  return static_cast< ::es::message::ReadEventCompleted_ReadEventResult >(_impl_.result_);
 }
 inline ::es::message::ReadEventCompleted_ReadEventResult ReadEventCompleted::result() const {
   // @@protoc_insertion_point(field_get:es.message.ReadEventCompleted.result)
-  return static_cast< ::es::message::ReadEventCompleted_ReadEventResult >(result_);
+  return _internal_result();
 }
-inline void ReadEventCompleted::set_result(::es::message::ReadEventCompleted_ReadEventResult value) {
+inline void ReadEventCompleted::_internal_set_result(::es::message::ReadEventCompleted_ReadEventResult value) {
   assert(::es::message::ReadEventCompleted_ReadEventResult_IsValid(value));
-  _has_bits_[0] |= 0x00000004u;
-  result_ = value;
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.result_ = value;
+}
+inline void ReadEventCompleted::set_result(::es::message::ReadEventCompleted_ReadEventResult value) {
+  _internal_set_result(value);
   // @@protoc_insertion_point(field_set:es.message.ReadEventCompleted.result)
 }
 
 // required .es.message.ResolvedIndexedEvent event = 2;
+inline bool ReadEventCompleted::_internal_has_event() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.event_ != nullptr);
+  return value;
+}
 inline bool ReadEventCompleted::has_event() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
+  return _internal_has_event();
 }
 inline void ReadEventCompleted::clear_event() {
-  if (event_ != nullptr) event_->Clear();
-  _has_bits_[0] &= ~0x00000002u;
+  if (_impl_.event_ != nullptr) _impl_.event_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const ::es::message::ResolvedIndexedEvent& ReadEventCompleted::_internal_event() const {
+  const ::es::message::ResolvedIndexedEvent* p = _impl_.event_;
+  return p != nullptr ? *p : reinterpret_cast<const ::es::message::ResolvedIndexedEvent&>(
+      ::es::message::_ResolvedIndexedEvent_default_instance_);
 }
 inline const ::es::message::ResolvedIndexedEvent& ReadEventCompleted::event() const {
-  const ::es::message::ResolvedIndexedEvent* p = event_;
   // @@protoc_insertion_point(field_get:es.message.ReadEventCompleted.event)
-  return p != nullptr ? *p : *reinterpret_cast<const ::es::message::ResolvedIndexedEvent*>(
-      &::es::message::_ResolvedIndexedEvent_default_instance_);
+  return _internal_event();
+}
+inline void ReadEventCompleted::unsafe_arena_set_allocated_event(
+    ::es::message::ResolvedIndexedEvent* event) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.event_);
+  }
+  _impl_.event_ = event;
+  if (event) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:es.message.ReadEventCompleted.event)
 }
 inline ::es::message::ResolvedIndexedEvent* ReadEventCompleted::release_event() {
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::es::message::ResolvedIndexedEvent* temp = _impl_.event_;
+  _impl_.event_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::es::message::ResolvedIndexedEvent* ReadEventCompleted::unsafe_arena_release_event() {
   // @@protoc_insertion_point(field_release:es.message.ReadEventCompleted.event)
-  _has_bits_[0] &= ~0x00000002u;
-  ::es::message::ResolvedIndexedEvent* temp = event_;
-  event_ = nullptr;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::es::message::ResolvedIndexedEvent* temp = _impl_.event_;
+  _impl_.event_ = nullptr;
   return temp;
 }
-inline ::es::message::ResolvedIndexedEvent* ReadEventCompleted::mutable_event() {
-  _has_bits_[0] |= 0x00000002u;
-  if (event_ == nullptr) {
-    auto* p = CreateMaybeMessage<::es::message::ResolvedIndexedEvent>(GetArenaNoVirtual());
-    event_ = p;
+inline ::es::message::ResolvedIndexedEvent* ReadEventCompleted::_internal_mutable_event() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  if (_impl_.event_ == nullptr) {
+    auto* p = CreateMaybeMessage<::es::message::ResolvedIndexedEvent>(GetArenaForAllocation());
+    _impl_.event_ = p;
   }
+  return _impl_.event_;
+}
+inline ::es::message::ResolvedIndexedEvent* ReadEventCompleted::mutable_event() {
+  ::es::message::ResolvedIndexedEvent* _msg = _internal_mutable_event();
   // @@protoc_insertion_point(field_mutable:es.message.ReadEventCompleted.event)
-  return event_;
+  return _msg;
 }
 inline void ReadEventCompleted::set_allocated_event(::es::message::ResolvedIndexedEvent* event) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete event_;
+    delete _impl_.event_;
   }
   if (event) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(event);
     if (message_arena != submessage_arena) {
       event = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, event, submessage_arena);
     }
-    _has_bits_[0] |= 0x00000002u;
+    _impl_._has_bits_[0] |= 0x00000002u;
   } else {
-    _has_bits_[0] &= ~0x00000002u;
+    _impl_._has_bits_[0] &= ~0x00000002u;
   }
-  event_ = event;
+  _impl_.event_ = event;
   // @@protoc_insertion_point(field_set_allocated:es.message.ReadEventCompleted.event)
 }
 
 // optional string error = 3;
+inline bool ReadEventCompleted::_internal_has_error() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
 inline bool ReadEventCompleted::has_error() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+  return _internal_has_error();
 }
 inline void ReadEventCompleted::clear_error() {
-  error_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  _has_bits_[0] &= ~0x00000001u;
+  _impl_.error_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
 }
 inline const std::string& ReadEventCompleted::error() const {
   // @@protoc_insertion_point(field_get:es.message.ReadEventCompleted.error)
-  return error_.GetNoArena();
+  return _internal_error();
 }
-inline void ReadEventCompleted::set_error(const std::string& value) {
-  _has_bits_[0] |= 0x00000001u;
-  error_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ReadEventCompleted::set_error(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.error_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:es.message.ReadEventCompleted.error)
 }
-inline void ReadEventCompleted::set_error(std::string&& value) {
-  _has_bits_[0] |= 0x00000001u;
-  error_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:es.message.ReadEventCompleted.error)
+inline std::string* ReadEventCompleted::mutable_error() {
+  std::string* _s = _internal_mutable_error();
+  // @@protoc_insertion_point(field_mutable:es.message.ReadEventCompleted.error)
+  return _s;
 }
-inline void ReadEventCompleted::set_error(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  _has_bits_[0] |= 0x00000001u;
-  error_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:es.message.ReadEventCompleted.error)
+inline const std::string& ReadEventCompleted::_internal_error() const {
+  return _impl_.error_.Get();
 }
-inline void ReadEventCompleted::set_error(const char* value, size_t size) {
-  _has_bits_[0] |= 0x00000001u;
-  error_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:es.message.ReadEventCompleted.error)
+inline void ReadEventCompleted::_internal_set_error(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.error_.Set(value, GetArenaForAllocation());
 }
-inline std::string* ReadEventCompleted::mutable_error() {
-  _has_bits_[0] |= 0x00000001u;
-  // @@protoc_insertion_point(field_mutable:es.message.ReadEventCompleted.error)
-  return error_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline std::string* ReadEventCompleted::_internal_mutable_error() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.error_.Mutable(GetArenaForAllocation());
 }
 inline std::string* ReadEventCompleted::release_error() {
   // @@protoc_insertion_point(field_release:es.message.ReadEventCompleted.error)
-  if (!has_error()) {
+  if (!_internal_has_error()) {
     return nullptr;
   }
-  _has_bits_[0] &= ~0x00000001u;
-  return error_.ReleaseNonDefaultNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.error_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.error_.IsDefault()) {
+    _impl_.error_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
 }
 inline void ReadEventCompleted::set_allocated_error(std::string* error) {
   if (error != nullptr) {
-    _has_bits_[0] |= 0x00000001u;
+    _impl_._has_bits_[0] |= 0x00000001u;
   } else {
-    _has_bits_[0] &= ~0x00000001u;
+    _impl_._has_bits_[0] &= ~0x00000001u;
   }
-  error_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), error);
+  _impl_.error_.SetAllocated(error, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.error_.IsDefault()) {
+    _impl_.error_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:es.message.ReadEventCompleted.error)
 }
 
@@ -10396,132 +12854,182 @@ inline void ReadEventCompleted::set_allocated_error(std::string* error) {
 // ReadStreamEvents
 
 // required string event_stream_id = 1;
+inline bool ReadStreamEvents::_internal_has_event_stream_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
 inline bool ReadStreamEvents::has_event_stream_id() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+  return _internal_has_event_stream_id();
 }
 inline void ReadStreamEvents::clear_event_stream_id() {
-  event_stream_id_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  _has_bits_[0] &= ~0x00000001u;
+  _impl_.event_stream_id_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
 }
 inline const std::string& ReadStreamEvents::event_stream_id() const {
   // @@protoc_insertion_point(field_get:es.message.ReadStreamEvents.event_stream_id)
-  return event_stream_id_.GetNoArena();
+  return _internal_event_stream_id();
 }
-inline void ReadStreamEvents::set_event_stream_id(const std::string& value) {
-  _has_bits_[0] |= 0x00000001u;
-  event_stream_id_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ReadStreamEvents::set_event_stream_id(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.event_stream_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:es.message.ReadStreamEvents.event_stream_id)
 }
-inline void ReadStreamEvents::set_event_stream_id(std::string&& value) {
-  _has_bits_[0] |= 0x00000001u;
-  event_stream_id_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:es.message.ReadStreamEvents.event_stream_id)
+inline std::string* ReadStreamEvents::mutable_event_stream_id() {
+  std::string* _s = _internal_mutable_event_stream_id();
+  // @@protoc_insertion_point(field_mutable:es.message.ReadStreamEvents.event_stream_id)
+  return _s;
 }
-inline void ReadStreamEvents::set_event_stream_id(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  _has_bits_[0] |= 0x00000001u;
-  event_stream_id_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:es.message.ReadStreamEvents.event_stream_id)
+inline const std::string& ReadStreamEvents::_internal_event_stream_id() const {
+  return _impl_.event_stream_id_.Get();
 }
-inline void ReadStreamEvents::set_event_stream_id(const char* value, size_t size) {
-  _has_bits_[0] |= 0x00000001u;
-  event_stream_id_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:es.message.ReadStreamEvents.event_stream_id)
+inline void ReadStreamEvents::_internal_set_event_stream_id(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.event_stream_id_.Set(value, GetArenaForAllocation());
 }
-inline std::string* ReadStreamEvents::mutable_event_stream_id() {
-  _has_bits_[0] |= 0x00000001u;
-  // @@protoc_insertion_point(field_mutable:es.message.ReadStreamEvents.event_stream_id)
-  return event_stream_id_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline std::string* ReadStreamEvents::_internal_mutable_event_stream_id() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.event_stream_id_.Mutable(GetArenaForAllocation());
 }
 inline std::string* ReadStreamEvents::release_event_stream_id() {
   // @@protoc_insertion_point(field_release:es.message.ReadStreamEvents.event_stream_id)
-  if (!has_event_stream_id()) {
+  if (!_internal_has_event_stream_id()) {
     return nullptr;
   }
-  _has_bits_[0] &= ~0x00000001u;
-  return event_stream_id_.ReleaseNonDefaultNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.event_stream_id_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.event_stream_id_.IsDefault()) {
+    _impl_.event_stream_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
 }
 inline void ReadStreamEvents::set_allocated_event_stream_id(std::string* event_stream_id) {
   if (event_stream_id != nullptr) {
-    _has_bits_[0] |= 0x00000001u;
+    _impl_._has_bits_[0] |= 0x00000001u;
   } else {
-    _has_bits_[0] &= ~0x00000001u;
+    _impl_._has_bits_[0] &= ~0x00000001u;
   }
-  event_stream_id_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), event_stream_id);
+  _impl_.event_stream_id_.SetAllocated(event_stream_id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.event_stream_id_.IsDefault()) {
+    _impl_.event_stream_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:es.message.ReadStreamEvents.event_stream_id)
 }
 
 // required int64 from_event_number = 2;
+inline bool ReadStreamEvents::_internal_has_from_event_number() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
 inline bool ReadStreamEvents::has_from_event_number() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
+  return _internal_has_from_event_number();
 }
 inline void ReadStreamEvents::clear_from_event_number() {
-  from_event_number_ = PROTOBUF_LONGLONG(0);
-  _has_bits_[0] &= ~0x00000002u;
+  _impl_.from_event_number_ = int64_t{0};
+  _impl_._has_bits_[0] &= ~0x00000002u;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int64 ReadStreamEvents::from_event_number() const {
+inline int64_t ReadStreamEvents::_internal_from_event_number() const {
+  return _impl_.from_event_number_;
+}
+inline int64_t ReadStreamEvents::from_event_number() const {
   // @@protoc_insertion_point(field_get:es.message.ReadStreamEvents.from_event_number)
-  return from_event_number_;
+  return _internal_from_event_number();
+}
+inline void ReadStreamEvents::_internal_set_from_event_number(int64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.from_event_number_ = value;
 }
-inline void ReadStreamEvents::set_from_event_number(::PROTOBUF_NAMESPACE_ID::int64 value) {
-  _has_bits_[0] |= 0x00000002u;
-  from_event_number_ = value;
+inline void ReadStreamEvents::set_from_event_number(int64_t value) {
+  _internal_set_from_event_number(value);
   // @@protoc_insertion_point(field_set:es.message.ReadStreamEvents.from_event_number)
 }
 
 // required int32 max_count = 3;
+inline bool ReadStreamEvents::_internal_has_max_count() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
 inline bool ReadStreamEvents::has_max_count() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
+  return _internal_has_max_count();
 }
 inline void ReadStreamEvents::clear_max_count() {
-  max_count_ = 0;
-  _has_bits_[0] &= ~0x00000004u;
+  _impl_.max_count_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline int32_t ReadStreamEvents::_internal_max_count() const {
+  return _impl_.max_count_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 ReadStreamEvents::max_count() const {
+inline int32_t ReadStreamEvents::max_count() const {
   // @@protoc_insertion_point(field_get:es.message.ReadStreamEvents.max_count)
-  return max_count_;
+  return _internal_max_count();
 }
-inline void ReadStreamEvents::set_max_count(::PROTOBUF_NAMESPACE_ID::int32 value) {
-  _has_bits_[0] |= 0x00000004u;
-  max_count_ = value;
+inline void ReadStreamEvents::_internal_set_max_count(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.max_count_ = value;
+}
+inline void ReadStreamEvents::set_max_count(int32_t value) {
+  _internal_set_max_count(value);
   // @@protoc_insertion_point(field_set:es.message.ReadStreamEvents.max_count)
 }
 
 // required bool resolve_link_tos = 4;
+inline bool ReadStreamEvents::_internal_has_resolve_link_tos() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
 inline bool ReadStreamEvents::has_resolve_link_tos() const {
-  return (_has_bits_[0] & 0x00000008u) != 0;
+  return _internal_has_resolve_link_tos();
 }
 inline void ReadStreamEvents::clear_resolve_link_tos() {
-  resolve_link_tos_ = false;
-  _has_bits_[0] &= ~0x00000008u;
+  _impl_.resolve_link_tos_ = false;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline bool ReadStreamEvents::_internal_resolve_link_tos() const {
+  return _impl_.resolve_link_tos_;
 }
 inline bool ReadStreamEvents::resolve_link_tos() const {
   // @@protoc_insertion_point(field_get:es.message.ReadStreamEvents.resolve_link_tos)
-  return resolve_link_tos_;
+  return _internal_resolve_link_tos();
+}
+inline void ReadStreamEvents::_internal_set_resolve_link_tos(bool value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.resolve_link_tos_ = value;
 }
 inline void ReadStreamEvents::set_resolve_link_tos(bool value) {
-  _has_bits_[0] |= 0x00000008u;
-  resolve_link_tos_ = value;
+  _internal_set_resolve_link_tos(value);
   // @@protoc_insertion_point(field_set:es.message.ReadStreamEvents.resolve_link_tos)
 }
 
 // required bool require_master = 5;
+inline bool ReadStreamEvents::_internal_has_require_master() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
 inline bool ReadStreamEvents::has_require_master() const {
-  return (_has_bits_[0] & 0x00000010u) != 0;
+  return _internal_has_require_master();
 }
 inline void ReadStreamEvents::clear_require_master() {
-  require_master_ = false;
-  _has_bits_[0] &= ~0x00000010u;
+  _impl_.require_master_ = false;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline bool ReadStreamEvents::_internal_require_master() const {
+  return _impl_.require_master_;
 }
 inline bool ReadStreamEvents::require_master() const {
   // @@protoc_insertion_point(field_get:es.message.ReadStreamEvents.require_master)
-  return require_master_;
+  return _internal_require_master();
+}
+inline void ReadStreamEvents::_internal_set_require_master(bool value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.require_master_ = value;
 }
 inline void ReadStreamEvents::set_require_master(bool value) {
-  _has_bits_[0] |= 0x00000010u;
-  require_master_ = value;
+  _internal_set_require_master(value);
   // @@protoc_insertion_point(field_set:es.message.ReadStreamEvents.require_master)
 }
 
@@ -10530,181 +13038,251 @@ inline void ReadStreamEvents::set_require_master(bool value) {
 // ReadStreamEventsCompleted
 
 // repeated .es.message.ResolvedIndexedEvent events = 1;
+inline int ReadStreamEventsCompleted::_internal_events_size() const {
+  return _impl_.events_.size();
+}
 inline int ReadStreamEventsCompleted::events_size() const {
-  return events_.size();
+  return _internal_events_size();
 }
 inline void ReadStreamEventsCompleted::clear_events() {
-  events_.Clear();
+  _impl_.events_.Clear();
 }
 inline ::es::message::ResolvedIndexedEvent* ReadStreamEventsCompleted::mutable_events(int index) {
   // @@protoc_insertion_point(field_mutable:es.message.ReadStreamEventsCompleted.events)
-  return events_.Mutable(index);
+  return _impl_.events_.Mutable(index);
 }
 inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::es::message::ResolvedIndexedEvent >*
 ReadStreamEventsCompleted::mutable_events() {
   // @@protoc_insertion_point(field_mutable_list:es.message.ReadStreamEventsCompleted.events)
-  return &events_;
+  return &_impl_.events_;
+}
+inline const ::es::message::ResolvedIndexedEvent& ReadStreamEventsCompleted::_internal_events(int index) const {
+  return _impl_.events_.Get(index);
 }
 inline const ::es::message::ResolvedIndexedEvent& ReadStreamEventsCompleted::events(int index) const {
   // @@protoc_insertion_point(field_get:es.message.ReadStreamEventsCompleted.events)
-  return events_.Get(index);
+  return _internal_events(index);
+}
+inline ::es::message::ResolvedIndexedEvent* ReadStreamEventsCompleted::_internal_add_events() {
+  return _impl_.events_.Add();
 }
 inline ::es::message::ResolvedIndexedEvent* ReadStreamEventsCompleted::add_events() {
+  ::es::message::ResolvedIndexedEvent* _add = _internal_add_events();
   // @@protoc_insertion_point(field_add:es.message.ReadStreamEventsCompleted.events)
-  return events_.Add();
+  return _add;
 }
 inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::es::message::ResolvedIndexedEvent >&
 ReadStreamEventsCompleted::events() const {
   // @@protoc_insertion_point(field_list:es.message.ReadStreamEventsCompleted.events)
-  return events_;
+  return _impl_.events_;
 }
 
 // required .es.message.ReadStreamEventsCompleted.ReadStreamResult result = 2;
+inline bool ReadStreamEventsCompleted::_internal_has_result() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
 inline bool ReadStreamEventsCompleted::has_result() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
+  return _internal_has_result();
 }
 inline void ReadStreamEventsCompleted::clear_result() {
-  result_ = 0;
-  _has_bits_[0] &= ~0x00000004u;
+  _impl_.result_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline ::es::message::ReadStreamEventsCompleted_ReadStreamResult ReadStreamEventsCompleted::_internal_result() const {
+  return static_cast< ::es::message::ReadStreamEventsCompleted_ReadStreamResult >(_impl_.result_);
 }
 inline ::es::message::ReadStreamEventsCompleted_ReadStreamResult ReadStreamEventsCompleted::result() const {
   // @@protoc_insertion_point(field_get:es.message.ReadStreamEventsCompleted.result)
-  return static_cast< ::es::message::ReadStreamEventsCompleted_ReadStreamResult >(result_);
+  return _internal_result();
 }
-inline void ReadStreamEventsCompleted::set_result(::es::message::ReadStreamEventsCompleted_ReadStreamResult value) {
+inline void ReadStreamEventsCompleted::_internal_set_result(::es::message::ReadStreamEventsCompleted_ReadStreamResult value) {
   assert(::es::message::ReadStreamEventsCompleted_ReadStreamResult_IsValid(value));
-  _has_bits_[0] |= 0x00000004u;
-  result_ = value;
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.result_ = value;
+}
+inline void ReadStreamEventsCompleted::set_result(::es::message::ReadStreamEventsCompleted_ReadStreamResult value) {
+  _internal_set_result(value);
   // @@protoc_insertion_point(field_set:es.message.ReadStreamEventsCompleted.result)
 }
 
 // required int64 next_event_number = 3;
+inline bool ReadStreamEventsCompleted::_internal_has_next_event_number() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
 inline bool ReadStreamEventsCompleted::has_next_event_number() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
+  return _internal_has_next_event_number();
 }
 inline void ReadStreamEventsCompleted::clear_next_event_number() {
-  next_event_number_ = PROTOBUF_LONGLONG(0);
-  _has_bits_[0] &= ~0x00000002u;
+  _impl_.next_event_number_ = int64_t{0};
+  _impl_._has_bits_[0] &= ~0x00000002u;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int64 ReadStreamEventsCompleted::next_event_number() const {
+inline int64_t ReadStreamEventsCompleted::_internal_next_event_number() const {
+  return _impl_.next_event_number_;
+}
+inline int64_t ReadStreamEventsCompleted::next_event_number() const {
   // @@protoc_insertion_point(field_get:es.message.ReadStreamEventsCompleted.next_event_number)
-  return next_event_number_;
+  return _internal_next_event_number();
+}
+inline void ReadStreamEventsCompleted::_internal_set_next_event_number(int64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.next_event_number_ = value;
 }
-inline void ReadStreamEventsCompleted::set_next_event_number(::PROTOBUF_NAMESPACE_ID::int64 value) {
-  _has_bits_[0] |= 0x00000002u;
-  next_event_number_ = value;
+inline void ReadStreamEventsCompleted::set_next_event_number(int64_t value) {
+  _internal_set_next_event_number(value);
   // @@protoc_insertion_point(field_set:es.message.ReadStreamEventsCompleted.next_event_number)
 }
 
 // required int64 last_event_number = 4;
+inline bool ReadStreamEventsCompleted::_internal_has_last_event_number() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
 inline bool ReadStreamEventsCompleted::has_last_event_number() const {
-  return (_has_bits_[0] & 0x00000010u) != 0;
+  return _internal_has_last_event_number();
 }
 inline void ReadStreamEventsCompleted::clear_last_event_number() {
-  last_event_number_ = PROTOBUF_LONGLONG(0);
-  _has_bits_[0] &= ~0x00000010u;
+  _impl_.last_event_number_ = int64_t{0};
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline int64_t ReadStreamEventsCompleted::_internal_last_event_number() const {
+  return _impl_.last_event_number_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int64 ReadStreamEventsCompleted::last_event_number() const {
+inline int64_t ReadStreamEventsCompleted::last_event_number() const {
   // @@protoc_insertion_point(field_get:es.message.ReadStreamEventsCompleted.last_event_number)
-  return last_event_number_;
+  return _internal_last_event_number();
 }
-inline void ReadStreamEventsCompleted::set_last_event_number(::PROTOBUF_NAMESPACE_ID::int64 value) {
-  _has_bits_[0] |= 0x00000010u;
-  last_event_number_ = value;
+inline void ReadStreamEventsCompleted::_internal_set_last_event_number(int64_t value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.last_event_number_ = value;
+}
+inline void ReadStreamEventsCompleted::set_last_event_number(int64_t value) {
+  _internal_set_last_event_number(value);
   // @@protoc_insertion_point(field_set:es.message.ReadStreamEventsCompleted.last_event_number)
 }
 
 // required bool is_end_of_stream = 5;
+inline bool ReadStreamEventsCompleted::_internal_has_is_end_of_stream() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
 inline bool ReadStreamEventsCompleted::has_is_end_of_stream() const {
-  return (_has_bits_[0] & 0x00000008u) != 0;
+  return _internal_has_is_end_of_stream();
 }
 inline void ReadStreamEventsCompleted::clear_is_end_of_stream() {
-  is_end_of_stream_ = false;
-  _has_bits_[0] &= ~0x00000008u;
+  _impl_.is_end_of_stream_ = false;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline bool ReadStreamEventsCompleted::_internal_is_end_of_stream() const {
+  return _impl_.is_end_of_stream_;
 }
 inline bool ReadStreamEventsCompleted::is_end_of_stream() const {
   // @@protoc_insertion_point(field_get:es.message.ReadStreamEventsCompleted.is_end_of_stream)
-  return is_end_of_stream_;
+  return _internal_is_end_of_stream();
+}
+inline void ReadStreamEventsCompleted::_internal_set_is_end_of_stream(bool value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.is_end_of_stream_ = value;
 }
 inline void ReadStreamEventsCompleted::set_is_end_of_stream(bool value) {
-  _has_bits_[0] |= 0x00000008u;
-  is_end_of_stream_ = value;
+  _internal_set_is_end_of_stream(value);
   // @@protoc_insertion_point(field_set:es.message.ReadStreamEventsCompleted.is_end_of_stream)
 }
 
 // required int64 last_commit_position = 6;
+inline bool ReadStreamEventsCompleted::_internal_has_last_commit_position() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
 inline bool ReadStreamEventsCompleted::has_last_commit_position() const {
-  return (_has_bits_[0] & 0x00000020u) != 0;
+  return _internal_has_last_commit_position();
 }
 inline void ReadStreamEventsCompleted::clear_last_commit_position() {
-  last_commit_position_ = PROTOBUF_LONGLONG(0);
-  _has_bits_[0] &= ~0x00000020u;
+  _impl_.last_commit_position_ = int64_t{0};
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline int64_t ReadStreamEventsCompleted::_internal_last_commit_position() const {
+  return _impl_.last_commit_position_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int64 ReadStreamEventsCompleted::last_commit_position() const {
+inline int64_t ReadStreamEventsCompleted::last_commit_position() const {
   // @@protoc_insertion_point(field_get:es.message.ReadStreamEventsCompleted.last_commit_position)
-  return last_commit_position_;
+  return _internal_last_commit_position();
 }
-inline void ReadStreamEventsCompleted::set_last_commit_position(::PROTOBUF_NAMESPACE_ID::int64 value) {
-  _has_bits_[0] |= 0x00000020u;
-  last_commit_position_ = value;
+inline void ReadStreamEventsCompleted::_internal_set_last_commit_position(int64_t value) {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.last_commit_position_ = value;
+}
+inline void ReadStreamEventsCompleted::set_last_commit_position(int64_t value) {
+  _internal_set_last_commit_position(value);
   // @@protoc_insertion_point(field_set:es.message.ReadStreamEventsCompleted.last_commit_position)
 }
 
 // optional string error = 7;
+inline bool ReadStreamEventsCompleted::_internal_has_error() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
 inline bool ReadStreamEventsCompleted::has_error() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+  return _internal_has_error();
 }
 inline void ReadStreamEventsCompleted::clear_error() {
-  error_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  _has_bits_[0] &= ~0x00000001u;
+  _impl_.error_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
 }
 inline const std::string& ReadStreamEventsCompleted::error() const {
   // @@protoc_insertion_point(field_get:es.message.ReadStreamEventsCompleted.error)
-  return error_.GetNoArena();
+  return _internal_error();
 }
-inline void ReadStreamEventsCompleted::set_error(const std::string& value) {
-  _has_bits_[0] |= 0x00000001u;
-  error_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ReadStreamEventsCompleted::set_error(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.error_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:es.message.ReadStreamEventsCompleted.error)
 }
-inline void ReadStreamEventsCompleted::set_error(std::string&& value) {
-  _has_bits_[0] |= 0x00000001u;
-  error_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:es.message.ReadStreamEventsCompleted.error)
+inline std::string* ReadStreamEventsCompleted::mutable_error() {
+  std::string* _s = _internal_mutable_error();
+  // @@protoc_insertion_point(field_mutable:es.message.ReadStreamEventsCompleted.error)
+  return _s;
 }
-inline void ReadStreamEventsCompleted::set_error(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  _has_bits_[0] |= 0x00000001u;
-  error_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:es.message.ReadStreamEventsCompleted.error)
+inline const std::string& ReadStreamEventsCompleted::_internal_error() const {
+  return _impl_.error_.Get();
 }
-inline void ReadStreamEventsCompleted::set_error(const char* value, size_t size) {
-  _has_bits_[0] |= 0x00000001u;
-  error_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:es.message.ReadStreamEventsCompleted.error)
+inline void ReadStreamEventsCompleted::_internal_set_error(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.error_.Set(value, GetArenaForAllocation());
 }
-inline std::string* ReadStreamEventsCompleted::mutable_error() {
-  _has_bits_[0] |= 0x00000001u;
-  // @@protoc_insertion_point(field_mutable:es.message.ReadStreamEventsCompleted.error)
-  return error_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline std::string* ReadStreamEventsCompleted::_internal_mutable_error() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.error_.Mutable(GetArenaForAllocation());
 }
 inline std::string* ReadStreamEventsCompleted::release_error() {
   // @@protoc_insertion_point(field_release:es.message.ReadStreamEventsCompleted.error)
-  if (!has_error()) {
+  if (!_internal_has_error()) {
     return nullptr;
   }
-  _has_bits_[0] &= ~0x00000001u;
-  return error_.ReleaseNonDefaultNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.error_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.error_.IsDefault()) {
+    _impl_.error_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
 }
 inline void ReadStreamEventsCompleted::set_allocated_error(std::string* error) {
   if (error != nullptr) {
-    _has_bits_[0] |= 0x00000001u;
+    _impl_._has_bits_[0] |= 0x00000001u;
   } else {
-    _has_bits_[0] &= ~0x00000001u;
+    _impl_._has_bits_[0] &= ~0x00000001u;
   }
-  error_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), error);
+  _impl_.error_.SetAllocated(error, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.error_.IsDefault()) {
+    _impl_.error_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:es.message.ReadStreamEventsCompleted.error)
 }
 
@@ -10713,92 +13291,142 @@ inline void ReadStreamEventsCompleted::set_allocated_error(std::string* error) {
 // ReadAllEvents
 
 // required int64 commit_position = 1;
+inline bool ReadAllEvents::_internal_has_commit_position() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
 inline bool ReadAllEvents::has_commit_position() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+  return _internal_has_commit_position();
 }
 inline void ReadAllEvents::clear_commit_position() {
-  commit_position_ = PROTOBUF_LONGLONG(0);
-  _has_bits_[0] &= ~0x00000001u;
+  _impl_.commit_position_ = int64_t{0};
+  _impl_._has_bits_[0] &= ~0x00000001u;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int64 ReadAllEvents::commit_position() const {
+inline int64_t ReadAllEvents::_internal_commit_position() const {
+  return _impl_.commit_position_;
+}
+inline int64_t ReadAllEvents::commit_position() const {
   // @@protoc_insertion_point(field_get:es.message.ReadAllEvents.commit_position)
-  return commit_position_;
+  return _internal_commit_position();
+}
+inline void ReadAllEvents::_internal_set_commit_position(int64_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.commit_position_ = value;
 }
-inline void ReadAllEvents::set_commit_position(::PROTOBUF_NAMESPACE_ID::int64 value) {
-  _has_bits_[0] |= 0x00000001u;
-  commit_position_ = value;
+inline void ReadAllEvents::set_commit_position(int64_t value) {
+  _internal_set_commit_position(value);
   // @@protoc_insertion_point(field_set:es.message.ReadAllEvents.commit_position)
 }
 
 // required int64 prepare_position = 2;
+inline bool ReadAllEvents::_internal_has_prepare_position() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
 inline bool ReadAllEvents::has_prepare_position() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
+  return _internal_has_prepare_position();
 }
 inline void ReadAllEvents::clear_prepare_position() {
-  prepare_position_ = PROTOBUF_LONGLONG(0);
-  _has_bits_[0] &= ~0x00000002u;
+  _impl_.prepare_position_ = int64_t{0};
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline int64_t ReadAllEvents::_internal_prepare_position() const {
+  return _impl_.prepare_position_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int64 ReadAllEvents::prepare_position() const {
+inline int64_t ReadAllEvents::prepare_position() const {
   // @@protoc_insertion_point(field_get:es.message.ReadAllEvents.prepare_position)
-  return prepare_position_;
+  return _internal_prepare_position();
 }
-inline void ReadAllEvents::set_prepare_position(::PROTOBUF_NAMESPACE_ID::int64 value) {
-  _has_bits_[0] |= 0x00000002u;
-  prepare_position_ = value;
+inline void ReadAllEvents::_internal_set_prepare_position(int64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.prepare_position_ = value;
+}
+inline void ReadAllEvents::set_prepare_position(int64_t value) {
+  _internal_set_prepare_position(value);
   // @@protoc_insertion_point(field_set:es.message.ReadAllEvents.prepare_position)
 }
 
 // required int32 max_count = 3;
+inline bool ReadAllEvents::_internal_has_max_count() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
 inline bool ReadAllEvents::has_max_count() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
+  return _internal_has_max_count();
 }
 inline void ReadAllEvents::clear_max_count() {
-  max_count_ = 0;
-  _has_bits_[0] &= ~0x00000004u;
+  _impl_.max_count_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000004u;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 ReadAllEvents::max_count() const {
+inline int32_t ReadAllEvents::_internal_max_count() const {
+  return _impl_.max_count_;
+}
+inline int32_t ReadAllEvents::max_count() const {
   // @@protoc_insertion_point(field_get:es.message.ReadAllEvents.max_count)
-  return max_count_;
+  return _internal_max_count();
+}
+inline void ReadAllEvents::_internal_set_max_count(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.max_count_ = value;
 }
-inline void ReadAllEvents::set_max_count(::PROTOBUF_NAMESPACE_ID::int32 value) {
-  _has_bits_[0] |= 0x00000004u;
-  max_count_ = value;
+inline void ReadAllEvents::set_max_count(int32_t value) {
+  _internal_set_max_count(value);
   // @@protoc_insertion_point(field_set:es.message.ReadAllEvents.max_count)
 }
 
 // required bool resolve_link_tos = 4;
+inline bool ReadAllEvents::_internal_has_resolve_link_tos() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
 inline bool ReadAllEvents::has_resolve_link_tos() const {
-  return (_has_bits_[0] & 0x00000008u) != 0;
+  return _internal_has_resolve_link_tos();
 }
 inline void ReadAllEvents::clear_resolve_link_tos() {
-  resolve_link_tos_ = false;
-  _has_bits_[0] &= ~0x00000008u;
+  _impl_.resolve_link_tos_ = false;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline bool ReadAllEvents::_internal_resolve_link_tos() const {
+  return _impl_.resolve_link_tos_;
 }
 inline bool ReadAllEvents::resolve_link_tos() const {
   // @@protoc_insertion_point(field_get:es.message.ReadAllEvents.resolve_link_tos)
-  return resolve_link_tos_;
+  return _internal_resolve_link_tos();
+}
+inline void ReadAllEvents::_internal_set_resolve_link_tos(bool value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.resolve_link_tos_ = value;
 }
 inline void ReadAllEvents::set_resolve_link_tos(bool value) {
-  _has_bits_[0] |= 0x00000008u;
-  resolve_link_tos_ = value;
+  _internal_set_resolve_link_tos(value);
   // @@protoc_insertion_point(field_set:es.message.ReadAllEvents.resolve_link_tos)
 }
 
 // required bool require_master = 5;
+inline bool ReadAllEvents::_internal_has_require_master() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
 inline bool ReadAllEvents::has_require_master() const {
-  return (_has_bits_[0] & 0x00000010u) != 0;
+  return _internal_has_require_master();
 }
 inline void ReadAllEvents::clear_require_master() {
-  require_master_ = false;
-  _has_bits_[0] &= ~0x00000010u;
+  _impl_.require_master_ = false;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline bool ReadAllEvents::_internal_require_master() const {
+  return _impl_.require_master_;
 }
 inline bool ReadAllEvents::require_master() const {
   // @@protoc_insertion_point(field_get:es.message.ReadAllEvents.require_master)
-  return require_master_;
+  return _internal_require_master();
+}
+inline void ReadAllEvents::_internal_set_require_master(bool value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.require_master_ = value;
 }
 inline void ReadAllEvents::set_require_master(bool value) {
-  _has_bits_[0] |= 0x00000010u;
-  require_master_ = value;
+  _internal_set_require_master(value);
   // @@protoc_insertion_point(field_set:es.message.ReadAllEvents.require_master)
 }
 
@@ -10807,181 +13435,251 @@ inline void ReadAllEvents::set_require_master(bool value) {
 // ReadAllEventsCompleted
 
 // required int64 commit_position = 1;
+inline bool ReadAllEventsCompleted::_internal_has_commit_position() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
 inline bool ReadAllEventsCompleted::has_commit_position() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
+  return _internal_has_commit_position();
 }
 inline void ReadAllEventsCompleted::clear_commit_position() {
-  commit_position_ = PROTOBUF_LONGLONG(0);
-  _has_bits_[0] &= ~0x00000002u;
+  _impl_.commit_position_ = int64_t{0};
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline int64_t ReadAllEventsCompleted::_internal_commit_position() const {
+  return _impl_.commit_position_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int64 ReadAllEventsCompleted::commit_position() const {
+inline int64_t ReadAllEventsCompleted::commit_position() const {
   // @@protoc_insertion_point(field_get:es.message.ReadAllEventsCompleted.commit_position)
-  return commit_position_;
+  return _internal_commit_position();
 }
-inline void ReadAllEventsCompleted::set_commit_position(::PROTOBUF_NAMESPACE_ID::int64 value) {
-  _has_bits_[0] |= 0x00000002u;
-  commit_position_ = value;
+inline void ReadAllEventsCompleted::_internal_set_commit_position(int64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.commit_position_ = value;
+}
+inline void ReadAllEventsCompleted::set_commit_position(int64_t value) {
+  _internal_set_commit_position(value);
   // @@protoc_insertion_point(field_set:es.message.ReadAllEventsCompleted.commit_position)
 }
 
 // required int64 prepare_position = 2;
+inline bool ReadAllEventsCompleted::_internal_has_prepare_position() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
 inline bool ReadAllEventsCompleted::has_prepare_position() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
+  return _internal_has_prepare_position();
 }
 inline void ReadAllEventsCompleted::clear_prepare_position() {
-  prepare_position_ = PROTOBUF_LONGLONG(0);
-  _has_bits_[0] &= ~0x00000004u;
+  _impl_.prepare_position_ = int64_t{0};
+  _impl_._has_bits_[0] &= ~0x00000004u;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int64 ReadAllEventsCompleted::prepare_position() const {
+inline int64_t ReadAllEventsCompleted::_internal_prepare_position() const {
+  return _impl_.prepare_position_;
+}
+inline int64_t ReadAllEventsCompleted::prepare_position() const {
   // @@protoc_insertion_point(field_get:es.message.ReadAllEventsCompleted.prepare_position)
-  return prepare_position_;
+  return _internal_prepare_position();
+}
+inline void ReadAllEventsCompleted::_internal_set_prepare_position(int64_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.prepare_position_ = value;
 }
-inline void ReadAllEventsCompleted::set_prepare_position(::PROTOBUF_NAMESPACE_ID::int64 value) {
-  _has_bits_[0] |= 0x00000004u;
-  prepare_position_ = value;
+inline void ReadAllEventsCompleted::set_prepare_position(int64_t value) {
+  _internal_set_prepare_position(value);
   // @@protoc_insertion_point(field_set:es.message.ReadAllEventsCompleted.prepare_position)
 }
 
 // repeated .es.message.ResolvedEvent events = 3;
+inline int ReadAllEventsCompleted::_internal_events_size() const {
+  return _impl_.events_.size();
+}
 inline int ReadAllEventsCompleted::events_size() const {
-  return events_.size();
+  return _internal_events_size();
 }
 inline void ReadAllEventsCompleted::clear_events() {
-  events_.Clear();
+  _impl_.events_.Clear();
 }
 inline ::es::message::ResolvedEvent* ReadAllEventsCompleted::mutable_events(int index) {
   // @@protoc_insertion_point(field_mutable:es.message.ReadAllEventsCompleted.events)
-  return events_.Mutable(index);
+  return _impl_.events_.Mutable(index);
 }
 inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::es::message::ResolvedEvent >*
 ReadAllEventsCompleted::mutable_events() {
   // @@protoc_insertion_point(field_mutable_list:es.message.ReadAllEventsCompleted.events)
-  return &events_;
+  return &_impl_.events_;
+}
+inline const ::es::message::ResolvedEvent& ReadAllEventsCompleted::_internal_events(int index) const {
+  return _impl_.events_.Get(index);
 }
 inline const ::es::message::ResolvedEvent& ReadAllEventsCompleted::events(int index) const {
   // @@protoc_insertion_point(field_get:es.message.ReadAllEventsCompleted.events)
-  return events_.Get(index);
+  return _internal_events(index);
+}
+inline ::es::message::ResolvedEvent* ReadAllEventsCompleted::_internal_add_events() {
+  return _impl_.events_.Add();
 }
 inline ::es::message::ResolvedEvent* ReadAllEventsCompleted::add_events() {
+  ::es::message::ResolvedEvent* _add = _internal_add_events();
   // @@protoc_insertion_point(field_add:es.message.ReadAllEventsCompleted.events)
-  return events_.Add();
+  return _add;
 }
 inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::es::message::ResolvedEvent >&
 ReadAllEventsCompleted::events() const {
   // @@protoc_insertion_point(field_list:es.message.ReadAllEventsCompleted.events)
-  return events_;
+  return _impl_.events_;
 }
 
 // required int64 next_commit_position = 4;
+inline bool ReadAllEventsCompleted::_internal_has_next_commit_position() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
 inline bool ReadAllEventsCompleted::has_next_commit_position() const {
-  return (_has_bits_[0] & 0x00000008u) != 0;
+  return _internal_has_next_commit_position();
 }
 inline void ReadAllEventsCompleted::clear_next_commit_position() {
-  next_commit_position_ = PROTOBUF_LONGLONG(0);
-  _has_bits_[0] &= ~0x00000008u;
+  _impl_.next_commit_position_ = int64_t{0};
+  _impl_._has_bits_[0] &= ~0x00000008u;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int64 ReadAllEventsCompleted::next_commit_position() const {
+inline int64_t ReadAllEventsCompleted::_internal_next_commit_position() const {
+  return _impl_.next_commit_position_;
+}
+inline int64_t ReadAllEventsCompleted::next_commit_position() const {
   // @@protoc_insertion_point(field_get:es.message.ReadAllEventsCompleted.next_commit_position)
-  return next_commit_position_;
+  return _internal_next_commit_position();
+}
+inline void ReadAllEventsCompleted::_internal_set_next_commit_position(int64_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.next_commit_position_ = value;
 }
-inline void ReadAllEventsCompleted::set_next_commit_position(::PROTOBUF_NAMESPACE_ID::int64 value) {
-  _has_bits_[0] |= 0x00000008u;
-  next_commit_position_ = value;
+inline void ReadAllEventsCompleted::set_next_commit_position(int64_t value) {
+  _internal_set_next_commit_position(value);
   // @@protoc_insertion_point(field_set:es.message.ReadAllEventsCompleted.next_commit_position)
 }
 
 // required int64 next_prepare_position = 5;
+inline bool ReadAllEventsCompleted::_internal_has_next_prepare_position() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
 inline bool ReadAllEventsCompleted::has_next_prepare_position() const {
-  return (_has_bits_[0] & 0x00000010u) != 0;
+  return _internal_has_next_prepare_position();
 }
 inline void ReadAllEventsCompleted::clear_next_prepare_position() {
-  next_prepare_position_ = PROTOBUF_LONGLONG(0);
-  _has_bits_[0] &= ~0x00000010u;
+  _impl_.next_prepare_position_ = int64_t{0};
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline int64_t ReadAllEventsCompleted::_internal_next_prepare_position() const {
+  return _impl_.next_prepare_position_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int64 ReadAllEventsCompleted::next_prepare_position() const {
+inline int64_t ReadAllEventsCompleted::next_prepare_position() const {
   // @@protoc_insertion_point(field_get:es.message.ReadAllEventsCompleted.next_prepare_position)
-  return next_prepare_position_;
+  return _internal_next_prepare_position();
 }
-inline void ReadAllEventsCompleted::set_next_prepare_position(::PROTOBUF_NAMESPACE_ID::int64 value) {
-  _has_bits_[0] |= 0x00000010u;
-  next_prepare_position_ = value;
+inline void ReadAllEventsCompleted::_internal_set_next_prepare_position(int64_t value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.next_prepare_position_ = value;
+}
+inline void ReadAllEventsCompleted::set_next_prepare_position(int64_t value) {
+  _internal_set_next_prepare_position(value);
   // @@protoc_insertion_point(field_set:es.message.ReadAllEventsCompleted.next_prepare_position)
 }
 
 // optional .es.message.ReadAllEventsCompleted.ReadAllResult result = 6;
+inline bool ReadAllEventsCompleted::_internal_has_result() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
 inline bool ReadAllEventsCompleted::has_result() const {
-  return (_has_bits_[0] & 0x00000020u) != 0;
+  return _internal_has_result();
 }
 inline void ReadAllEventsCompleted::clear_result() {
-  result_ = 0;
-  _has_bits_[0] &= ~0x00000020u;
+  _impl_.result_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline ::es::message::ReadAllEventsCompleted_ReadAllResult ReadAllEventsCompleted::_internal_result() const {
+  return static_cast< ::es::message::ReadAllEventsCompleted_ReadAllResult >(_impl_.result_);
 }
 inline ::es::message::ReadAllEventsCompleted_ReadAllResult ReadAllEventsCompleted::result() const {
   // @@protoc_insertion_point(field_get:es.message.ReadAllEventsCompleted.result)
-  return static_cast< ::es::message::ReadAllEventsCompleted_ReadAllResult >(result_);
+  return _internal_result();
 }
-inline void ReadAllEventsCompleted::set_result(::es::message::ReadAllEventsCompleted_ReadAllResult value) {
+inline void ReadAllEventsCompleted::_internal_set_result(::es::message::ReadAllEventsCompleted_ReadAllResult value) {
   assert(::es::message::ReadAllEventsCompleted_ReadAllResult_IsValid(value));
-  _has_bits_[0] |= 0x00000020u;
-  result_ = value;
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.result_ = value;
+}
+inline void ReadAllEventsCompleted::set_result(::es::message::ReadAllEventsCompleted_ReadAllResult value) {
+  _internal_set_result(value);
   // @@protoc_insertion_point(field_set:es.message.ReadAllEventsCompleted.result)
 }
 
 // optional string error = 7;
+inline bool ReadAllEventsCompleted::_internal_has_error() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
 inline bool ReadAllEventsCompleted::has_error() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+  return _internal_has_error();
 }
 inline void ReadAllEventsCompleted::clear_error() {
-  error_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  _has_bits_[0] &= ~0x00000001u;
+  _impl_.error_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
 }
 inline const std::string& ReadAllEventsCompleted::error() const {
   // @@protoc_insertion_point(field_get:es.message.ReadAllEventsCompleted.error)
-  return error_.GetNoArena();
+  return _internal_error();
 }
-inline void ReadAllEventsCompleted::set_error(const std::string& value) {
-  _has_bits_[0] |= 0x00000001u;
-  error_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ReadAllEventsCompleted::set_error(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.error_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:es.message.ReadAllEventsCompleted.error)
 }
-inline void ReadAllEventsCompleted::set_error(std::string&& value) {
-  _has_bits_[0] |= 0x00000001u;
-  error_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:es.message.ReadAllEventsCompleted.error)
+inline std::string* ReadAllEventsCompleted::mutable_error() {
+  std::string* _s = _internal_mutable_error();
+  // @@protoc_insertion_point(field_mutable:es.message.ReadAllEventsCompleted.error)
+  return _s;
 }
-inline void ReadAllEventsCompleted::set_error(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  _has_bits_[0] |= 0x00000001u;
-  error_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:es.message.ReadAllEventsCompleted.error)
+inline const std::string& ReadAllEventsCompleted::_internal_error() const {
+  return _impl_.error_.Get();
 }
-inline void ReadAllEventsCompleted::set_error(const char* value, size_t size) {
-  _has_bits_[0] |= 0x00000001u;
-  error_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:es.message.ReadAllEventsCompleted.error)
+inline void ReadAllEventsCompleted::_internal_set_error(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.error_.Set(value, GetArenaForAllocation());
 }
-inline std::string* ReadAllEventsCompleted::mutable_error() {
-  _has_bits_[0] |= 0x00000001u;
-  // @@protoc_insertion_point(field_mutable:es.message.ReadAllEventsCompleted.error)
-  return error_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline std::string* ReadAllEventsCompleted::_internal_mutable_error() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.error_.Mutable(GetArenaForAllocation());
 }
 inline std::string* ReadAllEventsCompleted::release_error() {
   // @@protoc_insertion_point(field_release:es.message.ReadAllEventsCompleted.error)
-  if (!has_error()) {
+  if (!_internal_has_error()) {
     return nullptr;
   }
-  _has_bits_[0] &= ~0x00000001u;
-  return error_.ReleaseNonDefaultNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.error_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.error_.IsDefault()) {
+    _impl_.error_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
 }
 inline void ReadAllEventsCompleted::set_allocated_error(std::string* error) {
   if (error != nullptr) {
-    _has_bits_[0] |= 0x00000001u;
+    _impl_._has_bits_[0] |= 0x00000001u;
   } else {
-    _has_bits_[0] &= ~0x00000001u;
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.error_.SetAllocated(error, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.error_.IsDefault()) {
+    _impl_.error_.Set("", GetArenaForAllocation());
   }
-  error_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), error);
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:es.message.ReadAllEventsCompleted.error)
 }
 
@@ -10990,410 +13688,570 @@ inline void ReadAllEventsCompleted::set_allocated_error(std::string* error) {
 // CreatePersistentSubscription
 
 // required string subscription_group_name = 1;
+inline bool CreatePersistentSubscription::_internal_has_subscription_group_name() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
 inline bool CreatePersistentSubscription::has_subscription_group_name() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+  return _internal_has_subscription_group_name();
 }
 inline void CreatePersistentSubscription::clear_subscription_group_name() {
-  subscription_group_name_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  _has_bits_[0] &= ~0x00000001u;
+  _impl_.subscription_group_name_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
 }
 inline const std::string& CreatePersistentSubscription::subscription_group_name() const {
   // @@protoc_insertion_point(field_get:es.message.CreatePersistentSubscription.subscription_group_name)
-  return subscription_group_name_.GetNoArena();
+  return _internal_subscription_group_name();
 }
-inline void CreatePersistentSubscription::set_subscription_group_name(const std::string& value) {
-  _has_bits_[0] |= 0x00000001u;
-  subscription_group_name_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CreatePersistentSubscription::set_subscription_group_name(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.subscription_group_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:es.message.CreatePersistentSubscription.subscription_group_name)
 }
-inline void CreatePersistentSubscription::set_subscription_group_name(std::string&& value) {
-  _has_bits_[0] |= 0x00000001u;
-  subscription_group_name_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:es.message.CreatePersistentSubscription.subscription_group_name)
+inline std::string* CreatePersistentSubscription::mutable_subscription_group_name() {
+  std::string* _s = _internal_mutable_subscription_group_name();
+  // @@protoc_insertion_point(field_mutable:es.message.CreatePersistentSubscription.subscription_group_name)
+  return _s;
 }
-inline void CreatePersistentSubscription::set_subscription_group_name(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  _has_bits_[0] |= 0x00000001u;
-  subscription_group_name_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:es.message.CreatePersistentSubscription.subscription_group_name)
+inline const std::string& CreatePersistentSubscription::_internal_subscription_group_name() const {
+  return _impl_.subscription_group_name_.Get();
 }
-inline void CreatePersistentSubscription::set_subscription_group_name(const char* value, size_t size) {
-  _has_bits_[0] |= 0x00000001u;
-  subscription_group_name_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:es.message.CreatePersistentSubscription.subscription_group_name)
+inline void CreatePersistentSubscription::_internal_set_subscription_group_name(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.subscription_group_name_.Set(value, GetArenaForAllocation());
 }
-inline std::string* CreatePersistentSubscription::mutable_subscription_group_name() {
-  _has_bits_[0] |= 0x00000001u;
-  // @@protoc_insertion_point(field_mutable:es.message.CreatePersistentSubscription.subscription_group_name)
-  return subscription_group_name_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline std::string* CreatePersistentSubscription::_internal_mutable_subscription_group_name() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.subscription_group_name_.Mutable(GetArenaForAllocation());
 }
 inline std::string* CreatePersistentSubscription::release_subscription_group_name() {
   // @@protoc_insertion_point(field_release:es.message.CreatePersistentSubscription.subscription_group_name)
-  if (!has_subscription_group_name()) {
+  if (!_internal_has_subscription_group_name()) {
     return nullptr;
   }
-  _has_bits_[0] &= ~0x00000001u;
-  return subscription_group_name_.ReleaseNonDefaultNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.subscription_group_name_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.subscription_group_name_.IsDefault()) {
+    _impl_.subscription_group_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
 }
 inline void CreatePersistentSubscription::set_allocated_subscription_group_name(std::string* subscription_group_name) {
   if (subscription_group_name != nullptr) {
-    _has_bits_[0] |= 0x00000001u;
+    _impl_._has_bits_[0] |= 0x00000001u;
   } else {
-    _has_bits_[0] &= ~0x00000001u;
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.subscription_group_name_.SetAllocated(subscription_group_name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.subscription_group_name_.IsDefault()) {
+    _impl_.subscription_group_name_.Set("", GetArenaForAllocation());
   }
-  subscription_group_name_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), subscription_group_name);
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:es.message.CreatePersistentSubscription.subscription_group_name)
 }
 
 // required string event_stream_id = 2;
+inline bool CreatePersistentSubscription::_internal_has_event_stream_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
 inline bool CreatePersistentSubscription::has_event_stream_id() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
+  return _internal_has_event_stream_id();
 }
 inline void CreatePersistentSubscription::clear_event_stream_id() {
-  event_stream_id_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  _has_bits_[0] &= ~0x00000002u;
+  _impl_.event_stream_id_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
 }
 inline const std::string& CreatePersistentSubscription::event_stream_id() const {
   // @@protoc_insertion_point(field_get:es.message.CreatePersistentSubscription.event_stream_id)
-  return event_stream_id_.GetNoArena();
+  return _internal_event_stream_id();
 }
-inline void CreatePersistentSubscription::set_event_stream_id(const std::string& value) {
-  _has_bits_[0] |= 0x00000002u;
-  event_stream_id_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CreatePersistentSubscription::set_event_stream_id(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.event_stream_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:es.message.CreatePersistentSubscription.event_stream_id)
 }
-inline void CreatePersistentSubscription::set_event_stream_id(std::string&& value) {
-  _has_bits_[0] |= 0x00000002u;
-  event_stream_id_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:es.message.CreatePersistentSubscription.event_stream_id)
+inline std::string* CreatePersistentSubscription::mutable_event_stream_id() {
+  std::string* _s = _internal_mutable_event_stream_id();
+  // @@protoc_insertion_point(field_mutable:es.message.CreatePersistentSubscription.event_stream_id)
+  return _s;
 }
-inline void CreatePersistentSubscription::set_event_stream_id(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  _has_bits_[0] |= 0x00000002u;
-  event_stream_id_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:es.message.CreatePersistentSubscription.event_stream_id)
+inline const std::string& CreatePersistentSubscription::_internal_event_stream_id() const {
+  return _impl_.event_stream_id_.Get();
 }
-inline void CreatePersistentSubscription::set_event_stream_id(const char* value, size_t size) {
-  _has_bits_[0] |= 0x00000002u;
-  event_stream_id_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:es.message.CreatePersistentSubscription.event_stream_id)
+inline void CreatePersistentSubscription::_internal_set_event_stream_id(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.event_stream_id_.Set(value, GetArenaForAllocation());
 }
-inline std::string* CreatePersistentSubscription::mutable_event_stream_id() {
-  _has_bits_[0] |= 0x00000002u;
-  // @@protoc_insertion_point(field_mutable:es.message.CreatePersistentSubscription.event_stream_id)
-  return event_stream_id_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline std::string* CreatePersistentSubscription::_internal_mutable_event_stream_id() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.event_stream_id_.Mutable(GetArenaForAllocation());
 }
 inline std::string* CreatePersistentSubscription::release_event_stream_id() {
   // @@protoc_insertion_point(field_release:es.message.CreatePersistentSubscription.event_stream_id)
-  if (!has_event_stream_id()) {
+  if (!_internal_has_event_stream_id()) {
     return nullptr;
   }
-  _has_bits_[0] &= ~0x00000002u;
-  return event_stream_id_.ReleaseNonDefaultNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.event_stream_id_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.event_stream_id_.IsDefault()) {
+    _impl_.event_stream_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
 }
 inline void CreatePersistentSubscription::set_allocated_event_stream_id(std::string* event_stream_id) {
   if (event_stream_id != nullptr) {
-    _has_bits_[0] |= 0x00000002u;
+    _impl_._has_bits_[0] |= 0x00000002u;
   } else {
-    _has_bits_[0] &= ~0x00000002u;
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.event_stream_id_.SetAllocated(event_stream_id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.event_stream_id_.IsDefault()) {
+    _impl_.event_stream_id_.Set("", GetArenaForAllocation());
   }
-  event_stream_id_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), event_stream_id);
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:es.message.CreatePersistentSubscription.event_stream_id)
 }
 
 // required bool resolve_link_tos = 3;
+inline bool CreatePersistentSubscription::_internal_has_resolve_link_tos() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
 inline bool CreatePersistentSubscription::has_resolve_link_tos() const {
-  return (_has_bits_[0] & 0x00000020u) != 0;
+  return _internal_has_resolve_link_tos();
 }
 inline void CreatePersistentSubscription::clear_resolve_link_tos() {
-  resolve_link_tos_ = false;
-  _has_bits_[0] &= ~0x00000020u;
+  _impl_.resolve_link_tos_ = false;
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline bool CreatePersistentSubscription::_internal_resolve_link_tos() const {
+  return _impl_.resolve_link_tos_;
 }
 inline bool CreatePersistentSubscription::resolve_link_tos() const {
   // @@protoc_insertion_point(field_get:es.message.CreatePersistentSubscription.resolve_link_tos)
-  return resolve_link_tos_;
+  return _internal_resolve_link_tos();
+}
+inline void CreatePersistentSubscription::_internal_set_resolve_link_tos(bool value) {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.resolve_link_tos_ = value;
 }
 inline void CreatePersistentSubscription::set_resolve_link_tos(bool value) {
-  _has_bits_[0] |= 0x00000020u;
-  resolve_link_tos_ = value;
+  _internal_set_resolve_link_tos(value);
   // @@protoc_insertion_point(field_set:es.message.CreatePersistentSubscription.resolve_link_tos)
 }
 
 // required int64 start_from = 4;
+inline bool CreatePersistentSubscription::_internal_has_start_from() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
 inline bool CreatePersistentSubscription::has_start_from() const {
-  return (_has_bits_[0] & 0x00000008u) != 0;
+  return _internal_has_start_from();
 }
 inline void CreatePersistentSubscription::clear_start_from() {
-  start_from_ = PROTOBUF_LONGLONG(0);
-  _has_bits_[0] &= ~0x00000008u;
+  _impl_.start_from_ = int64_t{0};
+  _impl_._has_bits_[0] &= ~0x00000008u;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int64 CreatePersistentSubscription::start_from() const {
+inline int64_t CreatePersistentSubscription::_internal_start_from() const {
+  return _impl_.start_from_;
+}
+inline int64_t CreatePersistentSubscription::start_from() const {
   // @@protoc_insertion_point(field_get:es.message.CreatePersistentSubscription.start_from)
-  return start_from_;
+  return _internal_start_from();
+}
+inline void CreatePersistentSubscription::_internal_set_start_from(int64_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.start_from_ = value;
 }
-inline void CreatePersistentSubscription::set_start_from(::PROTOBUF_NAMESPACE_ID::int64 value) {
-  _has_bits_[0] |= 0x00000008u;
-  start_from_ = value;
+inline void CreatePersistentSubscription::set_start_from(int64_t value) {
+  _internal_set_start_from(value);
   // @@protoc_insertion_point(field_set:es.message.CreatePersistentSubscription.start_from)
 }
 
 // required int32 message_timeout_milliseconds = 5;
+inline bool CreatePersistentSubscription::_internal_has_message_timeout_milliseconds() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
 inline bool CreatePersistentSubscription::has_message_timeout_milliseconds() const {
-  return (_has_bits_[0] & 0x00000010u) != 0;
+  return _internal_has_message_timeout_milliseconds();
 }
 inline void CreatePersistentSubscription::clear_message_timeout_milliseconds() {
-  message_timeout_milliseconds_ = 0;
-  _has_bits_[0] &= ~0x00000010u;
+  _impl_.message_timeout_milliseconds_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline int32_t CreatePersistentSubscription::_internal_message_timeout_milliseconds() const {
+  return _impl_.message_timeout_milliseconds_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 CreatePersistentSubscription::message_timeout_milliseconds() const {
+inline int32_t CreatePersistentSubscription::message_timeout_milliseconds() const {
   // @@protoc_insertion_point(field_get:es.message.CreatePersistentSubscription.message_timeout_milliseconds)
-  return message_timeout_milliseconds_;
+  return _internal_message_timeout_milliseconds();
 }
-inline void CreatePersistentSubscription::set_message_timeout_milliseconds(::PROTOBUF_NAMESPACE_ID::int32 value) {
-  _has_bits_[0] |= 0x00000010u;
-  message_timeout_milliseconds_ = value;
+inline void CreatePersistentSubscription::_internal_set_message_timeout_milliseconds(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.message_timeout_milliseconds_ = value;
+}
+inline void CreatePersistentSubscription::set_message_timeout_milliseconds(int32_t value) {
+  _internal_set_message_timeout_milliseconds(value);
   // @@protoc_insertion_point(field_set:es.message.CreatePersistentSubscription.message_timeout_milliseconds)
 }
 
 // required bool record_statistics = 6;
+inline bool CreatePersistentSubscription::_internal_has_record_statistics() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  return value;
+}
 inline bool CreatePersistentSubscription::has_record_statistics() const {
-  return (_has_bits_[0] & 0x00000040u) != 0;
+  return _internal_has_record_statistics();
 }
 inline void CreatePersistentSubscription::clear_record_statistics() {
-  record_statistics_ = false;
-  _has_bits_[0] &= ~0x00000040u;
+  _impl_.record_statistics_ = false;
+  _impl_._has_bits_[0] &= ~0x00000040u;
+}
+inline bool CreatePersistentSubscription::_internal_record_statistics() const {
+  return _impl_.record_statistics_;
 }
 inline bool CreatePersistentSubscription::record_statistics() const {
   // @@protoc_insertion_point(field_get:es.message.CreatePersistentSubscription.record_statistics)
-  return record_statistics_;
+  return _internal_record_statistics();
+}
+inline void CreatePersistentSubscription::_internal_set_record_statistics(bool value) {
+  _impl_._has_bits_[0] |= 0x00000040u;
+  _impl_.record_statistics_ = value;
 }
 inline void CreatePersistentSubscription::set_record_statistics(bool value) {
-  _has_bits_[0] |= 0x00000040u;
-  record_statistics_ = value;
+  _internal_set_record_statistics(value);
   // @@protoc_insertion_point(field_set:es.message.CreatePersistentSubscription.record_statistics)
 }
 
 // required int32 live_buffer_size = 7;
+inline bool CreatePersistentSubscription::_internal_has_live_buffer_size() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000100u) != 0;
+  return value;
+}
 inline bool CreatePersistentSubscription::has_live_buffer_size() const {
-  return (_has_bits_[0] & 0x00000100u) != 0;
+  return _internal_has_live_buffer_size();
 }
 inline void CreatePersistentSubscription::clear_live_buffer_size() {
-  live_buffer_size_ = 0;
-  _has_bits_[0] &= ~0x00000100u;
+  _impl_.live_buffer_size_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000100u;
+}
+inline int32_t CreatePersistentSubscription::_internal_live_buffer_size() const {
+  return _impl_.live_buffer_size_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 CreatePersistentSubscription::live_buffer_size() const {
+inline int32_t CreatePersistentSubscription::live_buffer_size() const {
   // @@protoc_insertion_point(field_get:es.message.CreatePersistentSubscription.live_buffer_size)
-  return live_buffer_size_;
+  return _internal_live_buffer_size();
 }
-inline void CreatePersistentSubscription::set_live_buffer_size(::PROTOBUF_NAMESPACE_ID::int32 value) {
-  _has_bits_[0] |= 0x00000100u;
-  live_buffer_size_ = value;
+inline void CreatePersistentSubscription::_internal_set_live_buffer_size(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000100u;
+  _impl_.live_buffer_size_ = value;
+}
+inline void CreatePersistentSubscription::set_live_buffer_size(int32_t value) {
+  _internal_set_live_buffer_size(value);
   // @@protoc_insertion_point(field_set:es.message.CreatePersistentSubscription.live_buffer_size)
 }
 
 // required int32 read_batch_size = 8;
+inline bool CreatePersistentSubscription::_internal_has_read_batch_size() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000200u) != 0;
+  return value;
+}
 inline bool CreatePersistentSubscription::has_read_batch_size() const {
-  return (_has_bits_[0] & 0x00000200u) != 0;
+  return _internal_has_read_batch_size();
 }
 inline void CreatePersistentSubscription::clear_read_batch_size() {
-  read_batch_size_ = 0;
-  _has_bits_[0] &= ~0x00000200u;
+  _impl_.read_batch_size_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000200u;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 CreatePersistentSubscription::read_batch_size() const {
+inline int32_t CreatePersistentSubscription::_internal_read_batch_size() const {
+  return _impl_.read_batch_size_;
+}
+inline int32_t CreatePersistentSubscription::read_batch_size() const {
   // @@protoc_insertion_point(field_get:es.message.CreatePersistentSubscription.read_batch_size)
-  return read_batch_size_;
+  return _internal_read_batch_size();
+}
+inline void CreatePersistentSubscription::_internal_set_read_batch_size(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000200u;
+  _impl_.read_batch_size_ = value;
 }
-inline void CreatePersistentSubscription::set_read_batch_size(::PROTOBUF_NAMESPACE_ID::int32 value) {
-  _has_bits_[0] |= 0x00000200u;
-  read_batch_size_ = value;
+inline void CreatePersistentSubscription::set_read_batch_size(int32_t value) {
+  _internal_set_read_batch_size(value);
   // @@protoc_insertion_point(field_set:es.message.CreatePersistentSubscription.read_batch_size)
 }
 
 // required int32 buffer_size = 9;
+inline bool CreatePersistentSubscription::_internal_has_buffer_size() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000400u) != 0;
+  return value;
+}
 inline bool CreatePersistentSubscription::has_buffer_size() const {
-  return (_has_bits_[0] & 0x00000400u) != 0;
+  return _internal_has_buffer_size();
 }
 inline void CreatePersistentSubscription::clear_buffer_size() {
-  buffer_size_ = 0;
-  _has_bits_[0] &= ~0x00000400u;
+  _impl_.buffer_size_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000400u;
+}
+inline int32_t CreatePersistentSubscription::_internal_buffer_size() const {
+  return _impl_.buffer_size_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 CreatePersistentSubscription::buffer_size() const {
+inline int32_t CreatePersistentSubscription::buffer_size() const {
   // @@protoc_insertion_point(field_get:es.message.CreatePersistentSubscription.buffer_size)
-  return buffer_size_;
+  return _internal_buffer_size();
 }
-inline void CreatePersistentSubscription::set_buffer_size(::PROTOBUF_NAMESPACE_ID::int32 value) {
-  _has_bits_[0] |= 0x00000400u;
-  buffer_size_ = value;
+inline void CreatePersistentSubscription::_internal_set_buffer_size(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000400u;
+  _impl_.buffer_size_ = value;
+}
+inline void CreatePersistentSubscription::set_buffer_size(int32_t value) {
+  _internal_set_buffer_size(value);
   // @@protoc_insertion_point(field_set:es.message.CreatePersistentSubscription.buffer_size)
 }
 
 // required int32 max_retry_count = 10;
+inline bool CreatePersistentSubscription::_internal_has_max_retry_count() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000800u) != 0;
+  return value;
+}
 inline bool CreatePersistentSubscription::has_max_retry_count() const {
-  return (_has_bits_[0] & 0x00000800u) != 0;
+  return _internal_has_max_retry_count();
 }
 inline void CreatePersistentSubscription::clear_max_retry_count() {
-  max_retry_count_ = 0;
-  _has_bits_[0] &= ~0x00000800u;
+  _impl_.max_retry_count_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000800u;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 CreatePersistentSubscription::max_retry_count() const {
+inline int32_t CreatePersistentSubscription::_internal_max_retry_count() const {
+  return _impl_.max_retry_count_;
+}
+inline int32_t CreatePersistentSubscription::max_retry_count() const {
   // @@protoc_insertion_point(field_get:es.message.CreatePersistentSubscription.max_retry_count)
-  return max_retry_count_;
+  return _internal_max_retry_count();
+}
+inline void CreatePersistentSubscription::_internal_set_max_retry_count(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000800u;
+  _impl_.max_retry_count_ = value;
 }
-inline void CreatePersistentSubscription::set_max_retry_count(::PROTOBUF_NAMESPACE_ID::int32 value) {
-  _has_bits_[0] |= 0x00000800u;
-  max_retry_count_ = value;
+inline void CreatePersistentSubscription::set_max_retry_count(int32_t value) {
+  _internal_set_max_retry_count(value);
   // @@protoc_insertion_point(field_set:es.message.CreatePersistentSubscription.max_retry_count)
 }
 
 // required bool prefer_round_robin = 11;
+inline bool CreatePersistentSubscription::_internal_has_prefer_round_robin() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000080u) != 0;
+  return value;
+}
 inline bool CreatePersistentSubscription::has_prefer_round_robin() const {
-  return (_has_bits_[0] & 0x00000080u) != 0;
+  return _internal_has_prefer_round_robin();
 }
 inline void CreatePersistentSubscription::clear_prefer_round_robin() {
-  prefer_round_robin_ = false;
-  _has_bits_[0] &= ~0x00000080u;
+  _impl_.prefer_round_robin_ = false;
+  _impl_._has_bits_[0] &= ~0x00000080u;
+}
+inline bool CreatePersistentSubscription::_internal_prefer_round_robin() const {
+  return _impl_.prefer_round_robin_;
 }
 inline bool CreatePersistentSubscription::prefer_round_robin() const {
   // @@protoc_insertion_point(field_get:es.message.CreatePersistentSubscription.prefer_round_robin)
-  return prefer_round_robin_;
+  return _internal_prefer_round_robin();
+}
+inline void CreatePersistentSubscription::_internal_set_prefer_round_robin(bool value) {
+  _impl_._has_bits_[0] |= 0x00000080u;
+  _impl_.prefer_round_robin_ = value;
 }
 inline void CreatePersistentSubscription::set_prefer_round_robin(bool value) {
-  _has_bits_[0] |= 0x00000080u;
-  prefer_round_robin_ = value;
+  _internal_set_prefer_round_robin(value);
   // @@protoc_insertion_point(field_set:es.message.CreatePersistentSubscription.prefer_round_robin)
 }
 
 // required int32 checkpoint_after_time = 12;
+inline bool CreatePersistentSubscription::_internal_has_checkpoint_after_time() const {
+  bool value = (_impl_._has_bits_[0] & 0x00001000u) != 0;
+  return value;
+}
 inline bool CreatePersistentSubscription::has_checkpoint_after_time() const {
-  return (_has_bits_[0] & 0x00001000u) != 0;
+  return _internal_has_checkpoint_after_time();
 }
 inline void CreatePersistentSubscription::clear_checkpoint_after_time() {
-  checkpoint_after_time_ = 0;
-  _has_bits_[0] &= ~0x00001000u;
+  _impl_.checkpoint_after_time_ = 0;
+  _impl_._has_bits_[0] &= ~0x00001000u;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 CreatePersistentSubscription::checkpoint_after_time() const {
+inline int32_t CreatePersistentSubscription::_internal_checkpoint_after_time() const {
+  return _impl_.checkpoint_after_time_;
+}
+inline int32_t CreatePersistentSubscription::checkpoint_after_time() const {
   // @@protoc_insertion_point(field_get:es.message.CreatePersistentSubscription.checkpoint_after_time)
-  return checkpoint_after_time_;
+  return _internal_checkpoint_after_time();
+}
+inline void CreatePersistentSubscription::_internal_set_checkpoint_after_time(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00001000u;
+  _impl_.checkpoint_after_time_ = value;
 }
-inline void CreatePersistentSubscription::set_checkpoint_after_time(::PROTOBUF_NAMESPACE_ID::int32 value) {
-  _has_bits_[0] |= 0x00001000u;
-  checkpoint_after_time_ = value;
+inline void CreatePersistentSubscription::set_checkpoint_after_time(int32_t value) {
+  _internal_set_checkpoint_after_time(value);
   // @@protoc_insertion_point(field_set:es.message.CreatePersistentSubscription.checkpoint_after_time)
 }
 
 // required int32 checkpoint_max_count = 13;
+inline bool CreatePersistentSubscription::_internal_has_checkpoint_max_count() const {
+  bool value = (_impl_._has_bits_[0] & 0x00002000u) != 0;
+  return value;
+}
 inline bool CreatePersistentSubscription::has_checkpoint_max_count() const {
-  return (_has_bits_[0] & 0x00002000u) != 0;
+  return _internal_has_checkpoint_max_count();
 }
 inline void CreatePersistentSubscription::clear_checkpoint_max_count() {
-  checkpoint_max_count_ = 0;
-  _has_bits_[0] &= ~0x00002000u;
+  _impl_.checkpoint_max_count_ = 0;
+  _impl_._has_bits_[0] &= ~0x00002000u;
+}
+inline int32_t CreatePersistentSubscription::_internal_checkpoint_max_count() const {
+  return _impl_.checkpoint_max_count_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 CreatePersistentSubscription::checkpoint_max_count() const {
+inline int32_t CreatePersistentSubscription::checkpoint_max_count() const {
   // @@protoc_insertion_point(field_get:es.message.CreatePersistentSubscription.checkpoint_max_count)
-  return checkpoint_max_count_;
+  return _internal_checkpoint_max_count();
 }
-inline void CreatePersistentSubscription::set_checkpoint_max_count(::PROTOBUF_NAMESPACE_ID::int32 value) {
-  _has_bits_[0] |= 0x00002000u;
-  checkpoint_max_count_ = value;
+inline void CreatePersistentSubscription::_internal_set_checkpoint_max_count(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00002000u;
+  _impl_.checkpoint_max_count_ = value;
+}
+inline void CreatePersistentSubscription::set_checkpoint_max_count(int32_t value) {
+  _internal_set_checkpoint_max_count(value);
   // @@protoc_insertion_point(field_set:es.message.CreatePersistentSubscription.checkpoint_max_count)
 }
 
 // required int32 checkpoint_min_count = 14;
+inline bool CreatePersistentSubscription::_internal_has_checkpoint_min_count() const {
+  bool value = (_impl_._has_bits_[0] & 0x00004000u) != 0;
+  return value;
+}
 inline bool CreatePersistentSubscription::has_checkpoint_min_count() const {
-  return (_has_bits_[0] & 0x00004000u) != 0;
+  return _internal_has_checkpoint_min_count();
 }
 inline void CreatePersistentSubscription::clear_checkpoint_min_count() {
-  checkpoint_min_count_ = 0;
-  _has_bits_[0] &= ~0x00004000u;
+  _impl_.checkpoint_min_count_ = 0;
+  _impl_._has_bits_[0] &= ~0x00004000u;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 CreatePersistentSubscription::checkpoint_min_count() const {
+inline int32_t CreatePersistentSubscription::_internal_checkpoint_min_count() const {
+  return _impl_.checkpoint_min_count_;
+}
+inline int32_t CreatePersistentSubscription::checkpoint_min_count() const {
   // @@protoc_insertion_point(field_get:es.message.CreatePersistentSubscription.checkpoint_min_count)
-  return checkpoint_min_count_;
+  return _internal_checkpoint_min_count();
+}
+inline void CreatePersistentSubscription::_internal_set_checkpoint_min_count(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00004000u;
+  _impl_.checkpoint_min_count_ = value;
 }
-inline void CreatePersistentSubscription::set_checkpoint_min_count(::PROTOBUF_NAMESPACE_ID::int32 value) {
-  _has_bits_[0] |= 0x00004000u;
-  checkpoint_min_count_ = value;
+inline void CreatePersistentSubscription::set_checkpoint_min_count(int32_t value) {
+  _internal_set_checkpoint_min_count(value);
   // @@protoc_insertion_point(field_set:es.message.CreatePersistentSubscription.checkpoint_min_count)
 }
 
 // required int32 subscriber_max_count = 15;
+inline bool CreatePersistentSubscription::_internal_has_subscriber_max_count() const {
+  bool value = (_impl_._has_bits_[0] & 0x00008000u) != 0;
+  return value;
+}
 inline bool CreatePersistentSubscription::has_subscriber_max_count() const {
-  return (_has_bits_[0] & 0x00008000u) != 0;
+  return _internal_has_subscriber_max_count();
 }
 inline void CreatePersistentSubscription::clear_subscriber_max_count() {
-  subscriber_max_count_ = 0;
-  _has_bits_[0] &= ~0x00008000u;
+  _impl_.subscriber_max_count_ = 0;
+  _impl_._has_bits_[0] &= ~0x00008000u;
+}
+inline int32_t CreatePersistentSubscription::_internal_subscriber_max_count() const {
+  return _impl_.subscriber_max_count_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 CreatePersistentSubscription::subscriber_max_count() const {
+inline int32_t CreatePersistentSubscription::subscriber_max_count() const {
   // @@protoc_insertion_point(field_get:es.message.CreatePersistentSubscription.subscriber_max_count)
-  return subscriber_max_count_;
+  return _internal_subscriber_max_count();
 }
-inline void CreatePersistentSubscription::set_subscriber_max_count(::PROTOBUF_NAMESPACE_ID::int32 value) {
-  _has_bits_[0] |= 0x00008000u;
-  subscriber_max_count_ = value;
+inline void CreatePersistentSubscription::_internal_set_subscriber_max_count(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00008000u;
+  _impl_.subscriber_max_count_ = value;
+}
+inline void CreatePersistentSubscription::set_subscriber_max_count(int32_t value) {
+  _internal_set_subscriber_max_count(value);
   // @@protoc_insertion_point(field_set:es.message.CreatePersistentSubscription.subscriber_max_count)
 }
 
 // optional string named_consumer_strategy = 16;
+inline bool CreatePersistentSubscription::_internal_has_named_consumer_strategy() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
 inline bool CreatePersistentSubscription::has_named_consumer_strategy() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
+  return _internal_has_named_consumer_strategy();
 }
 inline void CreatePersistentSubscription::clear_named_consumer_strategy() {
-  named_consumer_strategy_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  _has_bits_[0] &= ~0x00000004u;
+  _impl_.named_consumer_strategy_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000004u;
 }
 inline const std::string& CreatePersistentSubscription::named_consumer_strategy() const {
   // @@protoc_insertion_point(field_get:es.message.CreatePersistentSubscription.named_consumer_strategy)
-  return named_consumer_strategy_.GetNoArena();
+  return _internal_named_consumer_strategy();
 }
-inline void CreatePersistentSubscription::set_named_consumer_strategy(const std::string& value) {
-  _has_bits_[0] |= 0x00000004u;
-  named_consumer_strategy_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CreatePersistentSubscription::set_named_consumer_strategy(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000004u;
+ _impl_.named_consumer_strategy_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:es.message.CreatePersistentSubscription.named_consumer_strategy)
 }
-inline void CreatePersistentSubscription::set_named_consumer_strategy(std::string&& value) {
-  _has_bits_[0] |= 0x00000004u;
-  named_consumer_strategy_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:es.message.CreatePersistentSubscription.named_consumer_strategy)
+inline std::string* CreatePersistentSubscription::mutable_named_consumer_strategy() {
+  std::string* _s = _internal_mutable_named_consumer_strategy();
+  // @@protoc_insertion_point(field_mutable:es.message.CreatePersistentSubscription.named_consumer_strategy)
+  return _s;
 }
-inline void CreatePersistentSubscription::set_named_consumer_strategy(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  _has_bits_[0] |= 0x00000004u;
-  named_consumer_strategy_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:es.message.CreatePersistentSubscription.named_consumer_strategy)
+inline const std::string& CreatePersistentSubscription::_internal_named_consumer_strategy() const {
+  return _impl_.named_consumer_strategy_.Get();
 }
-inline void CreatePersistentSubscription::set_named_consumer_strategy(const char* value, size_t size) {
-  _has_bits_[0] |= 0x00000004u;
-  named_consumer_strategy_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:es.message.CreatePersistentSubscription.named_consumer_strategy)
+inline void CreatePersistentSubscription::_internal_set_named_consumer_strategy(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.named_consumer_strategy_.Set(value, GetArenaForAllocation());
 }
-inline std::string* CreatePersistentSubscription::mutable_named_consumer_strategy() {
-  _has_bits_[0] |= 0x00000004u;
-  // @@protoc_insertion_point(field_mutable:es.message.CreatePersistentSubscription.named_consumer_strategy)
-  return named_consumer_strategy_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline std::string* CreatePersistentSubscription::_internal_mutable_named_consumer_strategy() {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  return _impl_.named_consumer_strategy_.Mutable(GetArenaForAllocation());
 }
 inline std::string* CreatePersistentSubscription::release_named_consumer_strategy() {
   // @@protoc_insertion_point(field_release:es.message.CreatePersistentSubscription.named_consumer_strategy)
-  if (!has_named_consumer_strategy()) {
+  if (!_internal_has_named_consumer_strategy()) {
     return nullptr;
   }
-  _has_bits_[0] &= ~0x00000004u;
-  return named_consumer_strategy_.ReleaseNonDefaultNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  auto* p = _impl_.named_consumer_strategy_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.named_consumer_strategy_.IsDefault()) {
+    _impl_.named_consumer_strategy_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
 }
 inline void CreatePersistentSubscription::set_allocated_named_consumer_strategy(std::string* named_consumer_strategy) {
   if (named_consumer_strategy != nullptr) {
-    _has_bits_[0] |= 0x00000004u;
+    _impl_._has_bits_[0] |= 0x00000004u;
   } else {
-    _has_bits_[0] &= ~0x00000004u;
+    _impl_._has_bits_[0] &= ~0x00000004u;
   }
-  named_consumer_strategy_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), named_consumer_strategy);
+  _impl_.named_consumer_strategy_.SetAllocated(named_consumer_strategy, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.named_consumer_strategy_.IsDefault()) {
+    _impl_.named_consumer_strategy_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:es.message.CreatePersistentSubscription.named_consumer_strategy)
 }
 
@@ -11402,118 +14260,138 @@ inline void CreatePersistentSubscription::set_allocated_named_consumer_strategy(
 // DeletePersistentSubscription
 
 // required string subscription_group_name = 1;
+inline bool DeletePersistentSubscription::_internal_has_subscription_group_name() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
 inline bool DeletePersistentSubscription::has_subscription_group_name() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+  return _internal_has_subscription_group_name();
 }
 inline void DeletePersistentSubscription::clear_subscription_group_name() {
-  subscription_group_name_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  _has_bits_[0] &= ~0x00000001u;
+  _impl_.subscription_group_name_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
 }
 inline const std::string& DeletePersistentSubscription::subscription_group_name() const {
   // @@protoc_insertion_point(field_get:es.message.DeletePersistentSubscription.subscription_group_name)
-  return subscription_group_name_.GetNoArena();
+  return _internal_subscription_group_name();
 }
-inline void DeletePersistentSubscription::set_subscription_group_name(const std::string& value) {
-  _has_bits_[0] |= 0x00000001u;
-  subscription_group_name_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void DeletePersistentSubscription::set_subscription_group_name(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.subscription_group_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:es.message.DeletePersistentSubscription.subscription_group_name)
 }
-inline void DeletePersistentSubscription::set_subscription_group_name(std::string&& value) {
-  _has_bits_[0] |= 0x00000001u;
-  subscription_group_name_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:es.message.DeletePersistentSubscription.subscription_group_name)
+inline std::string* DeletePersistentSubscription::mutable_subscription_group_name() {
+  std::string* _s = _internal_mutable_subscription_group_name();
+  // @@protoc_insertion_point(field_mutable:es.message.DeletePersistentSubscription.subscription_group_name)
+  return _s;
 }
-inline void DeletePersistentSubscription::set_subscription_group_name(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  _has_bits_[0] |= 0x00000001u;
-  subscription_group_name_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:es.message.DeletePersistentSubscription.subscription_group_name)
+inline const std::string& DeletePersistentSubscription::_internal_subscription_group_name() const {
+  return _impl_.subscription_group_name_.Get();
 }
-inline void DeletePersistentSubscription::set_subscription_group_name(const char* value, size_t size) {
-  _has_bits_[0] |= 0x00000001u;
-  subscription_group_name_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:es.message.DeletePersistentSubscription.subscription_group_name)
+inline void DeletePersistentSubscription::_internal_set_subscription_group_name(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.subscription_group_name_.Set(value, GetArenaForAllocation());
 }
-inline std::string* DeletePersistentSubscription::mutable_subscription_group_name() {
-  _has_bits_[0] |= 0x00000001u;
-  // @@protoc_insertion_point(field_mutable:es.message.DeletePersistentSubscription.subscription_group_name)
-  return subscription_group_name_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline std::string* DeletePersistentSubscription::_internal_mutable_subscription_group_name() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.subscription_group_name_.Mutable(GetArenaForAllocation());
 }
 inline std::string* DeletePersistentSubscription::release_subscription_group_name() {
   // @@protoc_insertion_point(field_release:es.message.DeletePersistentSubscription.subscription_group_name)
-  if (!has_subscription_group_name()) {
+  if (!_internal_has_subscription_group_name()) {
     return nullptr;
   }
-  _has_bits_[0] &= ~0x00000001u;
-  return subscription_group_name_.ReleaseNonDefaultNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.subscription_group_name_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.subscription_group_name_.IsDefault()) {
+    _impl_.subscription_group_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
 }
 inline void DeletePersistentSubscription::set_allocated_subscription_group_name(std::string* subscription_group_name) {
   if (subscription_group_name != nullptr) {
-    _has_bits_[0] |= 0x00000001u;
+    _impl_._has_bits_[0] |= 0x00000001u;
   } else {
-    _has_bits_[0] &= ~0x00000001u;
+    _impl_._has_bits_[0] &= ~0x00000001u;
   }
-  subscription_group_name_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), subscription_group_name);
+  _impl_.subscription_group_name_.SetAllocated(subscription_group_name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.subscription_group_name_.IsDefault()) {
+    _impl_.subscription_group_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:es.message.DeletePersistentSubscription.subscription_group_name)
 }
 
 // required string event_stream_id = 2;
+inline bool DeletePersistentSubscription::_internal_has_event_stream_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
 inline bool DeletePersistentSubscription::has_event_stream_id() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
+  return _internal_has_event_stream_id();
 }
 inline void DeletePersistentSubscription::clear_event_stream_id() {
-  event_stream_id_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  _has_bits_[0] &= ~0x00000002u;
+  _impl_.event_stream_id_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
 }
 inline const std::string& DeletePersistentSubscription::event_stream_id() const {
   // @@protoc_insertion_point(field_get:es.message.DeletePersistentSubscription.event_stream_id)
-  return event_stream_id_.GetNoArena();
+  return _internal_event_stream_id();
 }
-inline void DeletePersistentSubscription::set_event_stream_id(const std::string& value) {
-  _has_bits_[0] |= 0x00000002u;
-  event_stream_id_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void DeletePersistentSubscription::set_event_stream_id(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.event_stream_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:es.message.DeletePersistentSubscription.event_stream_id)
 }
-inline void DeletePersistentSubscription::set_event_stream_id(std::string&& value) {
-  _has_bits_[0] |= 0x00000002u;
-  event_stream_id_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:es.message.DeletePersistentSubscription.event_stream_id)
+inline std::string* DeletePersistentSubscription::mutable_event_stream_id() {
+  std::string* _s = _internal_mutable_event_stream_id();
+  // @@protoc_insertion_point(field_mutable:es.message.DeletePersistentSubscription.event_stream_id)
+  return _s;
 }
-inline void DeletePersistentSubscription::set_event_stream_id(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  _has_bits_[0] |= 0x00000002u;
-  event_stream_id_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:es.message.DeletePersistentSubscription.event_stream_id)
+inline const std::string& DeletePersistentSubscription::_internal_event_stream_id() const {
+  return _impl_.event_stream_id_.Get();
 }
-inline void DeletePersistentSubscription::set_event_stream_id(const char* value, size_t size) {
-  _has_bits_[0] |= 0x00000002u;
-  event_stream_id_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:es.message.DeletePersistentSubscription.event_stream_id)
+inline void DeletePersistentSubscription::_internal_set_event_stream_id(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.event_stream_id_.Set(value, GetArenaForAllocation());
 }
-inline std::string* DeletePersistentSubscription::mutable_event_stream_id() {
-  _has_bits_[0] |= 0x00000002u;
-  // @@protoc_insertion_point(field_mutable:es.message.DeletePersistentSubscription.event_stream_id)
-  return event_stream_id_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline std::string* DeletePersistentSubscription::_internal_mutable_event_stream_id() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.event_stream_id_.Mutable(GetArenaForAllocation());
 }
 inline std::string* DeletePersistentSubscription::release_event_stream_id() {
   // @@protoc_insertion_point(field_release:es.message.DeletePersistentSubscription.event_stream_id)
-  if (!has_event_stream_id()) {
+  if (!_internal_has_event_stream_id()) {
     return nullptr;
   }
-  _has_bits_[0] &= ~0x00000002u;
-  return event_stream_id_.ReleaseNonDefaultNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.event_stream_id_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.event_stream_id_.IsDefault()) {
+    _impl_.event_stream_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
 }
 inline void DeletePersistentSubscription::set_allocated_event_stream_id(std::string* event_stream_id) {
   if (event_stream_id != nullptr) {
-    _has_bits_[0] |= 0x00000002u;
+    _impl_._has_bits_[0] |= 0x00000002u;
   } else {
-    _has_bits_[0] &= ~0x00000002u;
+    _impl_._has_bits_[0] &= ~0x00000002u;
   }
-  event_stream_id_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), event_stream_id);
+  _impl_.event_stream_id_.SetAllocated(event_stream_id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.event_stream_id_.IsDefault()) {
+    _impl_.event_stream_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:es.message.DeletePersistentSubscription.event_stream_id)
 }
 
@@ -11522,410 +14400,570 @@ inline void DeletePersistentSubscription::set_allocated_event_stream_id(std::str
 // UpdatePersistentSubscription
 
 // required string subscription_group_name = 1;
+inline bool UpdatePersistentSubscription::_internal_has_subscription_group_name() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
 inline bool UpdatePersistentSubscription::has_subscription_group_name() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+  return _internal_has_subscription_group_name();
 }
 inline void UpdatePersistentSubscription::clear_subscription_group_name() {
-  subscription_group_name_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  _has_bits_[0] &= ~0x00000001u;
+  _impl_.subscription_group_name_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
 }
 inline const std::string& UpdatePersistentSubscription::subscription_group_name() const {
   // @@protoc_insertion_point(field_get:es.message.UpdatePersistentSubscription.subscription_group_name)
-  return subscription_group_name_.GetNoArena();
+  return _internal_subscription_group_name();
 }
-inline void UpdatePersistentSubscription::set_subscription_group_name(const std::string& value) {
-  _has_bits_[0] |= 0x00000001u;
-  subscription_group_name_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void UpdatePersistentSubscription::set_subscription_group_name(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.subscription_group_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:es.message.UpdatePersistentSubscription.subscription_group_name)
 }
-inline void UpdatePersistentSubscription::set_subscription_group_name(std::string&& value) {
-  _has_bits_[0] |= 0x00000001u;
-  subscription_group_name_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:es.message.UpdatePersistentSubscription.subscription_group_name)
+inline std::string* UpdatePersistentSubscription::mutable_subscription_group_name() {
+  std::string* _s = _internal_mutable_subscription_group_name();
+  // @@protoc_insertion_point(field_mutable:es.message.UpdatePersistentSubscription.subscription_group_name)
+  return _s;
 }
-inline void UpdatePersistentSubscription::set_subscription_group_name(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  _has_bits_[0] |= 0x00000001u;
-  subscription_group_name_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:es.message.UpdatePersistentSubscription.subscription_group_name)
+inline const std::string& UpdatePersistentSubscription::_internal_subscription_group_name() const {
+  return _impl_.subscription_group_name_.Get();
 }
-inline void UpdatePersistentSubscription::set_subscription_group_name(const char* value, size_t size) {
-  _has_bits_[0] |= 0x00000001u;
-  subscription_group_name_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:es.message.UpdatePersistentSubscription.subscription_group_name)
+inline void UpdatePersistentSubscription::_internal_set_subscription_group_name(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.subscription_group_name_.Set(value, GetArenaForAllocation());
 }
-inline std::string* UpdatePersistentSubscription::mutable_subscription_group_name() {
-  _has_bits_[0] |= 0x00000001u;
-  // @@protoc_insertion_point(field_mutable:es.message.UpdatePersistentSubscription.subscription_group_name)
-  return subscription_group_name_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline std::string* UpdatePersistentSubscription::_internal_mutable_subscription_group_name() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.subscription_group_name_.Mutable(GetArenaForAllocation());
 }
 inline std::string* UpdatePersistentSubscription::release_subscription_group_name() {
   // @@protoc_insertion_point(field_release:es.message.UpdatePersistentSubscription.subscription_group_name)
-  if (!has_subscription_group_name()) {
+  if (!_internal_has_subscription_group_name()) {
     return nullptr;
   }
-  _has_bits_[0] &= ~0x00000001u;
-  return subscription_group_name_.ReleaseNonDefaultNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.subscription_group_name_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.subscription_group_name_.IsDefault()) {
+    _impl_.subscription_group_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
 }
 inline void UpdatePersistentSubscription::set_allocated_subscription_group_name(std::string* subscription_group_name) {
   if (subscription_group_name != nullptr) {
-    _has_bits_[0] |= 0x00000001u;
+    _impl_._has_bits_[0] |= 0x00000001u;
   } else {
-    _has_bits_[0] &= ~0x00000001u;
+    _impl_._has_bits_[0] &= ~0x00000001u;
   }
-  subscription_group_name_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), subscription_group_name);
+  _impl_.subscription_group_name_.SetAllocated(subscription_group_name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.subscription_group_name_.IsDefault()) {
+    _impl_.subscription_group_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:es.message.UpdatePersistentSubscription.subscription_group_name)
 }
 
 // required string event_stream_id = 2;
+inline bool UpdatePersistentSubscription::_internal_has_event_stream_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
 inline bool UpdatePersistentSubscription::has_event_stream_id() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
+  return _internal_has_event_stream_id();
 }
 inline void UpdatePersistentSubscription::clear_event_stream_id() {
-  event_stream_id_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  _has_bits_[0] &= ~0x00000002u;
+  _impl_.event_stream_id_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
 }
 inline const std::string& UpdatePersistentSubscription::event_stream_id() const {
   // @@protoc_insertion_point(field_get:es.message.UpdatePersistentSubscription.event_stream_id)
-  return event_stream_id_.GetNoArena();
+  return _internal_event_stream_id();
 }
-inline void UpdatePersistentSubscription::set_event_stream_id(const std::string& value) {
-  _has_bits_[0] |= 0x00000002u;
-  event_stream_id_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void UpdatePersistentSubscription::set_event_stream_id(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.event_stream_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:es.message.UpdatePersistentSubscription.event_stream_id)
 }
-inline void UpdatePersistentSubscription::set_event_stream_id(std::string&& value) {
-  _has_bits_[0] |= 0x00000002u;
-  event_stream_id_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:es.message.UpdatePersistentSubscription.event_stream_id)
+inline std::string* UpdatePersistentSubscription::mutable_event_stream_id() {
+  std::string* _s = _internal_mutable_event_stream_id();
+  // @@protoc_insertion_point(field_mutable:es.message.UpdatePersistentSubscription.event_stream_id)
+  return _s;
 }
-inline void UpdatePersistentSubscription::set_event_stream_id(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  _has_bits_[0] |= 0x00000002u;
-  event_stream_id_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:es.message.UpdatePersistentSubscription.event_stream_id)
+inline const std::string& UpdatePersistentSubscription::_internal_event_stream_id() const {
+  return _impl_.event_stream_id_.Get();
 }
-inline void UpdatePersistentSubscription::set_event_stream_id(const char* value, size_t size) {
-  _has_bits_[0] |= 0x00000002u;
-  event_stream_id_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:es.message.UpdatePersistentSubscription.event_stream_id)
+inline void UpdatePersistentSubscription::_internal_set_event_stream_id(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.event_stream_id_.Set(value, GetArenaForAllocation());
 }
-inline std::string* UpdatePersistentSubscription::mutable_event_stream_id() {
-  _has_bits_[0] |= 0x00000002u;
-  // @@protoc_insertion_point(field_mutable:es.message.UpdatePersistentSubscription.event_stream_id)
-  return event_stream_id_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline std::string* UpdatePersistentSubscription::_internal_mutable_event_stream_id() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.event_stream_id_.Mutable(GetArenaForAllocation());
 }
 inline std::string* UpdatePersistentSubscription::release_event_stream_id() {
   // @@protoc_insertion_point(field_release:es.message.UpdatePersistentSubscription.event_stream_id)
-  if (!has_event_stream_id()) {
+  if (!_internal_has_event_stream_id()) {
     return nullptr;
   }
-  _has_bits_[0] &= ~0x00000002u;
-  return event_stream_id_.ReleaseNonDefaultNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.event_stream_id_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.event_stream_id_.IsDefault()) {
+    _impl_.event_stream_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
 }
 inline void UpdatePersistentSubscription::set_allocated_event_stream_id(std::string* event_stream_id) {
   if (event_stream_id != nullptr) {
-    _has_bits_[0] |= 0x00000002u;
+    _impl_._has_bits_[0] |= 0x00000002u;
   } else {
-    _has_bits_[0] &= ~0x00000002u;
+    _impl_._has_bits_[0] &= ~0x00000002u;
   }
-  event_stream_id_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), event_stream_id);
+  _impl_.event_stream_id_.SetAllocated(event_stream_id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.event_stream_id_.IsDefault()) {
+    _impl_.event_stream_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:es.message.UpdatePersistentSubscription.event_stream_id)
 }
 
 // required bool resolve_link_tos = 3;
+inline bool UpdatePersistentSubscription::_internal_has_resolve_link_tos() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
 inline bool UpdatePersistentSubscription::has_resolve_link_tos() const {
-  return (_has_bits_[0] & 0x00000020u) != 0;
+  return _internal_has_resolve_link_tos();
 }
 inline void UpdatePersistentSubscription::clear_resolve_link_tos() {
-  resolve_link_tos_ = false;
-  _has_bits_[0] &= ~0x00000020u;
+  _impl_.resolve_link_tos_ = false;
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline bool UpdatePersistentSubscription::_internal_resolve_link_tos() const {
+  return _impl_.resolve_link_tos_;
 }
 inline bool UpdatePersistentSubscription::resolve_link_tos() const {
   // @@protoc_insertion_point(field_get:es.message.UpdatePersistentSubscription.resolve_link_tos)
-  return resolve_link_tos_;
+  return _internal_resolve_link_tos();
+}
+inline void UpdatePersistentSubscription::_internal_set_resolve_link_tos(bool value) {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.resolve_link_tos_ = value;
 }
 inline void UpdatePersistentSubscription::set_resolve_link_tos(bool value) {
-  _has_bits_[0] |= 0x00000020u;
-  resolve_link_tos_ = value;
+  _internal_set_resolve_link_tos(value);
   // @@protoc_insertion_point(field_set:es.message.UpdatePersistentSubscription.resolve_link_tos)
 }
 
 // required int64 start_from = 4;
+inline bool UpdatePersistentSubscription::_internal_has_start_from() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
 inline bool UpdatePersistentSubscription::has_start_from() const {
-  return (_has_bits_[0] & 0x00000008u) != 0;
+  return _internal_has_start_from();
 }
 inline void UpdatePersistentSubscription::clear_start_from() {
-  start_from_ = PROTOBUF_LONGLONG(0);
-  _has_bits_[0] &= ~0x00000008u;
+  _impl_.start_from_ = int64_t{0};
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline int64_t UpdatePersistentSubscription::_internal_start_from() const {
+  return _impl_.start_from_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int64 UpdatePersistentSubscription::start_from() const {
+inline int64_t UpdatePersistentSubscription::start_from() const {
   // @@protoc_insertion_point(field_get:es.message.UpdatePersistentSubscription.start_from)
-  return start_from_;
+  return _internal_start_from();
 }
-inline void UpdatePersistentSubscription::set_start_from(::PROTOBUF_NAMESPACE_ID::int64 value) {
-  _has_bits_[0] |= 0x00000008u;
-  start_from_ = value;
+inline void UpdatePersistentSubscription::_internal_set_start_from(int64_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.start_from_ = value;
+}
+inline void UpdatePersistentSubscription::set_start_from(int64_t value) {
+  _internal_set_start_from(value);
   // @@protoc_insertion_point(field_set:es.message.UpdatePersistentSubscription.start_from)
 }
 
 // required int32 message_timeout_milliseconds = 5;
+inline bool UpdatePersistentSubscription::_internal_has_message_timeout_milliseconds() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
 inline bool UpdatePersistentSubscription::has_message_timeout_milliseconds() const {
-  return (_has_bits_[0] & 0x00000010u) != 0;
+  return _internal_has_message_timeout_milliseconds();
 }
 inline void UpdatePersistentSubscription::clear_message_timeout_milliseconds() {
-  message_timeout_milliseconds_ = 0;
-  _has_bits_[0] &= ~0x00000010u;
+  _impl_.message_timeout_milliseconds_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000010u;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 UpdatePersistentSubscription::message_timeout_milliseconds() const {
+inline int32_t UpdatePersistentSubscription::_internal_message_timeout_milliseconds() const {
+  return _impl_.message_timeout_milliseconds_;
+}
+inline int32_t UpdatePersistentSubscription::message_timeout_milliseconds() const {
   // @@protoc_insertion_point(field_get:es.message.UpdatePersistentSubscription.message_timeout_milliseconds)
-  return message_timeout_milliseconds_;
+  return _internal_message_timeout_milliseconds();
+}
+inline void UpdatePersistentSubscription::_internal_set_message_timeout_milliseconds(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.message_timeout_milliseconds_ = value;
 }
-inline void UpdatePersistentSubscription::set_message_timeout_milliseconds(::PROTOBUF_NAMESPACE_ID::int32 value) {
-  _has_bits_[0] |= 0x00000010u;
-  message_timeout_milliseconds_ = value;
+inline void UpdatePersistentSubscription::set_message_timeout_milliseconds(int32_t value) {
+  _internal_set_message_timeout_milliseconds(value);
   // @@protoc_insertion_point(field_set:es.message.UpdatePersistentSubscription.message_timeout_milliseconds)
 }
 
 // required bool record_statistics = 6;
+inline bool UpdatePersistentSubscription::_internal_has_record_statistics() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  return value;
+}
 inline bool UpdatePersistentSubscription::has_record_statistics() const {
-  return (_has_bits_[0] & 0x00000040u) != 0;
+  return _internal_has_record_statistics();
 }
 inline void UpdatePersistentSubscription::clear_record_statistics() {
-  record_statistics_ = false;
-  _has_bits_[0] &= ~0x00000040u;
+  _impl_.record_statistics_ = false;
+  _impl_._has_bits_[0] &= ~0x00000040u;
+}
+inline bool UpdatePersistentSubscription::_internal_record_statistics() const {
+  return _impl_.record_statistics_;
 }
 inline bool UpdatePersistentSubscription::record_statistics() const {
   // @@protoc_insertion_point(field_get:es.message.UpdatePersistentSubscription.record_statistics)
-  return record_statistics_;
+  return _internal_record_statistics();
+}
+inline void UpdatePersistentSubscription::_internal_set_record_statistics(bool value) {
+  _impl_._has_bits_[0] |= 0x00000040u;
+  _impl_.record_statistics_ = value;
 }
 inline void UpdatePersistentSubscription::set_record_statistics(bool value) {
-  _has_bits_[0] |= 0x00000040u;
-  record_statistics_ = value;
+  _internal_set_record_statistics(value);
   // @@protoc_insertion_point(field_set:es.message.UpdatePersistentSubscription.record_statistics)
 }
 
 // required int32 live_buffer_size = 7;
+inline bool UpdatePersistentSubscription::_internal_has_live_buffer_size() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000100u) != 0;
+  return value;
+}
 inline bool UpdatePersistentSubscription::has_live_buffer_size() const {
-  return (_has_bits_[0] & 0x00000100u) != 0;
+  return _internal_has_live_buffer_size();
 }
 inline void UpdatePersistentSubscription::clear_live_buffer_size() {
-  live_buffer_size_ = 0;
-  _has_bits_[0] &= ~0x00000100u;
+  _impl_.live_buffer_size_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000100u;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 UpdatePersistentSubscription::live_buffer_size() const {
+inline int32_t UpdatePersistentSubscription::_internal_live_buffer_size() const {
+  return _impl_.live_buffer_size_;
+}
+inline int32_t UpdatePersistentSubscription::live_buffer_size() const {
   // @@protoc_insertion_point(field_get:es.message.UpdatePersistentSubscription.live_buffer_size)
-  return live_buffer_size_;
+  return _internal_live_buffer_size();
+}
+inline void UpdatePersistentSubscription::_internal_set_live_buffer_size(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000100u;
+  _impl_.live_buffer_size_ = value;
 }
-inline void UpdatePersistentSubscription::set_live_buffer_size(::PROTOBUF_NAMESPACE_ID::int32 value) {
-  _has_bits_[0] |= 0x00000100u;
-  live_buffer_size_ = value;
+inline void UpdatePersistentSubscription::set_live_buffer_size(int32_t value) {
+  _internal_set_live_buffer_size(value);
   // @@protoc_insertion_point(field_set:es.message.UpdatePersistentSubscription.live_buffer_size)
 }
 
 // required int32 read_batch_size = 8;
+inline bool UpdatePersistentSubscription::_internal_has_read_batch_size() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000200u) != 0;
+  return value;
+}
 inline bool UpdatePersistentSubscription::has_read_batch_size() const {
-  return (_has_bits_[0] & 0x00000200u) != 0;
+  return _internal_has_read_batch_size();
 }
 inline void UpdatePersistentSubscription::clear_read_batch_size() {
-  read_batch_size_ = 0;
-  _has_bits_[0] &= ~0x00000200u;
+  _impl_.read_batch_size_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000200u;
+}
+inline int32_t UpdatePersistentSubscription::_internal_read_batch_size() const {
+  return _impl_.read_batch_size_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 UpdatePersistentSubscription::read_batch_size() const {
+inline int32_t UpdatePersistentSubscription::read_batch_size() const {
   // @@protoc_insertion_point(field_get:es.message.UpdatePersistentSubscription.read_batch_size)
-  return read_batch_size_;
+  return _internal_read_batch_size();
 }
-inline void UpdatePersistentSubscription::set_read_batch_size(::PROTOBUF_NAMESPACE_ID::int32 value) {
-  _has_bits_[0] |= 0x00000200u;
-  read_batch_size_ = value;
+inline void UpdatePersistentSubscription::_internal_set_read_batch_size(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000200u;
+  _impl_.read_batch_size_ = value;
+}
+inline void UpdatePersistentSubscription::set_read_batch_size(int32_t value) {
+  _internal_set_read_batch_size(value);
   // @@protoc_insertion_point(field_set:es.message.UpdatePersistentSubscription.read_batch_size)
 }
 
 // required int32 buffer_size = 9;
+inline bool UpdatePersistentSubscription::_internal_has_buffer_size() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000400u) != 0;
+  return value;
+}
 inline bool UpdatePersistentSubscription::has_buffer_size() const {
-  return (_has_bits_[0] & 0x00000400u) != 0;
+  return _internal_has_buffer_size();
 }
 inline void UpdatePersistentSubscription::clear_buffer_size() {
-  buffer_size_ = 0;
-  _has_bits_[0] &= ~0x00000400u;
+  _impl_.buffer_size_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000400u;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 UpdatePersistentSubscription::buffer_size() const {
+inline int32_t UpdatePersistentSubscription::_internal_buffer_size() const {
+  return _impl_.buffer_size_;
+}
+inline int32_t UpdatePersistentSubscription::buffer_size() const {
   // @@protoc_insertion_point(field_get:es.message.UpdatePersistentSubscription.buffer_size)
-  return buffer_size_;
+  return _internal_buffer_size();
+}
+inline void UpdatePersistentSubscription::_internal_set_buffer_size(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000400u;
+  _impl_.buffer_size_ = value;
 }
-inline void UpdatePersistentSubscription::set_buffer_size(::PROTOBUF_NAMESPACE_ID::int32 value) {
-  _has_bits_[0] |= 0x00000400u;
-  buffer_size_ = value;
+inline void UpdatePersistentSubscription::set_buffer_size(int32_t value) {
+  _internal_set_buffer_size(value);
   // @@protoc_insertion_point(field_set:es.message.UpdatePersistentSubscription.buffer_size)
 }
 
 // required int32 max_retry_count = 10;
+inline bool UpdatePersistentSubscription::_internal_has_max_retry_count() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000800u) != 0;
+  return value;
+}
 inline bool UpdatePersistentSubscription::has_max_retry_count() const {
-  return (_has_bits_[0] & 0x00000800u) != 0;
+  return _internal_has_max_retry_count();
 }
 inline void UpdatePersistentSubscription::clear_max_retry_count() {
-  max_retry_count_ = 0;
-  _has_bits_[0] &= ~0x00000800u;
+  _impl_.max_retry_count_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000800u;
+}
+inline int32_t UpdatePersistentSubscription::_internal_max_retry_count() const {
+  return _impl_.max_retry_count_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 UpdatePersistentSubscription::max_retry_count() const {
+inline int32_t UpdatePersistentSubscription::max_retry_count() const {
   // @@protoc_insertion_point(field_get:es.message.UpdatePersistentSubscription.max_retry_count)
-  return max_retry_count_;
+  return _internal_max_retry_count();
 }
-inline void UpdatePersistentSubscription::set_max_retry_count(::PROTOBUF_NAMESPACE_ID::int32 value) {
-  _has_bits_[0] |= 0x00000800u;
-  max_retry_count_ = value;
+inline void UpdatePersistentSubscription::_internal_set_max_retry_count(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000800u;
+  _impl_.max_retry_count_ = value;
+}
+inline void UpdatePersistentSubscription::set_max_retry_count(int32_t value) {
+  _internal_set_max_retry_count(value);
   // @@protoc_insertion_point(field_set:es.message.UpdatePersistentSubscription.max_retry_count)
 }
 
 // required bool prefer_round_robin = 11;
+inline bool UpdatePersistentSubscription::_internal_has_prefer_round_robin() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000080u) != 0;
+  return value;
+}
 inline bool UpdatePersistentSubscription::has_prefer_round_robin() const {
-  return (_has_bits_[0] & 0x00000080u) != 0;
+  return _internal_has_prefer_round_robin();
 }
 inline void UpdatePersistentSubscription::clear_prefer_round_robin() {
-  prefer_round_robin_ = false;
-  _has_bits_[0] &= ~0x00000080u;
+  _impl_.prefer_round_robin_ = false;
+  _impl_._has_bits_[0] &= ~0x00000080u;
+}
+inline bool UpdatePersistentSubscription::_internal_prefer_round_robin() const {
+  return _impl_.prefer_round_robin_;
 }
 inline bool UpdatePersistentSubscription::prefer_round_robin() const {
   // @@protoc_insertion_point(field_get:es.message.UpdatePersistentSubscription.prefer_round_robin)
-  return prefer_round_robin_;
+  return _internal_prefer_round_robin();
+}
+inline void UpdatePersistentSubscription::_internal_set_prefer_round_robin(bool value) {
+  _impl_._has_bits_[0] |= 0x00000080u;
+  _impl_.prefer_round_robin_ = value;
 }
 inline void UpdatePersistentSubscription::set_prefer_round_robin(bool value) {
-  _has_bits_[0] |= 0x00000080u;
-  prefer_round_robin_ = value;
+  _internal_set_prefer_round_robin(value);
   // @@protoc_insertion_point(field_set:es.message.UpdatePersistentSubscription.prefer_round_robin)
 }
 
 // required int32 checkpoint_after_time = 12;
+inline bool UpdatePersistentSubscription::_internal_has_checkpoint_after_time() const {
+  bool value = (_impl_._has_bits_[0] & 0x00001000u) != 0;
+  return value;
+}
 inline bool UpdatePersistentSubscription::has_checkpoint_after_time() const {
-  return (_has_bits_[0] & 0x00001000u) != 0;
+  return _internal_has_checkpoint_after_time();
 }
 inline void UpdatePersistentSubscription::clear_checkpoint_after_time() {
-  checkpoint_after_time_ = 0;
-  _has_bits_[0] &= ~0x00001000u;
+  _impl_.checkpoint_after_time_ = 0;
+  _impl_._has_bits_[0] &= ~0x00001000u;
+}
+inline int32_t UpdatePersistentSubscription::_internal_checkpoint_after_time() const {
+  return _impl_.checkpoint_after_time_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 UpdatePersistentSubscription::checkpoint_after_time() const {
+inline int32_t UpdatePersistentSubscription::checkpoint_after_time() const {
   // @@protoc_insertion_point(field_get:es.message.UpdatePersistentSubscription.checkpoint_after_time)
-  return checkpoint_after_time_;
+  return _internal_checkpoint_after_time();
 }
-inline void UpdatePersistentSubscription::set_checkpoint_after_time(::PROTOBUF_NAMESPACE_ID::int32 value) {
-  _has_bits_[0] |= 0x00001000u;
-  checkpoint_after_time_ = value;
+inline void UpdatePersistentSubscription::_internal_set_checkpoint_after_time(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00001000u;
+  _impl_.checkpoint_after_time_ = value;
+}
+inline void UpdatePersistentSubscription::set_checkpoint_after_time(int32_t value) {
+  _internal_set_checkpoint_after_time(value);
   // @@protoc_insertion_point(field_set:es.message.UpdatePersistentSubscription.checkpoint_after_time)
 }
 
 // required int32 checkpoint_max_count = 13;
+inline bool UpdatePersistentSubscription::_internal_has_checkpoint_max_count() const {
+  bool value = (_impl_._has_bits_[0] & 0x00002000u) != 0;
+  return value;
+}
 inline bool UpdatePersistentSubscription::has_checkpoint_max_count() const {
-  return (_has_bits_[0] & 0x00002000u) != 0;
+  return _internal_has_checkpoint_max_count();
 }
 inline void UpdatePersistentSubscription::clear_checkpoint_max_count() {
-  checkpoint_max_count_ = 0;
-  _has_bits_[0] &= ~0x00002000u;
+  _impl_.checkpoint_max_count_ = 0;
+  _impl_._has_bits_[0] &= ~0x00002000u;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 UpdatePersistentSubscription::checkpoint_max_count() const {
+inline int32_t UpdatePersistentSubscription::_internal_checkpoint_max_count() const {
+  return _impl_.checkpoint_max_count_;
+}
+inline int32_t UpdatePersistentSubscription::checkpoint_max_count() const {
   // @@protoc_insertion_point(field_get:es.message.UpdatePersistentSubscription.checkpoint_max_count)
-  return checkpoint_max_count_;
+  return _internal_checkpoint_max_count();
+}
+inline void UpdatePersistentSubscription::_internal_set_checkpoint_max_count(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00002000u;
+  _impl_.checkpoint_max_count_ = value;
 }
-inline void UpdatePersistentSubscription::set_checkpoint_max_count(::PROTOBUF_NAMESPACE_ID::int32 value) {
-  _has_bits_[0] |= 0x00002000u;
-  checkpoint_max_count_ = value;
+inline void UpdatePersistentSubscription::set_checkpoint_max_count(int32_t value) {
+  _internal_set_checkpoint_max_count(value);
   // @@protoc_insertion_point(field_set:es.message.UpdatePersistentSubscription.checkpoint_max_count)
 }
 
 // required int32 checkpoint_min_count = 14;
+inline bool UpdatePersistentSubscription::_internal_has_checkpoint_min_count() const {
+  bool value = (_impl_._has_bits_[0] & 0x00004000u) != 0;
+  return value;
+}
 inline bool UpdatePersistentSubscription::has_checkpoint_min_count() const {
-  return (_has_bits_[0] & 0x00004000u) != 0;
+  return _internal_has_checkpoint_min_count();
 }
 inline void UpdatePersistentSubscription::clear_checkpoint_min_count() {
-  checkpoint_min_count_ = 0;
-  _has_bits_[0] &= ~0x00004000u;
+  _impl_.checkpoint_min_count_ = 0;
+  _impl_._has_bits_[0] &= ~0x00004000u;
+}
+inline int32_t UpdatePersistentSubscription::_internal_checkpoint_min_count() const {
+  return _impl_.checkpoint_min_count_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 UpdatePersistentSubscription::checkpoint_min_count() const {
+inline int32_t UpdatePersistentSubscription::checkpoint_min_count() const {
   // @@protoc_insertion_point(field_get:es.message.UpdatePersistentSubscription.checkpoint_min_count)
-  return checkpoint_min_count_;
+  return _internal_checkpoint_min_count();
 }
-inline void UpdatePersistentSubscription::set_checkpoint_min_count(::PROTOBUF_NAMESPACE_ID::int32 value) {
-  _has_bits_[0] |= 0x00004000u;
-  checkpoint_min_count_ = value;
+inline void UpdatePersistentSubscription::_internal_set_checkpoint_min_count(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00004000u;
+  _impl_.checkpoint_min_count_ = value;
+}
+inline void UpdatePersistentSubscription::set_checkpoint_min_count(int32_t value) {
+  _internal_set_checkpoint_min_count(value);
   // @@protoc_insertion_point(field_set:es.message.UpdatePersistentSubscription.checkpoint_min_count)
 }
 
 // required int32 subscriber_max_count = 15;
+inline bool UpdatePersistentSubscription::_internal_has_subscriber_max_count() const {
+  bool value = (_impl_._has_bits_[0] & 0x00008000u) != 0;
+  return value;
+}
 inline bool UpdatePersistentSubscription::has_subscriber_max_count() const {
-  return (_has_bits_[0] & 0x00008000u) != 0;
+  return _internal_has_subscriber_max_count();
 }
 inline void UpdatePersistentSubscription::clear_subscriber_max_count() {
-  subscriber_max_count_ = 0;
-  _has_bits_[0] &= ~0x00008000u;
+  _impl_.subscriber_max_count_ = 0;
+  _impl_._has_bits_[0] &= ~0x00008000u;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 UpdatePersistentSubscription::subscriber_max_count() const {
+inline int32_t UpdatePersistentSubscription::_internal_subscriber_max_count() const {
+  return _impl_.subscriber_max_count_;
+}
+inline int32_t UpdatePersistentSubscription::subscriber_max_count() const {
   // @@protoc_insertion_point(field_get:es.message.UpdatePersistentSubscription.subscriber_max_count)
-  return subscriber_max_count_;
+  return _internal_subscriber_max_count();
+}
+inline void UpdatePersistentSubscription::_internal_set_subscriber_max_count(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00008000u;
+  _impl_.subscriber_max_count_ = value;
 }
-inline void UpdatePersistentSubscription::set_subscriber_max_count(::PROTOBUF_NAMESPACE_ID::int32 value) {
-  _has_bits_[0] |= 0x00008000u;
-  subscriber_max_count_ = value;
+inline void UpdatePersistentSubscription::set_subscriber_max_count(int32_t value) {
+  _internal_set_subscriber_max_count(value);
   // @@protoc_insertion_point(field_set:es.message.UpdatePersistentSubscription.subscriber_max_count)
 }
 
 // optional string named_consumer_strategy = 16;
+inline bool UpdatePersistentSubscription::_internal_has_named_consumer_strategy() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
 inline bool UpdatePersistentSubscription::has_named_consumer_strategy() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
+  return _internal_has_named_consumer_strategy();
 }
 inline void UpdatePersistentSubscription::clear_named_consumer_strategy() {
-  named_consumer_strategy_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  _has_bits_[0] &= ~0x00000004u;
+  _impl_.named_consumer_strategy_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000004u;
 }
 inline const std::string& UpdatePersistentSubscription::named_consumer_strategy() const {
   // @@protoc_insertion_point(field_get:es.message.UpdatePersistentSubscription.named_consumer_strategy)
-  return named_consumer_strategy_.GetNoArena();
+  return _internal_named_consumer_strategy();
 }
-inline void UpdatePersistentSubscription::set_named_consumer_strategy(const std::string& value) {
-  _has_bits_[0] |= 0x00000004u;
-  named_consumer_strategy_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void UpdatePersistentSubscription::set_named_consumer_strategy(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000004u;
+ _impl_.named_consumer_strategy_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:es.message.UpdatePersistentSubscription.named_consumer_strategy)
 }
-inline void UpdatePersistentSubscription::set_named_consumer_strategy(std::string&& value) {
-  _has_bits_[0] |= 0x00000004u;
-  named_consumer_strategy_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:es.message.UpdatePersistentSubscription.named_consumer_strategy)
+inline std::string* UpdatePersistentSubscription::mutable_named_consumer_strategy() {
+  std::string* _s = _internal_mutable_named_consumer_strategy();
+  // @@protoc_insertion_point(field_mutable:es.message.UpdatePersistentSubscription.named_consumer_strategy)
+  return _s;
 }
-inline void UpdatePersistentSubscription::set_named_consumer_strategy(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  _has_bits_[0] |= 0x00000004u;
-  named_consumer_strategy_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:es.message.UpdatePersistentSubscription.named_consumer_strategy)
+inline const std::string& UpdatePersistentSubscription::_internal_named_consumer_strategy() const {
+  return _impl_.named_consumer_strategy_.Get();
 }
-inline void UpdatePersistentSubscription::set_named_consumer_strategy(const char* value, size_t size) {
-  _has_bits_[0] |= 0x00000004u;
-  named_consumer_strategy_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:es.message.UpdatePersistentSubscription.named_consumer_strategy)
+inline void UpdatePersistentSubscription::_internal_set_named_consumer_strategy(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.named_consumer_strategy_.Set(value, GetArenaForAllocation());
 }
-inline std::string* UpdatePersistentSubscription::mutable_named_consumer_strategy() {
-  _has_bits_[0] |= 0x00000004u;
-  // @@protoc_insertion_point(field_mutable:es.message.UpdatePersistentSubscription.named_consumer_strategy)
-  return named_consumer_strategy_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline std::string* UpdatePersistentSubscription::_internal_mutable_named_consumer_strategy() {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  return _impl_.named_consumer_strategy_.Mutable(GetArenaForAllocation());
 }
 inline std::string* UpdatePersistentSubscription::release_named_consumer_strategy() {
   // @@protoc_insertion_point(field_release:es.message.UpdatePersistentSubscription.named_consumer_strategy)
-  if (!has_named_consumer_strategy()) {
+  if (!_internal_has_named_consumer_strategy()) {
     return nullptr;
   }
-  _has_bits_[0] &= ~0x00000004u;
-  return named_consumer_strategy_.ReleaseNonDefaultNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  auto* p = _impl_.named_consumer_strategy_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.named_consumer_strategy_.IsDefault()) {
+    _impl_.named_consumer_strategy_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
 }
 inline void UpdatePersistentSubscription::set_allocated_named_consumer_strategy(std::string* named_consumer_strategy) {
   if (named_consumer_strategy != nullptr) {
-    _has_bits_[0] |= 0x00000004u;
+    _impl_._has_bits_[0] |= 0x00000004u;
   } else {
-    _has_bits_[0] &= ~0x00000004u;
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  _impl_.named_consumer_strategy_.SetAllocated(named_consumer_strategy, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.named_consumer_strategy_.IsDefault()) {
+    _impl_.named_consumer_strategy_.Set("", GetArenaForAllocation());
   }
-  named_consumer_strategy_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), named_consumer_strategy);
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:es.message.UpdatePersistentSubscription.named_consumer_strategy)
 }
 
@@ -11934,79 +14972,99 @@ inline void UpdatePersistentSubscription::set_allocated_named_consumer_strategy(
 // UpdatePersistentSubscriptionCompleted
 
 // required .es.message.UpdatePersistentSubscriptionCompleted.UpdatePersistentSubscriptionResult result = 1;
+inline bool UpdatePersistentSubscriptionCompleted::_internal_has_result() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
 inline bool UpdatePersistentSubscriptionCompleted::has_result() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
+  return _internal_has_result();
 }
 inline void UpdatePersistentSubscriptionCompleted::clear_result() {
-  result_ = 0;
-  _has_bits_[0] &= ~0x00000002u;
+  _impl_.result_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline ::es::message::UpdatePersistentSubscriptionCompleted_UpdatePersistentSubscriptionResult UpdatePersistentSubscriptionCompleted::_internal_result() const {
+  return static_cast< ::es::message::UpdatePersistentSubscriptionCompleted_UpdatePersistentSubscriptionResult >(_impl_.result_);
 }
 inline ::es::message::UpdatePersistentSubscriptionCompleted_UpdatePersistentSubscriptionResult UpdatePersistentSubscriptionCompleted::result() const {
   // @@protoc_insertion_point(field_get:es.message.UpdatePersistentSubscriptionCompleted.result)
-  return static_cast< ::es::message::UpdatePersistentSubscriptionCompleted_UpdatePersistentSubscriptionResult >(result_);
+  return _internal_result();
 }
-inline void UpdatePersistentSubscriptionCompleted::set_result(::es::message::UpdatePersistentSubscriptionCompleted_UpdatePersistentSubscriptionResult value) {
+inline void UpdatePersistentSubscriptionCompleted::_internal_set_result(::es::message::UpdatePersistentSubscriptionCompleted_UpdatePersistentSubscriptionResult value) {
   assert(::es::message::UpdatePersistentSubscriptionCompleted_UpdatePersistentSubscriptionResult_IsValid(value));
-  _has_bits_[0] |= 0x00000002u;
-  result_ = value;
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.result_ = value;
+}
+inline void UpdatePersistentSubscriptionCompleted::set_result(::es::message::UpdatePersistentSubscriptionCompleted_UpdatePersistentSubscriptionResult value) {
+  _internal_set_result(value);
   // @@protoc_insertion_point(field_set:es.message.UpdatePersistentSubscriptionCompleted.result)
 }
 
 // optional string reason = 2;
+inline bool UpdatePersistentSubscriptionCompleted::_internal_has_reason() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
 inline bool UpdatePersistentSubscriptionCompleted::has_reason() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+  return _internal_has_reason();
 }
 inline void UpdatePersistentSubscriptionCompleted::clear_reason() {
-  reason_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  _has_bits_[0] &= ~0x00000001u;
+  _impl_.reason_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
 }
 inline const std::string& UpdatePersistentSubscriptionCompleted::reason() const {
   // @@protoc_insertion_point(field_get:es.message.UpdatePersistentSubscriptionCompleted.reason)
-  return reason_.GetNoArena();
+  return _internal_reason();
 }
-inline void UpdatePersistentSubscriptionCompleted::set_reason(const std::string& value) {
-  _has_bits_[0] |= 0x00000001u;
-  reason_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void UpdatePersistentSubscriptionCompleted::set_reason(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.reason_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:es.message.UpdatePersistentSubscriptionCompleted.reason)
 }
-inline void UpdatePersistentSubscriptionCompleted::set_reason(std::string&& value) {
-  _has_bits_[0] |= 0x00000001u;
-  reason_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:es.message.UpdatePersistentSubscriptionCompleted.reason)
+inline std::string* UpdatePersistentSubscriptionCompleted::mutable_reason() {
+  std::string* _s = _internal_mutable_reason();
+  // @@protoc_insertion_point(field_mutable:es.message.UpdatePersistentSubscriptionCompleted.reason)
+  return _s;
 }
-inline void UpdatePersistentSubscriptionCompleted::set_reason(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  _has_bits_[0] |= 0x00000001u;
-  reason_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:es.message.UpdatePersistentSubscriptionCompleted.reason)
+inline const std::string& UpdatePersistentSubscriptionCompleted::_internal_reason() const {
+  return _impl_.reason_.Get();
 }
-inline void UpdatePersistentSubscriptionCompleted::set_reason(const char* value, size_t size) {
-  _has_bits_[0] |= 0x00000001u;
-  reason_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:es.message.UpdatePersistentSubscriptionCompleted.reason)
+inline void UpdatePersistentSubscriptionCompleted::_internal_set_reason(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.reason_.Set(value, GetArenaForAllocation());
 }
-inline std::string* UpdatePersistentSubscriptionCompleted::mutable_reason() {
-  _has_bits_[0] |= 0x00000001u;
-  // @@protoc_insertion_point(field_mutable:es.message.UpdatePersistentSubscriptionCompleted.reason)
-  return reason_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline std::string* UpdatePersistentSubscriptionCompleted::_internal_mutable_reason() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.reason_.Mutable(GetArenaForAllocation());
 }
 inline std::string* UpdatePersistentSubscriptionCompleted::release_reason() {
   // @@protoc_insertion_point(field_release:es.message.UpdatePersistentSubscriptionCompleted.reason)
-  if (!has_reason()) {
+  if (!_internal_has_reason()) {
     return nullptr;
   }
-  _has_bits_[0] &= ~0x00000001u;
-  return reason_.ReleaseNonDefaultNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.reason_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.reason_.IsDefault()) {
+    _impl_.reason_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
 }
 inline void UpdatePersistentSubscriptionCompleted::set_allocated_reason(std::string* reason) {
   if (reason != nullptr) {
-    _has_bits_[0] |= 0x00000001u;
+    _impl_._has_bits_[0] |= 0x00000001u;
   } else {
-    _has_bits_[0] &= ~0x00000001u;
+    _impl_._has_bits_[0] &= ~0x00000001u;
   }
-  reason_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), reason);
+  _impl_.reason_.SetAllocated(reason, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.reason_.IsDefault()) {
+    _impl_.reason_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:es.message.UpdatePersistentSubscriptionCompleted.reason)
 }
 
@@ -12015,79 +15073,99 @@ inline void UpdatePersistentSubscriptionCompleted::set_allocated_reason(std::str
 // CreatePersistentSubscriptionCompleted
 
 // required .es.message.CreatePersistentSubscriptionCompleted.CreatePersistentSubscriptionResult result = 1;
+inline bool CreatePersistentSubscriptionCompleted::_internal_has_result() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
 inline bool CreatePersistentSubscriptionCompleted::has_result() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
+  return _internal_has_result();
 }
 inline void CreatePersistentSubscriptionCompleted::clear_result() {
-  result_ = 0;
-  _has_bits_[0] &= ~0x00000002u;
+  _impl_.result_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline ::es::message::CreatePersistentSubscriptionCompleted_CreatePersistentSubscriptionResult CreatePersistentSubscriptionCompleted::_internal_result() const {
+  return static_cast< ::es::message::CreatePersistentSubscriptionCompleted_CreatePersistentSubscriptionResult >(_impl_.result_);
 }
 inline ::es::message::CreatePersistentSubscriptionCompleted_CreatePersistentSubscriptionResult CreatePersistentSubscriptionCompleted::result() const {
   // @@protoc_insertion_point(field_get:es.message.CreatePersistentSubscriptionCompleted.result)
-  return static_cast< ::es::message::CreatePersistentSubscriptionCompleted_CreatePersistentSubscriptionResult >(result_);
+  return _internal_result();
 }
-inline void CreatePersistentSubscriptionCompleted::set_result(::es::message::CreatePersistentSubscriptionCompleted_CreatePersistentSubscriptionResult value) {
+inline void CreatePersistentSubscriptionCompleted::_internal_set_result(::es::message::CreatePersistentSubscriptionCompleted_CreatePersistentSubscriptionResult value) {
   assert(::es::message::CreatePersistentSubscriptionCompleted_CreatePersistentSubscriptionResult_IsValid(value));
-  _has_bits_[0] |= 0x00000002u;
-  result_ = value;
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.result_ = value;
+}
+inline void CreatePersistentSubscriptionCompleted::set_result(::es::message::CreatePersistentSubscriptionCompleted_CreatePersistentSubscriptionResult value) {
+  _internal_set_result(value);
   // @@protoc_insertion_point(field_set:es.message.CreatePersistentSubscriptionCompleted.result)
 }
 
 // optional string reason = 2;
+inline bool CreatePersistentSubscriptionCompleted::_internal_has_reason() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
 inline bool CreatePersistentSubscriptionCompleted::has_reason() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+  return _internal_has_reason();
 }
 inline void CreatePersistentSubscriptionCompleted::clear_reason() {
-  reason_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  _has_bits_[0] &= ~0x00000001u;
+  _impl_.reason_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
 }
 inline const std::string& CreatePersistentSubscriptionCompleted::reason() const {
   // @@protoc_insertion_point(field_get:es.message.CreatePersistentSubscriptionCompleted.reason)
-  return reason_.GetNoArena();
+  return _internal_reason();
 }
-inline void CreatePersistentSubscriptionCompleted::set_reason(const std::string& value) {
-  _has_bits_[0] |= 0x00000001u;
-  reason_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CreatePersistentSubscriptionCompleted::set_reason(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.reason_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:es.message.CreatePersistentSubscriptionCompleted.reason)
 }
-inline void CreatePersistentSubscriptionCompleted::set_reason(std::string&& value) {
-  _has_bits_[0] |= 0x00000001u;
-  reason_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:es.message.CreatePersistentSubscriptionCompleted.reason)
+inline std::string* CreatePersistentSubscriptionCompleted::mutable_reason() {
+  std::string* _s = _internal_mutable_reason();
+  // @@protoc_insertion_point(field_mutable:es.message.CreatePersistentSubscriptionCompleted.reason)
+  return _s;
 }
-inline void CreatePersistentSubscriptionCompleted::set_reason(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  _has_bits_[0] |= 0x00000001u;
-  reason_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:es.message.CreatePersistentSubscriptionCompleted.reason)
+inline const std::string& CreatePersistentSubscriptionCompleted::_internal_reason() const {
+  return _impl_.reason_.Get();
 }
-inline void CreatePersistentSubscriptionCompleted::set_reason(const char* value, size_t size) {
-  _has_bits_[0] |= 0x00000001u;
-  reason_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:es.message.CreatePersistentSubscriptionCompleted.reason)
+inline void CreatePersistentSubscriptionCompleted::_internal_set_reason(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.reason_.Set(value, GetArenaForAllocation());
 }
-inline std::string* CreatePersistentSubscriptionCompleted::mutable_reason() {
-  _has_bits_[0] |= 0x00000001u;
-  // @@protoc_insertion_point(field_mutable:es.message.CreatePersistentSubscriptionCompleted.reason)
-  return reason_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline std::string* CreatePersistentSubscriptionCompleted::_internal_mutable_reason() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.reason_.Mutable(GetArenaForAllocation());
 }
 inline std::string* CreatePersistentSubscriptionCompleted::release_reason() {
   // @@protoc_insertion_point(field_release:es.message.CreatePersistentSubscriptionCompleted.reason)
-  if (!has_reason()) {
+  if (!_internal_has_reason()) {
     return nullptr;
   }
-  _has_bits_[0] &= ~0x00000001u;
-  return reason_.ReleaseNonDefaultNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.reason_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.reason_.IsDefault()) {
+    _impl_.reason_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
 }
 inline void CreatePersistentSubscriptionCompleted::set_allocated_reason(std::string* reason) {
   if (reason != nullptr) {
-    _has_bits_[0] |= 0x00000001u;
+    _impl_._has_bits_[0] |= 0x00000001u;
   } else {
-    _has_bits_[0] &= ~0x00000001u;
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.reason_.SetAllocated(reason, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.reason_.IsDefault()) {
+    _impl_.reason_.Set("", GetArenaForAllocation());
   }
-  reason_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), reason);
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:es.message.CreatePersistentSubscriptionCompleted.reason)
 }
 
@@ -12096,79 +15174,99 @@ inline void CreatePersistentSubscriptionCompleted::set_allocated_reason(std::str
 // DeletePersistentSubscriptionCompleted
 
 // required .es.message.DeletePersistentSubscriptionCompleted.DeletePersistentSubscriptionResult result = 1;
+inline bool DeletePersistentSubscriptionCompleted::_internal_has_result() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
 inline bool DeletePersistentSubscriptionCompleted::has_result() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
+  return _internal_has_result();
 }
 inline void DeletePersistentSubscriptionCompleted::clear_result() {
-  result_ = 0;
-  _has_bits_[0] &= ~0x00000002u;
+  _impl_.result_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline ::es::message::DeletePersistentSubscriptionCompleted_DeletePersistentSubscriptionResult DeletePersistentSubscriptionCompleted::_internal_result() const {
+  return static_cast< ::es::message::DeletePersistentSubscriptionCompleted_DeletePersistentSubscriptionResult >(_impl_.result_);
 }
 inline ::es::message::DeletePersistentSubscriptionCompleted_DeletePersistentSubscriptionResult DeletePersistentSubscriptionCompleted::result() const {
   // @@protoc_insertion_point(field_get:es.message.DeletePersistentSubscriptionCompleted.result)
-  return static_cast< ::es::message::DeletePersistentSubscriptionCompleted_DeletePersistentSubscriptionResult >(result_);
+  return _internal_result();
 }
-inline void DeletePersistentSubscriptionCompleted::set_result(::es::message::DeletePersistentSubscriptionCompleted_DeletePersistentSubscriptionResult value) {
+inline void DeletePersistentSubscriptionCompleted::_internal_set_result(::es::message::DeletePersistentSubscriptionCompleted_DeletePersistentSubscriptionResult value) {
   assert(::es::message::DeletePersistentSubscriptionCompleted_DeletePersistentSubscriptionResult_IsValid(value));
-  _has_bits_[0] |= 0x00000002u;
-  result_ = value;
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.result_ = value;
+}
+inline void DeletePersistentSubscriptionCompleted::set_result(::es::message::DeletePersistentSubscriptionCompleted_DeletePersistentSubscriptionResult value) {
+  _internal_set_result(value);
   // @@protoc_insertion_point(field_set:es.message.DeletePersistentSubscriptionCompleted.result)
 }
 
 // optional string reason = 2;
+inline bool DeletePersistentSubscriptionCompleted::_internal_has_reason() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
 inline bool DeletePersistentSubscriptionCompleted::has_reason() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+  return _internal_has_reason();
 }
 inline void DeletePersistentSubscriptionCompleted::clear_reason() {
-  reason_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  _has_bits_[0] &= ~0x00000001u;
+  _impl_.reason_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
 }
 inline const std::string& DeletePersistentSubscriptionCompleted::reason() const {
   // @@protoc_insertion_point(field_get:es.message.DeletePersistentSubscriptionCompleted.reason)
-  return reason_.GetNoArena();
+  return _internal_reason();
 }
-inline void DeletePersistentSubscriptionCompleted::set_reason(const std::string& value) {
-  _has_bits_[0] |= 0x00000001u;
-  reason_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void DeletePersistentSubscriptionCompleted::set_reason(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.reason_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:es.message.DeletePersistentSubscriptionCompleted.reason)
 }
-inline void DeletePersistentSubscriptionCompleted::set_reason(std::string&& value) {
-  _has_bits_[0] |= 0x00000001u;
-  reason_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:es.message.DeletePersistentSubscriptionCompleted.reason)
+inline std::string* DeletePersistentSubscriptionCompleted::mutable_reason() {
+  std::string* _s = _internal_mutable_reason();
+  // @@protoc_insertion_point(field_mutable:es.message.DeletePersistentSubscriptionCompleted.reason)
+  return _s;
 }
-inline void DeletePersistentSubscriptionCompleted::set_reason(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  _has_bits_[0] |= 0x00000001u;
-  reason_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:es.message.DeletePersistentSubscriptionCompleted.reason)
+inline const std::string& DeletePersistentSubscriptionCompleted::_internal_reason() const {
+  return _impl_.reason_.Get();
 }
-inline void DeletePersistentSubscriptionCompleted::set_reason(const char* value, size_t size) {
-  _has_bits_[0] |= 0x00000001u;
-  reason_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:es.message.DeletePersistentSubscriptionCompleted.reason)
+inline void DeletePersistentSubscriptionCompleted::_internal_set_reason(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.reason_.Set(value, GetArenaForAllocation());
 }
-inline std::string* DeletePersistentSubscriptionCompleted::mutable_reason() {
-  _has_bits_[0] |= 0x00000001u;
-  // @@protoc_insertion_point(field_mutable:es.message.DeletePersistentSubscriptionCompleted.reason)
-  return reason_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline std::string* DeletePersistentSubscriptionCompleted::_internal_mutable_reason() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.reason_.Mutable(GetArenaForAllocation());
 }
 inline std::string* DeletePersistentSubscriptionCompleted::release_reason() {
   // @@protoc_insertion_point(field_release:es.message.DeletePersistentSubscriptionCompleted.reason)
-  if (!has_reason()) {
+  if (!_internal_has_reason()) {
     return nullptr;
   }
-  _has_bits_[0] &= ~0x00000001u;
-  return reason_.ReleaseNonDefaultNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.reason_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.reason_.IsDefault()) {
+    _impl_.reason_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
 }
 inline void DeletePersistentSubscriptionCompleted::set_allocated_reason(std::string* reason) {
   if (reason != nullptr) {
-    _has_bits_[0] |= 0x00000001u;
+    _impl_._has_bits_[0] |= 0x00000001u;
   } else {
-    _has_bits_[0] &= ~0x00000001u;
+    _impl_._has_bits_[0] &= ~0x00000001u;
   }
-  reason_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), reason);
+  _impl_.reason_.SetAllocated(reason, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.reason_.IsDefault()) {
+    _impl_.reason_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:es.message.DeletePersistentSubscriptionCompleted.reason)
 }
 
@@ -12177,136 +15275,166 @@ inline void DeletePersistentSubscriptionCompleted::set_allocated_reason(std::str
 // ConnectToPersistentSubscription
 
 // required string subscription_id = 1;
+inline bool ConnectToPersistentSubscription::_internal_has_subscription_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
 inline bool ConnectToPersistentSubscription::has_subscription_id() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+  return _internal_has_subscription_id();
 }
 inline void ConnectToPersistentSubscription::clear_subscription_id() {
-  subscription_id_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  _has_bits_[0] &= ~0x00000001u;
+  _impl_.subscription_id_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
 }
 inline const std::string& ConnectToPersistentSubscription::subscription_id() const {
   // @@protoc_insertion_point(field_get:es.message.ConnectToPersistentSubscription.subscription_id)
-  return subscription_id_.GetNoArena();
+  return _internal_subscription_id();
 }
-inline void ConnectToPersistentSubscription::set_subscription_id(const std::string& value) {
-  _has_bits_[0] |= 0x00000001u;
-  subscription_id_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ConnectToPersistentSubscription::set_subscription_id(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.subscription_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:es.message.ConnectToPersistentSubscription.subscription_id)
 }
-inline void ConnectToPersistentSubscription::set_subscription_id(std::string&& value) {
-  _has_bits_[0] |= 0x00000001u;
-  subscription_id_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:es.message.ConnectToPersistentSubscription.subscription_id)
+inline std::string* ConnectToPersistentSubscription::mutable_subscription_id() {
+  std::string* _s = _internal_mutable_subscription_id();
+  // @@protoc_insertion_point(field_mutable:es.message.ConnectToPersistentSubscription.subscription_id)
+  return _s;
 }
-inline void ConnectToPersistentSubscription::set_subscription_id(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  _has_bits_[0] |= 0x00000001u;
-  subscription_id_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:es.message.ConnectToPersistentSubscription.subscription_id)
+inline const std::string& ConnectToPersistentSubscription::_internal_subscription_id() const {
+  return _impl_.subscription_id_.Get();
 }
-inline void ConnectToPersistentSubscription::set_subscription_id(const char* value, size_t size) {
-  _has_bits_[0] |= 0x00000001u;
-  subscription_id_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:es.message.ConnectToPersistentSubscription.subscription_id)
+inline void ConnectToPersistentSubscription::_internal_set_subscription_id(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.subscription_id_.Set(value, GetArenaForAllocation());
 }
-inline std::string* ConnectToPersistentSubscription::mutable_subscription_id() {
-  _has_bits_[0] |= 0x00000001u;
-  // @@protoc_insertion_point(field_mutable:es.message.ConnectToPersistentSubscription.subscription_id)
-  return subscription_id_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline std::string* ConnectToPersistentSubscription::_internal_mutable_subscription_id() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.subscription_id_.Mutable(GetArenaForAllocation());
 }
 inline std::string* ConnectToPersistentSubscription::release_subscription_id() {
   // @@protoc_insertion_point(field_release:es.message.ConnectToPersistentSubscription.subscription_id)
-  if (!has_subscription_id()) {
+  if (!_internal_has_subscription_id()) {
     return nullptr;
   }
-  _has_bits_[0] &= ~0x00000001u;
-  return subscription_id_.ReleaseNonDefaultNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.subscription_id_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.subscription_id_.IsDefault()) {
+    _impl_.subscription_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
 }
 inline void ConnectToPersistentSubscription::set_allocated_subscription_id(std::string* subscription_id) {
   if (subscription_id != nullptr) {
-    _has_bits_[0] |= 0x00000001u;
+    _impl_._has_bits_[0] |= 0x00000001u;
   } else {
-    _has_bits_[0] &= ~0x00000001u;
+    _impl_._has_bits_[0] &= ~0x00000001u;
   }
-  subscription_id_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), subscription_id);
+  _impl_.subscription_id_.SetAllocated(subscription_id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.subscription_id_.IsDefault()) {
+    _impl_.subscription_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:es.message.ConnectToPersistentSubscription.subscription_id)
 }
 
 // required string event_stream_id = 2;
+inline bool ConnectToPersistentSubscription::_internal_has_event_stream_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
 inline bool ConnectToPersistentSubscription::has_event_stream_id() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
+  return _internal_has_event_stream_id();
 }
 inline void ConnectToPersistentSubscription::clear_event_stream_id() {
-  event_stream_id_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  _has_bits_[0] &= ~0x00000002u;
+  _impl_.event_stream_id_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
 }
 inline const std::string& ConnectToPersistentSubscription::event_stream_id() const {
   // @@protoc_insertion_point(field_get:es.message.ConnectToPersistentSubscription.event_stream_id)
-  return event_stream_id_.GetNoArena();
+  return _internal_event_stream_id();
 }
-inline void ConnectToPersistentSubscription::set_event_stream_id(const std::string& value) {
-  _has_bits_[0] |= 0x00000002u;
-  event_stream_id_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ConnectToPersistentSubscription::set_event_stream_id(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.event_stream_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:es.message.ConnectToPersistentSubscription.event_stream_id)
 }
-inline void ConnectToPersistentSubscription::set_event_stream_id(std::string&& value) {
-  _has_bits_[0] |= 0x00000002u;
-  event_stream_id_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:es.message.ConnectToPersistentSubscription.event_stream_id)
+inline std::string* ConnectToPersistentSubscription::mutable_event_stream_id() {
+  std::string* _s = _internal_mutable_event_stream_id();
+  // @@protoc_insertion_point(field_mutable:es.message.ConnectToPersistentSubscription.event_stream_id)
+  return _s;
 }
-inline void ConnectToPersistentSubscription::set_event_stream_id(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  _has_bits_[0] |= 0x00000002u;
-  event_stream_id_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:es.message.ConnectToPersistentSubscription.event_stream_id)
+inline const std::string& ConnectToPersistentSubscription::_internal_event_stream_id() const {
+  return _impl_.event_stream_id_.Get();
 }
-inline void ConnectToPersistentSubscription::set_event_stream_id(const char* value, size_t size) {
-  _has_bits_[0] |= 0x00000002u;
-  event_stream_id_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:es.message.ConnectToPersistentSubscription.event_stream_id)
+inline void ConnectToPersistentSubscription::_internal_set_event_stream_id(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.event_stream_id_.Set(value, GetArenaForAllocation());
 }
-inline std::string* ConnectToPersistentSubscription::mutable_event_stream_id() {
-  _has_bits_[0] |= 0x00000002u;
-  // @@protoc_insertion_point(field_mutable:es.message.ConnectToPersistentSubscription.event_stream_id)
-  return event_stream_id_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline std::string* ConnectToPersistentSubscription::_internal_mutable_event_stream_id() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.event_stream_id_.Mutable(GetArenaForAllocation());
 }
 inline std::string* ConnectToPersistentSubscription::release_event_stream_id() {
   // @@protoc_insertion_point(field_release:es.message.ConnectToPersistentSubscription.event_stream_id)
-  if (!has_event_stream_id()) {
+  if (!_internal_has_event_stream_id()) {
     return nullptr;
   }
-  _has_bits_[0] &= ~0x00000002u;
-  return event_stream_id_.ReleaseNonDefaultNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.event_stream_id_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.event_stream_id_.IsDefault()) {
+    _impl_.event_stream_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
 }
 inline void ConnectToPersistentSubscription::set_allocated_event_stream_id(std::string* event_stream_id) {
   if (event_stream_id != nullptr) {
-    _has_bits_[0] |= 0x00000002u;
+    _impl_._has_bits_[0] |= 0x00000002u;
   } else {
-    _has_bits_[0] &= ~0x00000002u;
+    _impl_._has_bits_[0] &= ~0x00000002u;
   }
-  event_stream_id_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), event_stream_id);
+  _impl_.event_stream_id_.SetAllocated(event_stream_id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.event_stream_id_.IsDefault()) {
+    _impl_.event_stream_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:es.message.ConnectToPersistentSubscription.event_stream_id)
 }
 
 // required int32 allowed_in_flight_messages = 3;
+inline bool ConnectToPersistentSubscription::_internal_has_allowed_in_flight_messages() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
 inline bool ConnectToPersistentSubscription::has_allowed_in_flight_messages() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
+  return _internal_has_allowed_in_flight_messages();
 }
 inline void ConnectToPersistentSubscription::clear_allowed_in_flight_messages() {
-  allowed_in_flight_messages_ = 0;
-  _has_bits_[0] &= ~0x00000004u;
+  _impl_.allowed_in_flight_messages_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000004u;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 ConnectToPersistentSubscription::allowed_in_flight_messages() const {
+inline int32_t ConnectToPersistentSubscription::_internal_allowed_in_flight_messages() const {
+  return _impl_.allowed_in_flight_messages_;
+}
+inline int32_t ConnectToPersistentSubscription::allowed_in_flight_messages() const {
   // @@protoc_insertion_point(field_get:es.message.ConnectToPersistentSubscription.allowed_in_flight_messages)
-  return allowed_in_flight_messages_;
+  return _internal_allowed_in_flight_messages();
+}
+inline void ConnectToPersistentSubscription::_internal_set_allowed_in_flight_messages(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.allowed_in_flight_messages_ = value;
 }
-inline void ConnectToPersistentSubscription::set_allowed_in_flight_messages(::PROTOBUF_NAMESPACE_ID::int32 value) {
-  _has_bits_[0] |= 0x00000004u;
-  allowed_in_flight_messages_ = value;
+inline void ConnectToPersistentSubscription::set_allowed_in_flight_messages(int32_t value) {
+  _internal_set_allowed_in_flight_messages(value);
   // @@protoc_insertion_point(field_set:es.message.ConnectToPersistentSubscription.allowed_in_flight_messages)
 }
 
@@ -12315,126 +15443,146 @@ inline void ConnectToPersistentSubscription::set_allowed_in_flight_messages(::PR
 // PersistentSubscriptionAckEvents
 
 // required string subscription_id = 1;
+inline bool PersistentSubscriptionAckEvents::_internal_has_subscription_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
 inline bool PersistentSubscriptionAckEvents::has_subscription_id() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+  return _internal_has_subscription_id();
 }
 inline void PersistentSubscriptionAckEvents::clear_subscription_id() {
-  subscription_id_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  _has_bits_[0] &= ~0x00000001u;
+  _impl_.subscription_id_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
 }
 inline const std::string& PersistentSubscriptionAckEvents::subscription_id() const {
   // @@protoc_insertion_point(field_get:es.message.PersistentSubscriptionAckEvents.subscription_id)
-  return subscription_id_.GetNoArena();
+  return _internal_subscription_id();
 }
-inline void PersistentSubscriptionAckEvents::set_subscription_id(const std::string& value) {
-  _has_bits_[0] |= 0x00000001u;
-  subscription_id_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PersistentSubscriptionAckEvents::set_subscription_id(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.subscription_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:es.message.PersistentSubscriptionAckEvents.subscription_id)
 }
-inline void PersistentSubscriptionAckEvents::set_subscription_id(std::string&& value) {
-  _has_bits_[0] |= 0x00000001u;
-  subscription_id_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:es.message.PersistentSubscriptionAckEvents.subscription_id)
+inline std::string* PersistentSubscriptionAckEvents::mutable_subscription_id() {
+  std::string* _s = _internal_mutable_subscription_id();
+  // @@protoc_insertion_point(field_mutable:es.message.PersistentSubscriptionAckEvents.subscription_id)
+  return _s;
 }
-inline void PersistentSubscriptionAckEvents::set_subscription_id(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  _has_bits_[0] |= 0x00000001u;
-  subscription_id_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:es.message.PersistentSubscriptionAckEvents.subscription_id)
+inline const std::string& PersistentSubscriptionAckEvents::_internal_subscription_id() const {
+  return _impl_.subscription_id_.Get();
 }
-inline void PersistentSubscriptionAckEvents::set_subscription_id(const char* value, size_t size) {
-  _has_bits_[0] |= 0x00000001u;
-  subscription_id_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:es.message.PersistentSubscriptionAckEvents.subscription_id)
+inline void PersistentSubscriptionAckEvents::_internal_set_subscription_id(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.subscription_id_.Set(value, GetArenaForAllocation());
 }
-inline std::string* PersistentSubscriptionAckEvents::mutable_subscription_id() {
-  _has_bits_[0] |= 0x00000001u;
-  // @@protoc_insertion_point(field_mutable:es.message.PersistentSubscriptionAckEvents.subscription_id)
-  return subscription_id_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline std::string* PersistentSubscriptionAckEvents::_internal_mutable_subscription_id() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.subscription_id_.Mutable(GetArenaForAllocation());
 }
 inline std::string* PersistentSubscriptionAckEvents::release_subscription_id() {
   // @@protoc_insertion_point(field_release:es.message.PersistentSubscriptionAckEvents.subscription_id)
-  if (!has_subscription_id()) {
+  if (!_internal_has_subscription_id()) {
     return nullptr;
   }
-  _has_bits_[0] &= ~0x00000001u;
-  return subscription_id_.ReleaseNonDefaultNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.subscription_id_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.subscription_id_.IsDefault()) {
+    _impl_.subscription_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
 }
 inline void PersistentSubscriptionAckEvents::set_allocated_subscription_id(std::string* subscription_id) {
   if (subscription_id != nullptr) {
-    _has_bits_[0] |= 0x00000001u;
+    _impl_._has_bits_[0] |= 0x00000001u;
   } else {
-    _has_bits_[0] &= ~0x00000001u;
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.subscription_id_.SetAllocated(subscription_id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.subscription_id_.IsDefault()) {
+    _impl_.subscription_id_.Set("", GetArenaForAllocation());
   }
-  subscription_id_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), subscription_id);
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:es.message.PersistentSubscriptionAckEvents.subscription_id)
 }
 
 // repeated bytes processed_event_ids = 2;
+inline int PersistentSubscriptionAckEvents::_internal_processed_event_ids_size() const {
+  return _impl_.processed_event_ids_.size();
+}
 inline int PersistentSubscriptionAckEvents::processed_event_ids_size() const {
-  return processed_event_ids_.size();
+  return _internal_processed_event_ids_size();
 }
 inline void PersistentSubscriptionAckEvents::clear_processed_event_ids() {
-  processed_event_ids_.Clear();
+  _impl_.processed_event_ids_.Clear();
+}
+inline std::string* PersistentSubscriptionAckEvents::add_processed_event_ids() {
+  std::string* _s = _internal_add_processed_event_ids();
+  // @@protoc_insertion_point(field_add_mutable:es.message.PersistentSubscriptionAckEvents.processed_event_ids)
+  return _s;
+}
+inline const std::string& PersistentSubscriptionAckEvents::_internal_processed_event_ids(int index) const {
+  return _impl_.processed_event_ids_.Get(index);
 }
 inline const std::string& PersistentSubscriptionAckEvents::processed_event_ids(int index) const {
   // @@protoc_insertion_point(field_get:es.message.PersistentSubscriptionAckEvents.processed_event_ids)
-  return processed_event_ids_.Get(index);
+  return _internal_processed_event_ids(index);
 }
 inline std::string* PersistentSubscriptionAckEvents::mutable_processed_event_ids(int index) {
   // @@protoc_insertion_point(field_mutable:es.message.PersistentSubscriptionAckEvents.processed_event_ids)
-  return processed_event_ids_.Mutable(index);
+  return _impl_.processed_event_ids_.Mutable(index);
 }
 inline void PersistentSubscriptionAckEvents::set_processed_event_ids(int index, const std::string& value) {
+  _impl_.processed_event_ids_.Mutable(index)->assign(value);
   // @@protoc_insertion_point(field_set:es.message.PersistentSubscriptionAckEvents.processed_event_ids)
-  processed_event_ids_.Mutable(index)->assign(value);
 }
 inline void PersistentSubscriptionAckEvents::set_processed_event_ids(int index, std::string&& value) {
+  _impl_.processed_event_ids_.Mutable(index)->assign(std::move(value));
   // @@protoc_insertion_point(field_set:es.message.PersistentSubscriptionAckEvents.processed_event_ids)
-  processed_event_ids_.Mutable(index)->assign(std::move(value));
 }
 inline void PersistentSubscriptionAckEvents::set_processed_event_ids(int index, const char* value) {
   GOOGLE_DCHECK(value != nullptr);
-  processed_event_ids_.Mutable(index)->assign(value);
+  _impl_.processed_event_ids_.Mutable(index)->assign(value);
   // @@protoc_insertion_point(field_set_char:es.message.PersistentSubscriptionAckEvents.processed_event_ids)
 }
 inline void PersistentSubscriptionAckEvents::set_processed_event_ids(int index, const void* value, size_t size) {
-  processed_event_ids_.Mutable(index)->assign(
+  _impl_.processed_event_ids_.Mutable(index)->assign(
     reinterpret_cast<const char*>(value), size);
   // @@protoc_insertion_point(field_set_pointer:es.message.PersistentSubscriptionAckEvents.processed_event_ids)
 }
-inline std::string* PersistentSubscriptionAckEvents::add_processed_event_ids() {
-  // @@protoc_insertion_point(field_add_mutable:es.message.PersistentSubscriptionAckEvents.processed_event_ids)
-  return processed_event_ids_.Add();
+inline std::string* PersistentSubscriptionAckEvents::_internal_add_processed_event_ids() {
+  return _impl_.processed_event_ids_.Add();
 }
 inline void PersistentSubscriptionAckEvents::add_processed_event_ids(const std::string& value) {
-  processed_event_ids_.Add()->assign(value);
+  _impl_.processed_event_ids_.Add()->assign(value);
   // @@protoc_insertion_point(field_add:es.message.PersistentSubscriptionAckEvents.processed_event_ids)
 }
 inline void PersistentSubscriptionAckEvents::add_processed_event_ids(std::string&& value) {
-  processed_event_ids_.Add(std::move(value));
+  _impl_.processed_event_ids_.Add(std::move(value));
   // @@protoc_insertion_point(field_add:es.message.PersistentSubscriptionAckEvents.processed_event_ids)
 }
 inline void PersistentSubscriptionAckEvents::add_processed_event_ids(const char* value) {
   GOOGLE_DCHECK(value != nullptr);
-  processed_event_ids_.Add()->assign(value);
+  _impl_.processed_event_ids_.Add()->assign(value);
   // @@protoc_insertion_point(field_add_char:es.message.PersistentSubscriptionAckEvents.processed_event_ids)
 }
 inline void PersistentSubscriptionAckEvents::add_processed_event_ids(const void* value, size_t size) {
-  processed_event_ids_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  _impl_.processed_event_ids_.Add()->assign(reinterpret_cast<const char*>(value), size);
   // @@protoc_insertion_point(field_add_pointer:es.message.PersistentSubscriptionAckEvents.processed_event_ids)
 }
 inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
 PersistentSubscriptionAckEvents::processed_event_ids() const {
   // @@protoc_insertion_point(field_list:es.message.PersistentSubscriptionAckEvents.processed_event_ids)
-  return processed_event_ids_;
+  return _impl_.processed_event_ids_;
 }
 inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
 PersistentSubscriptionAckEvents::mutable_processed_event_ids() {
   // @@protoc_insertion_point(field_mutable_list:es.message.PersistentSubscriptionAckEvents.processed_event_ids)
-  return &processed_event_ids_;
+  return &_impl_.processed_event_ids_;
 }
 
 // -------------------------------------------------------------------
@@ -12442,202 +15590,242 @@ PersistentSubscriptionAckEvents::mutable_processed_event_ids() {
 // PersistentSubscriptionNakEvents
 
 // required string subscription_id = 1;
+inline bool PersistentSubscriptionNakEvents::_internal_has_subscription_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
 inline bool PersistentSubscriptionNakEvents::has_subscription_id() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+  return _internal_has_subscription_id();
 }
 inline void PersistentSubscriptionNakEvents::clear_subscription_id() {
-  subscription_id_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  _has_bits_[0] &= ~0x00000001u;
+  _impl_.subscription_id_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
 }
 inline const std::string& PersistentSubscriptionNakEvents::subscription_id() const {
   // @@protoc_insertion_point(field_get:es.message.PersistentSubscriptionNakEvents.subscription_id)
-  return subscription_id_.GetNoArena();
+  return _internal_subscription_id();
 }
-inline void PersistentSubscriptionNakEvents::set_subscription_id(const std::string& value) {
-  _has_bits_[0] |= 0x00000001u;
-  subscription_id_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PersistentSubscriptionNakEvents::set_subscription_id(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.subscription_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:es.message.PersistentSubscriptionNakEvents.subscription_id)
 }
-inline void PersistentSubscriptionNakEvents::set_subscription_id(std::string&& value) {
-  _has_bits_[0] |= 0x00000001u;
-  subscription_id_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:es.message.PersistentSubscriptionNakEvents.subscription_id)
+inline std::string* PersistentSubscriptionNakEvents::mutable_subscription_id() {
+  std::string* _s = _internal_mutable_subscription_id();
+  // @@protoc_insertion_point(field_mutable:es.message.PersistentSubscriptionNakEvents.subscription_id)
+  return _s;
 }
-inline void PersistentSubscriptionNakEvents::set_subscription_id(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  _has_bits_[0] |= 0x00000001u;
-  subscription_id_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:es.message.PersistentSubscriptionNakEvents.subscription_id)
+inline const std::string& PersistentSubscriptionNakEvents::_internal_subscription_id() const {
+  return _impl_.subscription_id_.Get();
 }
-inline void PersistentSubscriptionNakEvents::set_subscription_id(const char* value, size_t size) {
-  _has_bits_[0] |= 0x00000001u;
-  subscription_id_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:es.message.PersistentSubscriptionNakEvents.subscription_id)
+inline void PersistentSubscriptionNakEvents::_internal_set_subscription_id(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.subscription_id_.Set(value, GetArenaForAllocation());
 }
-inline std::string* PersistentSubscriptionNakEvents::mutable_subscription_id() {
-  _has_bits_[0] |= 0x00000001u;
-  // @@protoc_insertion_point(field_mutable:es.message.PersistentSubscriptionNakEvents.subscription_id)
-  return subscription_id_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline std::string* PersistentSubscriptionNakEvents::_internal_mutable_subscription_id() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.subscription_id_.Mutable(GetArenaForAllocation());
 }
 inline std::string* PersistentSubscriptionNakEvents::release_subscription_id() {
   // @@protoc_insertion_point(field_release:es.message.PersistentSubscriptionNakEvents.subscription_id)
-  if (!has_subscription_id()) {
+  if (!_internal_has_subscription_id()) {
     return nullptr;
   }
-  _has_bits_[0] &= ~0x00000001u;
-  return subscription_id_.ReleaseNonDefaultNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.subscription_id_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.subscription_id_.IsDefault()) {
+    _impl_.subscription_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
 }
 inline void PersistentSubscriptionNakEvents::set_allocated_subscription_id(std::string* subscription_id) {
   if (subscription_id != nullptr) {
-    _has_bits_[0] |= 0x00000001u;
+    _impl_._has_bits_[0] |= 0x00000001u;
   } else {
-    _has_bits_[0] &= ~0x00000001u;
+    _impl_._has_bits_[0] &= ~0x00000001u;
   }
-  subscription_id_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), subscription_id);
+  _impl_.subscription_id_.SetAllocated(subscription_id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.subscription_id_.IsDefault()) {
+    _impl_.subscription_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:es.message.PersistentSubscriptionNakEvents.subscription_id)
 }
 
 // repeated bytes processed_event_ids = 2;
+inline int PersistentSubscriptionNakEvents::_internal_processed_event_ids_size() const {
+  return _impl_.processed_event_ids_.size();
+}
 inline int PersistentSubscriptionNakEvents::processed_event_ids_size() const {
-  return processed_event_ids_.size();
+  return _internal_processed_event_ids_size();
 }
 inline void PersistentSubscriptionNakEvents::clear_processed_event_ids() {
-  processed_event_ids_.Clear();
+  _impl_.processed_event_ids_.Clear();
+}
+inline std::string* PersistentSubscriptionNakEvents::add_processed_event_ids() {
+  std::string* _s = _internal_add_processed_event_ids();
+  // @@protoc_insertion_point(field_add_mutable:es.message.PersistentSubscriptionNakEvents.processed_event_ids)
+  return _s;
+}
+inline const std::string& PersistentSubscriptionNakEvents::_internal_processed_event_ids(int index) const {
+  return _impl_.processed_event_ids_.Get(index);
 }
 inline const std::string& PersistentSubscriptionNakEvents::processed_event_ids(int index) const {
   // @@protoc_insertion_point(field_get:es.message.PersistentSubscriptionNakEvents.processed_event_ids)
-  return processed_event_ids_.Get(index);
+  return _internal_processed_event_ids(index);
 }
 inline std::string* PersistentSubscriptionNakEvents::mutable_processed_event_ids(int index) {
   // @@protoc_insertion_point(field_mutable:es.message.PersistentSubscriptionNakEvents.processed_event_ids)
-  return processed_event_ids_.Mutable(index);
+  return _impl_.processed_event_ids_.Mutable(index);
 }
 inline void PersistentSubscriptionNakEvents::set_processed_event_ids(int index, const std::string& value) {
+  _impl_.processed_event_ids_.Mutable(index)->assign(value);
   // @@protoc_insertion_point(field_set:es.message.PersistentSubscriptionNakEvents.processed_event_ids)
-  processed_event_ids_.Mutable(index)->assign(value);
 }
 inline void PersistentSubscriptionNakEvents::set_processed_event_ids(int index, std::string&& value) {
+  _impl_.processed_event_ids_.Mutable(index)->assign(std::move(value));
   // @@protoc_insertion_point(field_set:es.message.PersistentSubscriptionNakEvents.processed_event_ids)
-  processed_event_ids_.Mutable(index)->assign(std::move(value));
 }
 inline void PersistentSubscriptionNakEvents::set_processed_event_ids(int index, const char* value) {
   GOOGLE_DCHECK(value != nullptr);
-  processed_event_ids_.Mutable(index)->assign(value);
+  _impl_.processed_event_ids_.Mutable(index)->assign(value);
   // @@protoc_insertion_point(field_set_char:es.message.PersistentSubscriptionNakEvents.processed_event_ids)
 }
 inline void PersistentSubscriptionNakEvents::set_processed_event_ids(int index, const void* value, size_t size) {
-  processed_event_ids_.Mutable(index)->assign(
+  _impl_.processed_event_ids_.Mutable(index)->assign(
     reinterpret_cast<const char*>(value), size);
   // @@protoc_insertion_point(field_set_pointer:es.message.PersistentSubscriptionNakEvents.processed_event_ids)
 }
-inline std::string* PersistentSubscriptionNakEvents::add_processed_event_ids() {
-  // @@protoc_insertion_point(field_add_mutable:es.message.PersistentSubscriptionNakEvents.processed_event_ids)
-  return processed_event_ids_.Add();
+inline std::string* PersistentSubscriptionNakEvents::_internal_add_processed_event_ids() {
+  return _impl_.processed_event_ids_.Add();
 }
 inline void PersistentSubscriptionNakEvents::add_processed_event_ids(const std::string& value) {
-  processed_event_ids_.Add()->assign(value);
+  _impl_.processed_event_ids_.Add()->assign(value);
   // @@protoc_insertion_point(field_add:es.message.PersistentSubscriptionNakEvents.processed_event_ids)
 }
 inline void PersistentSubscriptionNakEvents::add_processed_event_ids(std::string&& value) {
-  processed_event_ids_.Add(std::move(value));
+  _impl_.processed_event_ids_.Add(std::move(value));
   // @@protoc_insertion_point(field_add:es.message.PersistentSubscriptionNakEvents.processed_event_ids)
 }
 inline void PersistentSubscriptionNakEvents::add_processed_event_ids(const char* value) {
   GOOGLE_DCHECK(value != nullptr);
-  processed_event_ids_.Add()->assign(value);
+  _impl_.processed_event_ids_.Add()->assign(value);
   // @@protoc_insertion_point(field_add_char:es.message.PersistentSubscriptionNakEvents.processed_event_ids)
 }
 inline void PersistentSubscriptionNakEvents::add_processed_event_ids(const void* value, size_t size) {
-  processed_event_ids_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  _impl_.processed_event_ids_.Add()->assign(reinterpret_cast<const char*>(value), size);
   // @@protoc_insertion_point(field_add_pointer:es.message.PersistentSubscriptionNakEvents.processed_event_ids)
 }
 inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
 PersistentSubscriptionNakEvents::processed_event_ids() const {
   // @@protoc_insertion_point(field_list:es.message.PersistentSubscriptionNakEvents.processed_event_ids)
-  return processed_event_ids_;
+  return _impl_.processed_event_ids_;
 }
 inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
 PersistentSubscriptionNakEvents::mutable_processed_event_ids() {
   // @@protoc_insertion_point(field_mutable_list:es.message.PersistentSubscriptionNakEvents.processed_event_ids)
-  return &processed_event_ids_;
+  return &_impl_.processed_event_ids_;
 }
 
 // optional string message = 3;
+inline bool PersistentSubscriptionNakEvents::_internal_has_message() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
 inline bool PersistentSubscriptionNakEvents::has_message() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
+  return _internal_has_message();
 }
 inline void PersistentSubscriptionNakEvents::clear_message() {
-  message_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  _has_bits_[0] &= ~0x00000002u;
+  _impl_.message_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
 }
 inline const std::string& PersistentSubscriptionNakEvents::message() const {
   // @@protoc_insertion_point(field_get:es.message.PersistentSubscriptionNakEvents.message)
-  return message_.GetNoArena();
+  return _internal_message();
 }
-inline void PersistentSubscriptionNakEvents::set_message(const std::string& value) {
-  _has_bits_[0] |= 0x00000002u;
-  message_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PersistentSubscriptionNakEvents::set_message(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.message_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:es.message.PersistentSubscriptionNakEvents.message)
 }
-inline void PersistentSubscriptionNakEvents::set_message(std::string&& value) {
-  _has_bits_[0] |= 0x00000002u;
-  message_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:es.message.PersistentSubscriptionNakEvents.message)
+inline std::string* PersistentSubscriptionNakEvents::mutable_message() {
+  std::string* _s = _internal_mutable_message();
+  // @@protoc_insertion_point(field_mutable:es.message.PersistentSubscriptionNakEvents.message)
+  return _s;
 }
-inline void PersistentSubscriptionNakEvents::set_message(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  _has_bits_[0] |= 0x00000002u;
-  message_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:es.message.PersistentSubscriptionNakEvents.message)
+inline const std::string& PersistentSubscriptionNakEvents::_internal_message() const {
+  return _impl_.message_.Get();
 }
-inline void PersistentSubscriptionNakEvents::set_message(const char* value, size_t size) {
-  _has_bits_[0] |= 0x00000002u;
-  message_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:es.message.PersistentSubscriptionNakEvents.message)
+inline void PersistentSubscriptionNakEvents::_internal_set_message(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.message_.Set(value, GetArenaForAllocation());
 }
-inline std::string* PersistentSubscriptionNakEvents::mutable_message() {
-  _has_bits_[0] |= 0x00000002u;
-  // @@protoc_insertion_point(field_mutable:es.message.PersistentSubscriptionNakEvents.message)
-  return message_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline std::string* PersistentSubscriptionNakEvents::_internal_mutable_message() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.message_.Mutable(GetArenaForAllocation());
 }
 inline std::string* PersistentSubscriptionNakEvents::release_message() {
   // @@protoc_insertion_point(field_release:es.message.PersistentSubscriptionNakEvents.message)
-  if (!has_message()) {
+  if (!_internal_has_message()) {
     return nullptr;
   }
-  _has_bits_[0] &= ~0x00000002u;
-  return message_.ReleaseNonDefaultNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.message_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.message_.IsDefault()) {
+    _impl_.message_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
 }
 inline void PersistentSubscriptionNakEvents::set_allocated_message(std::string* message) {
   if (message != nullptr) {
-    _has_bits_[0] |= 0x00000002u;
+    _impl_._has_bits_[0] |= 0x00000002u;
   } else {
-    _has_bits_[0] &= ~0x00000002u;
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.message_.SetAllocated(message, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.message_.IsDefault()) {
+    _impl_.message_.Set("", GetArenaForAllocation());
   }
-  message_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), message);
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:es.message.PersistentSubscriptionNakEvents.message)
 }
 
 // required .es.message.PersistentSubscriptionNakEvents.NakAction action = 4;
+inline bool PersistentSubscriptionNakEvents::_internal_has_action() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
 inline bool PersistentSubscriptionNakEvents::has_action() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
+  return _internal_has_action();
 }
 inline void PersistentSubscriptionNakEvents::clear_action() {
-  action_ = 0;
-  _has_bits_[0] &= ~0x00000004u;
+  _impl_.action_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline ::es::message::PersistentSubscriptionNakEvents_NakAction PersistentSubscriptionNakEvents::_internal_action() const {
+  return static_cast< ::es::message::PersistentSubscriptionNakEvents_NakAction >(_impl_.action_);
 }
 inline ::es::message::PersistentSubscriptionNakEvents_NakAction PersistentSubscriptionNakEvents::action() const {
   // @@protoc_insertion_point(field_get:es.message.PersistentSubscriptionNakEvents.action)
-  return static_cast< ::es::message::PersistentSubscriptionNakEvents_NakAction >(action_);
+  return _internal_action();
 }
-inline void PersistentSubscriptionNakEvents::set_action(::es::message::PersistentSubscriptionNakEvents_NakAction value) {
+inline void PersistentSubscriptionNakEvents::_internal_set_action(::es::message::PersistentSubscriptionNakEvents_NakAction value) {
   assert(::es::message::PersistentSubscriptionNakEvents_NakAction_IsValid(value));
-  _has_bits_[0] |= 0x00000004u;
-  action_ = value;
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.action_ = value;
+}
+inline void PersistentSubscriptionNakEvents::set_action(::es::message::PersistentSubscriptionNakEvents_NakAction value) {
+  _internal_set_action(value);
   // @@protoc_insertion_point(field_set:es.message.PersistentSubscriptionNakEvents.action)
 }
 
@@ -12646,96 +15834,126 @@ inline void PersistentSubscriptionNakEvents::set_action(::es::message::Persisten
 // PersistentSubscriptionConfirmation
 
 // required int64 last_commit_position = 1;
+inline bool PersistentSubscriptionConfirmation::_internal_has_last_commit_position() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
 inline bool PersistentSubscriptionConfirmation::has_last_commit_position() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
+  return _internal_has_last_commit_position();
 }
 inline void PersistentSubscriptionConfirmation::clear_last_commit_position() {
-  last_commit_position_ = PROTOBUF_LONGLONG(0);
-  _has_bits_[0] &= ~0x00000002u;
+  _impl_.last_commit_position_ = int64_t{0};
+  _impl_._has_bits_[0] &= ~0x00000002u;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int64 PersistentSubscriptionConfirmation::last_commit_position() const {
+inline int64_t PersistentSubscriptionConfirmation::_internal_last_commit_position() const {
+  return _impl_.last_commit_position_;
+}
+inline int64_t PersistentSubscriptionConfirmation::last_commit_position() const {
   // @@protoc_insertion_point(field_get:es.message.PersistentSubscriptionConfirmation.last_commit_position)
-  return last_commit_position_;
+  return _internal_last_commit_position();
+}
+inline void PersistentSubscriptionConfirmation::_internal_set_last_commit_position(int64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.last_commit_position_ = value;
 }
-inline void PersistentSubscriptionConfirmation::set_last_commit_position(::PROTOBUF_NAMESPACE_ID::int64 value) {
-  _has_bits_[0] |= 0x00000002u;
-  last_commit_position_ = value;
+inline void PersistentSubscriptionConfirmation::set_last_commit_position(int64_t value) {
+  _internal_set_last_commit_position(value);
   // @@protoc_insertion_point(field_set:es.message.PersistentSubscriptionConfirmation.last_commit_position)
 }
 
 // required string subscription_id = 2;
+inline bool PersistentSubscriptionConfirmation::_internal_has_subscription_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
 inline bool PersistentSubscriptionConfirmation::has_subscription_id() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+  return _internal_has_subscription_id();
 }
 inline void PersistentSubscriptionConfirmation::clear_subscription_id() {
-  subscription_id_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  _has_bits_[0] &= ~0x00000001u;
+  _impl_.subscription_id_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
 }
 inline const std::string& PersistentSubscriptionConfirmation::subscription_id() const {
   // @@protoc_insertion_point(field_get:es.message.PersistentSubscriptionConfirmation.subscription_id)
-  return subscription_id_.GetNoArena();
+  return _internal_subscription_id();
 }
-inline void PersistentSubscriptionConfirmation::set_subscription_id(const std::string& value) {
-  _has_bits_[0] |= 0x00000001u;
-  subscription_id_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PersistentSubscriptionConfirmation::set_subscription_id(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.subscription_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:es.message.PersistentSubscriptionConfirmation.subscription_id)
 }
-inline void PersistentSubscriptionConfirmation::set_subscription_id(std::string&& value) {
-  _has_bits_[0] |= 0x00000001u;
-  subscription_id_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:es.message.PersistentSubscriptionConfirmation.subscription_id)
+inline std::string* PersistentSubscriptionConfirmation::mutable_subscription_id() {
+  std::string* _s = _internal_mutable_subscription_id();
+  // @@protoc_insertion_point(field_mutable:es.message.PersistentSubscriptionConfirmation.subscription_id)
+  return _s;
 }
-inline void PersistentSubscriptionConfirmation::set_subscription_id(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  _has_bits_[0] |= 0x00000001u;
-  subscription_id_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:es.message.PersistentSubscriptionConfirmation.subscription_id)
+inline const std::string& PersistentSubscriptionConfirmation::_internal_subscription_id() const {
+  return _impl_.subscription_id_.Get();
 }
-inline void PersistentSubscriptionConfirmation::set_subscription_id(const char* value, size_t size) {
-  _has_bits_[0] |= 0x00000001u;
-  subscription_id_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:es.message.PersistentSubscriptionConfirmation.subscription_id)
+inline void PersistentSubscriptionConfirmation::_internal_set_subscription_id(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.subscription_id_.Set(value, GetArenaForAllocation());
 }
-inline std::string* PersistentSubscriptionConfirmation::mutable_subscription_id() {
-  _has_bits_[0] |= 0x00000001u;
-  // @@protoc_insertion_point(field_mutable:es.message.PersistentSubscriptionConfirmation.subscription_id)
-  return subscription_id_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline std::string* PersistentSubscriptionConfirmation::_internal_mutable_subscription_id() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.subscription_id_.Mutable(GetArenaForAllocation());
 }
 inline std::string* PersistentSubscriptionConfirmation::release_subscription_id() {
   // @@protoc_insertion_point(field_release:es.message.PersistentSubscriptionConfirmation.subscription_id)
-  if (!has_subscription_id()) {
+  if (!_internal_has_subscription_id()) {
     return nullptr;
   }
-  _has_bits_[0] &= ~0x00000001u;
-  return subscription_id_.ReleaseNonDefaultNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.subscription_id_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.subscription_id_.IsDefault()) {
+    _impl_.subscription_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
 }
 inline void PersistentSubscriptionConfirmation::set_allocated_subscription_id(std::string* subscription_id) {
   if (subscription_id != nullptr) {
-    _has_bits_[0] |= 0x00000001u;
+    _impl_._has_bits_[0] |= 0x00000001u;
   } else {
-    _has_bits_[0] &= ~0x00000001u;
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.subscription_id_.SetAllocated(subscription_id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.subscription_id_.IsDefault()) {
+    _impl_.subscription_id_.Set("", GetArenaForAllocation());
   }
-  subscription_id_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), subscription_id);
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:es.message.PersistentSubscriptionConfirmation.subscription_id)
 }
 
 // optional int64 last_event_number = 3;
+inline bool PersistentSubscriptionConfirmation::_internal_has_last_event_number() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
 inline bool PersistentSubscriptionConfirmation::has_last_event_number() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
+  return _internal_has_last_event_number();
 }
 inline void PersistentSubscriptionConfirmation::clear_last_event_number() {
-  last_event_number_ = PROTOBUF_LONGLONG(0);
-  _has_bits_[0] &= ~0x00000004u;
+  _impl_.last_event_number_ = int64_t{0};
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline int64_t PersistentSubscriptionConfirmation::_internal_last_event_number() const {
+  return _impl_.last_event_number_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int64 PersistentSubscriptionConfirmation::last_event_number() const {
+inline int64_t PersistentSubscriptionConfirmation::last_event_number() const {
   // @@protoc_insertion_point(field_get:es.message.PersistentSubscriptionConfirmation.last_event_number)
-  return last_event_number_;
+  return _internal_last_event_number();
 }
-inline void PersistentSubscriptionConfirmation::set_last_event_number(::PROTOBUF_NAMESPACE_ID::int64 value) {
-  _has_bits_[0] |= 0x00000004u;
-  last_event_number_ = value;
+inline void PersistentSubscriptionConfirmation::_internal_set_last_event_number(int64_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.last_event_number_ = value;
+}
+inline void PersistentSubscriptionConfirmation::set_last_event_number(int64_t value) {
+  _internal_set_last_event_number(value);
   // @@protoc_insertion_point(field_set:es.message.PersistentSubscriptionConfirmation.last_event_number)
 }
 
@@ -12744,69 +15962,120 @@ inline void PersistentSubscriptionConfirmation::set_last_event_number(::PROTOBUF
 // PersistentSubscriptionStreamEventAppeared
 
 // required .es.message.ResolvedIndexedEvent event = 1;
+inline bool PersistentSubscriptionStreamEventAppeared::_internal_has_event() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.event_ != nullptr);
+  return value;
+}
 inline bool PersistentSubscriptionStreamEventAppeared::has_event() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+  return _internal_has_event();
 }
 inline void PersistentSubscriptionStreamEventAppeared::clear_event() {
-  if (event_ != nullptr) event_->Clear();
-  _has_bits_[0] &= ~0x00000001u;
+  if (_impl_.event_ != nullptr) _impl_.event_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const ::es::message::ResolvedIndexedEvent& PersistentSubscriptionStreamEventAppeared::_internal_event() const {
+  const ::es::message::ResolvedIndexedEvent* p = _impl_.event_;
+  return p != nullptr ? *p : reinterpret_cast<const ::es::message::ResolvedIndexedEvent&>(
+      ::es::message::_ResolvedIndexedEvent_default_instance_);
 }
 inline const ::es::message::ResolvedIndexedEvent& PersistentSubscriptionStreamEventAppeared::event() const {
-  const ::es::message::ResolvedIndexedEvent* p = event_;
   // @@protoc_insertion_point(field_get:es.message.PersistentSubscriptionStreamEventAppeared.event)
-  return p != nullptr ? *p : *reinterpret_cast<const ::es::message::ResolvedIndexedEvent*>(
-      &::es::message::_ResolvedIndexedEvent_default_instance_);
+  return _internal_event();
+}
+inline void PersistentSubscriptionStreamEventAppeared::unsafe_arena_set_allocated_event(
+    ::es::message::ResolvedIndexedEvent* event) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.event_);
+  }
+  _impl_.event_ = event;
+  if (event) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:es.message.PersistentSubscriptionStreamEventAppeared.event)
 }
 inline ::es::message::ResolvedIndexedEvent* PersistentSubscriptionStreamEventAppeared::release_event() {
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::es::message::ResolvedIndexedEvent* temp = _impl_.event_;
+  _impl_.event_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::es::message::ResolvedIndexedEvent* PersistentSubscriptionStreamEventAppeared::unsafe_arena_release_event() {
   // @@protoc_insertion_point(field_release:es.message.PersistentSubscriptionStreamEventAppeared.event)
-  _has_bits_[0] &= ~0x00000001u;
-  ::es::message::ResolvedIndexedEvent* temp = event_;
-  event_ = nullptr;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::es::message::ResolvedIndexedEvent* temp = _impl_.event_;
+  _impl_.event_ = nullptr;
   return temp;
 }
-inline ::es::message::ResolvedIndexedEvent* PersistentSubscriptionStreamEventAppeared::mutable_event() {
-  _has_bits_[0] |= 0x00000001u;
-  if (event_ == nullptr) {
-    auto* p = CreateMaybeMessage<::es::message::ResolvedIndexedEvent>(GetArenaNoVirtual());
-    event_ = p;
+inline ::es::message::ResolvedIndexedEvent* PersistentSubscriptionStreamEventAppeared::_internal_mutable_event() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.event_ == nullptr) {
+    auto* p = CreateMaybeMessage<::es::message::ResolvedIndexedEvent>(GetArenaForAllocation());
+    _impl_.event_ = p;
   }
+  return _impl_.event_;
+}
+inline ::es::message::ResolvedIndexedEvent* PersistentSubscriptionStreamEventAppeared::mutable_event() {
+  ::es::message::ResolvedIndexedEvent* _msg = _internal_mutable_event();
   // @@protoc_insertion_point(field_mutable:es.message.PersistentSubscriptionStreamEventAppeared.event)
-  return event_;
+  return _msg;
 }
 inline void PersistentSubscriptionStreamEventAppeared::set_allocated_event(::es::message::ResolvedIndexedEvent* event) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete event_;
+    delete _impl_.event_;
   }
   if (event) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(event);
     if (message_arena != submessage_arena) {
       event = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, event, submessage_arena);
     }
-    _has_bits_[0] |= 0x00000001u;
+    _impl_._has_bits_[0] |= 0x00000001u;
   } else {
-    _has_bits_[0] &= ~0x00000001u;
+    _impl_._has_bits_[0] &= ~0x00000001u;
   }
-  event_ = event;
+  _impl_.event_ = event;
   // @@protoc_insertion_point(field_set_allocated:es.message.PersistentSubscriptionStreamEventAppeared.event)
 }
 
 // optional int32 retryCount = 2;
+inline bool PersistentSubscriptionStreamEventAppeared::_internal_has_retrycount() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
 inline bool PersistentSubscriptionStreamEventAppeared::has_retrycount() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
+  return _internal_has_retrycount();
 }
 inline void PersistentSubscriptionStreamEventAppeared::clear_retrycount() {
-  retrycount_ = 0;
-  _has_bits_[0] &= ~0x00000002u;
+  _impl_.retrycount_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 PersistentSubscriptionStreamEventAppeared::retrycount() const {
+inline int32_t PersistentSubscriptionStreamEventAppeared::_internal_retrycount() const {
+  return _impl_.retrycount_;
+}
+inline int32_t PersistentSubscriptionStreamEventAppeared::retrycount() const {
   // @@protoc_insertion_point(field_get:es.message.PersistentSubscriptionStreamEventAppeared.retryCount)
-  return retrycount_;
+  return _internal_retrycount();
+}
+inline void PersistentSubscriptionStreamEventAppeared::_internal_set_retrycount(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.retrycount_ = value;
 }
-inline void PersistentSubscriptionStreamEventAppeared::set_retrycount(::PROTOBUF_NAMESPACE_ID::int32 value) {
-  _has_bits_[0] |= 0x00000002u;
-  retrycount_ = value;
+inline void PersistentSubscriptionStreamEventAppeared::set_retrycount(int32_t value) {
+  _internal_set_retrycount(value);
   // @@protoc_insertion_point(field_set:es.message.PersistentSubscriptionStreamEventAppeared.retryCount)
 }
 
@@ -12815,78 +16084,98 @@ inline void PersistentSubscriptionStreamEventAppeared::set_retrycount(::PROTOBUF
 // SubscribeToStream
 
 // required string event_stream_id = 1;
+inline bool SubscribeToStream::_internal_has_event_stream_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
 inline bool SubscribeToStream::has_event_stream_id() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+  return _internal_has_event_stream_id();
 }
 inline void SubscribeToStream::clear_event_stream_id() {
-  event_stream_id_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  _has_bits_[0] &= ~0x00000001u;
+  _impl_.event_stream_id_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
 }
 inline const std::string& SubscribeToStream::event_stream_id() const {
   // @@protoc_insertion_point(field_get:es.message.SubscribeToStream.event_stream_id)
-  return event_stream_id_.GetNoArena();
+  return _internal_event_stream_id();
 }
-inline void SubscribeToStream::set_event_stream_id(const std::string& value) {
-  _has_bits_[0] |= 0x00000001u;
-  event_stream_id_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SubscribeToStream::set_event_stream_id(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.event_stream_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:es.message.SubscribeToStream.event_stream_id)
 }
-inline void SubscribeToStream::set_event_stream_id(std::string&& value) {
-  _has_bits_[0] |= 0x00000001u;
-  event_stream_id_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:es.message.SubscribeToStream.event_stream_id)
+inline std::string* SubscribeToStream::mutable_event_stream_id() {
+  std::string* _s = _internal_mutable_event_stream_id();
+  // @@protoc_insertion_point(field_mutable:es.message.SubscribeToStream.event_stream_id)
+  return _s;
 }
-inline void SubscribeToStream::set_event_stream_id(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  _has_bits_[0] |= 0x00000001u;
-  event_stream_id_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:es.message.SubscribeToStream.event_stream_id)
+inline const std::string& SubscribeToStream::_internal_event_stream_id() const {
+  return _impl_.event_stream_id_.Get();
 }
-inline void SubscribeToStream::set_event_stream_id(const char* value, size_t size) {
-  _has_bits_[0] |= 0x00000001u;
-  event_stream_id_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:es.message.SubscribeToStream.event_stream_id)
+inline void SubscribeToStream::_internal_set_event_stream_id(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.event_stream_id_.Set(value, GetArenaForAllocation());
 }
-inline std::string* SubscribeToStream::mutable_event_stream_id() {
-  _has_bits_[0] |= 0x00000001u;
-  // @@protoc_insertion_point(field_mutable:es.message.SubscribeToStream.event_stream_id)
-  return event_stream_id_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline std::string* SubscribeToStream::_internal_mutable_event_stream_id() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.event_stream_id_.Mutable(GetArenaForAllocation());
 }
 inline std::string* SubscribeToStream::release_event_stream_id() {
   // @@protoc_insertion_point(field_release:es.message.SubscribeToStream.event_stream_id)
-  if (!has_event_stream_id()) {
+  if (!_internal_has_event_stream_id()) {
     return nullptr;
   }
-  _has_bits_[0] &= ~0x00000001u;
-  return event_stream_id_.ReleaseNonDefaultNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.event_stream_id_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.event_stream_id_.IsDefault()) {
+    _impl_.event_stream_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
 }
 inline void SubscribeToStream::set_allocated_event_stream_id(std::string* event_stream_id) {
   if (event_stream_id != nullptr) {
-    _has_bits_[0] |= 0x00000001u;
+    _impl_._has_bits_[0] |= 0x00000001u;
   } else {
-    _has_bits_[0] &= ~0x00000001u;
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.event_stream_id_.SetAllocated(event_stream_id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.event_stream_id_.IsDefault()) {
+    _impl_.event_stream_id_.Set("", GetArenaForAllocation());
   }
-  event_stream_id_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), event_stream_id);
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:es.message.SubscribeToStream.event_stream_id)
 }
 
 // required bool resolve_link_tos = 2;
+inline bool SubscribeToStream::_internal_has_resolve_link_tos() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
 inline bool SubscribeToStream::has_resolve_link_tos() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
+  return _internal_has_resolve_link_tos();
 }
 inline void SubscribeToStream::clear_resolve_link_tos() {
-  resolve_link_tos_ = false;
-  _has_bits_[0] &= ~0x00000002u;
+  _impl_.resolve_link_tos_ = false;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline bool SubscribeToStream::_internal_resolve_link_tos() const {
+  return _impl_.resolve_link_tos_;
 }
 inline bool SubscribeToStream::resolve_link_tos() const {
   // @@protoc_insertion_point(field_get:es.message.SubscribeToStream.resolve_link_tos)
-  return resolve_link_tos_;
+  return _internal_resolve_link_tos();
+}
+inline void SubscribeToStream::_internal_set_resolve_link_tos(bool value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.resolve_link_tos_ = value;
 }
 inline void SubscribeToStream::set_resolve_link_tos(bool value) {
-  _has_bits_[0] |= 0x00000002u;
-  resolve_link_tos_ = value;
+  _internal_set_resolve_link_tos(value);
   // @@protoc_insertion_point(field_set:es.message.SubscribeToStream.resolve_link_tos)
 }
 
@@ -12895,38 +16184,58 @@ inline void SubscribeToStream::set_resolve_link_tos(bool value) {
 // SubscriptionConfirmation
 
 // required int64 last_commit_position = 1;
+inline bool SubscriptionConfirmation::_internal_has_last_commit_position() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
 inline bool SubscriptionConfirmation::has_last_commit_position() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+  return _internal_has_last_commit_position();
 }
 inline void SubscriptionConfirmation::clear_last_commit_position() {
-  last_commit_position_ = PROTOBUF_LONGLONG(0);
-  _has_bits_[0] &= ~0x00000001u;
+  _impl_.last_commit_position_ = int64_t{0};
+  _impl_._has_bits_[0] &= ~0x00000001u;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int64 SubscriptionConfirmation::last_commit_position() const {
+inline int64_t SubscriptionConfirmation::_internal_last_commit_position() const {
+  return _impl_.last_commit_position_;
+}
+inline int64_t SubscriptionConfirmation::last_commit_position() const {
   // @@protoc_insertion_point(field_get:es.message.SubscriptionConfirmation.last_commit_position)
-  return last_commit_position_;
+  return _internal_last_commit_position();
+}
+inline void SubscriptionConfirmation::_internal_set_last_commit_position(int64_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.last_commit_position_ = value;
 }
-inline void SubscriptionConfirmation::set_last_commit_position(::PROTOBUF_NAMESPACE_ID::int64 value) {
-  _has_bits_[0] |= 0x00000001u;
-  last_commit_position_ = value;
+inline void SubscriptionConfirmation::set_last_commit_position(int64_t value) {
+  _internal_set_last_commit_position(value);
   // @@protoc_insertion_point(field_set:es.message.SubscriptionConfirmation.last_commit_position)
 }
 
 // optional int64 last_event_number = 2;
+inline bool SubscriptionConfirmation::_internal_has_last_event_number() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
 inline bool SubscriptionConfirmation::has_last_event_number() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
+  return _internal_has_last_event_number();
 }
 inline void SubscriptionConfirmation::clear_last_event_number() {
-  last_event_number_ = PROTOBUF_LONGLONG(0);
-  _has_bits_[0] &= ~0x00000002u;
+  _impl_.last_event_number_ = int64_t{0};
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline int64_t SubscriptionConfirmation::_internal_last_event_number() const {
+  return _impl_.last_event_number_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int64 SubscriptionConfirmation::last_event_number() const {
+inline int64_t SubscriptionConfirmation::last_event_number() const {
   // @@protoc_insertion_point(field_get:es.message.SubscriptionConfirmation.last_event_number)
-  return last_event_number_;
+  return _internal_last_event_number();
 }
-inline void SubscriptionConfirmation::set_last_event_number(::PROTOBUF_NAMESPACE_ID::int64 value) {
-  _has_bits_[0] |= 0x00000002u;
-  last_event_number_ = value;
+inline void SubscriptionConfirmation::_internal_set_last_event_number(int64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.last_event_number_ = value;
+}
+inline void SubscriptionConfirmation::set_last_event_number(int64_t value) {
+  _internal_set_last_event_number(value);
   // @@protoc_insertion_point(field_set:es.message.SubscriptionConfirmation.last_event_number)
 }
 
@@ -12935,51 +16244,92 @@ inline void SubscriptionConfirmation::set_last_event_number(::PROTOBUF_NAMESPACE
 // StreamEventAppeared
 
 // required .es.message.ResolvedEvent event = 1;
+inline bool StreamEventAppeared::_internal_has_event() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.event_ != nullptr);
+  return value;
+}
 inline bool StreamEventAppeared::has_event() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+  return _internal_has_event();
 }
 inline void StreamEventAppeared::clear_event() {
-  if (event_ != nullptr) event_->Clear();
-  _has_bits_[0] &= ~0x00000001u;
+  if (_impl_.event_ != nullptr) _impl_.event_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const ::es::message::ResolvedEvent& StreamEventAppeared::_internal_event() const {
+  const ::es::message::ResolvedEvent* p = _impl_.event_;
+  return p != nullptr ? *p : reinterpret_cast<const ::es::message::ResolvedEvent&>(
+      ::es::message::_ResolvedEvent_default_instance_);
 }
 inline const ::es::message::ResolvedEvent& StreamEventAppeared::event() const {
-  const ::es::message::ResolvedEvent* p = event_;
   // @@protoc_insertion_point(field_get:es.message.StreamEventAppeared.event)
-  return p != nullptr ? *p : *reinterpret_cast<const ::es::message::ResolvedEvent*>(
-      &::es::message::_ResolvedEvent_default_instance_);
+  return _internal_event();
+}
+inline void StreamEventAppeared::unsafe_arena_set_allocated_event(
+    ::es::message::ResolvedEvent* event) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.event_);
+  }
+  _impl_.event_ = event;
+  if (event) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:es.message.StreamEventAppeared.event)
 }
 inline ::es::message::ResolvedEvent* StreamEventAppeared::release_event() {
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::es::message::ResolvedEvent* temp = _impl_.event_;
+  _impl_.event_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::es::message::ResolvedEvent* StreamEventAppeared::unsafe_arena_release_event() {
   // @@protoc_insertion_point(field_release:es.message.StreamEventAppeared.event)
-  _has_bits_[0] &= ~0x00000001u;
-  ::es::message::ResolvedEvent* temp = event_;
-  event_ = nullptr;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::es::message::ResolvedEvent* temp = _impl_.event_;
+  _impl_.event_ = nullptr;
   return temp;
 }
-inline ::es::message::ResolvedEvent* StreamEventAppeared::mutable_event() {
-  _has_bits_[0] |= 0x00000001u;
-  if (event_ == nullptr) {
-    auto* p = CreateMaybeMessage<::es::message::ResolvedEvent>(GetArenaNoVirtual());
-    event_ = p;
+inline ::es::message::ResolvedEvent* StreamEventAppeared::_internal_mutable_event() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.event_ == nullptr) {
+    auto* p = CreateMaybeMessage<::es::message::ResolvedEvent>(GetArenaForAllocation());
+    _impl_.event_ = p;
   }
+  return _impl_.event_;
+}
+inline ::es::message::ResolvedEvent* StreamEventAppeared::mutable_event() {
+  ::es::message::ResolvedEvent* _msg = _internal_mutable_event();
   // @@protoc_insertion_point(field_mutable:es.message.StreamEventAppeared.event)
-  return event_;
+  return _msg;
 }
 inline void StreamEventAppeared::set_allocated_event(::es::message::ResolvedEvent* event) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete event_;
+    delete _impl_.event_;
   }
   if (event) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(event);
     if (message_arena != submessage_arena) {
       event = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, event, submessage_arena);
     }
-    _has_bits_[0] |= 0x00000001u;
+    _impl_._has_bits_[0] |= 0x00000001u;
   } else {
-    _has_bits_[0] &= ~0x00000001u;
+    _impl_._has_bits_[0] &= ~0x00000001u;
   }
-  event_ = event;
+  _impl_.event_ = event;
   // @@protoc_insertion_point(field_set_allocated:es.message.StreamEventAppeared.event)
 }
 
@@ -12992,21 +16342,31 @@ inline void StreamEventAppeared::set_allocated_event(::es::message::ResolvedEven
 // SubscriptionDropped
 
 // optional .es.message.SubscriptionDropped.SubscriptionDropReason reason = 1;
+inline bool SubscriptionDropped::_internal_has_reason() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
 inline bool SubscriptionDropped::has_reason() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+  return _internal_has_reason();
 }
 inline void SubscriptionDropped::clear_reason() {
-  reason_ = 0;
-  _has_bits_[0] &= ~0x00000001u;
+  _impl_.reason_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline ::es::message::SubscriptionDropped_SubscriptionDropReason SubscriptionDropped::_internal_reason() const {
+  return static_cast< ::es::message::SubscriptionDropped_SubscriptionDropReason >(_impl_.reason_);
 }
 inline ::es::message::SubscriptionDropped_SubscriptionDropReason SubscriptionDropped::reason() const {
   // @@protoc_insertion_point(field_get:es.message.SubscriptionDropped.reason)
-  return static_cast< ::es::message::SubscriptionDropped_SubscriptionDropReason >(reason_);
+  return _internal_reason();
 }
-inline void SubscriptionDropped::set_reason(::es::message::SubscriptionDropped_SubscriptionDropReason value) {
+inline void SubscriptionDropped::_internal_set_reason(::es::message::SubscriptionDropped_SubscriptionDropReason value) {
   assert(::es::message::SubscriptionDropped_SubscriptionDropReason_IsValid(value));
-  _has_bits_[0] |= 0x00000001u;
-  reason_ = value;
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.reason_ = value;
+}
+inline void SubscriptionDropped::set_reason(::es::message::SubscriptionDropped_SubscriptionDropReason value) {
+  _internal_set_reason(value);
   // @@protoc_insertion_point(field_set:es.message.SubscriptionDropped.reason)
 }
 
@@ -13015,230 +16375,290 @@ inline void SubscriptionDropped::set_reason(::es::message::SubscriptionDropped_S
 // NotHandled_MasterInfo
 
 // required string external_tcp_address = 1;
+inline bool NotHandled_MasterInfo::_internal_has_external_tcp_address() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
 inline bool NotHandled_MasterInfo::has_external_tcp_address() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+  return _internal_has_external_tcp_address();
 }
 inline void NotHandled_MasterInfo::clear_external_tcp_address() {
-  external_tcp_address_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  _has_bits_[0] &= ~0x00000001u;
+  _impl_.external_tcp_address_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
 }
 inline const std::string& NotHandled_MasterInfo::external_tcp_address() const {
   // @@protoc_insertion_point(field_get:es.message.NotHandled.MasterInfo.external_tcp_address)
-  return external_tcp_address_.GetNoArena();
+  return _internal_external_tcp_address();
 }
-inline void NotHandled_MasterInfo::set_external_tcp_address(const std::string& value) {
-  _has_bits_[0] |= 0x00000001u;
-  external_tcp_address_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void NotHandled_MasterInfo::set_external_tcp_address(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.external_tcp_address_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:es.message.NotHandled.MasterInfo.external_tcp_address)
 }
-inline void NotHandled_MasterInfo::set_external_tcp_address(std::string&& value) {
-  _has_bits_[0] |= 0x00000001u;
-  external_tcp_address_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:es.message.NotHandled.MasterInfo.external_tcp_address)
+inline std::string* NotHandled_MasterInfo::mutable_external_tcp_address() {
+  std::string* _s = _internal_mutable_external_tcp_address();
+  // @@protoc_insertion_point(field_mutable:es.message.NotHandled.MasterInfo.external_tcp_address)
+  return _s;
 }
-inline void NotHandled_MasterInfo::set_external_tcp_address(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  _has_bits_[0] |= 0x00000001u;
-  external_tcp_address_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:es.message.NotHandled.MasterInfo.external_tcp_address)
+inline const std::string& NotHandled_MasterInfo::_internal_external_tcp_address() const {
+  return _impl_.external_tcp_address_.Get();
 }
-inline void NotHandled_MasterInfo::set_external_tcp_address(const char* value, size_t size) {
-  _has_bits_[0] |= 0x00000001u;
-  external_tcp_address_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:es.message.NotHandled.MasterInfo.external_tcp_address)
+inline void NotHandled_MasterInfo::_internal_set_external_tcp_address(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.external_tcp_address_.Set(value, GetArenaForAllocation());
 }
-inline std::string* NotHandled_MasterInfo::mutable_external_tcp_address() {
-  _has_bits_[0] |= 0x00000001u;
-  // @@protoc_insertion_point(field_mutable:es.message.NotHandled.MasterInfo.external_tcp_address)
-  return external_tcp_address_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline std::string* NotHandled_MasterInfo::_internal_mutable_external_tcp_address() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.external_tcp_address_.Mutable(GetArenaForAllocation());
 }
 inline std::string* NotHandled_MasterInfo::release_external_tcp_address() {
   // @@protoc_insertion_point(field_release:es.message.NotHandled.MasterInfo.external_tcp_address)
-  if (!has_external_tcp_address()) {
+  if (!_internal_has_external_tcp_address()) {
     return nullptr;
   }
-  _has_bits_[0] &= ~0x00000001u;
-  return external_tcp_address_.ReleaseNonDefaultNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.external_tcp_address_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.external_tcp_address_.IsDefault()) {
+    _impl_.external_tcp_address_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
 }
 inline void NotHandled_MasterInfo::set_allocated_external_tcp_address(std::string* external_tcp_address) {
   if (external_tcp_address != nullptr) {
-    _has_bits_[0] |= 0x00000001u;
+    _impl_._has_bits_[0] |= 0x00000001u;
   } else {
-    _has_bits_[0] &= ~0x00000001u;
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.external_tcp_address_.SetAllocated(external_tcp_address, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.external_tcp_address_.IsDefault()) {
+    _impl_.external_tcp_address_.Set("", GetArenaForAllocation());
   }
-  external_tcp_address_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), external_tcp_address);
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:es.message.NotHandled.MasterInfo.external_tcp_address)
 }
 
 // required int32 external_tcp_port = 2;
+inline bool NotHandled_MasterInfo::_internal_has_external_tcp_port() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
 inline bool NotHandled_MasterInfo::has_external_tcp_port() const {
-  return (_has_bits_[0] & 0x00000008u) != 0;
+  return _internal_has_external_tcp_port();
 }
 inline void NotHandled_MasterInfo::clear_external_tcp_port() {
-  external_tcp_port_ = 0;
-  _has_bits_[0] &= ~0x00000008u;
+  _impl_.external_tcp_port_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline int32_t NotHandled_MasterInfo::_internal_external_tcp_port() const {
+  return _impl_.external_tcp_port_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 NotHandled_MasterInfo::external_tcp_port() const {
+inline int32_t NotHandled_MasterInfo::external_tcp_port() const {
   // @@protoc_insertion_point(field_get:es.message.NotHandled.MasterInfo.external_tcp_port)
-  return external_tcp_port_;
+  return _internal_external_tcp_port();
 }
-inline void NotHandled_MasterInfo::set_external_tcp_port(::PROTOBUF_NAMESPACE_ID::int32 value) {
-  _has_bits_[0] |= 0x00000008u;
-  external_tcp_port_ = value;
+inline void NotHandled_MasterInfo::_internal_set_external_tcp_port(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.external_tcp_port_ = value;
+}
+inline void NotHandled_MasterInfo::set_external_tcp_port(int32_t value) {
+  _internal_set_external_tcp_port(value);
   // @@protoc_insertion_point(field_set:es.message.NotHandled.MasterInfo.external_tcp_port)
 }
 
 // required string external_http_address = 3;
+inline bool NotHandled_MasterInfo::_internal_has_external_http_address() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
 inline bool NotHandled_MasterInfo::has_external_http_address() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
+  return _internal_has_external_http_address();
 }
 inline void NotHandled_MasterInfo::clear_external_http_address() {
-  external_http_address_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  _has_bits_[0] &= ~0x00000002u;
+  _impl_.external_http_address_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
 }
 inline const std::string& NotHandled_MasterInfo::external_http_address() const {
   // @@protoc_insertion_point(field_get:es.message.NotHandled.MasterInfo.external_http_address)
-  return external_http_address_.GetNoArena();
+  return _internal_external_http_address();
 }
-inline void NotHandled_MasterInfo::set_external_http_address(const std::string& value) {
-  _has_bits_[0] |= 0x00000002u;
-  external_http_address_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void NotHandled_MasterInfo::set_external_http_address(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.external_http_address_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:es.message.NotHandled.MasterInfo.external_http_address)
 }
-inline void NotHandled_MasterInfo::set_external_http_address(std::string&& value) {
-  _has_bits_[0] |= 0x00000002u;
-  external_http_address_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:es.message.NotHandled.MasterInfo.external_http_address)
+inline std::string* NotHandled_MasterInfo::mutable_external_http_address() {
+  std::string* _s = _internal_mutable_external_http_address();
+  // @@protoc_insertion_point(field_mutable:es.message.NotHandled.MasterInfo.external_http_address)
+  return _s;
 }
-inline void NotHandled_MasterInfo::set_external_http_address(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  _has_bits_[0] |= 0x00000002u;
-  external_http_address_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:es.message.NotHandled.MasterInfo.external_http_address)
+inline const std::string& NotHandled_MasterInfo::_internal_external_http_address() const {
+  return _impl_.external_http_address_.Get();
 }
-inline void NotHandled_MasterInfo::set_external_http_address(const char* value, size_t size) {
-  _has_bits_[0] |= 0x00000002u;
-  external_http_address_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:es.message.NotHandled.MasterInfo.external_http_address)
+inline void NotHandled_MasterInfo::_internal_set_external_http_address(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.external_http_address_.Set(value, GetArenaForAllocation());
 }
-inline std::string* NotHandled_MasterInfo::mutable_external_http_address() {
-  _has_bits_[0] |= 0x00000002u;
-  // @@protoc_insertion_point(field_mutable:es.message.NotHandled.MasterInfo.external_http_address)
-  return external_http_address_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline std::string* NotHandled_MasterInfo::_internal_mutable_external_http_address() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.external_http_address_.Mutable(GetArenaForAllocation());
 }
 inline std::string* NotHandled_MasterInfo::release_external_http_address() {
   // @@protoc_insertion_point(field_release:es.message.NotHandled.MasterInfo.external_http_address)
-  if (!has_external_http_address()) {
+  if (!_internal_has_external_http_address()) {
     return nullptr;
   }
-  _has_bits_[0] &= ~0x00000002u;
-  return external_http_address_.ReleaseNonDefaultNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.external_http_address_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.external_http_address_.IsDefault()) {
+    _impl_.external_http_address_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
 }
 inline void NotHandled_MasterInfo::set_allocated_external_http_address(std::string* external_http_address) {
   if (external_http_address != nullptr) {
-    _has_bits_[0] |= 0x00000002u;
+    _impl_._has_bits_[0] |= 0x00000002u;
   } else {
-    _has_bits_[0] &= ~0x00000002u;
+    _impl_._has_bits_[0] &= ~0x00000002u;
   }
-  external_http_address_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), external_http_address);
+  _impl_.external_http_address_.SetAllocated(external_http_address, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.external_http_address_.IsDefault()) {
+    _impl_.external_http_address_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:es.message.NotHandled.MasterInfo.external_http_address)
 }
 
 // required int32 external_http_port = 4;
+inline bool NotHandled_MasterInfo::_internal_has_external_http_port() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
 inline bool NotHandled_MasterInfo::has_external_http_port() const {
-  return (_has_bits_[0] & 0x00000010u) != 0;
+  return _internal_has_external_http_port();
 }
 inline void NotHandled_MasterInfo::clear_external_http_port() {
-  external_http_port_ = 0;
-  _has_bits_[0] &= ~0x00000010u;
+  _impl_.external_http_port_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000010u;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 NotHandled_MasterInfo::external_http_port() const {
+inline int32_t NotHandled_MasterInfo::_internal_external_http_port() const {
+  return _impl_.external_http_port_;
+}
+inline int32_t NotHandled_MasterInfo::external_http_port() const {
   // @@protoc_insertion_point(field_get:es.message.NotHandled.MasterInfo.external_http_port)
-  return external_http_port_;
+  return _internal_external_http_port();
+}
+inline void NotHandled_MasterInfo::_internal_set_external_http_port(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.external_http_port_ = value;
 }
-inline void NotHandled_MasterInfo::set_external_http_port(::PROTOBUF_NAMESPACE_ID::int32 value) {
-  _has_bits_[0] |= 0x00000010u;
-  external_http_port_ = value;
+inline void NotHandled_MasterInfo::set_external_http_port(int32_t value) {
+  _internal_set_external_http_port(value);
   // @@protoc_insertion_point(field_set:es.message.NotHandled.MasterInfo.external_http_port)
 }
 
 // optional string external_secure_tcp_address = 5;
+inline bool NotHandled_MasterInfo::_internal_has_external_secure_tcp_address() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
 inline bool NotHandled_MasterInfo::has_external_secure_tcp_address() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
+  return _internal_has_external_secure_tcp_address();
 }
 inline void NotHandled_MasterInfo::clear_external_secure_tcp_address() {
-  external_secure_tcp_address_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  _has_bits_[0] &= ~0x00000004u;
+  _impl_.external_secure_tcp_address_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000004u;
 }
 inline const std::string& NotHandled_MasterInfo::external_secure_tcp_address() const {
   // @@protoc_insertion_point(field_get:es.message.NotHandled.MasterInfo.external_secure_tcp_address)
-  return external_secure_tcp_address_.GetNoArena();
+  return _internal_external_secure_tcp_address();
 }
-inline void NotHandled_MasterInfo::set_external_secure_tcp_address(const std::string& value) {
-  _has_bits_[0] |= 0x00000004u;
-  external_secure_tcp_address_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void NotHandled_MasterInfo::set_external_secure_tcp_address(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000004u;
+ _impl_.external_secure_tcp_address_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:es.message.NotHandled.MasterInfo.external_secure_tcp_address)
 }
-inline void NotHandled_MasterInfo::set_external_secure_tcp_address(std::string&& value) {
-  _has_bits_[0] |= 0x00000004u;
-  external_secure_tcp_address_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:es.message.NotHandled.MasterInfo.external_secure_tcp_address)
+inline std::string* NotHandled_MasterInfo::mutable_external_secure_tcp_address() {
+  std::string* _s = _internal_mutable_external_secure_tcp_address();
+  // @@protoc_insertion_point(field_mutable:es.message.NotHandled.MasterInfo.external_secure_tcp_address)
+  return _s;
 }
-inline void NotHandled_MasterInfo::set_external_secure_tcp_address(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  _has_bits_[0] |= 0x00000004u;
-  external_secure_tcp_address_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:es.message.NotHandled.MasterInfo.external_secure_tcp_address)
+inline const std::string& NotHandled_MasterInfo::_internal_external_secure_tcp_address() const {
+  return _impl_.external_secure_tcp_address_.Get();
 }
-inline void NotHandled_MasterInfo::set_external_secure_tcp_address(const char* value, size_t size) {
-  _has_bits_[0] |= 0x00000004u;
-  external_secure_tcp_address_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:es.message.NotHandled.MasterInfo.external_secure_tcp_address)
+inline void NotHandled_MasterInfo::_internal_set_external_secure_tcp_address(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.external_secure_tcp_address_.Set(value, GetArenaForAllocation());
 }
-inline std::string* NotHandled_MasterInfo::mutable_external_secure_tcp_address() {
-  _has_bits_[0] |= 0x00000004u;
-  // @@protoc_insertion_point(field_mutable:es.message.NotHandled.MasterInfo.external_secure_tcp_address)
-  return external_secure_tcp_address_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline std::string* NotHandled_MasterInfo::_internal_mutable_external_secure_tcp_address() {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  return _impl_.external_secure_tcp_address_.Mutable(GetArenaForAllocation());
 }
 inline std::string* NotHandled_MasterInfo::release_external_secure_tcp_address() {
   // @@protoc_insertion_point(field_release:es.message.NotHandled.MasterInfo.external_secure_tcp_address)
-  if (!has_external_secure_tcp_address()) {
+  if (!_internal_has_external_secure_tcp_address()) {
     return nullptr;
   }
-  _has_bits_[0] &= ~0x00000004u;
-  return external_secure_tcp_address_.ReleaseNonDefaultNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  auto* p = _impl_.external_secure_tcp_address_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.external_secure_tcp_address_.IsDefault()) {
+    _impl_.external_secure_tcp_address_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
 }
 inline void NotHandled_MasterInfo::set_allocated_external_secure_tcp_address(std::string* external_secure_tcp_address) {
   if (external_secure_tcp_address != nullptr) {
-    _has_bits_[0] |= 0x00000004u;
+    _impl_._has_bits_[0] |= 0x00000004u;
   } else {
-    _has_bits_[0] &= ~0x00000004u;
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  _impl_.external_secure_tcp_address_.SetAllocated(external_secure_tcp_address, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.external_secure_tcp_address_.IsDefault()) {
+    _impl_.external_secure_tcp_address_.Set("", GetArenaForAllocation());
   }
-  external_secure_tcp_address_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), external_secure_tcp_address);
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:es.message.NotHandled.MasterInfo.external_secure_tcp_address)
 }
 
 // optional int32 external_secure_tcp_port = 6;
+inline bool NotHandled_MasterInfo::_internal_has_external_secure_tcp_port() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
 inline bool NotHandled_MasterInfo::has_external_secure_tcp_port() const {
-  return (_has_bits_[0] & 0x00000020u) != 0;
+  return _internal_has_external_secure_tcp_port();
 }
 inline void NotHandled_MasterInfo::clear_external_secure_tcp_port() {
-  external_secure_tcp_port_ = 0;
-  _has_bits_[0] &= ~0x00000020u;
+  _impl_.external_secure_tcp_port_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline int32_t NotHandled_MasterInfo::_internal_external_secure_tcp_port() const {
+  return _impl_.external_secure_tcp_port_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 NotHandled_MasterInfo::external_secure_tcp_port() const {
+inline int32_t NotHandled_MasterInfo::external_secure_tcp_port() const {
   // @@protoc_insertion_point(field_get:es.message.NotHandled.MasterInfo.external_secure_tcp_port)
-  return external_secure_tcp_port_;
+  return _internal_external_secure_tcp_port();
 }
-inline void NotHandled_MasterInfo::set_external_secure_tcp_port(::PROTOBUF_NAMESPACE_ID::int32 value) {
-  _has_bits_[0] |= 0x00000020u;
-  external_secure_tcp_port_ = value;
+inline void NotHandled_MasterInfo::_internal_set_external_secure_tcp_port(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.external_secure_tcp_port_ = value;
+}
+inline void NotHandled_MasterInfo::set_external_secure_tcp_port(int32_t value) {
+  _internal_set_external_secure_tcp_port(value);
   // @@protoc_insertion_point(field_set:es.message.NotHandled.MasterInfo.external_secure_tcp_port)
 }
 
@@ -13247,79 +16667,99 @@ inline void NotHandled_MasterInfo::set_external_secure_tcp_port(::PROTOBUF_NAMES
 // NotHandled
 
 // required .es.message.NotHandled.NotHandledReason reason = 1;
+inline bool NotHandled::_internal_has_reason() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
 inline bool NotHandled::has_reason() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
+  return _internal_has_reason();
 }
 inline void NotHandled::clear_reason() {
-  reason_ = 0;
-  _has_bits_[0] &= ~0x00000002u;
+  _impl_.reason_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline ::es::message::NotHandled_NotHandledReason NotHandled::_internal_reason() const {
+  return static_cast< ::es::message::NotHandled_NotHandledReason >(_impl_.reason_);
 }
 inline ::es::message::NotHandled_NotHandledReason NotHandled::reason() const {
   // @@protoc_insertion_point(field_get:es.message.NotHandled.reason)
-  return static_cast< ::es::message::NotHandled_NotHandledReason >(reason_);
+  return _internal_reason();
 }
-inline void NotHandled::set_reason(::es::message::NotHandled_NotHandledReason value) {
+inline void NotHandled::_internal_set_reason(::es::message::NotHandled_NotHandledReason value) {
   assert(::es::message::NotHandled_NotHandledReason_IsValid(value));
-  _has_bits_[0] |= 0x00000002u;
-  reason_ = value;
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.reason_ = value;
+}
+inline void NotHandled::set_reason(::es::message::NotHandled_NotHandledReason value) {
+  _internal_set_reason(value);
   // @@protoc_insertion_point(field_set:es.message.NotHandled.reason)
 }
 
 // optional bytes additional_info = 2;
+inline bool NotHandled::_internal_has_additional_info() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
 inline bool NotHandled::has_additional_info() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+  return _internal_has_additional_info();
 }
 inline void NotHandled::clear_additional_info() {
-  additional_info_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  _has_bits_[0] &= ~0x00000001u;
+  _impl_.additional_info_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
 }
 inline const std::string& NotHandled::additional_info() const {
   // @@protoc_insertion_point(field_get:es.message.NotHandled.additional_info)
-  return additional_info_.GetNoArena();
+  return _internal_additional_info();
 }
-inline void NotHandled::set_additional_info(const std::string& value) {
-  _has_bits_[0] |= 0x00000001u;
-  additional_info_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void NotHandled::set_additional_info(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.additional_info_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:es.message.NotHandled.additional_info)
 }
-inline void NotHandled::set_additional_info(std::string&& value) {
-  _has_bits_[0] |= 0x00000001u;
-  additional_info_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:es.message.NotHandled.additional_info)
+inline std::string* NotHandled::mutable_additional_info() {
+  std::string* _s = _internal_mutable_additional_info();
+  // @@protoc_insertion_point(field_mutable:es.message.NotHandled.additional_info)
+  return _s;
 }
-inline void NotHandled::set_additional_info(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  _has_bits_[0] |= 0x00000001u;
-  additional_info_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:es.message.NotHandled.additional_info)
+inline const std::string& NotHandled::_internal_additional_info() const {
+  return _impl_.additional_info_.Get();
 }
-inline void NotHandled::set_additional_info(const void* value, size_t size) {
-  _has_bits_[0] |= 0x00000001u;
-  additional_info_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:es.message.NotHandled.additional_info)
+inline void NotHandled::_internal_set_additional_info(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.additional_info_.Set(value, GetArenaForAllocation());
 }
-inline std::string* NotHandled::mutable_additional_info() {
-  _has_bits_[0] |= 0x00000001u;
-  // @@protoc_insertion_point(field_mutable:es.message.NotHandled.additional_info)
-  return additional_info_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline std::string* NotHandled::_internal_mutable_additional_info() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.additional_info_.Mutable(GetArenaForAllocation());
 }
 inline std::string* NotHandled::release_additional_info() {
   // @@protoc_insertion_point(field_release:es.message.NotHandled.additional_info)
-  if (!has_additional_info()) {
+  if (!_internal_has_additional_info()) {
     return nullptr;
   }
-  _has_bits_[0] &= ~0x00000001u;
-  return additional_info_.ReleaseNonDefaultNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.additional_info_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.additional_info_.IsDefault()) {
+    _impl_.additional_info_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
 }
 inline void NotHandled::set_allocated_additional_info(std::string* additional_info) {
   if (additional_info != nullptr) {
-    _has_bits_[0] |= 0x00000001u;
+    _impl_._has_bits_[0] |= 0x00000001u;
   } else {
-    _has_bits_[0] &= ~0x00000001u;
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.additional_info_.SetAllocated(additional_info, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.additional_info_.IsDefault()) {
+    _impl_.additional_info_.Set("", GetArenaForAllocation());
   }
-  additional_info_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), additional_info);
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:es.message.NotHandled.additional_info)
 }
 
@@ -13332,79 +16772,99 @@ inline void NotHandled::set_allocated_additional_info(std::string* additional_in
 // ScavengeDatabaseResponse
 
 // required .es.message.ScavengeDatabaseResponse.ScavengeResult result = 1;
+inline bool ScavengeDatabaseResponse::_internal_has_result() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
 inline bool ScavengeDatabaseResponse::has_result() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
+  return _internal_has_result();
 }
 inline void ScavengeDatabaseResponse::clear_result() {
-  result_ = 0;
-  _has_bits_[0] &= ~0x00000002u;
+  _impl_.result_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline ::es::message::ScavengeDatabaseResponse_ScavengeResult ScavengeDatabaseResponse::_internal_result() const {
+  return static_cast< ::es::message::ScavengeDatabaseResponse_ScavengeResult >(_impl_.result_);
 }
 inline ::es::message::ScavengeDatabaseResponse_ScavengeResult ScavengeDatabaseResponse::result() const {
   // @@protoc_insertion_point(field_get:es.message.ScavengeDatabaseResponse.result)
-  return static_cast< ::es::message::ScavengeDatabaseResponse_ScavengeResult >(result_);
+  return _internal_result();
 }
-inline void ScavengeDatabaseResponse::set_result(::es::message::ScavengeDatabaseResponse_ScavengeResult value) {
+inline void ScavengeDatabaseResponse::_internal_set_result(::es::message::ScavengeDatabaseResponse_ScavengeResult value) {
   assert(::es::message::ScavengeDatabaseResponse_ScavengeResult_IsValid(value));
-  _has_bits_[0] |= 0x00000002u;
-  result_ = value;
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.result_ = value;
+}
+inline void ScavengeDatabaseResponse::set_result(::es::message::ScavengeDatabaseResponse_ScavengeResult value) {
+  _internal_set_result(value);
   // @@protoc_insertion_point(field_set:es.message.ScavengeDatabaseResponse.result)
 }
 
 // optional string scavengeId = 2;
+inline bool ScavengeDatabaseResponse::_internal_has_scavengeid() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
 inline bool ScavengeDatabaseResponse::has_scavengeid() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+  return _internal_has_scavengeid();
 }
 inline void ScavengeDatabaseResponse::clear_scavengeid() {
-  scavengeid_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  _has_bits_[0] &= ~0x00000001u;
+  _impl_.scavengeid_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
 }
 inline const std::string& ScavengeDatabaseResponse::scavengeid() const {
   // @@protoc_insertion_point(field_get:es.message.ScavengeDatabaseResponse.scavengeId)
-  return scavengeid_.GetNoArena();
+  return _internal_scavengeid();
 }
-inline void ScavengeDatabaseResponse::set_scavengeid(const std::string& value) {
-  _has_bits_[0] |= 0x00000001u;
-  scavengeid_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ScavengeDatabaseResponse::set_scavengeid(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.scavengeid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:es.message.ScavengeDatabaseResponse.scavengeId)
 }
-inline void ScavengeDatabaseResponse::set_scavengeid(std::string&& value) {
-  _has_bits_[0] |= 0x00000001u;
-  scavengeid_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:es.message.ScavengeDatabaseResponse.scavengeId)
+inline std::string* ScavengeDatabaseResponse::mutable_scavengeid() {
+  std::string* _s = _internal_mutable_scavengeid();
+  // @@protoc_insertion_point(field_mutable:es.message.ScavengeDatabaseResponse.scavengeId)
+  return _s;
 }
-inline void ScavengeDatabaseResponse::set_scavengeid(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  _has_bits_[0] |= 0x00000001u;
-  scavengeid_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:es.message.ScavengeDatabaseResponse.scavengeId)
+inline const std::string& ScavengeDatabaseResponse::_internal_scavengeid() const {
+  return _impl_.scavengeid_.Get();
 }
-inline void ScavengeDatabaseResponse::set_scavengeid(const char* value, size_t size) {
-  _has_bits_[0] |= 0x00000001u;
-  scavengeid_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:es.message.ScavengeDatabaseResponse.scavengeId)
+inline void ScavengeDatabaseResponse::_internal_set_scavengeid(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.scavengeid_.Set(value, GetArenaForAllocation());
 }
-inline std::string* ScavengeDatabaseResponse::mutable_scavengeid() {
-  _has_bits_[0] |= 0x00000001u;
-  // @@protoc_insertion_point(field_mutable:es.message.ScavengeDatabaseResponse.scavengeId)
-  return scavengeid_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline std::string* ScavengeDatabaseResponse::_internal_mutable_scavengeid() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.scavengeid_.Mutable(GetArenaForAllocation());
 }
 inline std::string* ScavengeDatabaseResponse::release_scavengeid() {
   // @@protoc_insertion_point(field_release:es.message.ScavengeDatabaseResponse.scavengeId)
-  if (!has_scavengeid()) {
+  if (!_internal_has_scavengeid()) {
     return nullptr;
   }
-  _has_bits_[0] &= ~0x00000001u;
-  return scavengeid_.ReleaseNonDefaultNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.scavengeid_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.scavengeid_.IsDefault()) {
+    _impl_.scavengeid_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
 }
 inline void ScavengeDatabaseResponse::set_allocated_scavengeid(std::string* scavengeid) {
   if (scavengeid != nullptr) {
-    _has_bits_[0] |= 0x00000001u;
+    _impl_._has_bits_[0] |= 0x00000001u;
   } else {
-    _has_bits_[0] &= ~0x00000001u;
+    _impl_._has_bits_[0] &= ~0x00000001u;
   }
-  scavengeid_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), scavengeid);
+  _impl_.scavengeid_.SetAllocated(scavengeid, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.scavengeid_.IsDefault()) {
+    _impl_.scavengeid_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:es.message.ScavengeDatabaseResponse.scavengeId)
 }
 
@@ -13413,78 +16873,98 @@ inline void ScavengeDatabaseResponse::set_allocated_scavengeid(std::string* scav
 // IdentifyClient
 
 // required int32 version = 1;
+inline bool IdentifyClient::_internal_has_version() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
 inline bool IdentifyClient::has_version() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
+  return _internal_has_version();
 }
 inline void IdentifyClient::clear_version() {
-  version_ = 0;
-  _has_bits_[0] &= ~0x00000002u;
+  _impl_.version_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 IdentifyClient::version() const {
+inline int32_t IdentifyClient::_internal_version() const {
+  return _impl_.version_;
+}
+inline int32_t IdentifyClient::version() const {
   // @@protoc_insertion_point(field_get:es.message.IdentifyClient.version)
-  return version_;
+  return _internal_version();
+}
+inline void IdentifyClient::_internal_set_version(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.version_ = value;
 }
-inline void IdentifyClient::set_version(::PROTOBUF_NAMESPACE_ID::int32 value) {
-  _has_bits_[0] |= 0x00000002u;
-  version_ = value;
+inline void IdentifyClient::set_version(int32_t value) {
+  _internal_set_version(value);
   // @@protoc_insertion_point(field_set:es.message.IdentifyClient.version)
 }
 
 // optional string connection_name = 2;
+inline bool IdentifyClient::_internal_has_connection_name() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
 inline bool IdentifyClient::has_connection_name() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+  return _internal_has_connection_name();
 }
 inline void IdentifyClient::clear_connection_name() {
-  connection_name_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  _has_bits_[0] &= ~0x00000001u;
+  _impl_.connection_name_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
 }
 inline const std::string& IdentifyClient::connection_name() const {
   // @@protoc_insertion_point(field_get:es.message.IdentifyClient.connection_name)
-  return connection_name_.GetNoArena();
+  return _internal_connection_name();
 }
-inline void IdentifyClient::set_connection_name(const std::string& value) {
-  _has_bits_[0] |= 0x00000001u;
-  connection_name_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void IdentifyClient::set_connection_name(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.connection_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:es.message.IdentifyClient.connection_name)
 }
-inline void IdentifyClient::set_connection_name(std::string&& value) {
-  _has_bits_[0] |= 0x00000001u;
-  connection_name_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:es.message.IdentifyClient.connection_name)
+inline std::string* IdentifyClient::mutable_connection_name() {
+  std::string* _s = _internal_mutable_connection_name();
+  // @@protoc_insertion_point(field_mutable:es.message.IdentifyClient.connection_name)
+  return _s;
 }
-inline void IdentifyClient::set_connection_name(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  _has_bits_[0] |= 0x00000001u;
-  connection_name_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:es.message.IdentifyClient.connection_name)
+inline const std::string& IdentifyClient::_internal_connection_name() const {
+  return _impl_.connection_name_.Get();
 }
-inline void IdentifyClient::set_connection_name(const char* value, size_t size) {
-  _has_bits_[0] |= 0x00000001u;
-  connection_name_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:es.message.IdentifyClient.connection_name)
+inline void IdentifyClient::_internal_set_connection_name(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.connection_name_.Set(value, GetArenaForAllocation());
 }
-inline std::string* IdentifyClient::mutable_connection_name() {
-  _has_bits_[0] |= 0x00000001u;
-  // @@protoc_insertion_point(field_mutable:es.message.IdentifyClient.connection_name)
-  return connection_name_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline std::string* IdentifyClient::_internal_mutable_connection_name() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.connection_name_.Mutable(GetArenaForAllocation());
 }
 inline std::string* IdentifyClient::release_connection_name() {
   // @@protoc_insertion_point(field_release:es.message.IdentifyClient.connection_name)
-  if (!has_connection_name()) {
+  if (!_internal_has_connection_name()) {
     return nullptr;
   }
-  _has_bits_[0] &= ~0x00000001u;
-  return connection_name_.ReleaseNonDefaultNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.connection_name_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.connection_name_.IsDefault()) {
+    _impl_.connection_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
 }
 inline void IdentifyClient::set_allocated_connection_name(std::string* connection_name) {
   if (connection_name != nullptr) {
-    _has_bits_[0] |= 0x00000001u;
+    _impl_._has_bits_[0] |= 0x00000001u;
   } else {
-    _has_bits_[0] &= ~0x00000001u;
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.connection_name_.SetAllocated(connection_name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.connection_name_.IsDefault()) {
+    _impl_.connection_name_.Set("", GetArenaForAllocation());
   }
-  connection_name_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), connection_name);
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:es.message.IdentifyClient.connection_name)
 }
 
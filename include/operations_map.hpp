@@ -3,93 +3,175 @@
 #ifndef ES_OPERATIONS_MAP_HPP
 #define ES_OPERATIONS_MAP_HPP
 
+#include <cstddef>
 #include <memory>
-#include <unordered_map>
+#include <new>
+#include <type_traits>
+#include <optional>
+#include <stdexcept>
 #include <utility>
 
 #include <boost/asio/error.hpp>
 
 #include "guid.hpp"
+#include "flat_guid_map.hpp"
 #include "tcp/tcp_package.hpp"
 
 namespace es {
 
-// type erased operation
-template <class Allocator = std::allocator<char>>
+// handlers up to this many bytes are stored inside the operation itself
+inline constexpr std::size_t kDefaultOperationInlineSize = 64;
+
+/*
+	Type erased operation. Handlers that fit in InlineSize bytes and are
+	nothrow move constructible are stored inline, larger ones are allocated
+	with Allocator. Dispatch goes through a function pointer held by the
+	operation, so there is no virtual call and, for small handlers, no
+	allocation at all.
+*/
+template <class Allocator = std::allocator<char>, std::size_t InlineSize = kDefaultOperationInlineSize>
 class operation
 {
 public:
 	using package_view_type = detail::tcp::tcp_package_view;
+	using allocator_type = Allocator;
+	static constexpr std::size_t inline_size = InlineSize < sizeof(void*) ? sizeof(void*) : InlineSize;
 
-	template <typename CompletionHandler>
+	template <
+		typename CompletionHandler,
+		typename = std::enable_if_t<!std::is_same_v<std::decay_t<CompletionHandler>, operation>>
+	>
 	operation(CompletionHandler&& token, Allocator const& alloc = Allocator())
-		: op_(nullptr), alloc_(alloc)
+		: invoke_(&invoke<std::decay_t<CompletionHandler>>),
+		manage_(&manage<std::decay_t<CompletionHandler>>),
+		alloc_(alloc)
 	{
+		using handler_type = std::decay_t<CompletionHandler>;
 		static_assert(
-			std::is_invocable_r_v<void, CompletionHandler, boost::system::error_code, package_view_type>,
+			std::is_invocable_r_v<void, handler_type&, boost::system::error_code, package_view_type>,
 			"CompletionToken must have signature void(boost::system::error_code, es::internal::tcp::tcp_package_view)"
 		);
 
-		op_ = (op_base*)alloc_.allocate(sizeof(op<CompletionHandler>));
-		new (op_) op<CompletionHandler>(std::move(token));
+		if constexpr (stored_inline<handler_type>)
+		{
+			new (&storage_) handler_type(std::forward<CompletionHandler>(token));
+		}
+		else
+		{
+			using handler_allocator_type = typename std::allocator_traits<Allocator>::template rebind_alloc<handler_type>;
+			using handler_traits = std::allocator_traits<handler_allocator_type>;
+
+			handler_allocator_type handler_alloc(alloc_);
+			handler_type* handler = handler_traits::allocate(handler_alloc, 1);
+			handler_traits::construct(handler_alloc, handler, std::forward<CompletionHandler>(token));
+			heap_pointer() = handler;
+		}
 	}
 
-	operation(operation<Allocator> const& other)
+	operation(operation const& other) = delete;
+	operation& operator=(operation const& other) = delete;
+
+	operation(operation&& other) noexcept
+		: invoke_(other.invoke_), manage_(other.manage_), alloc_(std::move(other.alloc_))
 	{
-		using std::swap;
-		swap(op_, other.op_);
-		swap(alloc_, other.alloc_);
+		if (manage_ != nullptr) manage_(manage_action::move, alloc_, &other.storage_, &storage_);
+		other.invoke_ = nullptr;
+		other.manage_ = nullptr;
 	}
 
-	operation(operation<Allocator>&& other) noexcept
+	operation& operator=(operation&& other) noexcept
 	{
-		op_ = std::move(other.op_);
-		other.op_ = nullptr;
+		if (this == &other) return *this;
+
+		reset();
+		invoke_ = other.invoke_;
+		manage_ = other.manage_;
 		alloc_ = std::move(other.alloc_);
+		if (manage_ != nullptr) manage_(manage_action::move, alloc_, &other.storage_, &storage_);
+		other.invoke_ = nullptr;
+		other.manage_ = nullptr;
+		return *this;
 	}
 
-	operation<Allocator>& operator=(operation<Allocator>&& other) noexcept
+	~operation() { reset(); }
+
+	void operator()(boost::system::error_code ec, package_view_type package)
 	{
-		using std::swap;
-		if (op_ != nullptr)
-		{
-			alloc_.deallocate(op_, op_->size());
-		}
+		invoke_(&storage_, ec, package);
+	}
+
+	explicit operator bool() const noexcept { return invoke_ != nullptr; }
+
+	// true if the handler type is small enough to skip the allocator
+	template <class CompletionHandler>
+	static constexpr bool stored_inline =
+		sizeof(CompletionHandler) <= inline_size &&
+		alignof(CompletionHandler) <= alignof(std::max_align_t) &&
+		std::is_nothrow_move_constructible_v<CompletionHandler>;
+
+private:
+	using storage_type = std::aligned_storage_t<inline_size, alignof(std::max_align_t)>;
+
+	enum class manage_action { move, destroy };
+
+	using invoke_type = void(*)(storage_type*, boost::system::error_code, package_view_type);
+	using manage_type = void(*)(manage_action, Allocator&, storage_type*, storage_type*) noexcept;
 
-		op_ = std::move(other.op_);
-		other.op_ = nullptr;
-		swap(alloc_, other.alloc_);
+	template <class Handler>
+	static Handler* target(storage_type* storage)
+	{
+		if constexpr (stored_inline<Handler>)
+			return std::launder(reinterpret_cast<Handler*>(storage));
+		else
+			return static_cast<Handler*>(*reinterpret_cast<void**>(storage));
 	}
 
-	void operator()(boost::system::error_code ec, package_view_type package)
+	template <class Handler>
+	static void invoke(storage_type* storage, boost::system::error_code ec, package_view_type package)
 	{
-		op_->handle(ec, package);
+		(*target<Handler>(storage))(ec, package);
 	}
 
-	~operation() 
-	{ 
-		if (op_ != nullptr)
-			alloc_.deallocate(reinterpret_cast<char*>(op_), op_->size()); 
+	template <class Handler>
+	static void manage(manage_action action, Allocator& alloc, storage_type* from, storage_type* to) noexcept
+	{
+		Handler* handler = target<Handler>(from);
+		if constexpr (stored_inline<Handler>)
+		{
+			if (action == manage_action::move) new (to) Handler(std::move(*handler));
+			handler->~Handler();
+		}
+		else
+		{
+			// heap allocated handlers only change owner when moved
+			if (action == manage_action::move)
+			{
+				*reinterpret_cast<void**>(to) = handler;
+				return;
+			}
+
+			using handler_allocator_type = typename std::allocator_traits<Allocator>::template rebind_alloc<Handler>;
+			using handler_traits = std::allocator_traits<handler_allocator_type>;
+
+			handler_allocator_type handler_alloc(alloc);
+			handler_traits::destroy(handler_alloc, handler);
+			handler_traits::deallocate(handler_alloc, handler, 1);
+		}
 	}
 
-private:
-	struct op_base
+	void*& heap_pointer() { return *reinterpret_cast<void**>(&storage_); }
+
+	void reset() noexcept
 	{
-		virtual void handle(boost::system::error_code ec, package_view_type package) = 0;
-		virtual std::size_t size() const = 0;
-		virtual ~op_base() {}
-	};
+		if (manage_ != nullptr) manage_(manage_action::destroy, alloc_, &storage_, nullptr);
+		invoke_ = nullptr;
+		manage_ = nullptr;
+	}
 
-	template <class CompletionHandler>
-	struct op : public op_base {
-		explicit op(CompletionHandler&& handler) : handler_(std::move(handler)) {}
-		virtual void handle(boost::system::error_code ec, package_view_type package) override { handler_(ec, package); }
-		virtual std::size_t size() const override { return sizeof(op<CompletionHandler>); }
-		CompletionHandler handler_;
-	};
-
-	op_base* op_;
+	invoke_type invoke_;
+	manage_type manage_;
 	Allocator alloc_;
+	storage_type storage_;
 };
 
 template <class Operation, class Allocator = std::allocator<std::pair<const es::guid_type, Operation>>>
@@ -102,27 +184,42 @@ public:
 	explicit operations_map(
 		Allocator const& alloc = Allocator(),
 		std::size_t initial_capacity = 0
-	) : operations_(initial_capacity, alloc)
+	) : operations_(alloc, initial_capacity)
 	{}
 
 	void register_op(es::guid_type const& guid, Operation&& op)
 	{
-		operations_.emplace(std::make_pair(guid, std::move(op)));
+		operations_.try_emplace(guid, std::move(op));
 	}
 
-	bool contains(es::guid_type const& key) { return operations_.find(key) != operations_.cend(); }
-	Operation& operator[](es::guid_type const& key) { return operations_.at(key); }
-	Operation const& operator[](es::guid_type const& key) const { return operations_.at(key); }
+	bool contains(es::guid_type const& key) const { return operations_.contains(key); }
+	Operation& operator[](es::guid_type const& key) { return at(key); }
+	Operation const& operator[](es::guid_type const& key) const { return at(key); }
 	void erase(es::guid_type const& key) { operations_.erase(key); }
 
+	// single lookup alternatives to contains() followed by operator[]
+	Operation* find(es::guid_type const& key) { return operations_.find(key); }
+	Operation const* find(es::guid_type const& key) const { return operations_.find(key); }
+
+	// removes the operation and hands it to the caller, empty if key is not registered
+	std::optional<Operation> find_and_extract(es::guid_type const& key) { return operations_.extract(key); }
+
+	std::size_t size() const { return operations_.size(); }
+	bool empty() const { return operations_.empty(); }
+	void reserve(std::size_t count) { operations_.reserve(count); }
+
+	template <class Func>
+	void for_each(Func&& f) { operations_.for_each(std::forward<Func>(f)); }
+
 private:
-	using map_type = std::unordered_map<
-		es::guid_type, // key type
-		Operation, // operation type
-		std::hash<es::guid_type>, // hasher type
-		std::equal_to<es::guid_type>, // equality type
-		Allocator // allocator type for key/value pairs
-	>;
+	Operation& at(es::guid_type const& key) const
+	{
+		Operation* op = const_cast<map_type&>(operations_).find(key);
+		if (op == nullptr) throw std::out_of_range("es::operations_map : no operation registered for this key");
+		return *op;
+	}
+
+	using map_type = es::flat_guid_map<Operation, Allocator>;
 
 	map_type operations_;
 };
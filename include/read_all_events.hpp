@@ -4,7 +4,10 @@
 #define ES_READ_ALL_EVENTS_HPP
 
 #include "all_events_slice.hpp"
+#include "columnar_all_events_slice.hpp"
 #include "error/error.hpp"
+#include "tcp/decode_arena.hpp"
+#include "tcp/encoders.hpp"
 #include "tcp/tcp_package.hpp"
 
 namespace es {
@@ -20,19 +23,19 @@ void async_read_all_events(
 )
 {
 	static_assert(
-		std::is_invocable_v<AllEventsSliceReadHandler, boost::system::error_code, std::optional<all_events_slice>>,
-		"AllEventsSliceReadHandler requirements not met, must have signature R(boost::system::error_code, std::optional<es::all_events_slice>)"
+		std::is_invocable_v<AllEventsSliceReadHandler, boost::system::error_code, std::optional<all_events_slice>> ||
+		is_columnar_all_events_slice_handler_v<AllEventsSliceReadHandler>,
+		"AllEventsSliceReadHandler requirements not met, must have signature R(boost::system::error_code, std::optional<es::all_events_slice>) or R(boost::system::error_code, std::optional<es::columnar_all_events_slice>)"
 	);
 
-	static message::ReadAllEvents request;
-	request.Clear();
-	request.set_commit_position(from_position.commit_position());
-	request.set_prepare_position(from_position.prepare_position());
-	request.set_max_count(max_count);
-	request.set_resolve_link_tos(resolve_link_tos);
-	request.set_require_master(connection->settings().require_master());
+	detail::tcp::read_all_events_encoder request(
+		from_position.commit_position(),
+		from_position.prepare_position(),
+		max_count,
+		resolve_link_tos,
+		connection->settings().require_master()
+	);
 
-	auto serialized = request.SerializeAsString();
 	auto corr_id = es::guid();
 
 	detail::tcp::tcp_package<> package;
@@ -43,8 +46,8 @@ void async_read_all_events(
 			direction == read_direction::forward ? detail::tcp::tcp_command::read_all_events_forward : detail::tcp::tcp_command::read_all_events_backward,
 			detail::tcp::tcp_flags::none,
 			corr_id,
-			(std::byte*)serialized.data(),
-			serialized.size()
+			request,
+			connection->package_allocator()
 			));
 	}
 	else
@@ -55,8 +58,8 @@ void async_read_all_events(
 			corr_id,
 			connection->settings().default_user_credentials().username(),
 			connection->settings().default_user_credentials().password(),
-			(std::byte*)serialized.data(),
-			serialized.size()
+			request,
+			connection->package_allocator()
 			));
 	}
 
@@ -85,8 +88,7 @@ void async_read_all_events(
 			return;
 		}
 
-		static message::ReadAllEventsCompleted response;
-		response.ParseFromArray(view.data() + view.message_offset(), view.message_size());
+		auto& response = detail::tcp::decode<message::ReadAllEventsCompleted>(view);
 
 		switch (response.result())
 		{
@@ -106,11 +108,22 @@ void async_read_all_events(
 
 		if (!ec)
 		{
-			auto result = std::make_optional(all_events_slice{
-				direction,
-				response
-				});
-			handler(ec, std::move(result));
+			if constexpr (is_columnar_all_events_slice_handler_v<AllEventsSliceReadHandler>)
+			{
+				auto result = std::make_optional(columnar_all_events_slice{
+					direction,
+					response
+					});
+				handler(ec, std::move(result));
+			}
+			else
+			{
+				auto result = std::make_optional(all_events_slice{
+					direction,
+					response
+					});
+				handler(ec, std::move(result));
+			}
 			return;
 		}
 		else
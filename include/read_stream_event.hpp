@@ -11,6 +11,8 @@ Add user credentials parameter to have authentication per request
 
 #include "event_read_result.hpp"
 #include "error/error.hpp"
+#include "tcp/decode_arena.hpp"
+#include "tcp/encoders.hpp"
 #include "tcp/tcp_package.hpp"
 
 namespace es {
@@ -29,14 +31,12 @@ void async_read_stream_event(
 		"ReadResultHandler requirements not met, must have signature R(boost::system::error_code, std::optional<es::event_read_result>)"
 	);
 
-	static message::ReadEvent request;
-	request.Clear();
-	request.set_event_stream_id(stream);
-	request.set_event_number(event_number);
-	request.set_resolve_link_tos(resolveLinkTos);
-	request.set_require_master(connection->settings().require_master());
-
-	auto serialized = request.SerializeAsString();
+	detail::tcp::read_event_encoder request(
+		stream,
+		event_number,
+		resolveLinkTos,
+		connection->settings().require_master()
+	);
 
 	auto corr_id = es::guid();
 	detail::tcp::tcp_package<> package;
@@ -47,8 +47,8 @@ void async_read_stream_event(
 			detail::tcp::tcp_command::read_event,
 			detail::tcp::tcp_flags::none,
 			corr_id,
-			(std::byte*)serialized.data(),
-			serialized.size()
+			request,
+			connection->package_allocator()
 			));
 	}
 	else
@@ -59,8 +59,8 @@ void async_read_stream_event(
 			corr_id,
 			connection->settings().default_user_credentials().username(),
 			connection->settings().default_user_credentials().password(),
-			(std::byte*)serialized.data(),
-			serialized.size()
+			request,
+			connection->package_allocator()
 			));
 	}
 
@@ -79,8 +79,7 @@ void async_read_stream_event(
 			return;
 		}
 
-		static message::ReadEventCompleted response;
-		response.ParseFromArray(view.data() + view.message_offset(), view.message_size());
+		auto& response = detail::tcp::decode<message::ReadEventCompleted>(view);
 		
 		event_read_status status;
 		switch (response.result())
@@ -4,7 +4,10 @@
 #define ES_READ_STREAM_EVENTS_HPP
 
 #include "stream_events_slice.hpp"
+#include "columnar_stream_events_slice.hpp"
 #include "error/error.hpp"
+#include "tcp/decode_arena.hpp"
+#include "tcp/encoders.hpp"
 #include "tcp/tcp_package.hpp"
 
 namespace es {
@@ -21,19 +24,19 @@ void async_read_stream_events(
 )
 {
 	static_assert(
-		std::is_invocable_v<EventsSliceReadHandler, boost::system::error_code, std::optional<stream_events_slice>>,
-		"EventsSliceReadHandler requirements not met, must have signature R(boost::system::error_code, std::optional<es::stream_events_slice>)"
+		std::is_invocable_v<EventsSliceReadHandler, boost::system::error_code, std::optional<stream_events_slice>> ||
+		is_columnar_stream_events_slice_handler_v<EventsSliceReadHandler>,
+		"EventsSliceReadHandler requirements not met, must have signature R(boost::system::error_code, std::optional<es::stream_events_slice>) or R(boost::system::error_code, std::optional<es::columnar_stream_events_slice>)"
 		);
 
-	static message::ReadStreamEvents request;
-	request.Clear();
-	request.set_event_stream_id(stream);
-	request.set_from_event_number(from_event_number);
-	request.set_max_count(max_count);
-	request.set_require_master(connection->settings().require_master());
-	request.set_resolve_link_tos(resolve_link_tos);
+	detail::tcp::read_stream_events_encoder request(
+		stream,
+		from_event_number,
+		max_count,
+		resolve_link_tos,
+		connection->settings().require_master()
+	);
 
-	auto serialized = request.SerializeAsString();
 	auto corr_id = es::guid();
 
 	detail::tcp::tcp_package<> package;
@@ -44,8 +47,8 @@ void async_read_stream_events(
 			direction == read_direction::forward ? detail::tcp::tcp_command::read_stream_events_forward : detail::tcp::tcp_command::read_stream_events_backward,
 			detail::tcp::tcp_flags::none,
 			corr_id,
-			(std::byte*)serialized.data(),
-			serialized.size()
+			request,
+			connection->package_allocator()
 			));
 	}
 	else
@@ -56,8 +59,8 @@ void async_read_stream_events(
 			corr_id,
 			connection->settings().default_user_credentials().username(),
 			connection->settings().default_user_credentials().password(),
-			(std::byte*)serialized.data(),
-			serialized.size()
+			request,
+			connection->package_allocator()
 			));
 	}
 
@@ -86,8 +89,7 @@ void async_read_stream_events(
 			return;
 		}
 
-		static message::ReadStreamEventsCompleted response;
-		response.ParseFromArray(view.data() + view.message_offset(), view.message_size());
+		auto& response = detail::tcp::decode<message::ReadStreamEventsCompleted>(view);
 
 		switch (response.result())
 		{
@@ -111,13 +113,26 @@ void async_read_stream_events(
 
 		if (!ec)
 		{
-			auto result = std::make_optional(stream_events_slice{
-				stream,
-				from_event_number,
-				direction,
-				response
-				});
-			handler(ec, std::move(result));
+			if constexpr (is_columnar_stream_events_slice_handler_v<EventsSliceReadHandler>)
+			{
+				auto result = std::make_optional(columnar_stream_events_slice{
+					stream,
+					from_event_number,
+					direction,
+					response
+					});
+				handler(ec, std::move(result));
+			}
+			else
+			{
+				auto result = std::make_optional(stream_events_slice{
+					stream,
+					from_event_number,
+					direction,
+					response
+					});
+				handler(ec, std::move(result));
+			}
 			return;
 		}
 		else
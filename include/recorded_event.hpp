@@ -9,18 +9,20 @@
 #include "message/messages.pb.h"
 
 #include "guid.hpp"
+#include "intern_table.hpp"
 
 namespace es {
 
 class recorded_event
 {
 public:
-	// record will be invalid after this constructor
-	explicit recorded_event(message::EventRecord& record)
-		: event_stream_id_(),
+	// record will be invalid after this constructor, its stream id and event type
+	// are interned with table if there is one
+	explicit recorded_event(message::EventRecord& record, intern_table* table = nullptr)
+		: event_stream_id_(es::intern(table, std::move(*record.mutable_event_stream_id()))),
 		  event_id_(es::guid(record.event_id().data())),
 		  event_number_(record.event_number()),
-		  event_type_(),
+		  event_type_(es::intern(table, std::move(*record.mutable_event_type()))),
 		  content_(),
 		  metadata_(),
 		  is_json_(record.data_content_type() == 1),
@@ -29,19 +31,42 @@ public:
 	{
 		using std::swap;
 		
-		swap(*record.mutable_event_stream_id(), event_stream_id_);
-		swap(*record.mutable_event_type(), event_type_);
 		swap(*record.mutable_data(), content_);
 		swap(*record.mutable_metadata(), metadata_);
 	}
 
-	std::string const& stream_id() const { return event_stream_id_; }
+	explicit recorded_event(
+		std::string event_stream_id,
+		guid_type const& event_id,
+		std::int64_t event_number,
+		std::string event_type,
+		std::string content,
+		std::string metadata,
+		bool is_json,
+		std::int64_t created,
+		std::int64_t created_epoch,
+		intern_table* table = nullptr
+	) : event_stream_id_(es::intern(table, std::move(event_stream_id))),
+		event_id_(event_id),
+		event_number_(event_number),
+		event_type_(es::intern(table, std::move(event_type))),
+		content_(std::move(content)),
+		metadata_(std::move(metadata)),
+		is_json_(is_json),
+		created_(created),
+		created_epoch_(created_epoch)
+	{}
+
+	std::string const& stream_id() const { return event_stream_id_.str(); }
 	guid_type const& event_id() const { return event_id_; }
 	std::int64_t event_number() const { return event_number_; }
-	std::string const& event_type() const { return event_type_; }
+	std::string const& event_type() const { return event_type_.str(); }
 	std::string const& content() const { return content_; }
 	std::string const& metadata() const { return metadata_; }
 	bool is_json() const { return is_json_; }
+	// shared with the events interned with the same table, comparing them is a pointer compare
+	interned_string const& interned_stream_id() const { return event_stream_id_; }
+	interned_string const& interned_event_type() const { return event_type_; }
 	std::int64_t created() const { return created_; } // maybe use optional
 	std::int64_t created_epoch() const { return created_epoch_; } // maybe use optional
 
@@ -50,10 +75,10 @@ public:
 	std::string& metadata() { return metadata_; }
 
 private:
-	std::string event_stream_id_;
+	interned_string event_stream_id_;
 	guid_type event_id_;
 	std::int64_t event_number_;
-	std::string event_type_;
+	interned_string event_type_;
 	std::string content_;
 	std::string metadata_;
 	bool is_json_;
@@ -0,0 +1,102 @@
+#pragma once
+
+#ifndef ES_RECORDED_EVENT_VIEW_HPP
+#define ES_RECORDED_EVENT_VIEW_HPP
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+#include "guid.hpp"
+#include "recorded_event.hpp"
+
+namespace es {
+
+/*
+	Non-owning counterpart of es::recorded_event, the stream id, type,
+	content and metadata view the bytes of the frame the event was received
+	in, or of the recorded_event it was made from.
+*/
+class recorded_event_view
+{
+public:
+	recorded_event_view() = default;
+
+	explicit recorded_event_view(
+		std::string_view event_stream_id,
+		guid_type const& event_id,
+		std::int64_t event_number,
+		std::string_view event_type,
+		std::string_view content,
+		std::string_view metadata,
+		bool is_json,
+		std::int64_t created,
+		std::int64_t created_epoch
+	) : event_stream_id_(event_stream_id),
+		event_id_(event_id),
+		event_number_(event_number),
+		event_type_(event_type),
+		content_(content),
+		metadata_(metadata),
+		is_json_(is_json),
+		created_(created),
+		created_epoch_(created_epoch)
+	{}
+
+	// views an owned event, which must outlive the view
+	explicit recorded_event_view(recorded_event const& event)
+		: recorded_event_view(
+			event.stream_id(),
+			event.event_id(),
+			event.event_number(),
+			event.event_type(),
+			event.content(),
+			event.metadata(),
+			event.is_json(),
+			event.created(),
+			event.created_epoch()
+		)
+	{}
+
+	std::string_view stream_id() const { return event_stream_id_; }
+	guid_type const& event_id() const { return event_id_; }
+	std::int64_t event_number() const { return event_number_; }
+	std::string_view event_type() const { return event_type_; }
+	std::string_view content() const { return content_; }
+	std::string_view metadata() const { return metadata_; }
+	bool is_json() const { return is_json_; }
+	std::int64_t created() const { return created_; }
+	std::int64_t created_epoch() const { return created_epoch_; }
+
+	// the stream id and event type are interned with table if there is one
+	recorded_event to_owned(intern_table* table = nullptr) const
+	{
+		return recorded_event(
+			std::string(event_stream_id_),
+			event_id_,
+			event_number_,
+			std::string(event_type_),
+			std::string(content_),
+			std::string(metadata_),
+			is_json_,
+			created_,
+			created_epoch_,
+			table
+		);
+	}
+
+private:
+	std::string_view event_stream_id_;
+	guid_type event_id_;
+	std::int64_t event_number_ = 0;
+	std::string_view event_type_;
+	std::string_view content_;
+	std::string_view metadata_;
+	bool is_json_ = false;
+	std::int64_t created_ = 0;
+	std::int64_t created_epoch_ = 0;
+};
+
+}
+
+#endif // ES_RECORDED_EVENT_VIEW_HPP
@@ -13,40 +13,52 @@ namespace es {
 class resolved_event
 {
 public:
+	// stream ids and event types are interned with table if there is one
 	explicit resolved_event(
-		message::ResolvedEvent& event
+		message::ResolvedEvent& event,
+		intern_table* table = nullptr
 	) : event_(),
 		link_(),
 		original_position_(position{ event.commit_position(), event.prepare_position() })
 	{
 		if (event.has_event())
 		{
-			event_.emplace(*event.mutable_event());
+			event_.emplace(*event.mutable_event(), table);
 		}
 
 		if (event.has_link())
 		{
-			link_.emplace(*event.mutable_link());
+			link_.emplace(*event.mutable_link(), table);
 		}
 	}
 
 	explicit resolved_event(
-		message::ResolvedIndexedEvent& event
+		message::ResolvedIndexedEvent& event,
+		intern_table* table = nullptr
 	) : event_(),
 		link_(),
 		original_position_()
 	{
 		if (event.has_event())
 		{
-			event_.emplace(*event.mutable_event());
+			event_.emplace(*event.mutable_event(), table);
 		}
 
 		if (event.has_link())
 		{
-			link_.emplace(*event.mutable_link());
+			link_.emplace(*event.mutable_link(), table);
 		}
 	}
 
+	explicit resolved_event(
+		std::optional<recorded_event> event,
+		std::optional<recorded_event> link,
+		std::optional<position> original_position
+	) : event_(std::move(event)),
+		link_(std::move(link)),
+		original_position_(original_position)
+	{}
+
 	resolved_event(resolved_event&& other) = default;
 
 	// might be changed to standard optional
@@ -0,0 +1,85 @@
+#pragma once
+
+#ifndef ES_RESOLVED_EVENT_VIEW_HPP
+#define ES_RESOLVED_EVENT_VIEW_HPP
+
+#include <memory>
+#include <optional>
+#include <string_view>
+#include <type_traits>
+
+#include "position.hpp"
+#include "recorded_event_view.hpp"
+#include "resolved_event.hpp"
+
+namespace es {
+
+// keeps the bytes viewed by events alive, see basic_tcp_connection::retain_frame()
+using frame_handle = std::shared_ptr<void const>;
+
+/*
+	Non-owning counterpart of es::resolved_event given to event appeared handlers
+	that take one. Its events view the received frame, which stays alive as long
+	as a copy of the view exists. Events that must be kept beyond that are
+	copied with to_owned().
+*/
+class resolved_event_view
+{
+public:
+	resolved_event_view() = default;
+
+	explicit resolved_event_view(
+		std::optional<recorded_event_view> event,
+		std::optional<recorded_event_view> link,
+		std::optional<position> original_position,
+		frame_handle frame
+	) : event_(event),
+		link_(link),
+		original_position_(original_position),
+		frame_(std::move(frame))
+	{}
+
+	// views an owned event, the view's frame keeps it alive
+	explicit resolved_event_view(std::shared_ptr<resolved_event const> event)
+		: original_position_(event->original_position())
+	{
+		if (event->event().has_value()) event_.emplace(*event->event());
+		if (event->link().has_value()) link_.emplace(*event->link());
+		frame_ = std::move(event);
+	}
+
+	std::optional<recorded_event_view> const& event() const { return event_; }
+	std::optional<recorded_event_view> const& link() const { return link_; }
+	std::optional<recorded_event_view> const& original_event() const { return link_.has_value() ? link_ : event_; }
+	bool is_resolved() const { return link_.has_value() && event_.has_value(); }
+	std::optional<position> original_position() const { return original_position_; }
+	std::string_view original_stream_id() const { return original_event().value().stream_id(); }
+	std::int64_t original_event_number() const { return original_event().value().event_number(); }
+	frame_handle const& frame() const { return frame_; }
+
+	// the stream ids and event types are interned with table if there is one
+	resolved_event to_owned(intern_table* table = nullptr) const
+	{
+		std::optional<recorded_event> event;
+		std::optional<recorded_event> link;
+		if (event_.has_value()) event.emplace(event_->to_owned(table));
+		if (link_.has_value()) link.emplace(link_->to_owned(table));
+		return resolved_event(std::move(event), std::move(link), original_position_);
+	}
+
+private:
+	std::optional<recorded_event_view> event_;
+	std::optional<recorded_event_view> link_;
+	std::optional<position> original_position_;
+	frame_handle frame_;
+};
+
+// event appeared handlers are given views if they take them and cannot take an es::resolved_event
+template <class EventAppearedHandler, class... Args>
+constexpr bool is_event_view_handler_v =
+	!std::is_invocable_v<EventAppearedHandler, resolved_event const&, Args...> &&
+	std::is_invocable_v<EventAppearedHandler, resolved_event_view const&, Args...>;
+
+}
+
+#endif // ES_RESOLVED_EVENT_VIEW_HPP
@@ -0,0 +1,97 @@
+#pragma once
+
+#ifndef ES_SHARED_EVENT_DATA_HPP
+#define ES_SHARED_EVENT_DATA_HPP
+
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <string>
+
+#include "guid.hpp"
+
+namespace es {
+
+/*
+	Event payload written to the socket from where it is, without being
+	copied into the request. It either shares ownership of the container
+	holding the bytes, or borrows them, in which case they must stay alive
+	until the append's handler is called. The connection no longer writes
+	the request by then, whatever the outcome: an append that times out
+	before its request was written is taken off the send queue, one that
+	times out while it is being written completes once the write is over.
+*/
+class shared_payload
+{
+public:
+	shared_payload() = default;
+
+	// shares ownership of a contiguous container, such as std::string or std::vector<std::uint8_t>
+	template <class Container>
+	explicit shared_payload(std::shared_ptr<Container> container)
+		: data_(reinterpret_cast<std::byte const*>(std::data(*container))),
+		size_(std::size(*container) * sizeof(*std::data(*container))),
+		owner_(std::move(container))
+	{}
+
+	// borrows size bytes at data
+	static shared_payload borrow(void const* data, std::size_t size)
+	{
+		shared_payload payload;
+		payload.data_ = static_cast<std::byte const*>(data);
+		payload.size_ = size;
+		return payload;
+	}
+
+	std::byte const* data() const { return data_; }
+	std::size_t size() const { return size_; }
+	bool empty() const { return size_ == 0; }
+	// keeps the payload alive, null for borrowed payloads
+	std::shared_ptr<void const> const& owner() const { return owner_; }
+
+private:
+	std::byte const* data_ = nullptr;
+	std::size_t size_ = 0;
+	std::shared_ptr<void const> owner_;
+};
+
+/*
+	Event whose content and metadata are shared payloads, appending a
+	sequence of these with es::async_append_to_stream writes them with
+	a scatter-gather write instead of serializing them into the request.
+*/
+class shared_event_data
+{
+public:
+	shared_event_data() = default;
+
+	explicit shared_event_data(
+		guid_type const& event_id,
+		std::string const& type,
+		bool is_json,
+		shared_payload content,
+		std::optional<shared_payload> metadata = {}
+	) : event_id_(event_id),
+		type_(type),
+		is_json_(is_json),
+		content_(std::move(content)),
+		metadata_(std::move(metadata))
+	{}
+
+	guid_type const& event_id() const { return event_id_; }
+	std::string const& type() const { return type_; }
+	bool is_json() const { return is_json_; }
+	shared_payload const& content() const { return content_; }
+	std::optional<shared_payload> const& metadata() const { return metadata_; }
+
+private:
+	guid_type event_id_;
+	std::string type_;
+	bool is_json_ = false;
+	shared_payload content_;
+	std::optional<shared_payload> metadata_;
+};
+
+}
+
+#endif // ES_SHARED_EVENT_DATA_HPP
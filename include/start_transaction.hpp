@@ -8,6 +8,7 @@
 #include "error/error.hpp"
 #include "guid.hpp"
 #include "transaction.hpp"
+#include "tcp/decode_arena.hpp"
 #include "tcp/tcp_package.hpp"
 
 namespace es {
@@ -30,7 +31,6 @@ void async_start_transaction(
 	request.set_expected_version(expected_version);
 	request.set_require_master(connection->settings().require_master());
 	
-	auto serialized = request.SerializeAsString();
 	auto corr_id = es::guid();
 
 	detail::tcp::tcp_package<> package;
@@ -41,8 +41,8 @@ void async_start_transaction(
 			detail::tcp::tcp_command::transaction_start,
 			detail::tcp::tcp_flags::none,
 			corr_id,
-			(std::byte*)serialized.data(),
-			serialized.size()
+			request,
+			connection->package_allocator()
 			));
 	}
 	else
@@ -53,8 +53,8 @@ void async_start_transaction(
 			corr_id,
 			connection->settings().default_user_credentials().username(),
 			connection->settings().default_user_credentials().password(),
-			(std::byte*)serialized.data(),
-			serialized.size()
+			request,
+			connection->package_allocator()
 			));
 	}
 
@@ -74,21 +74,17 @@ void async_start_transaction(
 				return;
 			}
 
-			message::TransactionStartCompleted response;
-			response.ParseFromArray(view.data() + view.message_offset(), view.message_size());
+			auto& response = detail::tcp::decode<message::TransactionStartCompleted>(view);
 
 			switch (response.result())
 			{
 			case message::OperationResult::Success:
 				break;
 			case message::OperationResult::PrepareTimeout:
-				// retry
-				break;
 			case message::OperationResult::CommitTimeout:
-				// retry
-				break;
 			case message::OperationResult::ForwardTimeout:
-				// retry
+				// the connection retries these, they only get here once retries are exhausted
+				ec = make_error_code(connection_errors::max_operation_retries);
 				break;
 			case message::OperationResult::WrongExpectedVersion:
 				ec = make_error_code(stream_errors::wrong_expected_version);
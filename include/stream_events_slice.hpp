@@ -4,6 +4,7 @@
 #define ES_STREAM_EVENTS_SLICE_HPP
 
 #include "read_direction.hpp"
+#include "intern_table.hpp"
 #include "resolved_event.hpp"
 
 namespace es {
@@ -28,14 +29,13 @@ public:
 		int size = response.events_size();
 		events_.reserve(size);
 
-		// convert all proto events to user events
-		auto events = response.events();
-		std::transform(
-			std::begin(events),
-			std::end(events),
-			std::back_inserter(events_),
-			[](message::ResolvedIndexedEvent& event) -> resolved_event { return resolved_event(event); }
-		);
+		// convert all proto events to user events, they take the strings of the
+		// records, which are left empty, and share their stream ids and types
+		intern_table interned;
+		for (auto& event : *response.mutable_events())
+		{
+			events_.emplace_back(event, &interned);
+		}
 	}
 
 	std::string const& stream() const { return stream_; }
@@ -45,6 +45,8 @@ public:
 	read_direction stream_read_direction() const { return read_direction_; }
 	bool is_end_of_stream() const { return is_end_of_stream_; }
 	std::vector<resolved_event> const& events() const { return events_; }
+	// events can be moved out of the slice
+	std::vector<resolved_event>& events() { return events_; }
 
 private:
 	std::int64_t from_event_number_;
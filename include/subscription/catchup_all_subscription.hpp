@@ -9,6 +9,8 @@
 #include "read_all_events.hpp"
 #include "read_stream_events.hpp"
 #include "subscription_base.hpp"
+#include "tcp/decode_arena.hpp"
+#include "tcp/encoders.hpp"
 #include "catchup_subscription_settings.hpp"
 #include "buffer/buffer_queue.hpp"
 
@@ -41,8 +43,9 @@ public:
 	void async_start(EventAppearedHandler&& event_appeared, SubscriptionDroppedHandler&& dropped)
 	{
 		static_assert(
-			std::is_invocable_v<EventAppearedHandler, resolved_event const&>,
-			"EventAppearedHandler requirements not met, must have signature R(es::resolved_event const&)"
+			std::is_invocable_v<EventAppearedHandler, resolved_event const&> ||
+			std::is_invocable_v<EventAppearedHandler, resolved_event_view const&>,
+			"EventAppearedHandler requirements not met, must have signature R(es::resolved_event const&) or R(es::resolved_event_view const&)"
 		);
 
 		catch_up_events(
@@ -58,7 +61,7 @@ public:
 
 				for (auto& event : value.events())
 				{
-					event_appeared(event);
+					this->event_appeared_with(event_appeared, std::move(event));
 				}
 				
 				if (value.is_end_of_stream())
@@ -91,8 +94,7 @@ public:
 	{
 		if (view.command() == detail::tcp::tcp_command::subscription_confirmation)
 		{
-			message::SubscriptionConfirmation response;
-			response.ParseFromArray(view.data() + view.message_offset(), view.message_size());
+			auto& response = detail::tcp::decode<message::SubscriptionConfirmation>(view);
 			this->set_last_commit_position(response.last_commit_position());
 			this->set_is_subscribed(true);
 			if (response.has_last_event_number())
@@ -108,12 +110,11 @@ public:
 		}
 		if (view.command() == detail::tcp::tcp_command::stream_event_appeared)
 		{
-			static message::StreamEventAppeared message;
-			message.ParseFromArray(view.data() + view.message_offset(), view.message_size());
+			auto& message = detail::tcp::decode<message::StreamEventAppeared>(view);
 
 			//resolved_event resolved{ *message.mutable_event() };
 			//position event_pos = resolved.original_position();
-			event_buffer_.emplace_back(*message.mutable_event());
+			event_buffer_.emplace_back(*message.mutable_event(), this->interned_strings());
 			
 			// we are currently catching up
 			if (position_to_catch_up_to_ > current_position_) return true;
@@ -138,11 +139,7 @@ private:
 	template <class EventAppearedHandler, class SubscriptionDroppedHandler>
 	void do_async_start(EventAppearedHandler&& event_appeared, SubscriptionDroppedHandler&& dropped)
 	{
-		message::SubscribeToStream request;
-		request.set_event_stream_id(this->stream());
-		request.set_resolve_link_tos(settings_.resolve_link_tos());
-
-		auto serialized = request.SerializeAsString();
+		detail::tcp::subscribe_to_stream_encoder request(this->stream(), settings_.resolve_link_tos());
 
 		detail::tcp::tcp_package<> package;
 		if (this->connection()->settings().default_user_credentials().null())
@@ -151,8 +148,8 @@ private:
 				detail::tcp::tcp_command::subscribe_to_stream,
 				detail::tcp::tcp_flags::none,
 				this->correlation_id(),
-				(std::byte*)serialized.data(),
-				serialized.size()
+				request,
+				this->connection()->package_allocator()
 				));
 		}
 		else
@@ -163,13 +160,13 @@ private:
 				this->correlation_id(),
 				this->connection()->settings().default_user_credentials().username(),
 				this->connection()->settings().default_user_credentials().password(),
-				(std::byte*)serialized.data(),
-				serialized.size()
+				request,
+				this->connection()->package_allocator()
 				));
 		}
 
 		base_type::async_start(std::forward<EventAppearedHandler>(event_appeared), std::forward<SubscriptionDroppedHandler>(dropped));
-		this->connection()->async_send(std::move(package));
+		this->connection()->async_subscribe(std::move(package));
 	}
 
 	template <class AllEventSliceReadHandler>
@@ -208,7 +205,7 @@ private:
 						break;
 					}
 
-					event_appeared(event);
+					this->event_appeared_with(event_appeared, std::move(event));
 				}
 
 				if (continue_next_batch)
@@ -237,7 +234,7 @@ private:
 		while (!event_buffer_.empty() && i < settings_.max_live_queue_size())
 		{
 			current_position_ = event_buffer_.front().original_position().value();
-			event_appeared(event_buffer_.front());
+			this->event_appeared_with(event_appeared, std::move(event_buffer_.front()));
 			event_buffer_.pop_front();
 			++i;
 		}
@@ -245,7 +242,7 @@ private:
 		if (!event_buffer_.empty())
 		{
 			boost::asio::post(
-				this->connection()->get_io_context(),
+				this->connection()->get_executor(),
 				[this, &event_appeared]()
 			{
 				read_subscription_events(event_appeared);
@@ -8,6 +8,8 @@
 #include "read_all_events.hpp"
 #include "read_stream_events.hpp"
 #include "subscription_base.hpp"
+#include "tcp/decode_arena.hpp"
+#include "tcp/encoders.hpp"
 #include "catchup_subscription_settings.hpp"
 #include "buffer/buffer_queue.hpp"
 
@@ -41,8 +43,9 @@ public:
 	void async_start(EventAppearedHandler&& event_appeared, SubscriptionDroppedHandler&& dropped)
 	{
 		static_assert(
-			std::is_invocable_v<EventAppearedHandler, resolved_event const&>,
-			"EventAppearedHandler requirements not met, must have signature R(es::resolved_event const&)"
+			std::is_invocable_v<EventAppearedHandler, resolved_event const&> ||
+			std::is_invocable_v<EventAppearedHandler, resolved_event_view const&>,
+			"EventAppearedHandler requirements not met, must have signature R(es::resolved_event const&) or R(es::resolved_event_view const&)"
 		);
 
 		catch_up_events(
@@ -58,7 +61,7 @@ public:
 
 				for (auto& event : value.events())
 				{
-					event_appeared(event);
+					this->event_appeared_with(event_appeared, std::move(event));
 					++current_event_number_;
 				}
 
@@ -91,8 +94,7 @@ public:
 	{
 		if (view.command() == detail::tcp::tcp_command::subscription_confirmation)
 		{
-			message::SubscriptionConfirmation response;
-			response.ParseFromArray(view.data() + view.message_offset(), view.message_size());
+			auto& response = detail::tcp::decode<message::SubscriptionConfirmation>(view);
 			this->set_last_commit_position(response.last_commit_position());
 			this->set_is_subscribed(true);
 			// for a subscription to a stream (as opposed to the all stream),
@@ -116,10 +118,9 @@ public:
 		}
 		if (view.command() == detail::tcp::tcp_command::stream_event_appeared)
 		{
-			static message::StreamEventAppeared message;
-			message.ParseFromArray(view.data() + view.message_offset(), view.message_size());
+			auto& message = detail::tcp::decode<message::StreamEventAppeared>(view);
 
-			event_buffer_.emplace_back(*message.mutable_event());
+			event_buffer_.emplace_back(*message.mutable_event(), this->interned_strings());
 			//resolved_event resolved{ *message.mutable_event() };
 			//std::int64_t event_no = resolved.event().value().event_number();
 			std::int64_t event_no = event_buffer_.front().event().value().event_number();
@@ -148,11 +149,7 @@ private:
 	template <class EventAppearedHandler, class SubscriptionDroppedHandler>
 	void do_async_start(EventAppearedHandler&& event_appeared, SubscriptionDroppedHandler&& dropped)
 	{
-		message::SubscribeToStream request;
-		request.set_event_stream_id(this->stream());
-		request.set_resolve_link_tos(settings_.resolve_link_tos());
-
-		auto serialized = request.SerializeAsString();
+		detail::tcp::subscribe_to_stream_encoder request(this->stream(), settings_.resolve_link_tos());
 
 		detail::tcp::tcp_package<> package;
 		if (this->connection()->settings().default_user_credentials().null())
@@ -161,8 +158,8 @@ private:
 				detail::tcp::tcp_command::subscribe_to_stream,
 				detail::tcp::tcp_flags::none,
 				this->correlation_id(),
-				(std::byte*)serialized.data(),
-				serialized.size()
+				request,
+				this->connection()->package_allocator()
 				));
 		}
 		else
@@ -173,13 +170,13 @@ private:
 				this->correlation_id(),
 				this->connection()->settings().default_user_credentials().username(),
 				this->connection()->settings().default_user_credentials().password(),
-				(std::byte*)serialized.data(),
-				serialized.size()
+				request,
+				this->connection()->package_allocator()
 				));
 		}
 
 		base_type::async_start(std::forward<EventAppearedHandler>(event_appeared), std::forward<SubscriptionDroppedHandler>(dropped));
-		this->connection()->async_send(std::move(package));
+		this->connection()->async_subscribe(std::move(package));
 	}
 
 	template <class EventSliceReadHandler>
@@ -209,7 +206,7 @@ private:
 				auto mutable_count = count;
 				for (auto& event : value.events())
 				{
-					event_appeared(event);
+					this->event_appeared_with(event_appeared, std::move(event));
 					++current_event_number_;
 					--mutable_count;
 				}
@@ -221,7 +218,7 @@ private:
 				else
 				{
 					boost::asio::post(
-						this->connection()->get_io_context(),
+						this->connection()->get_executor(),
 						[this, &event_appeared]()
 					{
 						// start reading buffered events
@@ -245,7 +242,7 @@ private:
 		int i = 0;
 		while (!event_buffer_.empty() && i < settings_.max_live_queue_size())
 		{
-			event_appeared(event_buffer_.front());
+			this->event_appeared_with(event_appeared, std::move(event_buffer_.front()));
 			event_buffer_.pop_front();
 			++current_event_number_;
 			++i;
@@ -254,7 +251,7 @@ private:
 		if (!event_buffer_.empty())
 		{
 			boost::asio::post(
-				this->connection()->get_io_context(),
+				this->connection()->get_executor(),
 				[this, &event_appeared]()
 			{
 				read_subscription_events(event_appeared);
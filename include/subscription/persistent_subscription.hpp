@@ -5,6 +5,9 @@
 
 #include "resolved_event.hpp"
 #include "subscription_base.hpp"
+#include "tcp/decoders.hpp"
+#include "tcp/decode_arena.hpp"
+#include "tcp/encoders.hpp"
 
 namespace es {
 namespace subscription {
@@ -56,8 +59,9 @@ public:
 	void async_start(PersistentSubscriptionEventAppearedHandler&& event_appeared, SubscriptionDroppedHandler&& dropped)
 	{
 		static_assert(
-			std::is_invocable_v<PersistentSubscriptionEventAppearedHandler, resolved_event const&, std::int32_t>,
-			"PersistentSubscriptionEventAppearedHandler requirements not met, must have signature R(es::resolved_event const&, std::int32_t)"
+			std::is_invocable_v<PersistentSubscriptionEventAppearedHandler, resolved_event const&, std::int32_t> ||
+			std::is_invocable_v<PersistentSubscriptionEventAppearedHandler, resolved_event_view const&, std::int32_t>,
+			"PersistentSubscriptionEventAppearedHandler requirements not met, must have signature R(es::resolved_event const&, std::int32_t) or R(es::resolved_event_view const&, std::int32_t)"
 		);
 
 		message::ConnectToPersistentSubscription request;
@@ -65,8 +69,6 @@ public:
 		request.set_event_stream_id(this->stream());
 		request.set_subscription_id(group_name_);
 
-		auto serialized = request.SerializeAsString();
-
 		detail::tcp::tcp_package<> package;
 		if (this->connection()->settings().default_user_credentials().null())
 		{
@@ -74,8 +76,8 @@ public:
 				detail::tcp::tcp_command::connect_to_persistent_subscription,
 				detail::tcp::tcp_flags::none,
 				this->correlation_id(),
-				(std::byte*)serialized.data(),
-				serialized.size()
+				request,
+				this->connection()->package_allocator()
 				));
 		}
 		else
@@ -86,13 +88,13 @@ public:
 				this->correlation_id(),
 				this->connection()->settings().default_user_credentials().username(),
 				this->connection()->settings().default_user_credentials().password(),
-				(std::byte*)serialized.data(),
-				serialized.size()
+				request,
+				this->connection()->package_allocator()
 				));
 		}
 
 		base_type::async_start(std::forward<PersistentSubscriptionEventAppearedHandler>(event_appeared), std::forward<SubscriptionDroppedHandler>(dropped));
-		this->connection()->async_send(std::move(package));
+		this->connection()->async_subscribe(std::move(package));
 	}
 
 	template <class PersistentSubscriptionEventAppearedHandler, class SubscriptionDroppedHandler>
@@ -106,8 +108,7 @@ public:
 		{
 		case detail::tcp::tcp_command::persistent_subscription_confirmation:
 		{
-			message::PersistentSubscriptionConfirmation response;
-			response.ParseFromArray(view.data() + view.message_offset(), view.message_size());
+			auto& response = detail::tcp::decode<message::PersistentSubscriptionConfirmation>(view);
 			this->set_last_commit_position(response.last_commit_position());
 			this->set_is_subscribed(true);
 			if (response.has_last_event_number())
@@ -120,22 +121,37 @@ public:
 		}
 		case detail::tcp::tcp_command::persistent_subscription_stream_event_appeared:
 		{
-			static message::PersistentSubscriptionStreamEventAppeared message;
-			message.ParseFromArray(view.data() + view.message_offset(), view.message_size());
-			
-			resolved_event resolved{ *message.mutable_event() };
-			event_appeared(resolved, (std::int32_t)message.retrycount());
-			if (auto_ack_)
+			if constexpr (is_event_view_handler_v<PersistentSubscriptionEventAppearedHandler, std::int32_t>)
 			{
-				this->acknowledge(resolved);
+				// the event views the frame, which the handler may keep alive
+				std::int32_t retry_count = 0;
+				auto frame = this->connection()->retain_frame(view);
+				auto resolved = detail::tcp::decode_persistent_subscription_stream_event_appeared(view, std::move(frame), retry_count);
+				if (!resolved.has_value()) return true;
+
+				event_appeared(*resolved, retry_count);
+				if (auto_ack_)
+				{
+					this->acknowledge(resolved->original_event().value().event_id());
+				}
+			}
+			else
+			{
+				auto& message = detail::tcp::decode<message::PersistentSubscriptionStreamEventAppeared>(view);
+
+				resolved_event resolved{ *message.mutable_event(), this->interned_strings() };
+				event_appeared(resolved, (std::int32_t)message.retrycount());
+				if (auto_ack_)
+				{
+					this->acknowledge(resolved);
+				}
 			}
 
 			return true;
 		}
 		case detail::tcp::tcp_command::subscription_dropped:
 		{
-			message::SubscriptionDropped message;
-			message.ParseFromArray(view.data() + view.message_offset(), view.message_size());
+			auto& message = detail::tcp::decode<message::SubscriptionDropped>(view);
 
 			boost::system::error_code ec;
 			if (message.reason() == message::SubscriptionDropped_SubscriptionDropReason_AccessDenied)
@@ -176,21 +192,17 @@ public:
 			"GuidOrResolvedEvent must be either es::guid_type or es::resolved_event"
 		);
 
-		message::PersistentSubscriptionAckEvents ack;
-		ack.set_subscription_id(subscription_id_);
+		guid_type const* event_id = nullptr;
 		if constexpr (std::is_same_v<GuidOrResolvedEvent, resolved_event>)
 		{
-			ack.add_processed_event_ids()->assign(
-				(char*)correlation_id_or_event.original_event().value().event_id().data,
-				correlation_id_or_event.original_event().value().event_id().size()
-			);
+			event_id = &correlation_id_or_event.original_event().value().event_id();
 		}
 		else
 		{
-			ack.add_processed_event_ids()->assign((char*)correlation_id_or_event.data, correlation_id_or_event.size());
+			event_id = &correlation_id_or_event;
 		}
 
-		auto serialized = ack.SerializeAsString();
+		detail::tcp::persistent_subscription_ack_events_encoder ack(subscription_id_, event_id, event_id + 1);
 
 		detail::tcp::tcp_package<> package;
 
@@ -200,8 +212,8 @@ public:
 				detail::tcp::tcp_command::persistent_subscription_ack_events,
 				detail::tcp::tcp_flags::none,
 				this->correlation_id(),
-				(std::byte*)serialized.data(),
-				serialized.size()
+				ack,
+				this->connection()->package_allocator()
 				));
 		}
 		else
@@ -212,8 +224,8 @@ public:
 				this->correlation_id(),
 				this->connection()->settings().default_user_credentials().username(),
 				this->connection()->settings().default_user_credentials().password(),
-				(std::byte*)serialized.data(),
-				serialized.size()
+				ack,
+				this->connection()->package_allocator()
 				});
 		}
 
@@ -231,42 +243,19 @@ public:
 			"a dereferenced and const-volatile-reference removed ResolvedEventOrGuidIterator must be of type es::guid_type or es::resolved_event"
 		);
 
-		message::PersistentSubscriptionAckEvents ack;
-		ack.set_subscription_id(subscription_id_);
-
-		for (; it != end; ++it)
+		auto event_id = [](auto const& guid_or_event) -> guid_type const&
 		{
-			if constexpr (std::is_same_v<std::decay_t<decltype(*it)>, resolved_event>)
+			if constexpr (std::is_same_v<std::decay_t<decltype(guid_or_event)>, resolved_event>)
 			{
-				if constexpr (std::is_same_v<decltype((char*)it->original_event().value().event_id().data), char*>)
-				{
-					ack.add_processed_event_ids()->assign(
-						(char*)it->original_event().value().event_id().data,
-						it->original_event().value().event_id().size()
-					);
-				}
-				else
-				{
-					ack.add_processed_event_ids()->assign(
-						(char*)it->original_event().value().event_id().data(),
-						it->original_event().value().event_id().size()
-					);
-				}
+				return guid_or_event.original_event().value().event_id();
 			}
 			else
 			{
-				if constexpr (std::is_same_v<decltype((char*)it->data), char*>)
-				{
-					ack.add_processed_event_ids()->assign((char*)it->data, it->size());
-				}
-				else
-				{
-					ack.add_processed_event_ids()->assign((char*)it->data(), it->size());
-				}
+				return guid_or_event;
 			}
-		}
+		};
 
-		auto serialized = ack.SerializeAsString();
+		detail::tcp::persistent_subscription_ack_events_encoder ack(subscription_id_, it, end, event_id);
 
 		detail::tcp::tcp_package<> package;
 
@@ -276,8 +265,8 @@ public:
 				detail::tcp::tcp_command::persistent_subscription_ack_events,
 				detail::tcp::tcp_flags::none,
 				this->correlation_id(),
-				(std::byte*)serialized.data(),
-				serialized.size()
+				ack,
+				this->connection()->package_allocator()
 				));
 		}
 		else
@@ -288,8 +277,8 @@ public:
 					this->correlation_id(),
 					this->connection()->settings().default_user_credentials().username(),
 					this->connection()->settings().default_user_credentials().password(),
-					(std::byte*)serialized.data(),
-					serialized.size()
+					ack,
+					this->connection()->package_allocator()
 			});
 		}
 
@@ -321,8 +310,6 @@ public:
 			nak.add_processed_event_ids()->assign((char*)correlation_id_or_event.data, correlation_id_or_event.size());
 		}
 
-		auto serialized = nak.SerializeAsString();
-
 		detail::tcp::tcp_package<> package;
 
 		if (this->connection()->settings().default_user_credentials().null())
@@ -331,8 +318,8 @@ public:
 				detail::tcp::tcp_command::persistent_subscription_nak_events,
 				detail::tcp::tcp_flags::none,
 				this->correlation_id(),
-				(std::byte*)serialized.data(),
-				serialized.size()
+				nak,
+				this->connection()->package_allocator()
 				));
 		}
 		else
@@ -343,8 +330,8 @@ public:
 					this->correlation_id(),
 					this->connection()->settings().default_user_credentials().username(),
 					this->connection()->settings().default_user_credentials().password(),
-					(std::byte*)serialized.data(),
-					serialized.size()
+					nak,
+					this->connection()->package_allocator()
 			});
 		}
 
@@ -400,8 +387,6 @@ public:
 			}
 		}
 
-		auto serialized = nak.SerializeAsString();
-
 		detail::tcp::tcp_package<> package;
 
 		if (this->connection()->settings().default_user_credentials().null())
@@ -410,8 +395,8 @@ public:
 				detail::tcp::tcp_command::persistent_subscription_nak_events,
 				detail::tcp::tcp_flags::none,
 				this->correlation_id(),
-				(std::byte*)serialized.data(),
-				serialized.size()
+				nak,
+				this->connection()->package_allocator()
 				));
 		}
 		else
@@ -422,8 +407,8 @@ public:
 					this->correlation_id(),
 					this->connection()->settings().default_user_credentials().username(),
 					this->connection()->settings().default_user_credentials().password(),
-					(std::byte*)serialized.data(),
-					serialized.size()
+					nak,
+					this->connection()->package_allocator()
 			});
 		}
 
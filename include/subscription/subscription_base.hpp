@@ -12,7 +12,11 @@
 
 #include "logger.hpp"
 #include "guid.hpp"
+#include "intern_table.hpp"
 #include "error/error.hpp"
+#include "resolved_event.hpp"
+#include "resolved_event_view.hpp"
+#include "tcp/decode_arena.hpp"
 #include "tcp/tcp_package.hpp"
 
 namespace es {
@@ -59,7 +63,7 @@ public:
 
 		this->unlock_handle_guard();
 
-		connection_->subscriptions_map_.register_op(
+		connection_->register_subscription(
 			key_,
 			[event_appeared = std::forward<EventAppearedHandler>(event_appeared), 
 			dropped = std::forward<SubscriptionDroppedHandler>(dropped),
@@ -82,8 +86,7 @@ public:
 			// handle a subscription drop !
 			case detail::tcp::tcp_command::subscription_dropped:
 			{
-				message::SubscriptionDropped response;
-				response.ParseFromArray(view.data() + view.message_offset(), view.message_size());
+				auto& response = detail::tcp::decode<message::SubscriptionDropped>(view);
 				switch (response.reason())
 				{
 				case message::SubscriptionDropped_SubscriptionDropReason_Unsubscribed:
@@ -128,8 +131,7 @@ public:
 					return;
 				}
 
-				message::NotHandled response;
-				response.ParseFromArray(view.data() + view.message_offset(), view.message_size());
+				auto& response = detail::tcp::decode<message::NotHandled>(view);
 
 				switch (response.reason())
 				{
@@ -140,15 +142,8 @@ public:
 					// retry
 					break;
 				case message::NotHandled_NotHandledReason_NotMaster:
-					// reconnect using master info
-					// message::NotHandled::MasterInfo info;
-					// info.ParseFromString(response.additional_info());
-					// info.external_http_address();
-					// info.external_http_port();
-					// info.external_secure_tcp_address();
-					// info.external_secure_tcp_port();
-					// info.external_tcp_address();
-					// info.external_tcp_port();
+					// the connection follows redirects that name the master and subscribes again,
+					// we only get here if the node did not say which node is the master
 					break;
 				default:
 					// retry
@@ -172,7 +167,7 @@ public:
 	void unsubscribe()
 	{
 		boost::system::error_code ec = make_error_code(subscription_errors::unsubscribed);
-		connection_->subscriptions_map_[key_](ec, {});
+		connection_->drop_subscription(key_, ec);
 	}
 
 	std::string const& stream() const { return stream_; }
@@ -185,7 +180,7 @@ public:
 protected:
 	void unsubscribe(boost::system::error_code ec)
 	{
-		connection_->subscriptions_map_[key_](ec, {});
+		connection_->drop_subscription(key_, ec);
 	}
 
 	template <class SubscriptionDroppedHandler>
@@ -207,14 +202,12 @@ protected:
 		if (ec == subscription_errors::unsubscribed)
 		{
 			message::UnsubscribeFromStream unsubscribe;
-			auto serialized = unsubscribe.SerializeAsString();
-
 			detail::tcp::tcp_package<> package{
 				detail::tcp::tcp_command::unsubscribe_from_stream,
 				detail::tcp::tcp_flags::none,
 				key_,
-				(std::byte*)serialized.data(),
-				serialized.size()
+				unsubscribe,
+				connection_->package_allocator()
 			};
 
 			connection_->async_send(
@@ -223,7 +216,7 @@ protected:
 			{
 				if (!err)
 				{
-					connection_->subscriptions_map_.erase(key_); // remove subscription from map
+					connection_->remove_subscription(key_); // remove subscription and its request from connection
 					dropped(ec, *static_cast<child_type*>(this)); // notify server error
 				}
 				else
@@ -235,11 +228,11 @@ protected:
 		else
 		{
 			boost::asio::post(
-				connection_->get_io_context(),
+				connection_->get_executor(),
 				[dropped = std::move(dropped),
 				ec = ec, this]()
 			{
-				connection_->subscriptions_map_.erase(key_); // remove subscription from map
+				connection_->remove_subscription(key_); // remove subscription and its request from connection
 				dropped(ec, *static_cast<child_type*>(this)); // notify server error
 			});
 		}
@@ -249,7 +242,23 @@ protected:
 	void set_last_commit_position(std::int64_t position) { last_commit_position_ = position; }
 	void set_is_subscribed(bool subscribed) { subscribed_ = subscribed; }
 
+	// gives an owned event to a handler, views take the event so that it lives as long as they do
+	template <class EventAppearedHandler, class... Args>
+	static void event_appeared_with(EventAppearedHandler& event_appeared, resolved_event&& event, Args... args)
+	{
+		if constexpr (is_event_view_handler_v<EventAppearedHandler, Args...>)
+		{
+			event_appeared(resolved_event_view(std::make_shared<resolved_event const>(std::move(event))), args...);
+		}
+		else
+		{
+			event_appeared(event, args...);
+		}
+	}
+
 	op_key_type const& correlation_id() const { return key_; }
+	// stream ids and event types of the events delivered by the subscription are interned here
+	intern_table* interned_strings() { return &interned_; }
 	void lock_handle_guard() { handle_guard_ = true; }
 	void unlock_handle_guard() { handle_guard_ = false; }
 
@@ -261,6 +270,7 @@ private:
 	std::optional<std::int64_t> last_commit_position_;
 	bool subscribed_;
 	bool handle_guard_;
+	intern_table interned_;
 };
 
 } // subscription
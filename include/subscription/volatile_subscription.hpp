@@ -5,6 +5,9 @@
 
 #include "resolved_event.hpp"
 #include "subscription_base.hpp"
+#include "tcp/decoders.hpp"
+#include "tcp/decode_arena.hpp"
+#include "tcp/encoders.hpp"
 
 namespace es {
 namespace subscription {
@@ -33,15 +36,12 @@ public:
 	void async_start(EventAppearedHandler&& event_appeared, SubscriptionDroppedHandler&& dropped)
 	{
 		static_assert(
-			std::is_invocable_v<EventAppearedHandler, resolved_event const&>,
-			"EventAppearedHandler requirements not met, must have signature R(es::resolved_event const&)"
+			std::is_invocable_v<EventAppearedHandler, resolved_event const&> ||
+			std::is_invocable_v<EventAppearedHandler, resolved_event_view const&>,
+			"EventAppearedHandler requirements not met, must have signature R(es::resolved_event const&) or R(es::resolved_event_view const&)"
 		);
 
-		message::SubscribeToStream request;
-		request.set_event_stream_id(this->stream());
-		request.set_resolve_link_tos(resolve_link_tos_);
-
-		auto serialized = request.SerializeAsString();
+		detail::tcp::subscribe_to_stream_encoder request(this->stream(), resolve_link_tos_);
 
 		detail::tcp::tcp_package<> package;
 		if (this->connection()->settings().default_user_credentials().null())
@@ -50,8 +50,8 @@ public:
 				detail::tcp::tcp_command::subscribe_to_stream,
 				detail::tcp::tcp_flags::none,
 				this->correlation_id(),
-				(std::byte*)serialized.data(),
-				serialized.size()
+				request,
+				this->connection()->package_allocator()
 				));
 		}
 		else
@@ -62,13 +62,13 @@ public:
 				this->correlation_id(),
 				this->connection()->settings().default_user_credentials().username(),
 				this->connection()->settings().default_user_credentials().password(),
-				(std::byte*)serialized.data(),
-				serialized.size()
+				request,
+				this->connection()->package_allocator()
 				));
 		}
 
 		base_type::async_start(std::forward<EventAppearedHandler>(event_appeared), std::forward<SubscriptionDroppedHandler>(dropped));
-		this->connection()->async_send(std::move(package));
+		this->connection()->async_subscribe(std::move(package));
 	}
 
 	template <class EventAppearedHandler, class SubscriptionDroppedHandler>
@@ -80,8 +80,7 @@ public:
 	{
 		if (view.command() == detail::tcp::tcp_command::subscription_confirmation)
 		{
-			message::SubscriptionConfirmation response;
-			response.ParseFromArray(view.data() + view.message_offset(), view.message_size());
+			auto& response = detail::tcp::decode<message::SubscriptionConfirmation>(view);
 			this->set_last_commit_position(response.last_commit_position());
 			this->set_is_subscribed(true);
 			if (response.has_last_event_number())
@@ -91,9 +90,20 @@ public:
 		}
 		if (view.command() == detail::tcp::tcp_command::stream_event_appeared)
 		{
-			static message::StreamEventAppeared message;
-			message.ParseFromArray(view.data() + view.message_offset(), view.message_size());
-			event_appeared(resolved_event(*message.mutable_event()));
+			if constexpr (is_event_view_handler_v<EventAppearedHandler>)
+			{
+				// the event views the frame, which the handler may keep alive
+				auto frame = this->connection()->retain_frame(view);
+				if (auto event = detail::tcp::decode_stream_event_appeared(view, std::move(frame)))
+				{
+					event_appeared(*event);
+				}
+			}
+			else
+			{
+				auto& message = detail::tcp::decode<message::StreamEventAppeared>(view);
+				event_appeared(resolved_event(*message.mutable_event(), this->interned_strings()));
+			}
 
 			return true;
 		}
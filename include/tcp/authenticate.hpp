@@ -34,7 +34,7 @@ public:
 		handler_type&& handler
 	) : connection_(connection), info_(), deadline_(), handler_(std::move(handler))
 	{
-		deadline_ = std::make_shared<waitable_timer_type>(connection->get_io_context());
+		deadline_ = std::make_shared<waitable_timer_type>(connection->get_executor());
 		auto conn = connection_.lock();
 		info_.set_correlation_id(es::guid());
 		info_.set_timestamp(conn->elapsed()); // not really needed, as we have a timer anyways...
@@ -56,7 +56,10 @@ public:
 			tcp_flags::authenticated,
 			info_.correlation_id(),
 			conn->settings().default_user_credentials().username(),
-			conn->settings().default_user_credentials().password()
+			conn->settings().default_user_credentials().password(),
+			nullptr,
+			0,
+			conn->package_allocator()
 		);
 		auto test = std::string_view(auth_package.data(), auth_package.size());
 		ES_TRACE("authenticate_op::initiate : tcp-package-size={}, cmd={}, authenticated={}, corr-id={}",
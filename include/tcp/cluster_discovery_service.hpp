@@ -3,10 +3,21 @@
 #ifndef ES_CLUSTER_DISCOVERY_SERVICE_HPP
 #define ES_CLUSTER_DISCOVERY_SERVICE_HPP
 
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <memory>
+#include <mutex>
 #include <type_traits>
 #include <optional>
+#include <string>
 #include <tuple>
+#include <unordered_map>
+#include <utility>
 #include <random>
+#include <vector>
 
 #include <boost/beast/core/tcp_stream.hpp>
 #include <boost/beast/http/dynamic_body.hpp>
@@ -21,17 +32,156 @@
 #include <boost/asio/io_context.hpp>
 #include <boost/asio/execution_context.hpp>
 #include <boost/asio/ip/tcp.hpp>
+#include <boost/asio/post.hpp>
+#include <boost/asio/steady_timer.hpp>
+#include <boost/asio/strand.hpp>
 
 #include <nlohmann/json.hpp>
 
 #include "cluster_settings.hpp"
 #include "error/error.hpp"
+#include "logger.hpp"
 #include "message/cluster_messages.hpp"
 
 namespace es {
 namespace tcp {
 namespace services {
 
+/*
+	Asks one gossip seed for the cluster's gossip. The whole exchange, from
+	connecting to reading the response, must complete within the timeout.
+*/
+class gossip_request
+	: public std::enable_shared_from_this<gossip_request>
+{
+public:
+	template <class Executor>
+	explicit gossip_request(
+		Executor const& executor,
+		tcp::gossip_seed const& seed
+	) : stream_(executor),
+		seed_(seed),
+		request_{ boost::beast::http::verb::get, "/gossip?format=json", 11 },
+		buffer_(),
+		response_()
+	{
+		request_.set(
+			boost::beast::http::field::host,
+			seed.host_header().empty() ? seed.endpoint().address().to_string() : seed.host_header()
+		);
+	}
+
+	// handler is called with the gossip, or nullopt if the seed did not answer with one in time
+	template <class GossipHandler>
+	void async_get(std::chrono::nanoseconds timeout, GossipHandler&& handler)
+	{
+		namespace http = boost::beast::http;
+
+		stream_.expires_after(timeout);
+		stream_.async_connect(
+			seed_.endpoint(),
+			[self = this->shared_from_this(), handler = std::move(handler)](boost::system::error_code ec) mutable
+		{
+			if (ec)
+			{
+				handler(std::optional<message::cluster_info>());
+				return;
+			}
+
+			self->sent_ = std::chrono::steady_clock::now();
+			http::async_write(
+				self->stream_,
+				self->request_,
+				[self, handler = std::move(handler)](boost::system::error_code ec, std::size_t) mutable
+			{
+				if (ec)
+				{
+					handler(std::optional<message::cluster_info>());
+					return;
+				}
+
+				http::async_read(
+					self->stream_,
+					self->buffer_,
+					self->response_,
+					[self, handler = std::move(handler)](boost::system::error_code ec, std::size_t) mutable
+				{
+					self->round_trip_ = std::chrono::steady_clock::now() - self->sent_;
+					boost::system::error_code ignored;
+					self->stream_.socket().shutdown(boost::asio::ip::tcp::socket::shutdown_both, ignored);
+
+					if (ec || self->response_.result() != http::status::ok)
+					{
+						handler(std::optional<message::cluster_info>());
+						return;
+					}
+
+					handler(self->parse_gossip());
+				});
+			});
+		});
+	}
+
+	// completes the request with nullopt if it has not completed yet
+	void cancel() { stream_.cancel(); }
+
+	// http endpoint of the seed
+	boost::asio::ip::tcp::endpoint const& endpoint() const { return seed_.endpoint(); }
+	// from sending the request to reading the response, only meaningful once a gossip was received
+	std::chrono::nanoseconds round_trip_time() const { return round_trip_; }
+
+private:
+	std::optional<message::cluster_info> parse_gossip() const
+	{
+		auto json = nlohmann::json::parse(response_.body(), nullptr, false);
+		if (json.is_discarded()) return {};
+
+		try
+		{
+			return json.get<message::cluster_info>();
+		}
+		catch (nlohmann::json::exception const&)
+		{
+			return {};
+		}
+	}
+
+	boost::beast::tcp_stream stream_;
+	tcp::gossip_seed seed_;
+	boost::beast::http::request<boost::beast::http::string_body> request_;
+	boost::beast::flat_buffer buffer_;
+	boost::beast::http::response<boost::beast::http::string_body> response_;
+	std::chrono::steady_clock::time_point sent_;
+	std::chrono::nanoseconds round_trip_{};
+};
+
+// connections that can be told the cluster elected another master
+template <class Connection, class = void>
+struct is_master_change_listener : std::false_type {};
+
+template <class Connection>
+struct is_master_change_listener<Connection, std::void_t<
+	decltype(std::declval<Connection&>().weak_from_this().lock()->on_master_changed(std::declval<boost::asio::ip::tcp::endpoint const&>()))
+>> : std::true_type {};
+
+// objects that follow the members of the cluster, see add_gossip_listener
+template <class Listener, class = void>
+struct is_gossip_listener : std::false_type {};
+
+template <class Listener>
+struct is_gossip_listener<Listener, std::void_t<
+	decltype(std::declval<Listener&>().on_gossip_changed(std::declval<std::vector<message::member_info> const&>()))
+>> : std::true_type {};
+
+/*
+	Discovers the node connections should connect to from the cluster's gossip.
+	With a gossip refresh interval, the gossip is also refreshed in the background
+	and connections are moved to a newly elected master as soon as the refresh
+	sees it. Round trip times of nodes are measured from gossip requests and
+	reported heartbeats, the lowest_latency preference picks the fastest node.
+	With a gossip cache file, each discovery saves the gossip and the next
+	process asks the nodes it names first.
+*/
 class cluster_discovery_service
 	: public boost::asio::execution_context::service
 {
@@ -45,8 +195,7 @@ public:
 		boost::asio::execution_context& ioc
 	) : boost::asio::execution_context::service(ioc),
 		settings_(),
-		old_gossip_(),
-		context_(nullptr)
+		refresh_strand_(boost::asio::make_strand(static_cast<boost::asio::io_context&>(ioc)))
 	{}
 
 	explicit cluster_discovery_service(
@@ -55,9 +204,10 @@ public:
 	)
 		: boost::asio::execution_context::service(ioc),
 		settings_(settings),
-		old_gossip_(),
-		context_(nullptr)
-	{}
+		refresh_strand_(boost::asio::make_strand(static_cast<boost::asio::io_context&>(ioc)))
+	{
+		cached_gossip_ = load_gossip_cache();
+	}
 
 	template <class Connection, class Func>
 	void async_discover_node_endpoints(Connection& connection, Func&& f)
@@ -67,194 +217,281 @@ public:
 			"template argument to Func must have signature void(boost::system::error_code, endpoint_type)"
 			);
 
-		context_ = std::addressof(connection.get_io_context());
-		auto timer = std::make_shared<boost::asio::steady_timer>(*context_);
+		this->add_master_change_listener(connection);
+		this->start_gossip_refresh();
+
+		// retries run on the connection's executor, which is its strand if it has one
+		auto timer = std::make_shared<boost::asio::steady_timer>(connection.get_executor());
 		// start the discovery cycle
 		this->perform_discovery(connection, std::forward<Func>(f), timer, 1);
 	}
 
-	~cluster_discovery_service()
+	// smoothed round trip time to a node, measured over http and tcp, if any was measured yet
+	std::optional<std::chrono::nanoseconds> round_trip_time(guid_type const& instance_id) const
 	{
-		shutdown();
+		std::lock_guard<std::mutex> lock(mutex_);
+		auto it = round_trips_.find(instance_id);
+		if (it == round_trips_.end()) return {};
+		return it->second;
 	}
 
-private:
-	template <class Connection, class Func>
-	bool do_discover_node_endpoints(Connection& connection, Func&& f, int attempt)
+	// round trip of a heartbeat sent to the node listening on tcp_endpoint
+	void report_round_trip(endpoint_type const& tcp_endpoint, std::chrono::nanoseconds round_trip)
 	{
-		if (attempt <= settings_.max_discover_attempts())
-		{
-			std::optional<node_endpoints_type> endpoints = discover_endpoints();
-			if (endpoints.has_value())
-			{
-				// for now, we'll just use .first to use the normal tcp endpoint instead of the secure one (ssl not yet used)
-				f(boost::system::error_code(), endpoints.value().first);
-				return true;
-			}
-			else
-			{
-				return false;
-			}
-		}
-		else
+		this->record_round_trip(tcp_endpoint, false, round_trip);
+	}
+
+	// members of the last gossip received
+	std::vector<message::member_info> gossip() const
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		return old_gossip_;
+	}
+
+	// listener->on_gossip_changed(members) is called from the thread that received the gossip each time
+	// a discovery or a refresh sees members join, leave, die or change state, until listener is destroyed
+	template <class Listener>
+	void add_gossip_listener(std::shared_ptr<Listener> const& listener)
+	{
+		static_assert(is_gossip_listener<Listener>::value, "Listener must have a on_gossip_changed(std::vector<message::member_info> const&) method");
+
+		std::lock_guard<std::mutex> lock(mutex_);
+		gossip_listeners_[listener.get()] = [weak = std::weak_ptr<Listener>(listener)](std::vector<message::member_info> const& members)
 		{
-			f(make_error_code(connection_errors::endpoint_discovery), boost::asio::ip::tcp::endpoint());
+			auto listener = weak.lock();
+			if (!listener) return false;
+			listener->on_gossip_changed(members);
 			return true;
-		}
+		};
+	}
 
-		return false;
+	void stop_gossip_refresh()
+	{
+		boost::asio::post(refresh_strand_, [this]()
+		{
+			refresh_stopped_ = true;
+			if (refresh_timer_.has_value()) refresh_timer_->cancel();
+		});
+	}
+
+	~cluster_discovery_service()
+	{
+		shutdown();
 	}
 
+private:
 	template <class Connection, class Func>
 	void perform_discovery(Connection& connection, Func&& f, std::shared_ptr<boost::asio::steady_timer> timer, int attempt)
 	{
 		boost::asio::post(
-			connection.get_io_context(),
+			connection.get_executor(),
 			[this, timer = timer, &connection, f = std::move(f), attempt = attempt]() mutable
 		{
-			if (!this->do_discover_node_endpoints(connection, std::move(f), attempt))
+			if (attempt > settings_.max_discover_attempts())
 			{
+				f(make_error_code(connection_errors::endpoint_discovery), boost::asio::ip::tcp::endpoint());
+				return;
+			}
+
+			this->async_discover_endpoints(
+				connection.get_executor(),
+				[this, timer = timer, &connection, f = std::move(f), attempt = attempt](std::optional<node_endpoints_type> endpoints) mutable
+			{
+				if (endpoints.has_value())
+				{
+					// for now, we'll just use .first to use the normal tcp endpoint instead of the secure one (ssl not yet used)
+					f(boost::system::error_code(), endpoints.value().first);
+					return;
+				}
+
 				timer->expires_after(std::chrono::milliseconds(500));
 				timer->async_wait(
 					[this, timer = timer, &connection, f = std::move(f), attempt = attempt + 1 /*here is where we increment the attempt, as in the for loop version of the .net client*/]
-				(boost::system::error_code ec)
+				(boost::system::error_code ec) mutable
 				{
 					// we are not checking the error code, because an async_wait's handler is called
 					// either on an operation_aborted or if the wait complete successfully, 
 					// but we never cancel the timer in this scenario
 					this->perform_discovery(connection, std::move(f), timer, attempt);
 				});
-			}
+			});
 		});
 	}
 
-	std::optional<node_endpoints_type> discover_endpoints()
+	// handler is called with the endpoints of the best node, or nullopt if no candidate gave a usable gossip
+	template <class Executor, class EndpointsHandler>
+	void async_discover_endpoints(Executor const& executor, EndpointsHandler&& handler)
 	{
-		std::vector<tcp::gossip_seed> candidates = old_gossip_.empty() ? get_dns_candidates() :
-			get_candidates(old_gossip_);
-
-		for (int i = 0; i < candidates.size(); ++i)
+		auto old_gossip = this->gossip();
+		if (!old_gossip.empty())
 		{
-			std::optional<message::cluster_info> gossip = try_get_gossip_from(candidates[i]);
-			if (!gossip.has_value() || gossip.value().members().empty())
-				continue;
+			this->async_query_candidates(executor, arrange_gossip_candidates(old_gossip), true, std::forward<EndpointsHandler>(handler));
+			return;
+		}
 
-			std::optional<node_endpoints_type> best_node = try_determine_best_node(gossip.value().members(), settings_.preference());
-			if (best_node.has_value())
+		std::vector<message::member_info> cached_gossip;
+		{
+			std::lock_guard<std::mutex> lock(mutex_);
+			cached_gossip.swap(cached_gossip_);
+		}
+		if (!cached_gossip.empty())
+		{
+			// the nodes of the last process are asked right away, in parallel with the seeds or
+			// the dns name in case they moved, whichever names an acceptable node first wins
+			auto race = std::make_shared<discovery_race<std::decay_t<EndpointsHandler>>>(
+				discovery_race<std::decay_t<EndpointsHandler>>{ std::forward<EndpointsHandler>(handler), 2, false }
+			);
+			auto finish = [race](std::optional<node_endpoints_type> endpoints)
 			{
-				old_gossip_ = gossip.value().members();
-				return best_node;
-			}
+				if (race->done) return;
+				if (!endpoints.has_value() && --race->pending != 0) return;
+
+				race->done = true;
+				race->handler(endpoints);
+			};
+
+			this->async_query_candidates(executor, arrange_gossip_candidates(cached_gossip), true, decltype(finish)(finish));
+			this->async_discover_from_seeds(executor, std::move(finish));
+			return;
 		}
 
-		return {};
+		this->async_discover_from_seeds(executor, std::forward<EndpointsHandler>(handler));
 	}
 
-	std::vector<tcp::gossip_seed> get_dns_candidates()
+	// same as async_discover_endpoints for the gossip seeds, or the cluster's dns name if there are none
+	template <class Executor, class EndpointsHandler>
+	void async_discover_from_seeds(Executor const& executor, EndpointsHandler&& handler)
 	{
-		std::vector<tcp::gossip_seed> endpoints;
 		if (!settings_.gossip_seeds().empty())
 		{
-			endpoints = settings_.gossip_seeds();
-		}
-		else
-		{
-			// perform dns resolution and create gossip seeds from results
-			boost::asio::ip::tcp::resolver resolver{ *context_ };
-			boost::system::error_code ec;
-			auto it = resolver.resolve(settings_.cluster_dns(), ec);
-			if (ec) return {};
-			std::transform(
-				it,
-				decltype(it)(),
-				std::back_inserter(endpoints),
-				[](decltype(*it) result)
-			{
-				return tcp::gossip_seed(result.endpoint());
-			});
+			auto candidates = settings_.gossip_seeds();
+			shuffle(candidates.begin(), candidates.end());
+			this->async_query_candidates(executor, std::move(candidates), true, std::forward<EndpointsHandler>(handler));
+			return;
 		}
 
-		std::random_device device;
-		std::mt19937 gen(device());
-
-		std::shuffle(endpoints.begin(), endpoints.end(), gen);
-
-		return endpoints;
+		// create gossip seeds from the addresses of the cluster's dns name
+		auto resolver = std::make_shared<boost::asio::ip::tcp::resolver>(executor);
+		resolver->async_resolve(
+			settings_.cluster_dns(),
+			std::to_string(settings_.external_gossip_port()),
+			[this, resolver, executor = executor, handler = std::move(handler)]
+		(boost::system::error_code ec, boost::asio::ip::tcp::resolver::results_type results) mutable
+		{
+			std::vector<tcp::gossip_seed> candidates;
+			if (!ec)
+			{
+				for (auto const& result : results) candidates.push_back(tcp::gossip_seed(result.endpoint()));
+			}
+			shuffle(candidates.begin(), candidates.end());
+			this->async_query_candidates(executor, std::move(candidates), true, std::move(handler));
+		});
 	}
 
-	std::vector<tcp::gossip_seed> get_candidates(std::vector<message::member_info> const& old_gossip)
+	template <class EndpointsHandler>
+	struct discovery_race
 	{
-		return arrange_gossip_candidates(old_gossip);
-	}
+		EndpointsHandler handler;
+		std::size_t pending;
+		bool done;
+	};
 
-	std::vector<tcp::gossip_seed> arrange_gossip_candidates(std::vector<message::member_info> const& members)
+	template <class EndpointsHandler>
+	struct gossip_round
+	{
+		EndpointsHandler handler;
+		std::size_t pending;
+		bool done;
+		std::vector<std::shared_ptr<gossip_request>> requests;
+	};
+
+	/*
+		Queries every candidate at once. If first_wins, the first gossip naming an acceptable
+		node wins and the other requests are cancelled, else every candidate is waited for so
+		that every answer updates the round trip times, and the handler is given nullopt.
+	*/
+	template <class Executor, class EndpointsHandler>
+	void async_query_candidates(Executor const& executor, std::vector<tcp::gossip_seed> candidates, bool first_wins, EndpointsHandler&& handler)
 	{
-		char* buffer = new char[members.size() * sizeof(tcp::gossip_seed)];
-		int i = -1;
-		int j = static_cast<int>(members.size());
-		for (int k = 0; k < members.size(); ++k)
+		if (candidates.empty())
 		{
-			auto endpoint = boost::asio::ip::tcp::endpoint(
-				boost::asio::ip::make_address_v4(members[k].external_http_ip()),
-				members[k].external_http_port()
-			);
-
-			if (members[k].state() == message::virtual_node_state::manager)
-			{
-				new (&buffer[(--j) * sizeof(tcp::gossip_seed)]) tcp::gossip_seed(endpoint);
-			}
-			else
-			{
-				new (&buffer[(++i) * sizeof(tcp::gossip_seed)]) tcp::gossip_seed(endpoint);
-			}
+			handler(std::optional<node_endpoints_type>());
+			return;
 		}
 
-		tcp::gossip_seed* ptr = reinterpret_cast<tcp::gossip_seed*>(&buffer[0]);
-		std::vector<tcp::gossip_seed> result;
-		std::copy(ptr, ptr + members.size(), result.begin());
-
-		std::random_device device;
-		std::mt19937 gen(device());
+		using round_type = gossip_round<std::decay_t<EndpointsHandler>>;
+		auto round = std::make_shared<round_type>(round_type{ std::move(handler), candidates.size(), false, {} });
 
-		std::shuffle(result.begin(), result.begin() + i, gen);
-		std::shuffle(result.begin() + j, result.end(), gen);
+		round->requests.reserve(candidates.size());
+		for (auto const& candidate : candidates)
+		{
+			round->requests.push_back(std::make_shared<gossip_request>(executor, candidate));
+		}
 
-		delete[] buffer;
+		for (auto& request : round->requests)
+		{
+			// the round owns its requests, which outlive their handlers
+			request->async_get(settings_.gossip_timeout(), [this, round, first_wins, request = request.get()](std::optional<message::cluster_info> gossip)
+			{
+				if (round->done) return;
 
-		return result;
+				if (gossip.has_value() && !gossip.value().members().empty())
+				{
+					this->update_gossip(gossip.value().members());
+					this->record_round_trip(request->endpoint(), true, request->round_trip_time());
+
+					std::optional<node_endpoints_type> best_node = first_wins
+						? try_determine_best_node(gossip.value().members(), settings_.preference())
+						: std::nullopt;
+					if (best_node.has_value())
+					{
+						round->done = true;
+						for (auto& request : round->requests) request->cancel();
+						this->save_gossip_cache();
+						round->handler(best_node);
+						return;
+					}
+				}
+
+				if (--round->pending == 0)
+				{
+					round->done = true;
+					if (!first_wins) this->save_gossip_cache();
+					round->handler(std::optional<node_endpoints_type>());
+				}
+			});
+		}
 	}
 
-	auto try_get_gossip_from(tcp::gossip_seed const& seed) 
-		-> std::optional<message::cluster_info>
+	template <class Iterator>
+	static void shuffle(Iterator first, Iterator last)
 	{
-		namespace beast = boost::beast;
-		beast::tcp_stream stream{ *context_ };
-
-		boost::system::error_code ec;
-		stream.connect(seed.endpoint(), ec);
-		if (ec) return {};
-
-		// get request with http version 1.1
-		beast::http::request<beast::http::string_body> req{ beast::http::verb::get, "/gossip?format=json", 11 };
-		req.set(beast::http::field::host, seed.endpoint().address().to_string());
+		std::random_device device;
+		std::mt19937 gen(device());
 
-		beast::http::write(stream, req, ec);
-		if (ec) return {};
+		std::shuffle(first, last, gen);
+	}
 
-		beast::flat_buffer buffer;
-		beast::http::response<beast::http::string_body> res;
-		beast::http::read(stream, buffer, res, ec);
-		if (ec) return {};
+	// members first, managers last, each group in random order
+	std::vector<tcp::gossip_seed> arrange_gossip_candidates(std::vector<message::member_info> const& members)
+	{
+		std::vector<tcp::gossip_seed> result;
+		std::vector<tcp::gossip_seed> managers;
+		for (auto const& member : members)
+		{
+			auto endpoint = boost::asio::ip::tcp::endpoint(
+				boost::asio::ip::make_address_v4(member.external_http_ip()),
+				member.external_http_port()
+			);
 
-		stream.socket().shutdown(boost::asio::ip::tcp::socket::shutdown_both, ec);
-		if (ec && ec != beast::errc::not_connected) return {};
+			(member.state() == message::virtual_node_state::manager ? managers : result).push_back(tcp::gossip_seed(endpoint));
+		}
 
-		if (res.result() != beast::http::status::ok) return {};
+		shuffle(result.begin(), result.end());
+		shuffle(managers.begin(), managers.end());
+		result.insert(result.end(), managers.begin(), managers.end());
 
-		std::string body = res.body();
-		auto json = nlohmann::json::parse(body);
-		message::cluster_info info = json.get<message::cluster_info>();
-		return info;
+		return result;
 	}
 
 	auto try_determine_best_node(std::vector<message::member_info> const& members, node_preference preference)
@@ -276,7 +513,8 @@ private:
 				std::find_if(unallowed_states.begin(), unallowed_states.end(),
 					[&info](auto state) { return info.state() == state; }) != unallowed_states.end();
 		});
-		if (it != nodes.end()) nodes.erase(it);
+		nodes.erase(it, nodes.end());
+		if (nodes.empty()) return {};
 
 		// sort in descending order by node state
 		std::sort(nodes.begin(), nodes.end(), 
@@ -311,6 +549,34 @@ private:
 			);
 		}
 
+		if (settings_.preference() == node_preference::lowest_latency)
+		{
+			// fastest of the master and slaves first, nodes without a measured round trip after them,
+			// ties keep the state order, nodes in other states keep it behind the master and slaves
+			std::unordered_map<guid_type, std::chrono::nanoseconds> round_trips;
+			{
+				std::lock_guard<std::mutex> lock(mutex_);
+				round_trips = round_trips_;
+			}
+
+			auto round_trip_of = [&round_trips](message::member_info const& info)
+			{
+				auto it = round_trips.find(info.instance_id());
+				return it == round_trips.end() ? std::chrono::nanoseconds::max() : it->second;
+			};
+
+			auto eligible_end = std::stable_partition(nodes.begin(), nodes.end(), [](message::member_info const& info)
+			{
+				return info.state() == message::virtual_node_state::master || info.state() == message::virtual_node_state::slave;
+			});
+
+			std::stable_sort(nodes.begin(), eligible_end,
+				[&round_trip_of](message::member_info const& info1, message::member_info const& info2)
+			{
+				return round_trip_of(info1) < round_trip_of(info2);
+			});
+		}
+
 		// get first node as potential best node
 		auto& best_node = *nodes.begin();
 
@@ -331,13 +597,253 @@ private:
 		return std::make_optional(endpoints);
 	}
 
+	// stores the gossip and moves the listening connections if the cluster elected another master
+	void update_gossip(std::vector<message::member_info> const& members)
+	{
+		auto master = std::find_if(members.begin(), members.end(), [](message::member_info const& info)
+		{
+			return info.is_alive() && info.state() == message::virtual_node_state::master;
+		});
+
+		bool master_changed = false;
+		std::vector<std::pair<void const*, master_listener>> listeners;
+		std::vector<std::pair<void const*, gossip_listener>> gossip_listeners;
+		{
+			std::lock_guard<std::mutex> lock(mutex_);
+			if (master != members.end())
+			{
+				master_changed = master_.has_value() && master_.value() != master->instance_id();
+				// nodes answering the same refresh round may lag behind the election, only a master
+				// of a later epoch (or further ahead in the same epoch) replaces the known one
+				if (master_changed && !is_ahead_of_master(*master))
+				{
+					ES_DEBUG("cluster_discovery_service::update_gossip : ignoring stale gossip naming master {}", es::to_string(master->instance_id()));
+					return;
+				}
+
+				master_ = master->instance_id();
+				if (master_changed || is_ahead_of_master(*master))
+				{
+					master_epoch_number_ = master->epoch_number();
+					master_writer_checkpoint_ = master->writer_checkpoint();
+				}
+			}
+
+			if (!same_roles(old_gossip_, members)) gossip_listeners.assign(gossip_listeners_.begin(), gossip_listeners_.end());
+			old_gossip_ = members;
+
+			// connections only follow the master if they prefer it
+			if (master_changed && settings_.preference() == node_preference::master) listeners.assign(listeners_.begin(), listeners_.end());
+		}
+
+		if (master_changed) ES_INFO("cluster_discovery_service::update_gossip : cluster elected master {}", es::to_string(master->instance_id()));
+
+		std::vector<void const*> expired;
+		if (!listeners.empty())
+		{
+			endpoint_type endpoint(boost::asio::ip::make_address_v4(master->external_tcp_ip()), master->external_tcp_port());
+			for (auto& [key, listener] : listeners)
+			{
+				if (!listener(endpoint)) expired.push_back(key);
+			}
+		}
+
+		std::vector<void const*> expired_gossip_listeners;
+		for (auto& [key, listener] : gossip_listeners)
+		{
+			if (!listener(members)) expired_gossip_listeners.push_back(key);
+		}
+
+		if (expired.empty() && expired_gossip_listeners.empty()) return;
+
+		std::lock_guard<std::mutex> lock(mutex_);
+		for (auto key : expired) listeners_.erase(key);
+		for (auto key : expired_gossip_listeners) gossip_listeners_.erase(key);
+	}
+
+	// true if both gossips have the same members, in the same state, at the same tcp endpoints
+	static bool same_roles(std::vector<message::member_info> const& before, std::vector<message::member_info> const& after)
+	{
+		if (before.size() != after.size()) return false;
+
+		return std::all_of(before.begin(), before.end(), [&after](message::member_info const& member)
+		{
+			return std::any_of(after.begin(), after.end(), [&member](message::member_info const& other)
+			{
+				return other.instance_id() == member.instance_id() &&
+					other.is_alive() == member.is_alive() &&
+					other.state() == member.state() &&
+					other.external_tcp_ip() == member.external_tcp_ip() &&
+					other.external_tcp_port() == member.external_tcp_port();
+			});
+		});
+	}
+
+	// must be called with mutex_ held
+	bool is_ahead_of_master(message::member_info const& master) const
+	{
+		if (master.epoch_number() != master_epoch_number_) return master.epoch_number() > master_epoch_number_;
+		return master.writer_checkpoint() > master_writer_checkpoint_;
+	}
+
+	// folds a round trip to the node listening on endpoint (its http endpoint if http, else its tcp endpoint) in its smoothed round trip time
+	void record_round_trip(endpoint_type const& endpoint, bool http, std::chrono::nanoseconds round_trip)
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		auto member = std::find_if(old_gossip_.begin(), old_gossip_.end(), [&endpoint, http](message::member_info const& info)
+		{
+			auto const& ip = http ? info.external_http_ip() : info.external_tcp_ip();
+			auto port = http ? info.external_http_port() : info.external_tcp_port();
+			return static_cast<int>(endpoint.port()) == port && endpoint.address().to_string() == ip;
+		});
+		if (member == old_gossip_.end()) return;
+
+		auto [it, inserted] = round_trips_.try_emplace(member->instance_id(), round_trip);
+		// same smoothing as tcp's srtt
+		if (!inserted) it->second = (7 * it->second + round_trip) / 8;
+	}
+
+	std::vector<message::member_info> load_gossip_cache() const
+	{
+		if (settings_.gossip_cache_file().empty()) return {};
+
+		std::ifstream file(settings_.gossip_cache_file());
+		if (!file) return {};
+
+		auto json = nlohmann::json::parse(file, nullptr, false);
+		if (json.is_discarded()) return {};
+
+		try
+		{
+			return json.get<message::cluster_info>().members();
+		}
+		catch (nlohmann::json::exception const&)
+		{
+			return {};
+		}
+	}
+
+	// the file is written on the refresh strand, never on the thread of the connection that discovered
+	void save_gossip_cache()
+	{
+		if (settings_.gossip_cache_file().empty()) return;
+
+		auto gossip = this->gossip();
+		if (gossip.empty()) return;
+		boost::asio::post(refresh_strand_, [this, json = nlohmann::json{ { "members", gossip } }.dump()]()
+		{
+			this->write_gossip_cache(json);
+		});
+	}
+
+	// written to a temporary file renamed over the cache, so that readers never see a partial gossip,
+	// the temporary file is unique to this write as processes often share their cache
+	void write_gossip_cache(std::string const& json)
+	{
+		std::filesystem::path path(settings_.gossip_cache_file());
+		auto temporary = path;
+		temporary += "." + std::to_string(std::random_device{}()) + std::to_string(std::random_device{}()) + ".tmp";
+		{
+			std::ofstream file(temporary, std::ios::trunc);
+			if (!(file << json).flush())
+			{
+				ES_WARN("cluster_discovery_service::save_gossip_cache : could not write {}", temporary.string());
+				file.close();
+				std::error_code ec;
+				std::filesystem::remove(temporary, ec);
+				return;
+			}
+		}
+
+		std::error_code ec;
+		std::filesystem::rename(temporary, path, ec);
+		if (!ec) return;
+
+		ES_WARN("cluster_discovery_service::save_gossip_cache : could not replace {}, {}", path.string(), ec.message());
+		std::filesystem::remove(temporary, ec);
+	}
+
+	template <class Connection>
+	void add_master_change_listener(Connection& connection)
+	{
+		if constexpr (is_master_change_listener<Connection>::value)
+		{
+			std::lock_guard<std::mutex> lock(mutex_);
+			listeners_[std::addressof(connection)] = [connection = connection.weak_from_this()](endpoint_type const& master)
+			{
+				auto conn = connection.lock();
+				if (!conn) return false;
+				conn->on_master_changed(master);
+				return true;
+			};
+		}
+	}
+
+	void start_gossip_refresh()
+	{
+		if (settings_.gossip_refresh_interval() <= std::chrono::nanoseconds::zero()) return;
+		{
+			std::lock_guard<std::mutex> lock(mutex_);
+			if (refresh_started_) return;
+			refresh_started_ = true;
+		}
+
+		boost::asio::post(refresh_strand_, [this]()
+		{
+			refresh_timer_.emplace(refresh_strand_);
+			this->schedule_gossip_refresh();
+		});
+	}
+
+	// runs on the refresh strand
+	void schedule_gossip_refresh()
+	{
+		if (refresh_stopped_) return;
+
+		refresh_timer_->expires_after(settings_.gossip_refresh_interval());
+		refresh_timer_->async_wait([this](boost::system::error_code ec)
+		{
+			if (ec || refresh_stopped_) return;
+
+			auto old_gossip = this->gossip();
+			auto candidates = old_gossip.empty() ? settings_.gossip_seeds() : arrange_gossip_candidates(old_gossip);
+			this->async_query_candidates(refresh_strand_, std::move(candidates), false, [this](std::optional<node_endpoints_type>)
+			{
+				this->schedule_gossip_refresh();
+			});
+		});
+	}
+
 private:
+	// returns false if the connection is gone
+	using master_listener = std::function<bool(endpoint_type const&)>;
+	// returns false if the listener is gone
+	using gossip_listener = std::function<bool(std::vector<message::member_info> const&)>;
+
 	virtual void shutdown() noexcept override
-	{}
+	{
+		// the timer must not outlive the timer service, which is destroyed before this service
+		refresh_timer_.reset();
+	}
 
 	cluster_settings settings_;
+	boost::asio::strand<boost::asio::io_context::executor_type> refresh_strand_;
+	// only used on the refresh strand
+	std::optional<boost::asio::steady_timer> refresh_timer_;
+	bool refresh_stopped_ = false;
+
+	mutable std::mutex mutex_;
 	std::vector<message::member_info> old_gossip_;
-	boost::asio::io_context* context_;
+	std::unordered_map<guid_type, std::chrono::nanoseconds> round_trips_;
+	std::optional<guid_type> master_;
+	// election and position of the known master, as last gossiped
+	int master_epoch_number_ = -1;
+	std::int64_t master_writer_checkpoint_ = -1;
+	std::unordered_map<void const*, master_listener> listeners_;
+	std::unordered_map<void const*, gossip_listener> gossip_listeners_;
+	bool refresh_started_ = false;
+	// gossip of the last process, until the first discovery
+	std::vector<message::member_info> cached_gossip_;
 };
 
 } // services
@@ -7,6 +7,7 @@
 #include <functional>
 
 #include <boost/asio/execution_context.hpp>
+#include <boost/asio/post.hpp>
 
 #include "logger.hpp"
 
@@ -47,6 +48,9 @@ public:
 
 		if (!ec)
 		{
+			// packages queued while connecting can be written now
+			this->socket_connected(*conn);
+
 			auto& settings = conn->settings();
 			if (settings.default_user_credentials().null())
 			{
@@ -241,9 +245,21 @@ public:
 		if (connection_.expired()) return;
 		auto conn = connection_.lock();
 
-		auto& endpoint_discoverer = boost::asio::use_service<discovery_service_type>(conn->get_io_context());
-
 		discover_node_endpoints_handler<connection_type, discovery_service_type, handler_type> handler{ conn, std::move(handler_) };
+
+		// connections pinned to a node and connections redirected to the master skip discovery
+		auto endpoint = conn->node_endpoint();
+		if (!endpoint.has_value()) endpoint = this->take_redirect_endpoint(*conn);
+		if (endpoint.has_value())
+		{
+			boost::asio::post(
+				conn->get_executor(),
+				[handler = std::move(handler), endpoint = endpoint.value()]() mutable { handler(boost::system::error_code(), endpoint); }
+			);
+			return;
+		}
+
+		auto& endpoint_discoverer = boost::asio::use_service<discovery_service_type>(conn->get_io_context());
 		endpoint_discoverer.async_discover_node_endpoints(*conn, std::move(handler));
 		ES_DEBUG("connect_op::initiate : initiated endpoints discovery");
 	}
@@ -0,0 +1,96 @@
+#pragma once
+
+#ifndef ES_DECODE_ARENA_HPP
+#define ES_DECODE_ARENA_HPP
+
+#include <array>
+#include <cstddef>
+
+#include <google/protobuf/arena.h>
+
+#include "tcp/tcp_package.hpp"
+
+namespace es {
+namespace detail {
+namespace tcp {
+
+constexpr std::size_t kDecodeArenaInitialBlockSize = 64 * 1024;
+
+/*
+	Responses are decoded on the arena of the thread dispatching the package,
+	the arena is reset once the package has been dispatched, so decoded
+	messages (and everything they point to) must not outlive the handler
+	they are decoded in. The first block is reused from package to package.
+	Messages decoded outside of a dispatch never touch the arena.
+*/
+inline google::protobuf::Arena& decode_arena()
+{
+	thread_local std::array<char, kDecodeArenaInitialBlockSize> initial_block;
+	thread_local google::protobuf::Arena arena([]()
+	{
+		google::protobuf::ArenaOptions options;
+		options.initial_block = initial_block.data();
+		options.initial_block_size = initial_block.size();
+		return options;
+	}());
+	return arena;
+}
+
+// marks the dispatch of a package, the thread's decode arena is reset when the outermost scope ends
+class decode_scope
+{
+public:
+	decode_scope() { ++depth(); }
+	~decode_scope()
+	{
+		if (--depth() == 0) decode_arena().Reset();
+	}
+
+	decode_scope(decode_scope const&) = delete;
+	decode_scope& operator=(decode_scope const&) = delete;
+
+	// true while a package is being dispatched on this thread
+	static bool active() { return depth() != 0; }
+
+private:
+	static int& depth()
+	{
+		thread_local int depth = 0;
+		return depth;
+	}
+};
+
+// parses the message of view on the thread's decode arena, messages generated without
+// arena support are heap allocated, but still destroyed when the arena is reset,
+// outside of a decode scope nothing would reset the arena, the message is then parsed
+// in a thread local one that is reused by the next message of its type decoded there
+template <class Message>
+Message& decode(tcp_package_view view)
+{
+	if (!decode_scope::active())
+	{
+		thread_local Message unscoped;
+		unscoped.Clear();
+		unscoped.ParseFromArray(view.data() + view.message_offset(), view.message_size());
+		return unscoped;
+	}
+
+	Message* message = nullptr;
+	if constexpr (google::protobuf::Arena::is_arena_constructable<Message>::value)
+	{
+		message = google::protobuf::Arena::CreateMessage<Message>(&decode_arena());
+	}
+	else
+	{
+		message = google::protobuf::Arena::Create<Message>(&decode_arena());
+	}
+
+	message->ParseFromArray(view.data() + view.message_offset(), view.message_size());
+	return *message;
+}
+
+} // tcp
+} // detail
+} // es
+
+#endif // ES_DECODE_ARENA_HPP
@@ -0,0 +1,169 @@
+#pragma once
+
+#ifndef ES_DECODERS_HPP
+#define ES_DECODERS_HPP
+
+#include <cstdint>
+#include <optional>
+#include <string_view>
+
+#include "guid.hpp"
+#include "resolved_event_view.hpp"
+
+#include "tcp/tcp_package.hpp"
+#include "tcp/wire_format.hpp"
+
+namespace es {
+namespace detail {
+namespace tcp {
+
+/*
+	Decoders reading events in place from their wire format, the decoded
+	views point into the decoded bytes, nothing is allocated.
+*/
+
+// message::EventRecord fields
+namespace event_record_fields {
+constexpr std::uint32_t event_stream_id = 1;
+constexpr std::uint32_t event_number = 2;
+constexpr std::uint32_t event_id = 3;
+constexpr std::uint32_t event_type = 4;
+constexpr std::uint32_t data_content_type = 5;
+constexpr std::uint32_t metadata_content_type = 6;
+constexpr std::uint32_t data = 7;
+constexpr std::uint32_t metadata = 8;
+constexpr std::uint32_t created = 9;
+constexpr std::uint32_t created_epoch = 10;
+}
+
+// message::ResolvedEvent and message::ResolvedIndexedEvent fields
+namespace resolved_event_fields {
+constexpr std::uint32_t event = 1;
+constexpr std::uint32_t link = 2;
+constexpr std::uint32_t commit_position = 3;
+constexpr std::uint32_t prepare_position = 4;
+}
+
+// message::StreamEventAppeared fields
+namespace stream_event_appeared_fields {
+constexpr std::uint32_t event = 1;
+}
+
+// message::PersistentSubscriptionStreamEventAppeared fields
+namespace persistent_subscription_stream_event_appeared_fields {
+constexpr std::uint32_t event = 1;
+constexpr std::uint32_t retry_count = 2;
+}
+
+inline std::optional<recorded_event_view> decode_event_record(std::byte const* data, std::size_t size)
+{
+	std::string_view fields[9];
+	std::int64_t event_number = 0;
+	bool is_json = false;
+	std::int64_t created = 0;
+	std::int64_t created_epoch = 0;
+
+	bool well_formed = visit_fields(data, size, [&](std::uint32_t field, std::uint32_t wire_type, std::uint64_t value, std::byte const* payload)
+	{
+		if (wire_type == 2)
+		{
+			if (field < 9) fields[field] = std::string_view(reinterpret_cast<char const*>(payload), static_cast<std::size_t>(value));
+			return false;
+		}
+
+		switch (field)
+		{
+		case event_record_fields::event_number: event_number = static_cast<std::int64_t>(value); break;
+		case event_record_fields::data_content_type: is_json = value == 1; break;
+		case event_record_fields::created: created = static_cast<std::int64_t>(value); break;
+		case event_record_fields::created_epoch: created_epoch = static_cast<std::int64_t>(value); break;
+		default: break;
+		}
+		return false;
+	});
+
+	std::string_view const event_id = fields[event_record_fields::event_id];
+	if (!well_formed || event_id.size() != 16) return std::nullopt;
+
+	return recorded_event_view(
+		fields[event_record_fields::event_stream_id],
+		es::guid(event_id.data()),
+		event_number,
+		fields[event_record_fields::event_type],
+		fields[event_record_fields::data],
+		fields[event_record_fields::metadata],
+		is_json,
+		created,
+		created_epoch
+	);
+}
+
+// decodes a message::ResolvedEvent, or a message::ResolvedIndexedEvent which has no position
+inline std::optional<resolved_event_view> decode_resolved_event(std::byte const* data, std::size_t size, frame_handle frame)
+{
+	std::optional<recorded_event_view> event;
+	std::optional<recorded_event_view> link;
+	std::optional<std::int64_t> commit_position;
+	std::optional<std::int64_t> prepare_position;
+	bool well_formed_records = true;
+
+	bool well_formed = visit_fields(data, size, [&](std::uint32_t field, std::uint32_t wire_type, std::uint64_t value, std::byte const* payload)
+	{
+		if (wire_type == 2 && (field == resolved_event_fields::event || field == resolved_event_fields::link))
+		{
+			auto record = decode_event_record(payload, static_cast<std::size_t>(value));
+			well_formed_records = well_formed_records && record.has_value();
+			(field == resolved_event_fields::event ? event : link) = record;
+		}
+		else if (wire_type == 0 && field == resolved_event_fields::commit_position)
+		{
+			commit_position = static_cast<std::int64_t>(value);
+		}
+		else if (wire_type == 0 && field == resolved_event_fields::prepare_position)
+		{
+			prepare_position = static_cast<std::int64_t>(value);
+		}
+		return !well_formed_records;
+	});
+
+	if (!well_formed || !well_formed_records) return std::nullopt;
+
+	std::optional<position> original_position;
+	if (commit_position.has_value() && prepare_position.has_value())
+	{
+		original_position = position{ *commit_position, *prepare_position };
+	}
+
+	return resolved_event_view(event, link, original_position, std::move(frame));
+}
+
+inline std::optional<resolved_event_view> decode_stream_event_appeared(tcp_package_view view, frame_handle frame)
+{
+	std::byte const* message = reinterpret_cast<std::byte const*>(view.data() + view.message_offset());
+	auto event = find_bytes_field(message, view.message_size(), stream_event_appeared_fields::event);
+	if (!event.has_value()) return std::nullopt;
+
+	return decode_resolved_event(reinterpret_cast<std::byte const*>(event->data()), event->size(), std::move(frame));
+}
+
+inline std::optional<resolved_event_view> decode_persistent_subscription_stream_event_appeared(
+	tcp_package_view view,
+	frame_handle frame,
+	std::int32_t& retry_count
+)
+{
+	std::byte const* message = reinterpret_cast<std::byte const*>(view.data() + view.message_offset());
+	auto event = find_bytes_field(message, view.message_size(), persistent_subscription_stream_event_appeared_fields::event);
+	if (!event.has_value()) return std::nullopt;
+
+	auto count = find_varint_field(message, view.message_size(), persistent_subscription_stream_event_appeared_fields::retry_count);
+	retry_count = count.has_value() ? static_cast<std::int32_t>(*count) : 0;
+
+	return decode_resolved_event(reinterpret_cast<std::byte const*>(event->data()), event->size(), std::move(frame));
+}
+
+} // tcp
+} // detail
+} // es
+
+#endif // ES_DECODERS_HPP
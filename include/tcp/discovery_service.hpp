@@ -49,7 +49,7 @@ public:
 			"template argument to Func must have signature void(boost::system::error_code, endpoint_type)"
 			);
 
-		boost::asio::post(connection.get_io_context(),
+		boost::asio::post(connection.get_executor(),
 			[this, f = std::move(f)]() mutable
 		{
 			boost::system::error_code ec;
@@ -0,0 +1,485 @@
+#pragma once
+
+#ifndef ES_ENCODERS_HPP
+#define ES_ENCODERS_HPP
+
+#include <cstdint>
+#include <iterator>
+#include <string_view>
+
+#include "guid.hpp"
+#include "shared_event_data.hpp"
+
+#include "tcp/tcp_package.hpp"
+#include "tcp/wire_format.hpp"
+
+namespace es {
+namespace detail {
+namespace tcp {
+
+/*
+	Encoders writing request messages directly in their wire format, the
+	output is byte for byte what the generated message classes serialize
+	(fields in field number order). Encoders with size() and encode(out)
+	write into any buffer of size() bytes, tcp_package gives them the frame.
+	They only refer to their arguments, which must outlive them.
+*/
+
+// message::NewEvent fields
+namespace new_event_fields {
+constexpr std::uint32_t event_id = 1;
+constexpr std::uint32_t event_type = 2;
+constexpr std::uint32_t data_content_type = 3;
+constexpr std::uint32_t metadata_content_type = 4;
+constexpr std::uint32_t data = 5;
+constexpr std::uint32_t metadata = 6;
+}
+
+// message::WriteEvents fields
+namespace write_events_fields {
+constexpr std::uint32_t event_stream_id = 1;
+constexpr std::uint32_t expected_version = 2;
+constexpr std::uint32_t events = 3;
+constexpr std::uint32_t require_master = 4;
+}
+
+// message::TransactionWrite fields
+namespace transaction_write_fields {
+constexpr std::uint32_t transaction_id = 1;
+constexpr std::uint32_t events = 2;
+constexpr std::uint32_t require_master = 3;
+}
+
+// message::ReadEvent fields
+namespace read_event_fields {
+constexpr std::uint32_t event_stream_id = 1;
+constexpr std::uint32_t event_number = 2;
+constexpr std::uint32_t resolve_link_tos = 3;
+constexpr std::uint32_t require_master = 4;
+}
+
+// message::ReadStreamEvents fields
+namespace read_stream_events_fields {
+constexpr std::uint32_t event_stream_id = 1;
+constexpr std::uint32_t from_event_number = 2;
+constexpr std::uint32_t max_count = 3;
+constexpr std::uint32_t resolve_link_tos = 4;
+constexpr std::uint32_t require_master = 5;
+}
+
+// message::ReadAllEvents fields
+namespace read_all_events_fields {
+constexpr std::uint32_t commit_position = 1;
+constexpr std::uint32_t prepare_position = 2;
+constexpr std::uint32_t max_count = 3;
+constexpr std::uint32_t resolve_link_tos = 4;
+constexpr std::uint32_t require_master = 5;
+}
+
+// message::PersistentSubscriptionAckEvents fields
+namespace persistent_subscription_ack_events_fields {
+constexpr std::uint32_t subscription_id = 1;
+constexpr std::uint32_t processed_event_ids = 2;
+}
+
+// message::SubscribeToStream fields
+namespace subscribe_to_stream_fields {
+constexpr std::uint32_t event_stream_id = 1;
+constexpr std::uint32_t resolve_link_tos = 2;
+}
+
+// encodes a message::WriteEvents whose event contents and metadata are external buffers of message
+template <class SharedEventSequence>
+void encode_write_events(
+	gather_message& message,
+	std::string_view stream,
+	std::int64_t expected_version,
+	bool require_master,
+	SharedEventSequence const& events
+)
+{
+	// upper bound of the tags, lengths and varints of an event
+	constexpr std::size_t kMaxEventFraming = 96;
+
+	std::size_t inline_size = length_delimited_field_size(write_events_fields::event_stream_id, stream.size())
+		+ int64_field_size(write_events_fields::expected_version, expected_version)
+		+ bool_field_size(write_events_fields::require_master);
+	for (auto const& event : events) inline_size += kMaxEventFraming + event.type().size();
+	message.reserve(inline_size);
+
+	std::uint8_t* out = message.prepare(
+		length_delimited_field_size(write_events_fields::event_stream_id, stream.size())
+		+ int64_field_size(write_events_fields::expected_version, expected_version)
+	);
+	out = write_bytes_field(out, write_events_fields::event_stream_id, stream.data(), stream.size());
+	out = write_int64_field(out, write_events_fields::expected_version, expected_version);
+	message.commit(out);
+
+	for (auto const& event : events)
+	{
+		shared_payload const& content = event.content();
+		std::int64_t const data_content_type = event.is_json() ? 1 : 0;
+		std::int64_t const metadata_content_type = 0; // see .NET client api
+
+		std::size_t event_size = length_delimited_field_size(new_event_fields::event_id, 16)
+			+ length_delimited_field_size(new_event_fields::event_type, event.type().size())
+			+ int64_field_size(new_event_fields::data_content_type, data_content_type)
+			+ int64_field_size(new_event_fields::metadata_content_type, metadata_content_type)
+			+ length_delimited_field_size(new_event_fields::data, content.size());
+		if (event.metadata().has_value())
+		{
+			event_size += length_delimited_field_size(new_event_fields::metadata, event.metadata()->size());
+		}
+
+		out = message.prepare(kMaxEventFraming + event.type().size());
+		out = write_length_delimited_header(out, write_events_fields::events, event_size);
+		out = write_bytes_field(out, new_event_fields::event_id, event.event_id().data, 16);
+		out = write_bytes_field(out, new_event_fields::event_type, event.type().data(), event.type().size());
+		out = write_int64_field(out, new_event_fields::data_content_type, data_content_type);
+		out = write_int64_field(out, new_event_fields::metadata_content_type, metadata_content_type);
+		out = write_length_delimited_header(out, new_event_fields::data, content.size());
+		message.commit(out);
+		message.append_external(content.data(), content.size(), content.owner());
+
+		if (event.metadata().has_value())
+		{
+			shared_payload const& metadata = *event.metadata();
+			out = message.prepare(tag_size(new_event_fields::metadata) + varint_size(metadata.size()));
+			out = write_length_delimited_header(out, new_event_fields::metadata, metadata.size());
+			message.commit(out);
+			message.append_external(metadata.data(), metadata.size(), metadata.owner());
+		}
+	}
+
+	out = message.prepare(bool_field_size(write_events_fields::require_master));
+	out = write_bool_field(out, write_events_fields::require_master, require_master);
+	message.commit(out);
+}
+
+// size of the message::NewEvent of an event whose type, content and metadata convert to std::string_view
+template <class Event>
+std::size_t new_event_size(Event const& event)
+{
+	std::string_view const type = event.type();
+	std::string_view const content = event.content();
+
+	std::size_t size = length_delimited_field_size(new_event_fields::event_id, 16)
+		+ length_delimited_field_size(new_event_fields::event_type, type.size())
+		+ int64_field_size(new_event_fields::data_content_type, event.is_json() ? 1 : 0)
+		+ int64_field_size(new_event_fields::metadata_content_type, 0)
+		+ length_delimited_field_size(new_event_fields::data, content.size());
+	if (event.metadata().has_value())
+	{
+		size += length_delimited_field_size(new_event_fields::metadata, std::string_view(*event.metadata()).size());
+	}
+	return size;
+}
+
+// writes event as the embedded message::NewEvent field_number, event_size is new_event_size(event)
+template <class Event>
+std::uint8_t* write_new_event(std::uint8_t* out, std::uint32_t field_number, Event const& event, std::size_t event_size)
+{
+	std::string_view const type = event.type();
+	std::string_view const content = event.content();
+
+	out = write_length_delimited_header(out, field_number, event_size);
+	out = write_bytes_field(out, new_event_fields::event_id, event.event_id().data, 16);
+	out = write_bytes_field(out, new_event_fields::event_type, type.data(), type.size());
+	out = write_int64_field(out, new_event_fields::data_content_type, event.is_json() ? 1 : 0);
+	out = write_int64_field(out, new_event_fields::metadata_content_type, 0); // see .NET client api
+	out = write_bytes_field(out, new_event_fields::data, content.data(), content.size());
+	if (event.metadata().has_value())
+	{
+		std::string_view const metadata = *event.metadata();
+		out = write_bytes_field(out, new_event_fields::metadata, metadata.data(), metadata.size());
+	}
+	return out;
+}
+
+// message::WriteEvents encoder, the events are copied straight into the frame
+template <class EventSequence>
+class write_events_encoder
+{
+public:
+	explicit write_events_encoder(
+		std::string_view stream,
+		std::int64_t expected_version,
+		bool require_master,
+		EventSequence const& events
+	) : stream_(stream),
+		expected_version_(expected_version),
+		require_master_(require_master),
+		events_(events)
+	{}
+
+	std::size_t size() const
+	{
+		std::size_t size = length_delimited_field_size(write_events_fields::event_stream_id, stream_.size())
+			+ int64_field_size(write_events_fields::expected_version, expected_version_)
+			+ bool_field_size(write_events_fields::require_master);
+		for (auto const& event : events_)
+		{
+			size += length_delimited_field_size(write_events_fields::events, new_event_size(event));
+		}
+		return size;
+	}
+
+	std::uint8_t* encode(std::uint8_t* out) const
+	{
+		out = write_bytes_field(out, write_events_fields::event_stream_id, stream_.data(), stream_.size());
+		out = write_int64_field(out, write_events_fields::expected_version, expected_version_);
+		for (auto const& event : events_)
+		{
+			out = write_new_event(out, write_events_fields::events, event, new_event_size(event));
+		}
+		return write_bool_field(out, write_events_fields::require_master, require_master_);
+	}
+
+private:
+	std::string_view stream_;
+	std::int64_t expected_version_;
+	bool require_master_;
+	EventSequence const& events_;
+};
+
+// message::TransactionWrite encoder, the events are copied straight into the frame
+template <class EventSequence>
+class transaction_write_encoder
+{
+public:
+	explicit transaction_write_encoder(
+		std::int64_t transaction_id,
+		bool require_master,
+		EventSequence const& events
+	) : transaction_id_(transaction_id),
+		require_master_(require_master),
+		events_(events)
+	{}
+
+	std::size_t size() const
+	{
+		std::size_t size = int64_field_size(transaction_write_fields::transaction_id, transaction_id_)
+			+ bool_field_size(transaction_write_fields::require_master);
+		for (auto const& event : events_)
+		{
+			size += length_delimited_field_size(transaction_write_fields::events, new_event_size(event));
+		}
+		return size;
+	}
+
+	std::uint8_t* encode(std::uint8_t* out) const
+	{
+		out = write_int64_field(out, transaction_write_fields::transaction_id, transaction_id_);
+		for (auto const& event : events_)
+		{
+			out = write_new_event(out, transaction_write_fields::events, event, new_event_size(event));
+		}
+		return write_bool_field(out, transaction_write_fields::require_master, require_master_);
+	}
+
+private:
+	std::int64_t transaction_id_;
+	bool require_master_;
+	EventSequence const& events_;
+};
+
+// message::ReadEvent encoder
+class read_event_encoder
+{
+public:
+	explicit read_event_encoder(
+		std::string_view stream,
+		std::int64_t event_number,
+		bool resolve_link_tos,
+		bool require_master
+	) : stream_(stream),
+		event_number_(event_number),
+		resolve_link_tos_(resolve_link_tos),
+		require_master_(require_master)
+	{}
+
+	std::size_t size() const
+	{
+		return length_delimited_field_size(read_event_fields::event_stream_id, stream_.size())
+			+ int64_field_size(read_event_fields::event_number, event_number_)
+			+ bool_field_size(read_event_fields::resolve_link_tos)
+			+ bool_field_size(read_event_fields::require_master);
+	}
+
+	std::uint8_t* encode(std::uint8_t* out) const
+	{
+		out = write_bytes_field(out, read_event_fields::event_stream_id, stream_.data(), stream_.size());
+		out = write_int64_field(out, read_event_fields::event_number, event_number_);
+		out = write_bool_field(out, read_event_fields::resolve_link_tos, resolve_link_tos_);
+		return write_bool_field(out, read_event_fields::require_master, require_master_);
+	}
+
+private:
+	std::string_view stream_;
+	std::int64_t event_number_;
+	bool resolve_link_tos_;
+	bool require_master_;
+};
+
+// message::ReadStreamEvents encoder
+class read_stream_events_encoder
+{
+public:
+	explicit read_stream_events_encoder(
+		std::string_view stream,
+		std::int64_t from_event_number,
+		std::int32_t max_count,
+		bool resolve_link_tos,
+		bool require_master
+	) : stream_(stream),
+		from_event_number_(from_event_number),
+		max_count_(max_count),
+		resolve_link_tos_(resolve_link_tos),
+		require_master_(require_master)
+	{}
+
+	std::size_t size() const
+	{
+		return length_delimited_field_size(read_stream_events_fields::event_stream_id, stream_.size())
+			+ int64_field_size(read_stream_events_fields::from_event_number, from_event_number_)
+			+ int64_field_size(read_stream_events_fields::max_count, max_count_)
+			+ bool_field_size(read_stream_events_fields::resolve_link_tos)
+			+ bool_field_size(read_stream_events_fields::require_master);
+	}
+
+	std::uint8_t* encode(std::uint8_t* out) const
+	{
+		out = write_bytes_field(out, read_stream_events_fields::event_stream_id, stream_.data(), stream_.size());
+		out = write_int64_field(out, read_stream_events_fields::from_event_number, from_event_number_);
+		out = write_int64_field(out, read_stream_events_fields::max_count, max_count_);
+		out = write_bool_field(out, read_stream_events_fields::resolve_link_tos, resolve_link_tos_);
+		return write_bool_field(out, read_stream_events_fields::require_master, require_master_);
+	}
+
+private:
+	std::string_view stream_;
+	std::int64_t from_event_number_;
+	std::int32_t max_count_;
+	bool resolve_link_tos_;
+	bool require_master_;
+};
+
+// message::ReadAllEvents encoder
+class read_all_events_encoder
+{
+public:
+	explicit read_all_events_encoder(
+		std::int64_t commit_position,
+		std::int64_t prepare_position,
+		std::int32_t max_count,
+		bool resolve_link_tos,
+		bool require_master
+	) : commit_position_(commit_position),
+		prepare_position_(prepare_position),
+		max_count_(max_count),
+		resolve_link_tos_(resolve_link_tos),
+		require_master_(require_master)
+	{}
+
+	std::size_t size() const
+	{
+		return int64_field_size(read_all_events_fields::commit_position, commit_position_)
+			+ int64_field_size(read_all_events_fields::prepare_position, prepare_position_)
+			+ int64_field_size(read_all_events_fields::max_count, max_count_)
+			+ bool_field_size(read_all_events_fields::resolve_link_tos)
+			+ bool_field_size(read_all_events_fields::require_master);
+	}
+
+	std::uint8_t* encode(std::uint8_t* out) const
+	{
+		out = write_int64_field(out, read_all_events_fields::commit_position, commit_position_);
+		out = write_int64_field(out, read_all_events_fields::prepare_position, prepare_position_);
+		out = write_int64_field(out, read_all_events_fields::max_count, max_count_);
+		out = write_bool_field(out, read_all_events_fields::resolve_link_tos, resolve_link_tos_);
+		return write_bool_field(out, read_all_events_fields::require_master, require_master_);
+	}
+
+private:
+	std::int64_t commit_position_;
+	std::int64_t prepare_position_;
+	std::int32_t max_count_;
+	bool resolve_link_tos_;
+	bool require_master_;
+};
+
+// projection of iterators over event ids
+struct identity_event_id
+{
+	guid_type const& operator()(guid_type const& event_id) const { return event_id; }
+};
+
+// message::PersistentSubscriptionAckEvents encoder, event_id(*it) is the id of each acknowledged event
+template <class Iterator, class EventId = identity_event_id>
+class persistent_subscription_ack_events_encoder
+{
+public:
+	explicit persistent_subscription_ack_events_encoder(
+		std::string_view subscription_id,
+		Iterator first,
+		Iterator last,
+		EventId event_id = EventId()
+	) : subscription_id_(subscription_id),
+		first_(first),
+		last_(last),
+		event_id_(event_id)
+	{}
+
+	std::size_t size() const
+	{
+		std::size_t const id_count = static_cast<std::size_t>(std::distance(first_, last_));
+		return length_delimited_field_size(persistent_subscription_ack_events_fields::subscription_id, subscription_id_.size())
+			+ id_count * length_delimited_field_size(persistent_subscription_ack_events_fields::processed_event_ids, 16);
+	}
+
+	std::uint8_t* encode(std::uint8_t* out) const
+	{
+		out = write_bytes_field(out, persistent_subscription_ack_events_fields::subscription_id, subscription_id_.data(), subscription_id_.size());
+		for (auto it = first_; it != last_; ++it)
+		{
+			out = write_bytes_field(out, persistent_subscription_ack_events_fields::processed_event_ids, event_id_(*it).data, 16);
+		}
+		return out;
+	}
+
+private:
+	std::string_view subscription_id_;
+	Iterator first_;
+	Iterator last_;
+	EventId event_id_;
+};
+
+// message::SubscribeToStream encoder
+class subscribe_to_stream_encoder
+{
+public:
+	explicit subscribe_to_stream_encoder(std::string_view stream, bool resolve_link_tos)
+		: stream_(stream), resolve_link_tos_(resolve_link_tos)
+	{}
+
+	std::size_t size() const
+	{
+		return length_delimited_field_size(subscribe_to_stream_fields::event_stream_id, stream_.size())
+			+ bool_field_size(subscribe_to_stream_fields::resolve_link_tos);
+	}
+
+	std::uint8_t* encode(std::uint8_t* out) const
+	{
+		out = write_bytes_field(out, subscribe_to_stream_fields::event_stream_id, stream_.data(), stream_.size());
+		return write_bool_field(out, subscribe_to_stream_fields::resolve_link_tos, resolve_link_tos_);
+	}
+
+private:
+	std::string_view stream_;
+	bool resolve_link_tos_;
+};
+
+} // tcp
+} // detail
+} // es
+
+#endif // ES_ENCODERS_HPP
@@ -3,6 +3,7 @@
 #ifndef ES_HEARTBEAT_HPP
 #define ES_HEARTBEAT_HPP
 
+#include <cstdint>
 #include <memory>
 
 #include <boost/asio/error.hpp>
@@ -31,11 +32,13 @@ public:
 	explicit heartbeat_op(
 		std::shared_ptr<connection_type> const& connection
 	) : connection_(connection),
-		info_()
+		info_(),
+		generation_(0)
 	{
-		deadline_ = std::make_shared<waitable_timer_type>(connection->get_io_context());
+		deadline_ = std::make_shared<waitable_timer_type>(connection->get_executor());
 
 		auto conn = connection_.lock();
+		generation_ = this->connection_generation(*conn);
 		info_.set_last_package_no(this->get_package_number(*conn));
 		// we actually don't even need elapsed, since we can trust the timer.
 		// we leave it for the time being
@@ -60,7 +63,8 @@ public:
 
 		auto conn = connection_.lock();
 
-		if (!conn->socket().is_open())
+		// the connection was lost since this heartbeat chain started, the new connection has its own
+		if (!conn->socket().is_open() || generation_ != this->connection_generation(*conn))
 		{
 			ES_DEBUG("heartbeat_op::initiate : socket closed, cancelling heartbeat chain");
 			this->operator()(make_error_code(connection_errors::connection_closed));
@@ -94,10 +98,15 @@ public:
 			using tcp_command = detail::tcp::tcp_command;
 			using tcp_flags = detail::tcp::tcp_flags;
 
+			auto correlation_id = es::guid();
+			this->heartbeat_sent(*conn, correlation_id);
 			conn->async_send(tcp_package(
 				tcp_command::heartbeat_request_command,
 				tcp_flags::none,
-				es::guid()
+				correlation_id,
+				nullptr,
+				0,
+				conn->package_allocator()
 			));
 
 			info_.set_is_interval_stage(false);
@@ -142,10 +151,10 @@ public:
 		}
 		else
 		{
-			ES_ERROR("heartbeat_op::operator() : error={}, closing connection", ec.message());
+			ES_ERROR("heartbeat_op::operator() : error={}, dropping connection", ec.message());
 			if (connection_.expired()) return;
 			auto conn = connection_.lock();
-			conn->close();
+			this->connection_lost(*conn, ec, generation_);
 		}
 	}
 
@@ -153,6 +162,7 @@ private:
 	std::weak_ptr<connection_type> connection_;
 	detail::connection::heartbeat_info<clock_type> info_;
 	std::shared_ptr<waitable_timer_type> deadline_;
+	std::uint64_t generation_;
 };
 
 } // operations
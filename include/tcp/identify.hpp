@@ -46,7 +46,7 @@ public:
 		handler_(std::move(handler)), 
 		authenticated_(authenticated)
 	{
-		deadline_ = std::make_shared<waitable_timer_type>(connection->get_io_context());
+		deadline_ = std::make_shared<waitable_timer_type>(connection->get_executor());
 		auto conn = connection_.lock();
 		// we need to make this information available in the identify callback, so that connection_id is propagated to app code
 		info_.set_correlation_id(es::guid()); 
@@ -68,8 +68,6 @@ public:
 		message.set_version(ES_CLIENT_VERSION);
 		message.set_connection_name(conn->connection_name());
 
-		auto serialized = message.SerializeAsString();
-
 		auto do_identify = [this, &conn](tcp_package&& identify_package)
 		{
 			ES_TRACE("identify_op::initiate : tcp-package-size={}, cmd={}, authenticated={}, corr-id={}",
@@ -111,8 +109,8 @@ public:
 				info_.correlation_id(),
 				conn->settings().default_user_credentials().username(),
 				conn->settings().default_user_credentials().password(),
-				(std::byte*)serialized.data(),
-				serialized.size()
+				message,
+				conn->package_allocator()
 			);
 
 			do_identify(std::move(package));
@@ -123,8 +121,8 @@ public:
 				tcp_command::identify_client,
 				tcp_flags::none,
 				info_.correlation_id(),
-				(std::byte*)serialized.data(),
-				serialized.size()
+				message,
+				conn->package_allocator()
 			);
 
 			do_identify(std::move(package));
@@ -5,10 +5,15 @@
 
 #include <memory>
 #include <cstddef>
+#include <cstring>
+#include <algorithm>
 
 #include <boost/asio/read.hpp>
 
 #include "logger.hpp"
+#include "buffer/frame_buffer.hpp"
+#include "connection/constants.hpp"
+#include "error/error.hpp"
 #include "tcp/tcp_package.hpp"
 
 namespace es {
@@ -133,7 +138,7 @@ public:
 
 		length_check_handler<connection_type, dynamic_buffer_type, CompletionToken> handler(conn, buffer_, std::move(token));
 
-		// not sure if this is what we want, maybe we want more flexiblity, this works well for single threaded code ...
+		// reads of a connection never overlap, they run one after the other on its executor (or strand)
 		buffer_.consume(buffer_.size());
 
 		boost::asio::async_read(
@@ -148,6 +153,111 @@ private:
 	dynamic_buffer_type& buffer_;
 };
 
+template <class ConnectionType, class CompletionToken>
+class read_tcp_packages_handler
+{
+public:
+	using connection_type = ConnectionType;
+	using frame_buffer_type = buffer::frame_buffer;
+
+	template <class Token>
+	explicit read_tcp_packages_handler(
+		std::shared_ptr<connection_type> const& connection,
+		frame_buffer_type& buffer,
+		Token&& token
+	) : connection_(connection), buffer_(buffer), token_(std::forward<Token>(token))
+	{}
+
+	void operator()(boost::system::error_code ec, std::size_t bytes_read)
+	{
+		if (connection_.expired()) return;
+		auto conn = connection_.lock();
+
+		if (ec)
+		{
+			ES_ERROR("failed to read tcp frames, {}", ec.message());
+			token_(ec, {});
+			return;
+		}
+
+		buffer_.commit(bytes_read);
+
+		// split out every complete frame we have received so far
+		std::size_t missing = 0;
+		while (buffer_.size() >= 4)
+		{
+			int length = 0;
+			std::memcpy(&length, buffer_.data(), 4);
+
+			if (length < detail::tcp::kMandatorySize - detail::tcp::kCommandOffset || length > detail::tcp::kMaxPackageSize)
+			{
+				ec = make_error_code(communication_errors::bad_length_prefix);
+				token_(ec, {});
+				return;
+			}
+
+			std::size_t frame_size = static_cast<std::size_t>(length) + 4;
+			if (buffer_.size() < frame_size)
+			{
+				missing = frame_size - buffer_.size();
+				break;
+			}
+
+			// frame bytes stay valid until the next prepare, so we can consume before dispatching
+			detail::tcp::tcp_package_view view(buffer_.data(), frame_size);
+			buffer_.consume(frame_size);
+			token_(ec, view);
+		}
+
+		conn->socket().async_read_some(
+			buffer_.prepare(std::max<std::size_t>(missing, connection::constants::kMinReadSize)),
+			std::move(*this)
+		);
+	}
+private:
+	std::weak_ptr<connection_type> connection_;
+	frame_buffer_type& buffer_;
+	CompletionToken token_;
+};
+
+/*
+	Continuously reads as many bytes as are available into a frame buffer, and
+	calls the completion token once for every complete tcp frame with signature
+	void(boost::system::error_code, es::detail::tcp::tcp_package_view).
+	The read loop stops after the token is called with an error (and an invalid view).
+	The view is only valid for the duration of the token call.
+*/
+template <class ConnectionType>
+class read_tcp_packages_op
+{
+public:
+	using connection_type = ConnectionType;
+	using frame_buffer_type = buffer::frame_buffer;
+
+	explicit read_tcp_packages_op(
+		std::shared_ptr<connection_type> const& connection,
+		frame_buffer_type& buffer
+	) : connection_(connection), buffer_(buffer)
+	{}
+
+	template <class CompletionToken>
+	void initiate(CompletionToken&& token)
+	{
+		if (connection_.expired()) return;
+		auto conn = connection_.lock();
+
+		read_tcp_packages_handler<connection_type, std::decay_t<CompletionToken>> handler(conn, buffer_, std::forward<CompletionToken>(token));
+
+		conn->socket().async_read_some(
+			buffer_.prepare(connection::constants::kMinReadSize),
+			std::move(handler)
+		);
+	}
+private:
+	std::weak_ptr<connection_type> connection_;
+	frame_buffer_type& buffer_;
+};
+
 } // operations
 } // tcp
 } // es
@@ -0,0 +1,115 @@
+#pragma once
+
+#ifndef ES_RETRY_HPP
+#define ES_RETRY_HPP
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <optional>
+#include <random>
+#include <string>
+
+#include <boost/asio/ip/tcp.hpp>
+
+#include "message/messages.pb.h"
+
+#include "tcp/tcp_commands.hpp"
+#include "tcp/tcp_package.hpp"
+#include "tcp/wire_format.hpp"
+
+namespace es {
+namespace detail {
+namespace tcp {
+
+// true if the server could not handle the request for a transient reason,
+// in which case the same request can be sent again under the same correlation id
+inline bool is_transient_failure(tcp_package_view view)
+{
+	auto const* body = reinterpret_cast<std::byte const*>(view.data() + view.message_offset());
+	auto const size = view.message_size();
+
+	std::uint32_t result_field = 0;
+	switch (view.command())
+	{
+	case tcp_command::not_handled:
+	{
+		auto reason = find_varint_field(body, size, 1);
+		return reason.has_value() && (
+			*reason == message::NotHandled_NotHandledReason_NotReady ||
+			*reason == message::NotHandled_NotHandledReason_TooBusy
+		);
+	}
+	case tcp_command::write_events_completed:
+	case tcp_command::delete_stream_completed:
+		result_field = 1;
+		break;
+	case tcp_command::transaction_start_completed:
+	case tcp_command::transaction_write_completed:
+	case tcp_command::transaction_commit_completed:
+		result_field = 2;
+		break;
+	default:
+		return false;
+	}
+
+	auto result = find_varint_field(body, size, result_field);
+	return result.has_value() && (
+		*result == message::OperationResult::PrepareTimeout ||
+		*result == message::OperationResult::CommitTimeout ||
+		*result == message::OperationResult::ForwardTimeout
+	);
+}
+
+// tcp endpoint of the master a node advertised when it refused a request for not being the master,
+// nothing if the response is not such a refusal or does not carry a usable master info
+inline std::optional<boost::asio::ip::tcp::endpoint> not_master_redirect(tcp_package_view view)
+{
+	if (view.command() != tcp_command::not_handled) return {};
+
+	auto const* body = reinterpret_cast<std::byte const*>(view.data() + view.message_offset());
+	auto const size = view.message_size();
+
+	auto reason = find_varint_field(body, size, 1);
+	if (!reason.has_value() || *reason != message::NotHandled_NotHandledReason_NotMaster) return {};
+
+	// additional_info holds a serialized message::NotHandled::MasterInfo
+	auto info = find_bytes_field(body, size, 2);
+	if (!info.has_value()) return {};
+
+	auto const* info_data = reinterpret_cast<std::byte const*>(info->data());
+	auto address = find_bytes_field(info_data, info->size(), 1);
+	auto port = find_varint_field(info_data, info->size(), 2);
+	if (!address.has_value() || !port.has_value() || *port == 0 || *port > 65535) return {};
+
+	boost::system::error_code ec;
+	auto ip = boost::asio::ip::make_address(std::string(*address), ec);
+	if (ec) return {};
+
+	return boost::asio::ip::tcp::endpoint(ip, static_cast<unsigned short>(*port));
+}
+
+// exponential backoff with jitter, the delay before retry number attempt (starting at 1)
+// is drawn uniformly from [d/2, d] where d = min(initial * 2^(attempt - 1), max)
+inline std::chrono::milliseconds retry_delay(
+	std::uint32_t attempt,
+	std::chrono::milliseconds initial,
+	std::chrono::milliseconds max
+)
+{
+	thread_local std::minstd_rand generator{ std::random_device{}() };
+
+	auto delay = initial;
+	for (std::uint32_t i = 1; i < attempt && delay < max; ++i) delay *= 2;
+	delay = std::min(delay, max);
+
+	if (delay.count() <= 1) return delay;
+	std::uniform_int_distribution<std::chrono::milliseconds::rep> jitter(delay.count() / 2, delay.count());
+	return std::chrono::milliseconds(jitter(generator));
+}
+
+} // tcp
+} // detail
+} // es
+
+#endif // ES_RETRY_HPP
@@ -3,11 +3,19 @@
 #ifndef TCP_PACKAGE_HPP
 #define TCP_PACKAGE_HPP
 
+#include <cstring>
+#include <memory>
 #include <string>
 #include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include <boost/asio/buffer.hpp>
+#include <google/protobuf/message_lite.h>
 
 #include "guid.hpp"
 
+#include "buffer/frame_pool.hpp"
 #include "tcp/tcp_commands.hpp"
 #include "tcp/tcp_flags.hpp"
 
@@ -106,14 +114,91 @@ private:
 	std::size_t length_;
 };
 
-template <class Allocator = std::allocator<std::byte>>
+// buffers referenced by a package instead of being copied in its frame
+struct external_buffers
+{
+	struct segment
+	{
+		// offset in the package's own bytes the buffer is written at
+		std::size_t offset;
+		boost::asio::const_buffer buffer;
+	};
+
+	std::vector<segment> segments;
+	// keep the buffers alive as long as a package refers to them
+	std::vector<std::shared_ptr<void const>> owners;
+	std::size_t size = 0;
+};
+
+/*
+	Message body made of inline bytes, copied in the frame, interleaved with
+	external buffers that are written to the socket from where they are.
+	Encoders write the inline bytes with prepare()/commit() and insert
+	external buffers at the current inline position.
+*/
+class gather_message
+{
+public:
+	gather_message() = default;
+
+	void reserve(std::size_t inline_size) { inline_.reserve(inline_size); }
+
+	// room for at most size inline bytes, commit() tells where writing stopped
+	std::uint8_t* prepare(std::size_t size)
+	{
+		inline_.resize(committed_ + size);
+		return inline_.data() + committed_;
+	}
+
+	void commit(std::uint8_t* end)
+	{
+		committed_ = static_cast<std::size_t>(end - inline_.data());
+		inline_.resize(committed_);
+	}
+
+	void append_external(std::byte const* data, std::size_t size, std::shared_ptr<void const> owner)
+	{
+		if (size == 0) return;
+		external_.segments.push_back(external_buffers::segment{ committed_, boost::asio::const_buffer(data, size) });
+		external_.size += size;
+		if (owner != nullptr) external_.owners.push_back(std::move(owner));
+	}
+
+	std::uint8_t const* inline_data() const { return inline_.data(); }
+	std::size_t inline_size() const { return committed_; }
+	std::size_t size() const { return committed_ + external_.size; }
+	external_buffers& external() { return external_; }
+
+private:
+	std::vector<std::uint8_t> inline_;
+	std::size_t committed_ = 0;
+	external_buffers external_;
+};
+
+/*
+	Message encoders write a request from plain arguments, without building
+	a message object, size() is the exact number of bytes encode(out) writes.
+*/
+template <class Encoder, class = void>
+struct is_message_encoder : std::false_type {};
+
+template <class Encoder>
+struct is_message_encoder<Encoder, std::void_t<
+	decltype(std::size_t{ std::declval<Encoder const&>().size() }),
+	decltype(std::declval<Encoder const&>().encode(std::declval<std::uint8_t*>()))
+>> : std::true_type {};
+
+// frames are allocated from the default frame pool unless given the allocator of a connection
+template <class Allocator = buffer::frame_allocator<std::byte>>
 class tcp_package
 {
 public:
+	using allocator_type = Allocator;
+
 	tcp_package() = default;
 
 	tcp_package(tcp_package&& other)
-		: package_(other.package_), length_(other.length_), alloc_(other.alloc_)
+		: package_(other.package_), length_(other.length_), alloc_(other.alloc_), external_(std::move(other.external_))
 	{
 		// check alloc for propagate on move/copy, and all of that stuff...
 
@@ -122,28 +207,34 @@ public:
 	}
 	tcp_package& operator=(tcp_package&& other)
 	{
+		if (this == &other) return *this;
+		if (package_ != nullptr)
+			alloc_.deallocate(package_, allocated_size());
+
 		package_ = other.package_;
 		length_ = other.length_;
 		// check for propagate on move/copy, and all of that stuff...
 		alloc_ = other.alloc_;
+		external_ = std::move(other.external_);
 
 		// deallocating on a nullptr should be a noop
 		other.package_ = nullptr;
 
 		return *this;
 	}
+	// external buffers are shared, not copied
 	tcp_package(tcp_package const& other)
-		: package_(nullptr), length_(other.length_), alloc_(other.alloc_)
+		: package_(nullptr), length_(other.length_), alloc_(other.alloc_), external_(other.external_)
 	{
-		package_ = alloc_.allocate(length_ + 4);
-		std::memcpy(package_, other.package_, other.length_ + 4);
+		if (other.package_ == nullptr) return;
+		package_ = alloc_.allocate(allocated_size());
+		std::memcpy(package_, other.package_, allocated_size());
 	}
 	tcp_package& operator=(tcp_package const& other)
 	{
-		length_ = other.length_;
-		alloc_ = other.alloc_;
-		package_ = alloc_.allocate(length_ + 4);
-		std::memcpy(package_, other.package_, other.length_ + 4);
+		if (this == &other) return *this;
+		tcp_package copy(other);
+		return *this = std::move(copy);
 	}
 
 	// unauthenticated ctor
@@ -171,18 +262,9 @@ public:
 	{
 		if ((char)flags & (char)tcp_flags::authenticated) return;
 
-		length_ = 18 + length; // command, flag, correlation id, message
-		package_ = (std::byte*)alloc_.allocate(length_ + 4);
-		// write length of message
-		*reinterpret_cast<int*>(&package_[kLengthOffset]) = (unsigned int)length_;
-		// write command
-		*reinterpret_cast<tcp_command*>(&package_[kCommandOffset]) = command;
-		// write flags
-		*reinterpret_cast<tcp_flags*>(&package_[kFlagsOffset]) = flags;
-		// write correlation id
-		std::memcpy(&package_[kCorrelationOffset], correlation_id.data(), correlation_id.size());
+		std::byte* body = allocate_frame(command, flags, correlation_id, nullptr, nullptr, length);
 		// write message
-		std::memcpy(&package_[kMandatorySize], message, length);
+		if (length != 0) std::memcpy(body, message, length);
 	}
 
 	explicit tcp_package(
@@ -200,28 +282,9 @@ public:
 	{
 		if (!((char)flags & (char)tcp_flags::authenticated)) return;
 
-		// command, flag, correlation id, login_size, login, password_size, password, message
-		length_ = 18 + 1 + login.size() + 1 + password.size() + length;
-		package_ = (std::byte*)alloc_.allocate(length_ + 4);
-		// write length of message
-		*reinterpret_cast<int*>(&package_[kLengthOffset]) = (unsigned int)length_;
-		// write command
-		*reinterpret_cast<tcp_command*>(&package_[kCommandOffset]) = command;
-		// write flags
-		*reinterpret_cast<tcp_flags*>(&package_[kFlagsOffset]) = flags;
-		// write correlation id
-		std::memcpy(&package_[kCorrelationOffset], correlation_id.data(), correlation_id.size());
-		// write login_size + login
-		*reinterpret_cast<std::uint8_t*>(&package_[kAuthOffset]) = (std::uint8_t)login.size();
-		std::memcpy(&package_[kAuthOffset + 1], login.data(), login.size());
-		// write password_size + password
-		auto password_size_offset = kAuthOffset + 1 + login.size();
-		*reinterpret_cast<std::uint8_t*>(&package_[password_size_offset]) = static_cast<std::uint8_t>(password.size());
-		std::memcpy(&package_[password_size_offset + 1], password.data(), password.size());
-
+		std::byte* body = allocate_frame(command, flags, correlation_id, &login, &password, length);
 		// write message
-		auto message_offset = password_size_offset + 1 + password.size();
-		std::memcpy(&package_[message_offset], message, length);
+		if (length != 0) std::memcpy(body, message, length);
 	}
 
 	// authenticated ctor
@@ -238,6 +301,110 @@ public:
 		: tcp_package(command, flags, std::string_view((char*)correlation_id.data, correlation_id.size()), login, password, message, length, alloc)
 	{}
 
+	// unauthenticated ctor, serializes message straight into the frame
+	explicit tcp_package(
+		tcp_command command,
+		tcp_flags flags,
+		guid_type const& correlation_id,
+		google::protobuf::MessageLite const& message,
+		Allocator alloc = Allocator()
+	) : package_(nullptr),
+		length_(0),
+		alloc_(alloc)
+	{
+		if ((char)flags & (char)tcp_flags::authenticated) return;
+
+		serialize_frame(command, flags, correlation_id, nullptr, nullptr, message);
+	}
+
+	// authenticated ctor, serializes message straight into the frame
+	explicit tcp_package(
+		tcp_command command,
+		tcp_flags flags,
+		guid_type const& correlation_id,
+		std::string const& login,
+		std::string const& password,
+		google::protobuf::MessageLite const& message,
+		Allocator alloc = Allocator()
+	) : package_(nullptr),
+		length_(0),
+		alloc_(alloc)
+	{
+		if (!((char)flags & (char)tcp_flags::authenticated)) return;
+
+		serialize_frame(command, flags, correlation_id, &login, &password, message);
+	}
+
+	// unauthenticated ctor, the message's external buffers are referenced, not copied
+	explicit tcp_package(
+		tcp_command command,
+		tcp_flags flags,
+		guid_type const& correlation_id,
+		gather_message&& message,
+		Allocator alloc = Allocator()
+	) : package_(nullptr),
+		length_(0),
+		alloc_(alloc)
+	{
+		if ((char)flags & (char)tcp_flags::authenticated) return;
+
+		gather_frame(command, flags, correlation_id, nullptr, nullptr, std::move(message));
+	}
+
+	// authenticated ctor, the message's external buffers are referenced, not copied
+	explicit tcp_package(
+		tcp_command command,
+		tcp_flags flags,
+		guid_type const& correlation_id,
+		std::string const& login,
+		std::string const& password,
+		gather_message&& message,
+		Allocator alloc = Allocator()
+	) : package_(nullptr),
+		length_(0),
+		alloc_(alloc)
+	{
+		if (!((char)flags & (char)tcp_flags::authenticated)) return;
+
+		gather_frame(command, flags, correlation_id, &login, &password, std::move(message));
+	}
+
+	// unauthenticated ctor, encodes message straight into the frame
+	template <class Encoder, class = std::enable_if_t<is_message_encoder<Encoder>::value>>
+	explicit tcp_package(
+		tcp_command command,
+		tcp_flags flags,
+		guid_type const& correlation_id,
+		Encoder const& message,
+		Allocator alloc = Allocator()
+	) : package_(nullptr),
+		length_(0),
+		alloc_(alloc)
+	{
+		if ((char)flags & (char)tcp_flags::authenticated) return;
+
+		encode_frame(command, flags, correlation_id, nullptr, nullptr, message);
+	}
+
+	// authenticated ctor, encodes message straight into the frame
+	template <class Encoder, class = std::enable_if_t<is_message_encoder<Encoder>::value>>
+	explicit tcp_package(
+		tcp_command command,
+		tcp_flags flags,
+		guid_type const& correlation_id,
+		std::string const& login,
+		std::string const& password,
+		Encoder const& message,
+		Allocator alloc = Allocator()
+	) : package_(nullptr),
+		length_(0),
+		alloc_(alloc)
+	{
+		if (!((char)flags & (char)tcp_flags::authenticated)) return;
+
+		encode_frame(command, flags, correlation_id, &login, &password, message);
+	}
+
 	void change_length_endianness()
 	{
 		std::swap(package_[0], package_[3]);
@@ -245,21 +412,165 @@ public:
 	}
 	bool is_valid() const { return package_ != nullptr && length_ >= 18 && is_header_valid(); }
 	bool is_header_valid() const { return *reinterpret_cast<int*>(&package_[kLengthOffset]) == static_cast<int>(length_); }
+	// the package's own bytes, the whole frame unless it refers to external buffers
 	char* data() { return (char*)package_; }
+	// size of the whole frame
 	std::size_t size() const { return length_ + 4; }
+	bool is_contiguous() const { return external_ == nullptr; }
+	allocator_type const& get_allocator() const { return alloc_; }
+
+	// appends the buffers to write for this package, in order
+	void append_buffers(std::vector<boost::asio::const_buffer>& buffers) const
+	{
+		if (external_ == nullptr)
+		{
+			buffers.emplace_back(package_, length_ + 4);
+			return;
+		}
+
+		std::size_t offset = 0;
+		for (auto const& segment : external_->segments)
+		{
+			if (segment.offset > offset) buffers.emplace_back(package_ + offset, segment.offset - offset);
+			buffers.push_back(segment.buffer);
+			offset = segment.offset;
+		}
+		if (offset < allocated_size()) buffers.emplace_back(package_ + offset, allocated_size() - offset);
+	}
 	
-	// explicit conversion
-	explicit operator tcp_package_view() const { return tcp_package_view(package_, length_ + 4); }
+	// explicit conversion, with external buffers the view only spans the owned bytes preceding the
+	// first external buffer, the header and the start of the message, so its size() is not the frame's
+	explicit operator tcp_package_view() const
+	{
+		if (external_ == nullptr) return tcp_package_view(package_, length_ + 4);
+		return tcp_package_view(package_, external_->segments.front().offset);
+	}
 
 	~tcp_package()
 	{
 		if (package_ != nullptr)
-			alloc_.deallocate(package_, length_ + 4);
+			alloc_.deallocate(package_, allocated_size());
 	}
 private:
-	std::byte* package_;
-	std::size_t length_;
+	// allocates the whole frame and writes everything but the message, returns where the message goes,
+	// login and password are only written for authenticated packages
+	std::byte* allocate_frame(
+		tcp_command command,
+		tcp_flags flags,
+		std::string_view correlation_id,
+		std::string const* login,
+		std::string const* password,
+		std::size_t message_length,
+		std::size_t external_length = 0
+	)
+	{
+		std::size_t auth_length = login == nullptr ? 0 : 1 + login->size() + 1 + password->size();
+
+		// command, flag, correlation id, [login_size, login, password_size, password], message
+		length_ = 18 + auth_length + message_length + external_length;
+		package_ = (std::byte*)alloc_.allocate(length_ + 4 - external_length);
+		// write length of message
+		*reinterpret_cast<int*>(&package_[kLengthOffset]) = (unsigned int)length_;
+		// write command
+		*reinterpret_cast<tcp_command*>(&package_[kCommandOffset]) = command;
+		// write flags
+		*reinterpret_cast<tcp_flags*>(&package_[kFlagsOffset]) = flags;
+		// write correlation id
+		std::memcpy(&package_[kCorrelationOffset], correlation_id.data(), correlation_id.size());
+
+		if (login == nullptr) return &package_[kMandatorySize];
+
+		// write login_size + login
+		*reinterpret_cast<std::uint8_t*>(&package_[kAuthOffset]) = (std::uint8_t)login->size();
+		std::memcpy(&package_[kAuthOffset + 1], login->data(), login->size());
+		// write password_size + password
+		auto password_size_offset = kAuthOffset + 1 + login->size();
+		*reinterpret_cast<std::uint8_t*>(&package_[password_size_offset]) = static_cast<std::uint8_t>(password->size());
+		std::memcpy(&package_[password_size_offset + 1], password->data(), password->size());
+
+		return &package_[password_size_offset + 1 + password->size()];
+	}
+
+	// ByteSizeLong() caches the sizes of nested messages, the message is then written
+	// in place without an intermediate string
+	void serialize_frame(
+		tcp_command command,
+		tcp_flags flags,
+		guid_type const& correlation_id,
+		std::string const* login,
+		std::string const* password,
+		google::protobuf::MessageLite const& message
+	)
+	{
+		std::size_t const message_length = message.ByteSizeLong();
+		std::byte* body = allocate_frame(
+			command,
+			flags,
+			std::string_view((char*)correlation_id.data, correlation_id.size()),
+			login,
+			password,
+			message_length
+		);
+		message.SerializeWithCachedSizesToArray(reinterpret_cast<std::uint8_t*>(body));
+	}
+
+	template <class Encoder>
+	void encode_frame(
+		tcp_command command,
+		tcp_flags flags,
+		guid_type const& correlation_id,
+		std::string const* login,
+		std::string const* password,
+		Encoder const& message
+	)
+	{
+		std::size_t const message_length = message.size();
+		std::byte* body = allocate_frame(
+			command,
+			flags,
+			std::string_view((char*)correlation_id.data, correlation_id.size()),
+			login,
+			password,
+			message_length
+		);
+		message.encode(reinterpret_cast<std::uint8_t*>(body));
+	}
+
+	void gather_frame(
+		tcp_command command,
+		tcp_flags flags,
+		guid_type const& correlation_id,
+		std::string const* login,
+		std::string const* password,
+		gather_message&& message
+	)
+	{
+		auto& external = message.external();
+		std::byte* body = allocate_frame(
+			command,
+			flags,
+			std::string_view((char*)correlation_id.data, correlation_id.size()),
+			login,
+			password,
+			message.inline_size(),
+			external.size
+		);
+		if (message.inline_size() != 0) std::memcpy(body, message.inline_data(), message.inline_size());
+
+		if (external.segments.empty()) return;
+
+		// external buffers are placed relative to the start of the frame
+		std::size_t const body_offset = static_cast<std::size_t>(body - package_);
+		for (auto& segment : external.segments) segment.offset += body_offset;
+		external_ = std::make_shared<external_buffers const>(std::move(external));
+	}
+
+	std::size_t allocated_size() const { return length_ + 4 - (external_ == nullptr ? 0 : external_->size); }
+
+	std::byte* package_ = nullptr;
+	std::size_t length_ = 0;
 	Allocator alloc_;
+	std::shared_ptr<external_buffers const> external_;
 };
 
 } // detail
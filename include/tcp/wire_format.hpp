@@ -0,0 +1,191 @@
+#pragma once
+
+#ifndef ES_WIRE_FORMAT_HPP
+#define ES_WIRE_FORMAT_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <string_view>
+
+namespace es {
+namespace detail {
+namespace tcp {
+
+/*
+	Minimal protobuf wire format reader and writer. The reader peeks at a single
+	field of a serialized message (a result code, a stream id) without parsing
+	all of it, the writer encodes messages whose payloads are not copied.
+*/
+
+inline bool read_varint(std::byte const*& it, std::byte const* end, std::uint64_t& value)
+{
+	value = 0;
+	for (int shift = 0; shift < 64 && it != end; shift += 7)
+	{
+		auto byte = static_cast<std::uint8_t>(*it++);
+		value |= std::uint64_t(byte & 0x7F) << shift;
+		if ((byte & 0x80) == 0) return true;
+	}
+	return false;
+}
+
+// calls f(field_number, wire_type, value, payload) for each top-level field until f returns true,
+// value is the varint value or the payload length, payload points to length delimited content,
+// returns false if the message is malformed
+template <class FieldVisitor>
+bool visit_fields(std::byte const* data, std::size_t size, FieldVisitor&& f)
+{
+	std::byte const* it = data;
+	std::byte const* end = data + size;
+
+	while (it != end)
+	{
+		std::uint64_t tag;
+		if (!read_varint(it, end, tag)) return false;
+
+		std::uint32_t const field_number = static_cast<std::uint32_t>(tag >> 3);
+		std::uint32_t const wire_type = static_cast<std::uint32_t>(tag & 0x7);
+		std::uint64_t value = 0;
+		std::byte const* payload = nullptr;
+
+		switch (wire_type)
+		{
+		case 0: // varint
+			if (!read_varint(it, end, value)) return false;
+			break;
+		case 1: // 64 bits
+			if (end - it < 8) return false;
+			it += 8;
+			break;
+		case 2: // length delimited
+			if (!read_varint(it, end, value) || static_cast<std::uint64_t>(end - it) < value) return false;
+			payload = it;
+			it += value;
+			break;
+		case 5: // 32 bits
+			if (end - it < 4) return false;
+			it += 4;
+			break;
+		default:
+			return false;
+		}
+
+		if (f(field_number, wire_type, value, payload)) return true;
+	}
+
+	return true;
+}
+
+// reads a varint field of a serialized protobuf message without parsing the whole message,
+// returns nothing if the field is absent or the message is malformed
+inline std::optional<std::uint64_t> find_varint_field(std::byte const* data, std::size_t size, std::uint32_t field_number)
+{
+	std::optional<std::uint64_t> result;
+	bool well_formed = visit_fields(data, size, [&result, field_number](std::uint32_t field, std::uint32_t wire_type, std::uint64_t value, std::byte const*)
+	{
+		if (field != field_number || wire_type != 0) return false;
+		result = value;
+		return true;
+	});
+	return well_formed ? result : std::nullopt;
+}
+
+// same as find_varint_field for string and bytes fields, the view points into data
+inline std::optional<std::string_view> find_bytes_field(std::byte const* data, std::size_t size, std::uint32_t field_number)
+{
+	std::optional<std::string_view> result;
+	bool well_formed = visit_fields(data, size, [&result, field_number](std::uint32_t field, std::uint32_t wire_type, std::uint64_t length, std::byte const* payload)
+	{
+		if (field != field_number || wire_type != 2) return false;
+		result = std::string_view(reinterpret_cast<char const*>(payload), static_cast<std::size_t>(length));
+		return true;
+	});
+	return well_formed ? result : std::nullopt;
+}
+
+// writers, the caller makes sure out has room for what is written
+
+enum class wire_type : std::uint32_t
+{
+	varint = 0,
+	fixed64 = 1,
+	length_delimited = 2,
+	fixed32 = 5
+};
+
+constexpr std::size_t varint_size(std::uint64_t value)
+{
+	std::size_t size = 1;
+	while (value >= 0x80)
+	{
+		value >>= 7;
+		++size;
+	}
+	return size;
+}
+
+constexpr std::size_t tag_size(std::uint32_t field_number) { return varint_size(std::uint64_t(field_number) << 3); }
+
+inline std::uint8_t* write_varint(std::uint8_t* out, std::uint64_t value)
+{
+	while (value >= 0x80)
+	{
+		*out++ = static_cast<std::uint8_t>(value | 0x80);
+		value >>= 7;
+	}
+	*out++ = static_cast<std::uint8_t>(value);
+	return out;
+}
+
+inline std::uint8_t* write_tag(std::uint8_t* out, std::uint32_t field_number, wire_type type)
+{
+	return write_varint(out, (std::uint64_t(field_number) << 3) | static_cast<std::uint32_t>(type));
+}
+
+// negative int32 and int64 values are sign extended to 10 bytes, like protobuf does
+inline std::uint8_t* write_int64_field(std::uint8_t* out, std::uint32_t field_number, std::int64_t value)
+{
+	out = write_tag(out, field_number, wire_type::varint);
+	return write_varint(out, static_cast<std::uint64_t>(value));
+}
+
+inline std::uint8_t* write_bool_field(std::uint8_t* out, std::uint32_t field_number, bool value)
+{
+	out = write_tag(out, field_number, wire_type::varint);
+	*out++ = value ? 1 : 0;
+	return out;
+}
+
+// writes the tag and length of a length delimited field, the content follows
+inline std::uint8_t* write_length_delimited_header(std::uint8_t* out, std::uint32_t field_number, std::size_t length)
+{
+	out = write_tag(out, field_number, wire_type::length_delimited);
+	return write_varint(out, length);
+}
+
+inline std::uint8_t* write_bytes_field(std::uint8_t* out, std::uint32_t field_number, void const* data, std::size_t length)
+{
+	out = write_length_delimited_header(out, field_number, length);
+	if (length != 0) std::memcpy(out, data, length);
+	return out + length;
+}
+
+constexpr std::size_t int64_field_size(std::uint32_t field_number, std::int64_t value)
+{
+	return tag_size(field_number) + varint_size(static_cast<std::uint64_t>(value));
+}
+
+constexpr std::size_t bool_field_size(std::uint32_t field_number) { return tag_size(field_number) + 1; }
+
+constexpr std::size_t length_delimited_field_size(std::uint32_t field_number, std::size_t length)
+{
+	return tag_size(field_number) + varint_size(length) + length;
+}
+
+} // tcp
+} // detail
+} // es
+
+#endif // ES_WIRE_FORMAT_HPP
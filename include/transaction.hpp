@@ -38,7 +38,7 @@ public:
 		{
 			// call the handler with the error
 			boost::asio::post(
-				connection_->get_io_context(),
+				connection_->get_executor(),
 				[ec = ec, handler = std::move(handler)]() { handler(ec, {}); }
 			);
 
@@ -69,7 +69,7 @@ public:
 		{
 			// call the handler with the error
 			boost::asio::post(
-				connection_->get_io_context(),
+				connection_->get_executor(),
 				[ec = ec, handler = std::move(handler)]() { handler(ec); }
 			);
 
@@ -7,6 +7,9 @@
 
 #include "guid.hpp"
 #include "error/error.hpp"
+#include "event_data_view.hpp"
+#include "tcp/decode_arena.hpp"
+#include "tcp/encoders.hpp"
 #include "tcp/tcp_package.hpp"
 
 namespace es {
@@ -24,62 +27,74 @@ void async_transactional_write(
 		"TransactionalWriteHandler requirements not met, must have signature R(boost::system::error_code)"
 	);
 
-	message::TransactionWrite request;
-	request.set_transaction_id(transaction_id);
-	request.set_require_master(connection->settings().require_master());
-
-	auto it = std::begin(events);
-	auto end = std::end(events);
+	auto corr_id = es::guid();
+	auto const& credentials = connection->settings().default_user_credentials();
 
-	for (; it != end; ++it)
+	auto make_package = [&connection, &corr_id, &credentials](auto&& request)
 	{
-		auto* new_event = request.add_events();
-		if constexpr (std::is_same_v<es::guid_type, std::decay_t<decltype(it->event_id())>>)
-		{
-			new_event->set_event_id(it->event_id().data, it->event_id().size());
-		}
-		else
+		if (credentials.null())
 		{
-			new_event->set_event_id(std::move(it->event_id()));
+			return detail::tcp::tcp_package<>(
+				detail::tcp::tcp_command::transaction_write,
+				detail::tcp::tcp_flags::none,
+				corr_id,
+				std::forward<decltype(request)>(request),
+				connection->package_allocator()
+			);
 		}
 
-		// we just try to move to prevent copying
-		new_event->set_event_type(std::move(it->type()));
-		new_event->set_data_content_type(it->is_json() ? 1 : 0);
-		new_event->set_metadata_content_type(0); // see .NET client api
-		new_event->set_data(std::move(it->content()));
-		if (it->metadata().has_value())
-		{
-			new_event->set_metadata(std::move(it->metadata().value()));
-		}
-	}
-
-	auto serialized = request.SerializeAsString();
-	auto corr_id = es::guid();
+		return detail::tcp::tcp_package<>(
+			detail::tcp::tcp_command::transaction_write,
+			detail::tcp::tcp_flags::authenticated,
+			corr_id,
+			credentials.username(),
+			credentials.password(),
+			std::forward<decltype(request)>(request),
+			connection->package_allocator()
+		);
+	};
 
 	detail::tcp::tcp_package<> package;
 
-	if (connection->settings().default_user_credentials().null())
+	using event_type = std::decay_t<decltype(*std::begin(events))>;
+
+	if constexpr (std::is_same_v<event_type, event_data> || std::is_same_v<event_type, event_data_view>)
 	{
-		package = std::move(detail::tcp::tcp_package<>(
-			detail::tcp::tcp_command::transaction_write,
-			detail::tcp::tcp_flags::none,
-			corr_id,
-			(std::byte*)serialized.data(),
-			serialized.size()
-			));
+		package = make_package(detail::tcp::transaction_write_encoder(transaction_id, connection->settings().require_master(), events));
 	}
 	else
 	{
-		package = std::move(detail::tcp::tcp_package<>(
-			detail::tcp::tcp_command::transaction_write,
-			detail::tcp::tcp_flags::authenticated,
-			corr_id,
-			connection->settings().default_user_credentials().username(),
-			connection->settings().default_user_credentials().password(),
-			(std::byte*)serialized.data(),
-			serialized.size()
-			));
+		message::TransactionWrite request;
+		request.set_transaction_id(transaction_id);
+		request.set_require_master(connection->settings().require_master());
+
+		auto it = std::begin(events);
+		auto end = std::end(events);
+
+		for (; it != end; ++it)
+		{
+			auto* new_event = request.add_events();
+			if constexpr (std::is_same_v<es::guid_type, std::decay_t<decltype(it->event_id())>>)
+			{
+				new_event->set_event_id(it->event_id().data, it->event_id().size());
+			}
+			else
+			{
+				new_event->set_event_id(std::move(it->event_id()));
+			}
+
+			// we just try to move to prevent copying
+			new_event->set_event_type(std::move(it->type()));
+			new_event->set_data_content_type(it->is_json() ? 1 : 0);
+			new_event->set_metadata_content_type(0); // see .NET client api
+			new_event->set_data(std::move(it->content()));
+			if (it->metadata().has_value())
+			{
+				new_event->set_metadata(std::move(it->metadata().value()));
+			}
+		}
+
+		package = make_package(request);
 	}
 
 	connection->async_send(
@@ -98,21 +113,17 @@ void async_transactional_write(
 				return;
 			}
 
-			message::TransactionWriteCompleted response;
-			response.ParseFromArray(view.data() + view.message_offset(), view.message_size());
+			auto& response = detail::tcp::decode<message::TransactionWriteCompleted>(view);
 
 			switch (response.result())
 			{
 			case message::OperationResult::Success:
 				break;
 			case message::OperationResult::PrepareTimeout:
-				// retry
-				break;
 			case message::OperationResult::CommitTimeout:
-				// retry
-				break;
 			case message::OperationResult::ForwardTimeout:
-				// retry
+				// the connection retries these, they only get here once retries are exhausted
+				ec = make_error_code(connection_errors::max_operation_retries);
 				break;
 			case message::OperationResult::AccessDenied:
 				ec = make_error_code(stream_errors::access_denied);
@@ -16,6 +16,7 @@ Add user credentials parameter to have authentication per request
 #include "guid.hpp"
 #include "persistent_subscription_settings.hpp"
 #include "error/error.hpp"
+#include "tcp/decode_arena.hpp"
 #include "tcp/tcp_package.hpp"
 
 namespace es {
@@ -52,7 +53,6 @@ void async_update_persistent_subscription(
 	request.set_subscriber_max_count(settings.max_subscriber_count());
 	request.set_subscription_group_name(std::string(group));
 
-	auto serialized = request.SerializeAsString();
 	auto corr_id = es::guid();
 	detail::tcp::tcp_package<> package;
 
@@ -62,8 +62,8 @@ void async_update_persistent_subscription(
 			detail::tcp::tcp_command::update_persistent_subscription,
 			detail::tcp::tcp_flags::none,
 			corr_id,
-			(std::byte*)serialized.data(),
-			serialized.size()
+			request,
+			connection->package_allocator()
 			));
 	}
 	else
@@ -74,8 +74,8 @@ void async_update_persistent_subscription(
 			corr_id,
 			connection->settings().default_user_credentials().username(),
 			connection->settings().default_user_credentials().password(),
-			(std::byte*)serialized.data(),
-			serialized.size()
+			request,
+			connection->package_allocator()
 			));
 	}
 
@@ -95,8 +95,7 @@ void async_update_persistent_subscription(
 			return;
 		}
 
-		message::UpdatePersistentSubscriptionCompleted response;
-		response.ParseFromArray(view.data() + view.message_offset(), view.message_size());
+		auto& response = detail::tcp::decode<message::UpdatePersistentSubscriptionCompleted>(view);
 
 		switch (response.result())
 		{
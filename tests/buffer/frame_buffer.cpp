@@ -0,0 +1,61 @@
+#include <catch2/catch.hpp>
+
+#include <cstring>
+
+#include "buffer/frame_buffer.hpp"
+
+TEST_CASE("frame_buffer keeps received bytes contiguous", "[buffer][frame_buffer]")
+{
+	es::buffer::frame_buffer buffer{ 64 };
+
+	auto receive = [&buffer](const char* bytes, std::size_t size, std::size_t min_size)
+	{
+		auto tail = buffer.prepare(min_size);
+		REQUIRE(tail.size() >= min_size);
+		std::memcpy(tail.data(), bytes, size);
+		buffer.commit(size);
+	};
+
+	SECTION("consuming everything rewinds the buffer without moving bytes")
+	{
+		receive("0123456789", 10, 10);
+		auto* first = buffer.data();
+		buffer.consume(10);
+		REQUIRE(buffer.size() == 0);
+
+		receive("abc", 3, 10);
+		REQUIRE(buffer.data() == first);
+		REQUIRE(std::memcmp(buffer.data(), "abc", 3) == 0);
+	}
+	SECTION("the pending partial frame is moved to the front when the tail is too small")
+	{
+		receive("0123456789012345678901234567890123456789012345678901234567", 58, 58);
+		buffer.consume(50);
+		REQUIRE(buffer.size() == 8);
+
+		// only 6 bytes left in tail, asking for 10 compacts the pending bytes
+		receive("abcdefghij", 10, 10);
+		REQUIRE(buffer.size() == 18);
+		REQUIRE(buffer.capacity() == 64);
+		REQUIRE(std::memcmp(buffer.data(), "01234567abcdefghij", 18) == 0);
+	}
+	SECTION("the buffer grows to fit frames larger than its capacity")
+	{
+		receive("0123", 4, 4);
+		buffer.prepare(100);
+		REQUIRE(buffer.capacity() >= 104);
+		REQUIRE(std::memcmp(buffer.data(), "0123", 4) == 0);
+	}
+	SECTION("a slab referenced through a handle is never overwritten")
+	{
+		receive("0123456789", 10, 10);
+		auto handle = buffer.handle();
+		auto* retained = buffer.data();
+		buffer.consume(10);
+
+		receive("abcdefghij", 10, 60);
+		REQUIRE(std::memcmp(retained, "0123456789", 10) == 0);
+		REQUIRE(std::memcmp(buffer.data(), "abcdefghij", 10) == 0);
+		REQUIRE(buffer.handle() != handle);
+	}
+}
@@ -0,0 +1,762 @@
+#include <catch2/catch.hpp>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <functional>
+#include <future>
+#include <memory>
+#include <optional>
+#include <thread>
+#include <vector>
+
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/ip/tcp.hpp>
+#include <boost/asio/steady_timer.hpp>
+#include <boost/asio/read.hpp>
+#include <boost/asio/write.hpp>
+
+#include "message/messages.pb.h"
+
+#include "guid.hpp"
+#include "operations_map.hpp"
+#include "connection_settings.hpp"
+#include "shared_event_data.hpp"
+#include "connection/basic_tcp_connection.hpp"
+#include "tcp/discovery_service.hpp"
+#include "tcp/encoders.hpp"
+#include "tcp/tcp_package.hpp"
+
+TEST_CASE("basic_tcp_connection coalesces queued packages into vectored writes", "[connection][send]")
+{
+	using connection_type = es::connection::basic_tcp_connection<
+		boost::asio::steady_timer,
+		es::tcp::services::discovery_service,
+		es::operation<>
+	>;
+	using tcp_package = es::detail::tcp::tcp_package<>;
+
+	boost::asio::io_context ioc;
+	boost::asio::ip::tcp::acceptor acceptor{ ioc, boost::asio::ip::tcp::endpoint(boost::asio::ip::make_address_v4("127.0.0.1"), 0) };
+	boost::asio::ip::tcp::socket server_socket{ ioc };
+
+	const int package_count = 100;
+	const std::size_t package_size = tcp_package(es::detail::tcp::tcp_command::heartbeat_request_command, es::detail::tcp::tcp_flags::none, es::guid()).size();
+
+	auto send_and_receive = [&](es::connection_settings const& settings) -> es::connection::send_statistics
+	{
+		std::vector<std::uint8_t> buffer_storage;
+		auto conn = std::make_shared<connection_type>(ioc, settings, boost::asio::dynamic_buffer(buffer_storage));
+
+		acceptor.async_accept(server_socket, [](boost::system::error_code ec) { REQUIRE(!ec); });
+		conn->socket().connect(acceptor.local_endpoint());
+		ioc.run();
+		ioc.restart();
+
+		for (int i = 0; i < package_count; ++i)
+		{
+			conn->async_send(tcp_package(es::detail::tcp::tcp_command::heartbeat_request_command, es::detail::tcp::tcp_flags::none, es::guid()));
+		}
+
+		std::vector<std::uint8_t> received(package_count * package_size);
+		boost::asio::async_read(server_socket, boost::asio::buffer(received), [](boost::system::error_code ec, std::size_t) { REQUIRE(!ec); });
+		ioc.run();
+		ioc.restart();
+
+		server_socket.close();
+		return conn->statistics();
+	};
+
+	SECTION("every queued package is written with a single write")
+	{
+		auto stats = send_and_receive(es::connection_settings_builder().build());
+
+		REQUIRE(stats.packages() == package_count);
+		REQUIRE(stats.bytes() == package_count * package_size);
+		// the first package starts the send loop, the rest are queued while it is being written
+		REQUIRE(stats.batches() == 2);
+		REQUIRE(stats.max_batch_size() == package_count - 1);
+	}
+	SECTION("write batches are capped by package count")
+	{
+		auto stats = send_and_receive(es::connection_settings_builder().with_max_write_batch(10, 1024 * 1024).build());
+
+		REQUIRE(stats.packages() == package_count);
+		REQUIRE(stats.batches() == 1 + (package_count - 1 + 9) / 10);
+		REQUIRE(stats.max_batch_size() == 10);
+	}
+	SECTION("write batches are capped by bytes, but always write at least one package")
+	{
+		auto stats = send_and_receive(es::connection_settings_builder().with_max_write_batch(1024, 1).build());
+
+		REQUIRE(stats.packages() == package_count);
+		REQUIRE(stats.batches() == package_count);
+		REQUIRE(stats.max_batch_size() == 1);
+	}
+}
+
+TEST_CASE("basic_tcp_connection times out operations that get no response", "[connection][timeout]")
+{
+	using connection_type = es::connection::basic_tcp_connection<
+		boost::asio::steady_timer,
+		es::tcp::services::discovery_service,
+		es::operation<>
+	>;
+	using tcp_package = es::detail::tcp::tcp_package<>;
+
+	boost::asio::io_context ioc;
+	boost::asio::ip::tcp::acceptor acceptor{ ioc, boost::asio::ip::tcp::endpoint(boost::asio::ip::make_address_v4("127.0.0.1"), 0) };
+	boost::asio::ip::tcp::socket server_socket{ ioc };
+
+	auto settings = es::connection_settings_builder()
+		.with_operation_timeout(std::chrono::seconds(1))
+		.with_operation_timeout_check_period(std::chrono::seconds(1))
+		.build();
+
+	std::vector<std::uint8_t> buffer_storage;
+	auto conn = std::make_shared<connection_type>(ioc, settings, boost::asio::dynamic_buffer(buffer_storage));
+
+	acceptor.async_accept(server_socket, [](boost::system::error_code ec) { REQUIRE(!ec); });
+	conn->socket().connect(acceptor.local_endpoint());
+	ioc.run();
+	ioc.restart();
+
+	// the server never answers
+	int timeouts = 0;
+	for (int i = 0; i < 10; ++i)
+	{
+		conn->async_send(
+			tcp_package(es::detail::tcp::tcp_command::ping, es::detail::tcp::tcp_flags::none, es::guid()),
+			[&timeouts](boost::system::error_code ec, es::detail::tcp::tcp_package_view)
+		{
+			if (ec == es::connection_errors::operation_timeout) ++timeouts;
+		}
+		);
+	}
+
+	auto start = std::chrono::steady_clock::now();
+	// the sweep timer is the only pending work once every operation timed out
+	ioc.run();
+	auto elapsed = std::chrono::steady_clock::now() - start;
+
+	REQUIRE(timeouts == 10);
+	REQUIRE(elapsed >= std::chrono::seconds(1));
+	REQUIRE(elapsed < std::chrono::seconds(3));
+}
+
+TEST_CASE("basic_tcp_connection times out an operation being written once the write is over", "[connection][timeout]")
+{
+	using connection_type = es::connection::basic_tcp_connection<
+		boost::asio::steady_timer,
+		es::tcp::services::discovery_service,
+		es::operation<>
+	>;
+	using tcp_package = es::detail::tcp::tcp_package<>;
+
+	boost::asio::io_context ioc;
+	boost::asio::ip::tcp::acceptor acceptor{ ioc, boost::asio::ip::tcp::endpoint(boost::asio::ip::make_address_v4("127.0.0.1"), 0) };
+	boost::asio::ip::tcp::socket server_socket{ ioc };
+
+	auto settings = es::connection_settings_builder()
+		.with_operation_timeout(std::chrono::seconds(1))
+		.with_operation_timeout_check_period(std::chrono::seconds(1))
+		.build();
+
+	std::vector<std::uint8_t> buffer_storage;
+	auto conn = std::make_shared<connection_type>(ioc, settings, boost::asio::dynamic_buffer(buffer_storage));
+
+	acceptor.async_accept(server_socket, [](boost::system::error_code ec) { REQUIRE(!ec); });
+	conn->socket().connect(acceptor.local_endpoint());
+	ioc.run();
+	ioc.restart();
+
+	// the server never reads, so the socket's buffers fill up and the write of the borrowed payload stays pending
+	std::vector<std::uint8_t> borrowed(64 * 1024 * 1024, 7);
+	std::vector<es::shared_event_data> events{
+		es::shared_event_data{ es::guid(), "Test.Type", false, es::shared_payload::borrow(borrowed.data(), borrowed.size()) }
+	};
+	es::detail::tcp::gather_message request;
+	es::detail::tcp::encode_write_events(request, "borrowed-stream", -2, true, events);
+
+	std::optional<boost::system::error_code> written_result;
+	conn->async_send(
+		tcp_package(es::detail::tcp::tcp_command::write_events, es::detail::tcp::tcp_flags::none, es::guid(), std::move(request)),
+		[&written_result](boost::system::error_code ec, es::detail::tcp::tcp_package_view) { written_result = ec; }
+	);
+	// queued behind the write, it is never sent
+	std::optional<boost::system::error_code> queued_result;
+	conn->async_send(
+		tcp_package(es::detail::tcp::tcp_command::ping, es::detail::tcp::tcp_flags::none, es::guid()),
+		[&queued_result](boost::system::error_code ec, es::detail::tcp::tcp_package_view) { queued_result = ec; }
+	);
+
+	ioc.run_for(std::chrono::seconds(3));
+	REQUIRE(queued_result == make_error_code(es::connection_errors::operation_timeout));
+	// the payload is still being written, the handler is not called until the connection lets go of it
+	REQUIRE_FALSE(written_result.has_value());
+
+	server_socket.close();
+	ioc.restart();
+	ioc.run();
+	REQUIRE(written_result == make_error_code(es::connection_errors::operation_timeout));
+}
+
+TEST_CASE("basic_tcp_connection bounds the number of operations in flight", "[connection][backpressure]")
+{
+	using connection_type = es::connection::basic_tcp_connection<
+		boost::asio::steady_timer,
+		es::tcp::services::discovery_service,
+		es::operation<>
+	>;
+	using tcp_package = es::detail::tcp::tcp_package<>;
+
+	boost::asio::io_context ioc;
+	boost::asio::ip::tcp::acceptor acceptor{ ioc, boost::asio::ip::tcp::endpoint(boost::asio::ip::make_address_v4("127.0.0.1"), 0) };
+	boost::asio::ip::tcp::socket server_socket{ ioc };
+
+	auto settings = es::connection_settings_builder()
+		.with_max_concurrent_items(2)
+		.with_max_queue_size(3)
+		.build();
+
+	std::vector<std::uint8_t> buffer_storage;
+	auto conn = std::make_shared<connection_type>(ioc, settings, boost::asio::dynamic_buffer(buffer_storage));
+
+	acceptor.async_accept(server_socket, [](boost::system::error_code ec) { REQUIRE(!ec); });
+	conn->socket().connect(acceptor.local_endpoint());
+	ioc.run();
+	ioc.restart();
+
+	// receiving is normally started by the connect operation
+	struct receive_starter : connection_type::friend_base_type<receive_starter> {};
+	receive_starter{}.async_start_receive(*conn);
+
+	int completed = 0;
+	int rejected = 0;
+	for (int i = 0; i < 10; ++i)
+	{
+		conn->async_send(
+			tcp_package(es::detail::tcp::tcp_command::ping, es::detail::tcp::tcp_flags::none, es::guid()),
+			[&](boost::system::error_code ec, es::detail::tcp::tcp_package_view)
+		{
+			if (!ec) ++completed;
+			else if (ec == es::connection_errors::queue_overflow) ++rejected;
+		}
+		);
+	}
+
+	REQUIRE(conn->operations_in_flight() == 2);
+	REQUIRE(conn->pending_operations() == 3);
+
+	// the server answers every ping with a pong carrying the same correlation id
+	const std::size_t package_size = tcp_package(es::detail::tcp::tcp_command::ping, es::detail::tcp::tcp_flags::none, es::guid()).size();
+	std::vector<std::uint8_t> request(package_size);
+	std::function<void()> serve = [&]()
+	{
+		boost::asio::async_read(server_socket, boost::asio::buffer(request), [&](boost::system::error_code ec, std::size_t)
+		{
+			if (ec) return;
+			auto reply = std::make_shared<tcp_package>(
+				es::detail::tcp::tcp_command::pong,
+				es::detail::tcp::tcp_flags::none,
+				es::guid(reinterpret_cast<const char*>(request.data()) + es::detail::tcp::kCorrelationOffset)
+			);
+			boost::asio::async_write(server_socket, boost::asio::buffer(reply->data(), reply->size()), [reply](boost::system::error_code, std::size_t) {});
+			serve();
+		});
+	};
+	serve();
+
+	while (completed + rejected < 10 && ioc.run_one() != 0) {}
+
+	REQUIRE(rejected == 5);
+	REQUIRE(completed == 5);
+	REQUIRE(conn->operations_in_flight() == 0);
+	REQUIRE(conn->pending_operations() == 0);
+}
+
+TEST_CASE("basic_tcp_connection retries operations the server could not handle", "[connection][retry]")
+{
+	using connection_type = es::connection::basic_tcp_connection<
+		boost::asio::steady_timer,
+		es::tcp::services::discovery_service,
+		es::operation<>
+	>;
+	using tcp_package = es::detail::tcp::tcp_package<>;
+	using es::detail::tcp::tcp_command;
+	using es::detail::tcp::tcp_flags;
+
+	boost::asio::io_context ioc;
+	boost::asio::ip::tcp::acceptor acceptor{ ioc, boost::asio::ip::tcp::endpoint(boost::asio::ip::make_address_v4("127.0.0.1"), 0) };
+	boost::asio::ip::tcp::socket server_socket{ ioc };
+
+	auto run = [&](es::connection_settings const& settings, std::function<tcp_package(es::guid_type const&, int)> respond)
+	{
+		std::vector<std::uint8_t> buffer_storage;
+		auto conn = std::make_shared<connection_type>(ioc, settings, boost::asio::dynamic_buffer(buffer_storage));
+
+		acceptor.async_accept(server_socket, [](boost::system::error_code ec) { REQUIRE(!ec); });
+		conn->socket().connect(acceptor.local_endpoint());
+		ioc.run();
+		ioc.restart();
+
+		struct receive_starter : connection_type::friend_base_type<receive_starter> {};
+		receive_starter{}.async_start_receive(*conn);
+
+		auto request_id = es::guid();
+		bool done = false;
+		boost::system::error_code result;
+		conn->async_send(
+			tcp_package(tcp_command::write_events, tcp_flags::none, request_id),
+			[&](boost::system::error_code ec, es::detail::tcp::tcp_package_view) { result = ec; done = true; }
+		);
+
+		// every attempt must reuse the correlation id of the original request
+		int attempts = 0;
+		std::vector<std::uint8_t> request(tcp_package(tcp_command::write_events, tcp_flags::none, request_id).size());
+		std::function<void()> serve = [&]()
+		{
+			boost::asio::async_read(server_socket, boost::asio::buffer(request), [&](boost::system::error_code ec, std::size_t)
+			{
+				if (ec) return;
+				REQUIRE(es::guid(reinterpret_cast<const char*>(request.data()) + es::detail::tcp::kCorrelationOffset) == request_id);
+				auto reply = std::make_shared<tcp_package>(respond(request_id, attempts++));
+				boost::asio::async_write(server_socket, boost::asio::buffer(reply->data(), reply->size()), [reply](boost::system::error_code, std::size_t) {});
+				serve();
+			});
+		};
+		serve();
+
+		while (!done && ioc.run_one() != 0) {}
+
+		server_socket.close();
+		conn->close();
+		ioc.restart();
+		return std::make_pair(result, attempts);
+	};
+
+	auto write_completed = [](es::guid_type const& id, es::message::OperationResult result)
+	{
+		es::message::WriteEventsCompleted response;
+		response.set_result(result);
+		response.set_first_event_number(0);
+		response.set_last_event_number(0);
+		auto body = response.SerializeAsString();
+		return tcp_package(tcp_command::write_events_completed, tcp_flags::none, id, (std::byte*)body.data(), body.size());
+	};
+	auto too_busy = [](es::guid_type const& id)
+	{
+		es::message::NotHandled response;
+		response.set_reason(es::message::NotHandled_NotHandledReason_TooBusy);
+		auto body = response.SerializeAsString();
+		return tcp_package(tcp_command::not_handled, tcp_flags::none, id, (std::byte*)body.data(), body.size());
+	};
+
+	auto settings = es::connection_settings_builder()
+		.with_max_retries(3)
+		.with_retry_delay(std::chrono::milliseconds(1), std::chrono::milliseconds(10))
+		.build();
+
+	SECTION("transient failures are retried until the server succeeds")
+	{
+		auto [ec, attempts] = run(settings, [&](es::guid_type const& id, int attempt)
+		{
+			if (attempt == 0) return write_completed(id, es::message::OperationResult::PrepareTimeout);
+			if (attempt == 1) return too_busy(id);
+			return write_completed(id, es::message::OperationResult::Success);
+		});
+
+		REQUIRE(!ec);
+		REQUIRE(attempts == 3);
+	}
+	SECTION("operations fail once max_retries is reached")
+	{
+		auto [ec, attempts] = run(settings, [&](es::guid_type const& id, int) { return too_busy(id); });
+
+		REQUIRE(ec == es::connection_errors::max_operation_retries);
+		REQUIRE(attempts == 4);
+	}
+	SECTION("definitive results are not retried")
+	{
+		auto [ec, attempts] = run(settings, [&](es::guid_type const& id, int)
+		{
+			return write_completed(id, es::message::OperationResult::WrongExpectedVersion);
+		});
+
+		REQUIRE(!ec);
+		REQUIRE(attempts == 1);
+	}
+}
+
+TEST_CASE("basic_tcp_connection reconnects and sends pending operations again", "[connection][reconnection]")
+{
+	using connection_type = es::connection::basic_tcp_connection<
+		boost::asio::steady_timer,
+		es::tcp::services::discovery_service,
+		es::operation<>
+	>;
+	using tcp_package = es::detail::tcp::tcp_package<>;
+	using es::detail::tcp::tcp_command;
+	using es::detail::tcp::tcp_flags;
+
+	boost::asio::io_context ioc;
+	boost::asio::ip::tcp::acceptor acceptor{ ioc, boost::asio::ip::tcp::endpoint(boost::asio::ip::make_address_v4("127.0.0.1"), 0) };
+	boost::asio::make_service<es::tcp::services::discovery_service>(ioc, acceptor.local_endpoint(), boost::asio::ip::tcp::endpoint(), false);
+
+	// identifies every client, drops the connection on the first write request and answers the next ones
+	struct fake_server
+	{
+		boost::asio::ip::tcp::acceptor& acceptor;
+		boost::asio::ip::tcp::socket socket;
+		std::array<std::uint8_t, 4> header{};
+		std::vector<std::uint8_t> body;
+		int accepted = 0;
+		std::vector<es::guid_type> write_requests;
+
+		void accept()
+		{
+			acceptor.async_accept(socket, [this](boost::system::error_code ec) { if (!ec) { ++accepted; read(); } });
+		}
+
+		void read()
+		{
+			boost::asio::async_read(socket, boost::asio::buffer(header), [this](boost::system::error_code ec, std::size_t)
+			{
+				if (ec) return;
+				std::uint32_t length;
+				std::memcpy(&length, header.data(), 4);
+				body.resize(length);
+				boost::asio::async_read(socket, boost::asio::buffer(body), [this](boost::system::error_code ec, std::size_t)
+				{
+					if (ec) return;
+					on_request(static_cast<tcp_command>(body[0]), es::guid(reinterpret_cast<const char*>(body.data()) + 2));
+				});
+			});
+		}
+
+		void on_request(tcp_command command, es::guid_type id)
+		{
+			if (command == tcp_command::identify_client)
+			{
+				reply(tcp_package(tcp_command::client_identified, tcp_flags::none, id));
+			}
+			else if (command == tcp_command::write_events)
+			{
+				write_requests.push_back(id);
+				if (write_requests.size() == 1)
+				{
+					socket.close();
+					accept();
+					return;
+				}
+
+				es::message::WriteEventsCompleted response;
+				response.set_result(es::message::OperationResult::Success);
+				response.set_first_event_number(0);
+				response.set_last_event_number(0);
+				auto serialized = response.SerializeAsString();
+				reply(tcp_package(tcp_command::write_events_completed, tcp_flags::none, id, (std::byte*)serialized.data(), serialized.size()));
+			}
+			read();
+		}
+
+		void reply(tcp_package&& package)
+		{
+			auto reply = std::make_shared<tcp_package>(std::move(package));
+			boost::asio::async_write(socket, boost::asio::buffer(reply->data(), reply->size()), [reply](boost::system::error_code, std::size_t) {});
+		}
+	};
+
+	fake_server server{ acceptor, boost::asio::ip::tcp::socket{ ioc }, {}, {}, 0, {} };
+	server.accept();
+
+	auto settings = es::connection_settings_builder()
+		.with_reconnection_delay(std::chrono::milliseconds(10))
+		.build();
+
+	std::vector<std::uint8_t> buffer_storage;
+	auto conn = std::make_shared<connection_type>(ioc, settings, boost::asio::dynamic_buffer(buffer_storage));
+
+	auto request_id = es::guid();
+	bool done = false;
+	boost::system::error_code result;
+	tcp_command response_command{};
+
+	conn->async_connect([&](boost::system::error_code ec, std::optional<es::connection_result>)
+	{
+		// no credentials, the connection is usable anyway
+		REQUIRE((!ec || ec == es::connection_errors::authentication_failed));
+		REQUIRE(conn->is_connected());
+		conn->async_send(
+			tcp_package(tcp_command::write_events, tcp_flags::none, request_id),
+			[&](boost::system::error_code ec, es::detail::tcp::tcp_package_view view)
+		{
+			result = ec;
+			if (!ec) response_command = view.command();
+			done = true;
+		}
+		);
+	});
+
+	while (!done && ioc.run_one() != 0) {}
+
+	REQUIRE(!result);
+	REQUIRE(response_command == tcp_command::write_events_completed);
+	REQUIRE(server.accepted == 2);
+	REQUIRE(server.write_requests == std::vector<es::guid_type>{ request_id, request_id });
+	REQUIRE(conn->is_connected());
+	REQUIRE(conn->reconnection_attempt() == 0);
+
+	conn->close();
+	REQUIRE_FALSE(conn->is_connected());
+}
+
+TEST_CASE("basic_tcp_connection follows NotMaster redirects to the advertised master", "[connection][reconnection]")
+{
+	using connection_type = es::connection::basic_tcp_connection<
+		boost::asio::steady_timer,
+		es::tcp::services::discovery_service,
+		es::operation<>
+	>;
+	using tcp_package = es::detail::tcp::tcp_package<>;
+	using es::detail::tcp::tcp_command;
+	using es::detail::tcp::tcp_flags;
+
+	boost::asio::io_context ioc;
+
+	// identifies every client, a slave refuses writes and names the master, the master answers them
+	struct fake_node
+	{
+		boost::asio::ip::tcp::acceptor acceptor;
+		boost::asio::ip::tcp::socket socket;
+		std::optional<boost::asio::ip::tcp::endpoint> master;
+		std::array<std::uint8_t, 4> header{};
+		std::vector<std::uint8_t> body;
+		std::vector<es::guid_type> write_requests;
+
+		fake_node(boost::asio::io_context& ioc)
+			: acceptor(ioc, boost::asio::ip::tcp::endpoint(boost::asio::ip::make_address_v4("127.0.0.1"), 0)), socket(ioc)
+		{}
+
+		void accept()
+		{
+			acceptor.async_accept(socket, [this](boost::system::error_code ec) { if (!ec) read(); });
+		}
+
+		void read()
+		{
+			boost::asio::async_read(socket, boost::asio::buffer(header), [this](boost::system::error_code ec, std::size_t)
+			{
+				if (ec) return;
+				std::uint32_t length;
+				std::memcpy(&length, header.data(), 4);
+				body.resize(length);
+				boost::asio::async_read(socket, boost::asio::buffer(body), [this](boost::system::error_code ec, std::size_t)
+				{
+					if (ec) return;
+					on_request(static_cast<tcp_command>(body[0]), es::guid(reinterpret_cast<const char*>(body.data()) + 2));
+				});
+			});
+		}
+
+		void on_request(tcp_command command, es::guid_type id)
+		{
+			if (command == tcp_command::identify_client)
+			{
+				reply(tcp_package(tcp_command::client_identified, tcp_flags::none, id));
+			}
+			else if (command == tcp_command::write_events && master.has_value())
+			{
+				write_requests.push_back(id);
+
+				es::message::NotHandled_MasterInfo info;
+				info.set_external_tcp_address(master->address().to_string());
+				info.set_external_tcp_port(master->port());
+				info.set_external_http_address(master->address().to_string());
+				info.set_external_http_port(2113);
+				es::message::NotHandled response;
+				response.set_reason(es::message::NotHandled_NotHandledReason_NotMaster);
+				response.set_additional_info(info.SerializeAsString());
+				auto serialized = response.SerializeAsString();
+				reply(tcp_package(tcp_command::not_handled, tcp_flags::none, id, (std::byte*)serialized.data(), serialized.size()));
+			}
+			else if (command == tcp_command::write_events)
+			{
+				write_requests.push_back(id);
+
+				es::message::WriteEventsCompleted response;
+				response.set_result(es::message::OperationResult::Success);
+				response.set_first_event_number(0);
+				response.set_last_event_number(0);
+				auto serialized = response.SerializeAsString();
+				reply(tcp_package(tcp_command::write_events_completed, tcp_flags::none, id, (std::byte*)serialized.data(), serialized.size()));
+			}
+			read();
+		}
+
+		void reply(tcp_package&& package)
+		{
+			auto reply = std::make_shared<tcp_package>(std::move(package));
+			boost::asio::async_write(socket, boost::asio::buffer(reply->data(), reply->size()), [reply](boost::system::error_code, std::size_t) {});
+		}
+	};
+
+	fake_node master{ ioc };
+	fake_node slave{ ioc };
+	slave.master = master.acceptor.local_endpoint();
+	master.accept();
+	slave.accept();
+
+	// discovery only knows the slave
+	boost::asio::make_service<es::tcp::services::discovery_service>(ioc, slave.acceptor.local_endpoint(), boost::asio::ip::tcp::endpoint(), false);
+
+	// a redirect must not wait for the reconnection delay
+	auto settings = es::connection_settings_builder()
+		.with_reconnection_delay(std::chrono::seconds(30))
+		.build();
+
+	std::vector<std::uint8_t> buffer_storage;
+	auto conn = std::make_shared<connection_type>(ioc, settings, boost::asio::dynamic_buffer(buffer_storage));
+
+	auto request_id = es::guid();
+	bool done = false;
+	boost::system::error_code result;
+	tcp_command response_command{};
+
+	conn->async_connect([&](boost::system::error_code ec, std::optional<es::connection_result>)
+	{
+		// no credentials, the connection is usable anyway
+		REQUIRE((!ec || ec == es::connection_errors::authentication_failed));
+		REQUIRE(conn->is_connected());
+		conn->async_send(
+			tcp_package(tcp_command::write_events, tcp_flags::none, request_id),
+			[&](boost::system::error_code ec, es::detail::tcp::tcp_package_view view)
+		{
+			result = ec;
+			if (!ec) response_command = view.command();
+			done = true;
+		}
+		);
+	});
+
+	while (!done && ioc.run_one_for(std::chrono::seconds(5)) != 0) {}
+
+	REQUIRE(done);
+	REQUIRE(!result);
+	REQUIRE(response_command == tcp_command::write_events_completed);
+	REQUIRE(slave.write_requests == std::vector<es::guid_type>{ request_id });
+	REQUIRE(master.write_requests == std::vector<es::guid_type>{ request_id });
+	REQUIRE(conn->socket().remote_endpoint() == master.acceptor.local_endpoint());
+
+	conn->close();
+}
+
+TEST_CASE("basic_tcp_connection accepts operations from any thread when it runs on a strand", "[connection][strand]")
+{
+	using connection_type = es::connection::basic_tcp_connection<
+		boost::asio::steady_timer,
+		es::tcp::services::discovery_service,
+		es::operation<>
+	>;
+	using tcp_package = es::detail::tcp::tcp_package<>;
+	using es::detail::tcp::tcp_command;
+	using es::detail::tcp::tcp_flags;
+
+	constexpr int kThreads = 4;
+	constexpr int kOperationsPerThread = 250;
+	constexpr int kOperations = kThreads * kOperationsPerThread;
+
+	boost::asio::io_context ioc;
+	boost::asio::io_context server_ioc;
+	boost::asio::ip::tcp::acceptor acceptor{ server_ioc, boost::asio::ip::tcp::endpoint(boost::asio::ip::make_address_v4("127.0.0.1"), 0) };
+	boost::asio::ip::tcp::socket server_socket{ server_ioc };
+
+	auto settings = es::connection_settings_builder()
+		.use_strand(true)
+		.build();
+
+	std::vector<std::uint8_t> buffer_storage;
+	auto conn = std::make_shared<connection_type>(ioc, settings, boost::asio::dynamic_buffer(buffer_storage));
+	conn->socket().connect(acceptor.local_endpoint());
+	acceptor.accept(server_socket);
+
+	// answers every request with a successful write, from its own thread
+	std::thread server{ [&server_socket]()
+	{
+		std::vector<std::uint8_t> request(tcp_package(tcp_command::write_events, tcp_flags::none, es::guid()).size());
+		for (int i = 0; i < kOperations; ++i)
+		{
+			boost::system::error_code ec;
+			boost::asio::read(server_socket, boost::asio::buffer(request), ec);
+			if (ec) return;
+
+			es::message::WriteEventsCompleted response;
+			response.set_result(es::message::OperationResult::Success);
+			response.set_first_event_number(0);
+			response.set_last_event_number(0);
+			auto body = response.SerializeAsString();
+			tcp_package reply(
+				tcp_command::write_events_completed,
+				tcp_flags::none,
+				es::guid(reinterpret_cast<const char*>(request.data()) + es::detail::tcp::kCorrelationOffset),
+				(std::byte*)body.data(),
+				body.size()
+			);
+			boost::asio::write(server_socket, boost::asio::buffer(reply.data(), reply.size()), ec);
+			if (ec) return;
+		}
+	} };
+
+	struct receive_starter : connection_type::friend_base_type<receive_starter> {};
+	receive_starter{}.async_start_receive(*conn);
+
+	std::vector<std::thread> io_threads;
+	for (int i = 0; i < kThreads; ++i) io_threads.emplace_back([&ioc]() { ioc.run(); });
+
+	// handlers of a connection never run concurrently, even with several threads running the io_context
+	std::atomic<int> completed{ 0 };
+	std::atomic<int> failed{ 0 };
+	std::atomic<bool> in_handler{ false };
+	std::atomic<bool> overlapped{ false };
+
+	std::vector<std::thread> senders;
+	for (int i = 0; i < kThreads; ++i)
+	{
+		senders.emplace_back([&]()
+		{
+			for (int j = 0; j < kOperationsPerThread; ++j)
+			{
+				conn->async_send(
+					tcp_package(tcp_command::write_events, tcp_flags::none, es::guid()),
+					[&](boost::system::error_code ec, es::detail::tcp::tcp_package_view)
+				{
+					if (in_handler.exchange(true)) overlapped = true;
+					if (ec) ++failed;
+					++completed;
+					in_handler = false;
+				}
+				);
+			}
+		});
+	}
+	for (auto& sender : senders) sender.join();
+
+	auto const deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+	while (completed < kOperations && std::chrono::steady_clock::now() < deadline)
+	{
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+	}
+
+	std::promise<void> closed;
+	boost::asio::dispatch(conn->get_executor(), [&]() { conn->close(); closed.set_value(); });
+	closed.get_future().wait();
+	ioc.stop();
+	for (auto& thread : io_threads) thread.join();
+	server_socket.close();
+	server.join();
+
+	REQUIRE(completed == kOperations);
+	REQUIRE(failed == 0);
+	REQUIRE_FALSE(overlapped);
+}
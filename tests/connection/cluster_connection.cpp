@@ -0,0 +1,232 @@
+#include <catch2/catch.hpp>
+
+#include <array>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/ip/tcp.hpp>
+#include <boost/asio/read.hpp>
+#include <boost/asio/steady_timer.hpp>
+#include <boost/asio/write.hpp>
+
+#include "connection/basic_tcp_connection.hpp"
+#include "connection/cluster_connection.hpp"
+#include "message/cluster_messages.hpp"
+#include "tcp/discovery_service.hpp"
+
+namespace {
+
+// identifies every client that connects and ignores their other requests
+struct identifying_node
+{
+	using tcp = boost::asio::ip::tcp;
+
+	explicit identifying_node(boost::asio::io_context& ioc)
+		: acceptor(ioc, tcp::endpoint(boost::asio::ip::make_address_v4("127.0.0.1"), 0)), socket(ioc)
+	{
+		acceptor.async_accept(socket, [this](boost::system::error_code ec) { if (!ec) read(); });
+	}
+
+	void read()
+	{
+		boost::asio::async_read(socket, boost::asio::buffer(header), [this](boost::system::error_code ec, std::size_t)
+		{
+			if (ec) return;
+			std::uint32_t length;
+			std::memcpy(&length, header.data(), 4);
+			body.resize(length);
+			boost::asio::async_read(socket, boost::asio::buffer(body), [this](boost::system::error_code ec, std::size_t)
+			{
+				if (ec) return;
+				if (static_cast<es::detail::tcp::tcp_command>(body[0]) == es::detail::tcp::tcp_command::identify_client)
+				{
+					reply(es::detail::tcp::tcp_command::client_identified);
+				}
+				read();
+			});
+		});
+	}
+
+	// length, command, flags and the request's correlation id
+	void reply(es::detail::tcp::tcp_command command)
+	{
+		auto package = std::make_shared<std::array<std::uint8_t, 22>>();
+		std::uint32_t const length = 18;
+		std::memcpy(package->data(), &length, 4);
+		(*package)[4] = static_cast<std::uint8_t>(command);
+		(*package)[5] = static_cast<std::uint8_t>(es::detail::tcp::tcp_flags::none);
+		std::memcpy(package->data() + 6, body.data() + 2, 16);
+		boost::asio::async_write(socket, boost::asio::buffer(*package), [package](boost::system::error_code, std::size_t) {});
+	}
+
+	int port() const { return acceptor.local_endpoint().port(); }
+
+	tcp::acceptor acceptor;
+	tcp::socket socket;
+	std::array<std::uint8_t, 4> header{};
+	std::vector<std::uint8_t> body;
+};
+
+es::message::member_info member(std::string const& instance_id, std::string const& state, int tcp_port)
+{
+	return nlohmann::json{
+		{ "instanceId", instance_id }, { "timeStamp", "2019-09-05T19:12:38.2676819Z" }, { "state", state }, { "isAlive", true },
+		{ "internalTcpIp", "127.0.0.1" }, { "internalTcpPort", 4111 }, { "internalSecureTcpPort", 0 },
+		{ "externalTcpIp", "127.0.0.1" }, { "externalTcpPort", tcp_port }, { "externalSecureTcpPort", 0 },
+		{ "internalHttpIp", "127.0.0.1" }, { "internalHttpPort", 4113 }, { "externalHttpIp", "127.0.0.1" }, { "externalHttpPort", 4114 },
+		{ "lastCommitPosition", 0 }, { "writerCheckpoint", 0 }, { "chaserCheckpoint", 0 },
+		{ "epochPosition", 0 }, { "epochNumber", 1 }, { "epochId", "3e15906c-598b-4146-846e-b8b4bf35e72a" }, { "nodePriority", 0 }
+	}.get<es::message::member_info>();
+}
+
+}
+
+TEST_CASE("cluster_connection sends reads that do not require the master to followers", "[connection][cluster_connection]")
+{
+	using connection_type = es::connection::basic_tcp_connection<
+		boost::asio::steady_timer,
+		es::tcp::services::discovery_service,
+		es::operation<>
+	>;
+	using cluster_type = es::connection::cluster_connection<connection_type>;
+	using es::detail::tcp::tcp_command;
+	using es::detail::tcp::tcp_flags;
+
+	auto package = [](tcp_command command, google::protobuf::MessageLite const& request)
+	{
+		auto serialized = request.SerializeAsString();
+		return es::detail::tcp::tcp_package<>(command, tcp_flags::none, es::guid(), (std::byte*)serialized.data(), serialized.size());
+	};
+
+	auto read_stream = [&package](bool require_master)
+	{
+		es::message::ReadStreamEvents request;
+		request.set_event_stream_id("stream");
+		request.set_from_event_number(0);
+		request.set_max_count(10);
+		request.set_resolve_link_tos(false);
+		request.set_require_master(require_master);
+		return package(tcp_command::read_stream_events_forward, request);
+	};
+
+	auto read_all = [&package](bool require_master)
+	{
+		es::message::ReadAllEvents request;
+		request.set_commit_position(0);
+		request.set_prepare_position(0);
+		request.set_max_count(10);
+		request.set_resolve_link_tos(false);
+		request.set_require_master(require_master);
+		return package(tcp_command::read_all_events_backward, request);
+	};
+
+	auto read_event = [&package](bool require_master)
+	{
+		es::message::ReadEvent request;
+		request.set_event_stream_id("stream");
+		request.set_event_number(3);
+		request.set_resolve_link_tos(true);
+		request.set_require_master(require_master);
+		return package(tcp_command::read_event, request);
+	};
+
+	auto is_follower_read = [](es::detail::tcp::tcp_package<> const& package)
+	{
+		return es::connection::is_follower_read(static_cast<es::detail::tcp::tcp_package_view>(package));
+	};
+
+	SECTION("only reads without require_master can be served by followers")
+	{
+		REQUIRE(is_follower_read(read_stream(false)));
+		REQUIRE(is_follower_read(read_all(false)));
+		REQUIRE(is_follower_read(read_event(false)));
+		REQUIRE(!is_follower_read(read_stream(true)));
+		REQUIRE(!is_follower_read(read_all(true)));
+		REQUIRE(!is_follower_read(read_event(true)));
+
+		es::message::WriteEvents write;
+		write.set_event_stream_id("stream");
+		write.set_expected_version(-2);
+		write.set_require_master(false);
+		REQUIRE(!is_follower_read(package(tcp_command::write_events, write)));
+	}
+
+	SECTION("reads go to the master without followers")
+	{
+		boost::asio::io_context ioc;
+		auto cluster = std::make_shared<cluster_type>(ioc, es::connection_settings_builder().build(), es::connection::read_routing::pinned);
+
+		REQUIRE(cluster->followers_size() == 0);
+		REQUIRE(cluster->select_reader() == cluster->master());
+	}
+}
+
+TEST_CASE("cluster_connection follows the slaves of the gossip", "[connection][cluster_connection]")
+{
+	using connection_type = es::connection::basic_tcp_connection<
+		boost::asio::steady_timer,
+		es::tcp::services::discovery_service,
+		es::operation<>
+	>;
+	using cluster_type = es::connection::cluster_connection<connection_type>;
+
+	boost::asio::io_context ioc;
+	identifying_node master{ ioc };
+	identifying_node first_slave{ ioc };
+	identifying_node second_slave{ ioc };
+	boost::asio::make_service<es::tcp::services::discovery_service>(ioc, master.acceptor.local_endpoint(), boost::asio::ip::tcp::endpoint(), false);
+
+	auto cluster = std::make_shared<cluster_type>(ioc, es::connection_settings_builder().build(), es::connection::read_routing::pinned);
+	auto const master_id = "9b1350ea-4f62-4008-b2ed-0548712baed2";
+	auto const first_id = "4c1b1f2e-7a3d-4e5f-9a8b-0c1d2e3f4a5b";
+	auto const second_id = "6d2c2a3f-8b4e-4f6a-8b9c-1d2e3f4a5b6c";
+
+	// gossip seen before the master is connected is not followed
+	cluster->on_gossip_changed({ member(master_id, "Master", master.port()), member(first_id, "Slave", first_slave.port()) });
+	REQUIRE(cluster->followers_size() == 0);
+
+	bool connected = false;
+	cluster->async_connect([&connected](boost::system::error_code ec, std::optional<es::connection_result>)
+	{
+		// no credentials, the connection is usable anyway
+		REQUIRE((!ec || ec == es::connection_errors::authentication_failed));
+		connected = true;
+	});
+	while (!connected && ioc.run_one_for(std::chrono::seconds(5)) != 0) {}
+	REQUIRE(connected);
+
+	cluster->on_gossip_changed({ member(master_id, "Master", master.port()), member(first_id, "Slave", first_slave.port()) });
+	REQUIRE(cluster->followers_size() == 1);
+	while (cluster->select_reader() == cluster->master() && ioc.run_one_for(std::chrono::seconds(5)) != 0) {}
+	auto const first = cluster->select_reader();
+	REQUIRE(first != cluster->master());
+	REQUIRE(first->is_connected());
+
+	// a slave joins, the pinned follower keeps the reads
+	cluster->on_gossip_changed({
+		member(master_id, "Master", master.port()),
+		member(first_id, "Slave", first_slave.port()),
+		member(second_id, "Slave", second_slave.port())
+	});
+	REQUIRE(cluster->followers_size() == 2);
+	REQUIRE(cluster->select_reader() == first);
+
+	// the pinned follower is no longer a slave, it is closed and reads go to the master from then on
+	cluster->on_gossip_changed({
+		member(master_id, "Master", master.port()),
+		member(first_id, "CatchingUp", first_slave.port()),
+		member(second_id, "Slave", second_slave.port())
+	});
+	REQUIRE(cluster->followers_size() == 1);
+	ioc.run_for(std::chrono::milliseconds(100));
+	REQUIRE_FALSE(first->is_connected());
+	REQUIRE(cluster->select_reader() == cluster->master());
+
+	cluster->close();
+	ioc.run_for(std::chrono::milliseconds(100));
+}
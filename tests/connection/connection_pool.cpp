@@ -0,0 +1,95 @@
+#include <catch2/catch.hpp>
+
+#include <set>
+#include <string>
+
+#include <boost/asio/steady_timer.hpp>
+
+#include "connection/basic_tcp_connection.hpp"
+#include "connection/connection_pool.hpp"
+#include "tcp/discovery_service.hpp"
+#include "subscription/persistent_subscription.hpp"
+#include "subscription/volatile_subscription.hpp"
+
+TEST_CASE("connection_pool routes operations on the same stream to the same connection", "[connection][connection_pool]")
+{
+	using connection_type = es::connection::basic_tcp_connection<
+		boost::asio::steady_timer,
+		es::tcp::services::discovery_service,
+		es::operation<>
+	>;
+	using pool_type = es::connection::connection_pool<connection_type>;
+	using es::detail::tcp::tcp_command;
+	using es::detail::tcp::tcp_flags;
+
+	boost::asio::io_context ioc;
+	auto settings = es::connection_settings_builder().build();
+	auto pool = std::make_shared<pool_type>(ioc, settings, 8, es::connection::pool_routing::stream_affinity);
+	REQUIRE(pool->size() == 8);
+
+	auto write_request = [](std::string const& stream)
+	{
+		es::message::WriteEvents request;
+		request.set_event_stream_id(stream);
+		request.set_expected_version(-2);
+		request.set_require_master(false);
+		auto serialized = request.SerializeAsString();
+		return es::detail::tcp::tcp_package<>(tcp_command::write_events, tcp_flags::none, es::guid(), (std::byte*)serialized.data(), serialized.size());
+	};
+
+	std::set<connection_type*> used;
+	for (int i = 0; i < 64; ++i)
+	{
+		auto stream = "stream-" + std::to_string(i);
+		auto const& connection = pool->select(write_request(stream));
+		REQUIRE(connection == pool->select(write_request(stream)));
+		REQUIRE(connection == pool->select(stream));
+		used.insert(connection.get());
+	}
+	REQUIRE(used.size() > 1);
+
+	// requests without a stream go to the least loaded connection, which rotates while the pool is idle
+	used.clear();
+	for (std::size_t i = 0; i < pool->size(); ++i)
+	{
+		used.insert(pool->select(es::detail::tcp::tcp_package<>(tcp_command::read_all_events_forward, tcp_flags::none, es::guid())).get());
+	}
+	REQUIRE(used.size() == pool->size());
+}
+
+TEST_CASE("connection_pool keeps subscriptions on its subscription connection", "[connection][connection_pool]")
+{
+	using connection_type = es::connection::basic_tcp_connection<
+		boost::asio::steady_timer,
+		es::tcp::services::discovery_service,
+		es::operation<>
+	>;
+	using pool_type = es::connection::connection_pool<connection_type>;
+	using es::detail::tcp::tcp_command;
+	using es::detail::tcp::tcp_flags;
+
+	boost::asio::io_context ioc;
+	auto settings = es::connection_settings_builder().build();
+	auto pool = std::make_shared<pool_type>(ioc, settings, 4, es::connection::pool_routing::least_outstanding);
+	REQUIRE(pool->subscription_connection() == (*pool)[0]);
+
+	for (auto command : {
+		tcp_command::subscribe_to_stream,
+		tcp_command::unsubscribe_from_stream,
+		tcp_command::connect_to_persistent_subscription,
+		tcp_command::persistent_subscription_ack_events,
+		tcp_command::persistent_subscription_nak_events })
+	{
+		// the least outstanding policy would rotate through the connections
+		for (std::size_t i = 0; i < pool->size(); ++i)
+		{
+			REQUIRE(pool->select(es::detail::tcp::tcp_package<>(command, tcp_flags::none, es::guid())) == pool->subscription_connection());
+		}
+	}
+
+	// subscriptions are created on the pool like on a connection
+	auto volatile_subscription = es::make_volatile_subscription(pool, es::guid(), "pool-stream");
+	auto persistent_subscription = es::make_persistent_subscription(pool, es::guid(), "pool-stream", "pool-group", 10);
+	REQUIRE(volatile_subscription->connection() == pool);
+	REQUIRE(persistent_subscription->connection() == pool);
+}
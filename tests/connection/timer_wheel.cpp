@@ -0,0 +1,52 @@
+#include <catch2/catch.hpp>
+
+#include <vector>
+
+#include "connection/timer_wheel.hpp"
+
+TEST_CASE("timer_wheel expires keys when their tick is reached", "[connection][timer_wheel]")
+{
+	es::connection::timer_wheel<int> wheel;
+	std::vector<int> expired;
+	auto on_expired = [&expired](int key) { expired.push_back(key); };
+
+	SECTION("keys expire on their deadline tick, not before")
+	{
+		wheel.schedule(1, 3);
+		wheel.schedule(2, 7);
+		REQUIRE(wheel.size() == 2);
+
+		wheel.advance(2, on_expired);
+		REQUIRE(expired.empty());
+		wheel.advance(3, on_expired);
+		REQUIRE(expired == std::vector<int>{ 1 });
+		wheel.advance(10, on_expired);
+		REQUIRE(expired == std::vector<int>{ 1, 2 });
+		REQUIRE(wheel.empty());
+	}
+	SECTION("deadlines on upper levels cascade down to the right tick")
+	{
+		std::vector<std::uint64_t> deadlines{ 63, 64, 65, 4095, 4096, 4097, 300000, (std::uint64_t(1) << 24) + 5 };
+		for (std::size_t i = 0; i < deadlines.size(); ++i)
+		{
+			wheel.schedule(static_cast<int>(i), deadlines[i]);
+		}
+
+		for (std::size_t i = 0; i < deadlines.size(); ++i)
+		{
+			wheel.advance(deadlines[i] - 1, on_expired);
+			REQUIRE(expired.size() == i);
+			wheel.advance(deadlines[i], on_expired);
+			REQUIRE(expired.size() == i + 1);
+			REQUIRE(expired.back() == static_cast<int>(i));
+		}
+	}
+	SECTION("an empty wheel jumps to the requested tick")
+	{
+		wheel.advance(1000000, on_expired);
+		REQUIRE(wheel.now() == 1000000);
+		wheel.schedule(1, 0);
+		wheel.advance(1000001, on_expired);
+		REQUIRE(expired == std::vector<int>{ 1 });
+	}
+}
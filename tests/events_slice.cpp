@@ -0,0 +1,179 @@
+#include <catch2/catch.hpp>
+
+#include <algorithm>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include "guid.hpp"
+#include "all_events_slice.hpp"
+#include "columnar_all_events_slice.hpp"
+#include "columnar_stream_events_slice.hpp"
+#include "stream_events_slice.hpp"
+
+#include "message/messages.pb.h"
+
+namespace {
+
+void fill_record(es::message::EventRecord* record, std::int64_t event_number)
+{
+	auto id = es::guid();
+	record->set_event_stream_id("orders-" + std::to_string(event_number % 16));
+	record->set_event_number(event_number);
+	record->set_event_id(id.data, id.size());
+	record->set_event_type("Order.Placed");
+	record->set_data_content_type(1);
+	record->set_metadata_content_type(0);
+	record->set_data(std::string(256, 'd'));
+	record->set_metadata(std::string(64, 'm'));
+}
+
+es::message::ReadAllEventsCompleted make_all_events_page(int count)
+{
+	es::message::ReadAllEventsCompleted response;
+	response.set_commit_position(0);
+	response.set_prepare_position(0);
+	response.set_next_commit_position(count);
+	response.set_next_prepare_position(count);
+	for (int i = 0; i < count; ++i)
+	{
+		auto* event = response.add_events();
+		fill_record(event->mutable_event(), i);
+		event->set_commit_position(i);
+		event->set_prepare_position(i);
+	}
+	return response;
+}
+
+}
+
+TEST_CASE("events slices take the events of the response", "[slice]")
+{
+	SECTION("stream events")
+	{
+		es::message::ReadStreamEventsCompleted response;
+		response.set_result(es::message::ReadStreamEventsCompleted_ReadStreamResult_Success);
+		response.set_next_event_number(3);
+		response.set_last_event_number(2);
+		response.set_is_end_of_stream(true);
+		response.set_last_commit_position(0);
+		for (int i = 0; i < 3; ++i) fill_record(response.add_events()->mutable_event(), i);
+		fill_record(response.mutable_events(1)->mutable_link(), 100);
+
+		std::string const* data = &response.events(2).event().data();
+		char const* bytes = data->data();
+
+		es::stream_events_slice slice("orders", 0, es::read_direction::forward, response);
+
+		REQUIRE(slice.events().size() == 3);
+		REQUIRE(slice.is_end_of_stream());
+		REQUIRE(slice.events()[1].is_resolved());
+		REQUIRE(slice.events()[1].link().value().event_number() == 100);
+		REQUIRE(slice.events()[2].event().value().event_number() == 2);
+		REQUIRE(slice.events()[2].event().value().content() == std::string(256, 'd'));
+		REQUIRE(slice.events()[2].event().value().metadata() == std::string(64, 'm'));
+
+		// the content was moved, not copied
+		REQUIRE(slice.events()[2].event().value().content().data() == bytes);
+	}
+
+	SECTION("all events")
+	{
+		auto response = make_all_events_page(5);
+		es::all_events_slice slice(es::read_direction::forward, response);
+
+		REQUIRE(slice.events().size() == 5);
+		REQUIRE_FALSE(slice.is_end_of_stream());
+		REQUIRE(slice.next_position() == es::position{ 5, 5 });
+		REQUIRE(slice.events()[4].original_position() == es::position{ 4, 4 });
+		REQUIRE(slice.events()[4].original_stream_id() == "orders-4");
+		REQUIRE(slice.events()[4].event().value().content() == std::string(256, 'd'));
+
+		// the events share their type and stream ids with those of the same name
+		auto const& first = slice.events()[0].event().value();
+		auto const& last = slice.events()[4].event().value();
+		REQUIRE(&first.event_type() == &last.event_type());
+		REQUIRE(first.interned_event_type() == last.interned_event_type());
+		REQUIRE(first.interned_stream_id() != last.interned_stream_id());
+	}
+}
+
+TEST_CASE("columnar slices store the events of the response column by column", "[slice]")
+{
+	SECTION("stream events")
+	{
+		es::message::ReadStreamEventsCompleted response;
+		response.set_result(es::message::ReadStreamEventsCompleted_ReadStreamResult_Success);
+		response.set_next_event_number(3);
+		response.set_last_event_number(2);
+		response.set_is_end_of_stream(true);
+		response.set_last_commit_position(0);
+		for (int i = 0; i < 3; ++i) fill_record(response.add_events()->mutable_event(), i);
+		response.mutable_events(1)->mutable_event()->set_event_type("Order.Shipped");
+		response.mutable_events(1)->mutable_event()->set_data("{}");
+
+		es::columnar_stream_events_slice slice("orders", 0, es::read_direction::forward, response);
+		auto const& columns = slice.columns();
+
+		REQUIRE(slice.is_end_of_stream());
+		REQUIRE(columns.size() == 3);
+		REQUIRE(columns.event_numbers() == std::vector<std::int64_t>{ 0, 1, 2 });
+		REQUIRE(columns.event_types().size() == 2);
+		REQUIRE(columns.type_ids()[0] == columns.type_ids()[2]);
+		REQUIRE(columns.type_id("Order.Shipped") == columns.type_ids()[1]);
+		REQUIRE_FALSE(columns.type_id("Order.Cancelled").has_value());
+		REQUIRE(columns.event_type(1) == "Order.Shipped");
+		REQUIRE(columns.stream(2) == "orders-2");
+		REQUIRE(columns.content(1) == "{}");
+		REQUIRE(columns.content(2) == std::string(256, 'd'));
+		REQUIRE(columns.metadata(2) == std::string(64, 'm'));
+		REQUIRE(columns.payload().size() == 2 * 256 + 2 + 3 * 64);
+		REQUIRE(columns.event_ids()[0] == es::guid(response.events(0).event().event_id().data()));
+	}
+
+	SECTION("all events")
+	{
+		auto response = make_all_events_page(5);
+		es::columnar_all_events_slice slice(es::read_direction::forward, response);
+
+		REQUIRE(slice.columns().size() == 5);
+		REQUIRE(slice.next_position() == es::position{ 5, 5 });
+		REQUIRE(slice.original_position(4) == es::position{ 4, 4 });
+		REQUIRE(slice.columns().streams().size() == 5);
+		REQUIRE(slice.columns().event_types().size() == 1);
+	}
+}
+
+TEST_CASE("all_events_slice construction benchmark", "[slice][!benchmark]")
+{
+	constexpr int page_size = 4096;
+
+	// the previous construction, copying the events of the response before converting them
+	BENCHMARK_ADVANCED("copy RepeatedPtrField then convert (4096 events)")(Catch::Benchmark::Chronometer meter)
+	{
+		std::vector<es::message::ReadAllEventsCompleted> pages(meter.runs(), make_all_events_page(page_size));
+		meter.measure([&pages](int i)
+		{
+			std::vector<es::resolved_event> events;
+			events.reserve(pages[i].events_size());
+			auto copy = pages[i].events();
+			std::transform(
+				std::begin(copy),
+				std::end(copy),
+				std::back_inserter(events),
+				[](es::message::ResolvedEvent& event) { return es::resolved_event(event); }
+			);
+			return events.size();
+		});
+	};
+
+	BENCHMARK_ADVANCED("all_events_slice (4096 events)")(Catch::Benchmark::Chronometer meter)
+	{
+		std::vector<es::message::ReadAllEventsCompleted> pages(meter.runs(), make_all_events_page(page_size));
+		meter.measure([&pages](int i)
+		{
+			es::all_events_slice slice(es::read_direction::forward, pages[i]);
+			return slice.events().size();
+		});
+	};
+}
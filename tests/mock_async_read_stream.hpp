@@ -16,6 +16,8 @@ namespace test {
 
 struct mock_async_read_stream
 {
+	using executor_type = boost::asio::io_context::executor_type;
+
 	boost::asio::io_context::executor_type ex_;
 	char* buffer_;
 	std::size_t size_;
@@ -0,0 +1,151 @@
+#include <catch2/catch.hpp>
+
+#include <array>
+#include <chrono>
+#include <cstring>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/ip/tcp.hpp>
+#include <boost/asio/read.hpp>
+#include <boost/asio/steady_timer.hpp>
+#include <boost/asio/write.hpp>
+
+#include "message/messages.pb.h"
+
+#include "guid.hpp"
+#include "connection_settings.hpp"
+#include "resolved_event_view.hpp"
+#include "connection/basic_tcp_connection.hpp"
+#include "subscription/catchup_subscription.hpp"
+#include "tcp/discovery_service.hpp"
+#include "tcp/tcp_package.hpp"
+
+TEST_CASE("catchup_subscription keeps the events of views alive", "[subscription][catchup]")
+{
+	using connection_type = es::connection::basic_tcp_connection<
+		boost::asio::steady_timer,
+		es::tcp::services::discovery_service,
+		es::operation<>
+	>;
+	using tcp_package = es::detail::tcp::tcp_package<>;
+	using es::detail::tcp::tcp_command;
+	using es::detail::tcp::tcp_flags;
+
+	boost::asio::io_context ioc;
+
+	// identifies every client, answers the catch-up read with the whole stream and confirms the subscription
+	struct fake_node
+	{
+		boost::asio::ip::tcp::acceptor acceptor;
+		boost::asio::ip::tcp::socket socket;
+		std::array<std::uint8_t, 4> header{};
+		std::vector<std::uint8_t> body;
+
+		fake_node(boost::asio::io_context& ioc)
+			: acceptor(ioc, boost::asio::ip::tcp::endpoint(boost::asio::ip::make_address_v4("127.0.0.1"), 0)), socket(ioc)
+		{}
+
+		void accept()
+		{
+			acceptor.async_accept(socket, [this](boost::system::error_code ec) { if (!ec) read(); });
+		}
+
+		void read()
+		{
+			boost::asio::async_read(socket, boost::asio::buffer(header), [this](boost::system::error_code ec, std::size_t)
+			{
+				if (ec) return;
+				std::uint32_t length;
+				std::memcpy(&length, header.data(), 4);
+				body.resize(length);
+				boost::asio::async_read(socket, boost::asio::buffer(body), [this](boost::system::error_code ec, std::size_t)
+				{
+					if (ec) return;
+					on_request(static_cast<tcp_command>(body[0]), es::guid(reinterpret_cast<const char*>(body.data()) + 2));
+				});
+			});
+		}
+
+		void on_request(tcp_command command, es::guid_type id)
+		{
+			if (command == tcp_command::identify_client)
+			{
+				reply(tcp_package(tcp_command::client_identified, tcp_flags::none, id));
+			}
+			else if (command == tcp_command::read_stream_events_forward)
+			{
+				es::message::ReadStreamEventsCompleted response;
+				for (int number = 0; number < 2; ++number)
+				{
+					auto event_id = es::guid();
+					auto* event = response.add_events()->mutable_event();
+					event->set_event_stream_id("orders-1");
+					event->set_event_number(number);
+					event->set_event_id(event_id.data, event_id.size());
+					event->set_event_type("Order.Placed");
+					event->set_data_content_type(1);
+					event->set_metadata_content_type(0);
+					event->set_data(std::string(1000, static_cast<char>('a' + number)));
+				}
+				response.set_result(es::message::ReadStreamEventsCompleted_ReadStreamResult_Success);
+				response.set_next_event_number(2);
+				response.set_last_event_number(1);
+				response.set_is_end_of_stream(true);
+				response.set_last_commit_position(100);
+				auto serialized = response.SerializeAsString();
+				reply(tcp_package(tcp_command::read_stream_events_forward_completed, tcp_flags::none, id, (std::byte*)serialized.data(), serialized.size()));
+			}
+			else if (command == tcp_command::subscribe_to_stream)
+			{
+				es::message::SubscriptionConfirmation response;
+				response.set_last_commit_position(100);
+				response.set_last_event_number(1);
+				auto serialized = response.SerializeAsString();
+				reply(tcp_package(tcp_command::subscription_confirmation, tcp_flags::none, id, (std::byte*)serialized.data(), serialized.size()));
+			}
+			read();
+		}
+
+		void reply(tcp_package&& package)
+		{
+			auto reply = std::make_shared<tcp_package>(std::move(package));
+			boost::asio::async_write(socket, boost::asio::buffer(reply->data(), reply->size()), [reply](boost::system::error_code, std::size_t) {});
+		}
+	};
+
+	fake_node node{ ioc };
+	node.accept();
+	boost::asio::make_service<es::tcp::services::discovery_service>(ioc, node.acceptor.local_endpoint(), boost::asio::ip::tcp::endpoint(), false);
+
+	std::vector<std::uint8_t> buffer_storage;
+	auto conn = std::make_shared<connection_type>(ioc, es::connection_settings_builder().build(), boost::asio::dynamic_buffer(buffer_storage));
+
+	std::vector<es::resolved_event_view> kept;
+	std::shared_ptr<es::subscription::catchup_subscription<connection_type>> subscription;
+	conn->async_connect([&](boost::system::error_code, std::optional<es::connection_result>)
+	{
+		subscription = es::make_catchup_subscription(conn, es::guid(), "orders-1", 0, es::catchup_subscription_settings_builder().build());
+		subscription->async_start(
+			[&kept](es::resolved_event_view const& event) { kept.push_back(event); },
+			[](boost::system::error_code, es::subscription::catchup_subscription<connection_type> const&) {}
+		);
+	});
+
+	while (!(subscription && subscription->is_subscribed()) && ioc.run_one_for(std::chrono::seconds(5)) != 0) {}
+
+	// the slice the events were read in is gone, the views own them
+	REQUIRE(kept.size() == 2);
+	for (std::size_t i = 0; i < kept.size(); ++i)
+	{
+		REQUIRE(kept[i].frame() != nullptr);
+		REQUIRE(kept[i].event()->event_number() == static_cast<std::int64_t>(i));
+		REQUIRE(kept[i].event()->stream_id() == "orders-1");
+		REQUIRE(kept[i].event()->content() == std::string(1000, static_cast<char>('a' + i)));
+	}
+
+	conn->close();
+}
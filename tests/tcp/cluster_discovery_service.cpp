@@ -0,0 +1,332 @@
+#include <catch2/catch.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/ip/tcp.hpp>
+#include <boost/beast/core/flat_buffer.hpp>
+#include <boost/beast/http/read.hpp>
+#include <boost/beast/http/write.hpp>
+#include <boost/beast/http/string_body.hpp>
+
+#include "cluster_settings.hpp"
+#include "tcp/cluster_discovery_service.hpp"
+
+namespace {
+
+using tcp = boost::asio::ip::tcp;
+namespace http = boost::beast::http;
+
+struct fake_connection
+{
+	boost::asio::io_context& ioc;
+	boost::asio::io_context::executor_type get_executor() { return ioc.get_executor(); }
+};
+
+std::string member_json(std::string const& instance_id, std::string const& state, int tcp_port, int http_port, int epoch_number = 1)
+{
+	return R"({
+		"instanceId": ")" + instance_id + R"(", "timeStamp": "2019-09-05T19:12:38.2676819Z",
+		"state": ")" + state + R"(", "isAlive": true,
+		"internalTcpIp": "127.0.0.1", "internalTcpPort": 4111, "internalSecureTcpPort": 0,
+		"externalTcpIp": "127.0.0.1", "externalTcpPort": )" + std::to_string(tcp_port) + R"(, "externalSecureTcpPort": 0,
+		"internalHttpIp": "127.0.0.1", "internalHttpPort": 4113, "externalHttpIp": "127.0.0.1", "externalHttpPort": )" + std::to_string(http_port) + R"(,
+		"lastCommitPosition": 85117, "writerCheckpoint": 101017, "chaserCheckpoint": 101017,
+		"epochPosition": 1963, "epochNumber": )" + std::to_string(epoch_number) + R"(, "epochId": "3e15906c-598b-4146-846e-b8b4bf35e72a", "nodePriority": 0
+	})";
+}
+
+constexpr char const* kMasterId = "9b1350ea-4f62-4008-b2ed-0548712baed2";
+constexpr char const* kSlaveId = "4c1b1f2e-7a3d-4e5f-9a8b-0c1d2e3f4a5b";
+
+// answers gossip requests with the members members(port) gives for its own http port
+struct gossip_node
+{
+	explicit gossip_node(boost::asio::io_context& ioc, std::function<std::string(int)> const& members)
+		: acceptor(ioc, tcp::endpoint(boost::asio::ip::make_address_v4("127.0.0.1"), 0)), socket(ioc)
+	{
+		answer(members(acceptor.local_endpoint().port()));
+		serve();
+	}
+
+	// a cluster whose master's tcp endpoint is 127.0.0.1:master_port
+	explicit gossip_node(boost::asio::io_context& ioc, int master_port)
+		: gossip_node(ioc, [master_port](int) { return member_json(kMasterId, "Master", master_port, 4114); })
+	{}
+
+	void serve()
+	{
+		acceptor.async_accept(socket, [this](boost::system::error_code ec)
+		{
+			if (ec) return;
+			http::async_read(socket, buffer, request, [this](boost::system::error_code ec, std::size_t)
+			{
+				if (ec) return;
+				http::async_write(socket, response, [this](boost::system::error_code, std::size_t)
+				{
+					boost::system::error_code ignored;
+					socket.close(ignored);
+					request = {};
+					serve();
+				});
+			});
+		});
+	}
+
+	// the members the next requests are answered with
+	void answer(std::string const& members)
+	{
+		response.result(http::status::ok);
+		response.body() = R"({ "members": [ )" + members + " ] }";
+		response.prepare_payload();
+	}
+
+	int port() const { return acceptor.local_endpoint().port(); }
+	es::tcp::gossip_seed seed() const { return es::tcp::gossip_seed(acceptor.local_endpoint()); }
+
+	tcp::acceptor acceptor;
+	tcp::socket socket;
+	boost::beast::flat_buffer buffer;
+	http::request<http::string_body> request;
+	http::response<http::string_body> response;
+};
+
+// connection told about the masters the background refresh sees
+struct listening_connection : std::enable_shared_from_this<listening_connection>
+{
+	explicit listening_connection(boost::asio::io_context& ioc) : ioc(ioc) {}
+
+	boost::asio::io_context::executor_type get_executor() { return ioc.get_executor(); }
+	void on_master_changed(tcp::endpoint const& master) { masters.push_back(master.port()); }
+
+	boost::asio::io_context& ioc;
+	std::vector<int> masters;
+};
+
+// accepts connections in its backlog but never answers
+struct silent_node
+{
+	explicit silent_node(boost::asio::io_context& ioc)
+		: acceptor(ioc, tcp::endpoint(boost::asio::ip::make_address_v4("127.0.0.1"), 0))
+	{}
+
+	es::tcp::gossip_seed seed() const { return es::tcp::gossip_seed(acceptor.local_endpoint()); }
+
+	tcp::acceptor acceptor;
+};
+
+}
+
+TEST_CASE("cluster_discovery_service queries gossip seeds concurrently", "[tcp][discovery]")
+{
+	using clock_type = std::chrono::steady_clock;
+
+	boost::asio::io_context ioc;
+	fake_connection connection{ ioc };
+
+	boost::system::error_code discovery_ec = make_error_code(boost::asio::error::would_block);
+	tcp::endpoint endpoint;
+	clock_type::duration elapsed{};
+	auto start = clock_type::now();
+	auto on_discovered = [&](boost::system::error_code ec, tcp::endpoint discovered)
+	{
+		discovery_ec = ec;
+		endpoint = discovered;
+		elapsed = clock_type::now() - start;
+	};
+
+	SECTION("a silent seed does not delay the answer of another seed")
+	{
+		silent_node silent{ ioc };
+		gossip_node live{ ioc, 1113 };
+		std::vector<es::tcp::gossip_seed> seeds{ silent.seed(), live.seed() };
+
+		auto& service = boost::asio::make_service<es::tcp::services::cluster_discovery_service>(
+			ioc,
+			es::cluster_settings_builder()
+			.with_gossip_seed_endpoints(seeds.begin(), seeds.end())
+			.with_max_discover_attempts(1)
+			.with_gossip_timeout(std::chrono::seconds(5))
+			.build()
+		);
+
+		service.async_discover_node_endpoints(connection, on_discovered);
+		ioc.run_for(std::chrono::seconds(10));
+
+		REQUIRE(!discovery_ec);
+		REQUIRE(endpoint == tcp::endpoint(boost::asio::ip::make_address_v4("127.0.0.1"), 1113));
+		REQUIRE(elapsed < std::chrono::seconds(1));
+	}
+
+	SECTION("each request is bounded by the gossip timeout")
+	{
+		silent_node first{ ioc };
+		silent_node second{ ioc };
+		std::vector<es::tcp::gossip_seed> seeds{ first.seed(), second.seed() };
+
+		auto& service = boost::asio::make_service<es::tcp::services::cluster_discovery_service>(
+			ioc,
+			es::cluster_settings_builder()
+			.with_gossip_seed_endpoints(seeds.begin(), seeds.end())
+			.with_max_discover_attempts(1)
+			.with_gossip_timeout(std::chrono::milliseconds(100))
+			.build()
+		);
+
+		service.async_discover_node_endpoints(connection, on_discovered);
+		ioc.run_for(std::chrono::seconds(10));
+
+		REQUIRE(discovery_ec == es::connection_errors::endpoint_discovery);
+		// one timed out round and the delay before giving up
+		REQUIRE(elapsed < std::chrono::seconds(2));
+	}
+
+	SECTION("the lowest latency preference picks the node with the lowest round trip time")
+	{
+		// the master answers gossip requests itself, the other nodes' http endpoints are closed
+		constexpr char const* catching_up_id = "6d2c2a3f-8b4e-4f6a-8b9c-1d2e3f4a5b6c";
+		gossip_node node{ ioc, [catching_up_id](int port)
+		{
+			return member_json(kMasterId, "Master", 1113, port) + ", " + member_json(kSlaveId, "Slave", 1114, 1)
+				+ ", " + member_json(catching_up_id, "CatchingUp", 1116, 1);
+		} };
+		std::vector<es::tcp::gossip_seed> seeds{ node.seed() };
+
+		auto& service = boost::asio::make_service<es::tcp::services::cluster_discovery_service>(
+			ioc,
+			es::cluster_settings_builder()
+			.with_gossip_seed_endpoints(seeds.begin(), seeds.end())
+			.with_max_discover_attempts(1)
+			.prefer_lowest_latency_node()
+			.build()
+		);
+
+		// only the master's round trip is known after the first gossip
+		service.async_discover_node_endpoints(connection, on_discovered);
+		ioc.run_for(std::chrono::seconds(2));
+
+		REQUIRE(!discovery_ec);
+		REQUIRE(endpoint.port() == 1113);
+		REQUIRE(service.round_trip_time(es::guid(std::string_view{ kMasterId })).has_value());
+		REQUIRE(!service.round_trip_time(es::guid(std::string_view{ kSlaveId })).has_value());
+
+		// a heartbeat reports a faster round trip to the slave, a node that is catching up is never picked however fast
+		service.report_round_trip(tcp::endpoint(boost::asio::ip::make_address_v4("127.0.0.1"), 1114), std::chrono::nanoseconds(2));
+		service.report_round_trip(tcp::endpoint(boost::asio::ip::make_address_v4("127.0.0.1"), 1116), std::chrono::nanoseconds(1));
+
+		ioc.restart();
+		service.async_discover_node_endpoints(connection, on_discovered);
+		ioc.run_for(std::chrono::seconds(2));
+
+		REQUIRE(!discovery_ec);
+		REQUIRE(endpoint.port() == 1114);
+	}
+
+	SECTION("the nodes of the gossip cache are asked before the seeds")
+	{
+		// the cache names the node, which has since moved its master to another tcp port
+		gossip_node node{ ioc, [](int port) { return member_json(kMasterId, "Master", 1115, port); } };
+		silent_node seed{ ioc };
+		std::vector<es::tcp::gossip_seed> seeds{ seed.seed() };
+
+		auto cache = std::filesystem::temp_directory_path() / "es-gossip-cache-test.json";
+		{
+			std::ofstream file(cache, std::ios::trunc);
+			file << R"({ "members": [ )" << member_json(kMasterId, "Master", 1113, node.acceptor.local_endpoint().port()) << " ] }";
+		}
+
+		auto& service = boost::asio::make_service<es::tcp::services::cluster_discovery_service>(
+			ioc,
+			es::cluster_settings_builder()
+			.with_gossip_seed_endpoints(seeds.begin(), seeds.end())
+			.with_max_discover_attempts(1)
+			.with_gossip_timeout(std::chrono::seconds(5))
+			.with_gossip_cache_file(cache.string())
+			.build()
+		);
+
+		service.async_discover_node_endpoints(connection, on_discovered);
+		while (elapsed == clock_type::duration::zero() && ioc.run_one_for(std::chrono::seconds(10)) != 0) {}
+
+		REQUIRE(!discovery_ec);
+		REQUIRE(endpoint.port() == 1115);
+		REQUIRE(elapsed < std::chrono::seconds(1));
+
+		// the cache now holds the gossip of this discovery, written off the connection's handler
+		ioc.poll();
+		std::ifstream file(cache);
+		auto json = nlohmann::json::parse(file);
+		REQUIRE(json.at("members").at(0).at("externalTcpPort") == 1115);
+		// and no temporary file is left next to it
+		auto const temporary_prefix = cache.filename().string() + ".";
+		for (auto const& entry : std::filesystem::directory_iterator(cache.parent_path()))
+		{
+			REQUIRE(entry.path().filename().string().rfind(temporary_prefix, 0) != 0);
+		}
+
+		file.close();
+		std::filesystem::remove(cache);
+	}
+}
+
+TEST_CASE("cluster_discovery_service refreshes the gossip and pushes newly elected masters", "[tcp][discovery]")
+{
+	boost::asio::io_context ioc;
+	auto connection = std::make_shared<listening_connection>(ioc);
+
+	// both nodes answer gossip requests, the master is the first one
+	gossip_node first{ ioc, [](int) { return std::string(); } };
+	gossip_node second{ ioc, [](int) { return std::string(); } };
+	auto const elected_first = member_json(kMasterId, "Master", 1113, first.port(), 1) + ", " + member_json(kSlaveId, "Slave", 1114, second.port(), 1);
+	first.answer(elected_first);
+	second.answer(elected_first);
+	std::vector<es::tcp::gossip_seed> seeds{ first.seed(), second.seed() };
+
+	auto& service = boost::asio::make_service<es::tcp::services::cluster_discovery_service>(
+		ioc,
+		es::cluster_settings_builder()
+		.with_gossip_seed_endpoints(seeds.begin(), seeds.end())
+		.with_max_discover_attempts(1)
+		.with_gossip_refresh_interval(std::chrono::milliseconds(50))
+		.build()
+	);
+
+	std::optional<tcp::endpoint> endpoint;
+	service.async_discover_node_endpoints(*connection, [&endpoint](boost::system::error_code ec, tcp::endpoint discovered)
+	{
+		REQUIRE(!ec);
+		endpoint = discovered;
+	});
+	while (!endpoint.has_value() && ioc.run_one_for(std::chrono::seconds(5)) != 0) {}
+	REQUIRE(endpoint.has_value());
+	REQUIRE(endpoint->port() == 1113);
+
+	// the second node wins an election, the first one lags behind and still gossips itself as the master
+	second.answer(member_json(kMasterId, "Slave", 1113, first.port(), 2) + ", " + member_json(kSlaveId, "Master", 1114, second.port(), 2));
+	ioc.run_for(std::chrono::milliseconds(600));
+
+	// the refresh pushed the new master once and never went back to the stale one
+	REQUIRE(connection->masters == std::vector<int>{ 1114 });
+
+	auto gossip = service.gossip();
+	auto master = std::find_if(gossip.begin(), gossip.end(), [](es::message::member_info const& info)
+	{
+		return info.state() == es::message::virtual_node_state::master;
+	});
+	REQUIRE(master != gossip.end());
+	REQUIRE(master->external_tcp_port() == 1114);
+	REQUIRE(master->epoch_number() == 2);
+
+	service.stop_gossip_refresh();
+}
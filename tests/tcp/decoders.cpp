@@ -0,0 +1,159 @@
+#include <catch2/catch.hpp>
+
+#include <memory>
+#include <string>
+
+#include "guid.hpp"
+#include "resolved_event_view.hpp"
+
+#include "message/messages.pb.h"
+#include "tcp/decode_arena.hpp"
+#include "tcp/decoders.hpp"
+#include "tcp/tcp_package.hpp"
+
+TEST_CASE("decode_stream_event_appeared views the events of the frame", "[tcp][decoders]")
+{
+	using es::detail::tcp::tcp_package;
+	using es::detail::tcp::tcp_package_view;
+	using es::detail::tcp::tcp_command;
+	using es::detail::tcp::tcp_flags;
+
+	auto event_id = es::guid();
+	auto link_id = es::guid();
+
+	es::message::StreamEventAppeared appeared;
+	auto* resolved = appeared.mutable_event();
+	resolved->set_commit_position(1024);
+	resolved->set_prepare_position(1000);
+
+	auto* event = resolved->mutable_event();
+	event->set_event_stream_id("orders-1");
+	event->set_event_number(42);
+	event->set_event_id(event_id.data, event_id.size());
+	event->set_event_type("Order.Placed");
+	event->set_data_content_type(1);
+	event->set_metadata_content_type(0);
+	event->set_data(std::string(300, 'd'));
+	event->set_metadata("{}");
+	event->set_created(637000000000000000);
+	event->set_created_epoch(1600000000000);
+
+	auto* link = resolved->mutable_link();
+	link->set_event_stream_id("$ce-orders");
+	link->set_event_number(7);
+	link->set_event_id(link_id.data, link_id.size());
+	link->set_event_type("$>");
+	link->set_data_content_type(0);
+	link->set_metadata_content_type(0);
+	link->set_data("42@orders-1");
+
+	tcp_package<> package(tcp_command::stream_event_appeared, tcp_flags::none, es::guid(), appeared);
+	tcp_package_view view(reinterpret_cast<std::byte*>(package.data()), package.size());
+
+	auto frame = std::make_shared<int>(0);
+	auto decoded = es::detail::tcp::decode_stream_event_appeared(view, frame);
+
+	REQUIRE(decoded.has_value());
+	REQUIRE(decoded->is_resolved());
+	REQUIRE(decoded->frame() == frame);
+	REQUIRE(decoded->original_position().has_value());
+	REQUIRE(decoded->original_position()->commit_position() == 1024);
+	REQUIRE(decoded->original_position()->prepare_position() == 1000);
+	REQUIRE(decoded->original_stream_id() == "$ce-orders");
+	REQUIRE(decoded->original_event_number() == 7);
+
+	auto const& viewed = decoded->event().value();
+	REQUIRE(viewed.stream_id() == "orders-1");
+	REQUIRE(viewed.event_number() == 42);
+	REQUIRE(viewed.event_id() == event_id);
+	REQUIRE(viewed.event_type() == "Order.Placed");
+	REQUIRE(viewed.is_json());
+	REQUIRE(viewed.content() == std::string(300, 'd'));
+	REQUIRE(viewed.metadata() == "{}");
+	REQUIRE(viewed.created() == 637000000000000000);
+	REQUIRE(viewed.created_epoch() == 1600000000000);
+
+	// the content is not copied out of the frame
+	REQUIRE(viewed.content().data() >= package.data());
+	REQUIRE(viewed.content().data() < package.data() + package.size());
+
+	es::resolved_event owned = decoded->to_owned();
+	package = tcp_package<>();
+	REQUIRE(owned.event().value().content() == std::string(300, 'd'));
+	REQUIRE(owned.link().value().content() == "42@orders-1");
+	REQUIRE(owned.link().value().event_id() == link_id);
+	REQUIRE(owned.original_position() == decoded->original_position());
+
+	// malformed events are not decoded
+	std::string truncated = appeared.SerializeAsString().substr(0, 40);
+	tcp_package<> bad(tcp_command::stream_event_appeared, tcp_flags::none, es::guid(), (std::byte*)truncated.data(), truncated.size());
+	REQUIRE_FALSE(es::detail::tcp::decode_stream_event_appeared(tcp_package_view((std::byte*)bad.data(), bad.size()), nullptr).has_value());
+}
+
+TEST_CASE("decode parses responses on the thread's arena until the outermost decode scope ends", "[tcp][decoders]")
+{
+	using es::detail::tcp::tcp_package;
+	using es::detail::tcp::tcp_package_view;
+	using es::detail::tcp::tcp_command;
+	using es::detail::tcp::tcp_flags;
+	using es::detail::tcp::decode;
+	using es::detail::tcp::decode_arena;
+	using es::detail::tcp::decode_scope;
+
+	auto response = [](std::int64_t last_event_number)
+	{
+		es::message::WriteEventsCompleted completed;
+		completed.set_result(es::message::OperationResult::Success);
+		completed.set_message(std::string(256, 'm'));
+		completed.set_first_event_number(0);
+		completed.set_last_event_number(last_event_number);
+		return tcp_package<>(tcp_command::write_events_completed, tcp_flags::none, es::guid(), completed);
+	};
+	auto first = response(1);
+	auto second = response(2);
+
+	// other tests may have left the arena in use
+	decode_arena().Reset();
+	REQUIRE(decode_arena().SpaceUsed() == 0);
+
+	SECTION("messages decoded in nested scopes live until the outermost one ends")
+	{
+		{
+			decode_scope outer;
+			REQUIRE(decode_scope::active());
+
+			auto& outer_message = decode<es::message::WriteEventsCompleted>(static_cast<tcp_package_view>(first));
+			auto const used = decode_arena().SpaceUsed();
+			REQUIRE(used > 0);
+
+			{
+				decode_scope inner;
+				auto& inner_message = decode<es::message::WriteEventsCompleted>(static_cast<tcp_package_view>(second));
+				REQUIRE(&inner_message != &outer_message);
+				REQUIRE(inner_message.last_event_number() == 2);
+			}
+
+			// the inner scope does not reset the arena
+			REQUIRE(decode_arena().SpaceUsed() > used);
+			REQUIRE(outer_message.last_event_number() == 1);
+			REQUIRE(outer_message.message() == std::string(256, 'm'));
+		}
+
+		REQUIRE_FALSE(decode_scope::active());
+		REQUIRE(decode_arena().SpaceUsed() == 0);
+	}
+	SECTION("messages decoded outside of a scope do not use the arena")
+	{
+		REQUIRE_FALSE(decode_scope::active());
+
+		auto& message = decode<es::message::WriteEventsCompleted>(static_cast<tcp_package_view>(first));
+		REQUIRE(message.last_event_number() == 1);
+		REQUIRE(message.GetArena() == nullptr);
+		REQUIRE(decode_arena().SpaceUsed() == 0);
+
+		// the next one replaces it
+		auto& next = decode<es::message::WriteEventsCompleted>(static_cast<tcp_package_view>(second));
+		REQUIRE(&next == &message);
+		REQUIRE(message.last_event_number() == 2);
+	}
+}
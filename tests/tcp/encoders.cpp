@@ -0,0 +1,255 @@
+#include <catch2/catch.hpp>
+
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "event_data.hpp"
+#include "event_data_view.hpp"
+#include "guid.hpp"
+#include "shared_event_data.hpp"
+
+#include "message/messages.pb.h"
+#include "tcp/encoders.hpp"
+#include "tcp/tcp_package.hpp"
+
+TEST_CASE("encode_write_events matches the generated WriteEvents serialization", "[tcp][encoders]")
+{
+	using es::detail::tcp::tcp_package;
+	using es::detail::tcp::tcp_command;
+	using es::detail::tcp::tcp_flags;
+
+	auto content = std::make_shared<std::string>(4096, 'x');
+	std::vector<std::uint8_t> borrowed(300, 7);
+	auto metadata = std::make_shared<std::vector<std::uint8_t>>(200, 3);
+
+	std::vector<es::shared_event_data> events{
+		es::shared_event_data{ es::guid(), "Image.Attached", false, es::shared_payload(content), es::shared_payload(metadata) },
+		es::shared_event_data{ es::guid(), "Test.Type", true, es::shared_payload::borrow(borrowed.data(), borrowed.size()) }
+	};
+
+	es::message::WriteEvents expected;
+	expected.set_event_stream_id("image-stream");
+	expected.set_expected_version(-2);
+	expected.set_require_master(true);
+	for (auto const& event : events)
+	{
+		auto* new_event = expected.add_events();
+		new_event->set_event_id(event.event_id().data, event.event_id().size());
+		new_event->set_event_type(event.type());
+		new_event->set_data_content_type(event.is_json() ? 1 : 0);
+		new_event->set_metadata_content_type(0);
+		new_event->set_data(event.content().data(), event.content().size());
+		if (event.metadata().has_value()) new_event->set_metadata(event.metadata()->data(), event.metadata()->size());
+	}
+
+	auto guid = es::guid();
+	tcp_package<> expected_package(tcp_command::write_events, tcp_flags::authenticated, guid, "admin", "changeit", expected);
+
+	es::detail::tcp::gather_message request;
+	es::detail::tcp::encode_write_events(request, "image-stream", -2, true, events);
+	tcp_package<> package(tcp_command::write_events, tcp_flags::authenticated, guid, "admin", "changeit", std::move(request));
+
+	REQUIRE_FALSE(package.is_contiguous());
+	REQUIRE(package.is_valid());
+	REQUIRE(package.size() == expected_package.size());
+
+	// the view only spans the bytes the package owns before the first payload
+	auto view = static_cast<es::detail::tcp::tcp_package_view>(package);
+	REQUIRE(view.is_valid());
+	REQUIRE(view.size() < package.size());
+	REQUIRE(view.command() == tcp_command::write_events);
+	REQUIRE(view.correlation_id() == static_cast<es::detail::tcp::tcp_package_view>(expected_package).correlation_id());
+	REQUIRE(std::memcmp(view.data(), expected_package.data(), view.size()) == 0);
+
+	std::vector<boost::asio::const_buffer> buffers;
+	package.append_buffers(buffers);
+
+	// payloads are written from where they are
+	auto refers_to = [&buffers](void const* data) 
+	{
+		for (auto const& buffer : buffers) if (buffer.data() == data) return true;
+		return false;
+	};
+	REQUIRE(refers_to(content->data()));
+	REQUIRE(refers_to(metadata->data()));
+	REQUIRE(refers_to(borrowed.data()));
+
+	std::string written;
+	for (auto const& buffer : buffers) written.append(static_cast<char const*>(buffer.data()), buffer.size());
+	REQUIRE(written == std::string(expected_package.data(), expected_package.size()));
+
+	// copies share the external payloads
+	content.reset();
+	tcp_package<> copy(package);
+	package = tcp_package<>();
+	buffers.clear();
+	copy.append_buffers(buffers);
+	written.clear();
+	for (auto const& buffer : buffers) written.append(static_cast<char const*>(buffer.data()), buffer.size());
+	REQUIRE(written == std::string(expected_package.data(), expected_package.size()));
+}
+
+TEST_CASE("encoders write viewed events like the generated WriteEvents and TransactionWrite", "[tcp][encoders]")
+{
+	using es::detail::tcp::tcp_package;
+	using es::detail::tcp::tcp_command;
+	using es::detail::tcp::tcp_flags;
+
+	std::string content(1000, 'y');
+	es::event_data owned{ es::guid(), "Owned.Type", true, "{\"a\":1}", std::string("{}") };
+
+	std::vector<es::event_data_view> events{
+		es::event_data_view{ es::guid(), "Viewed.Type", false, content },
+		es::event_data_view{ owned }
+	};
+
+	auto fill = [&events](auto* message)
+	{
+		for (auto const& event : events)
+		{
+			auto* new_event = message->add_events();
+			new_event->set_event_id(event.event_id().data, event.event_id().size());
+			new_event->set_event_type(std::string(event.type()));
+			new_event->set_data_content_type(event.is_json() ? 1 : 0);
+			new_event->set_metadata_content_type(0);
+			new_event->set_data(std::string(event.content()));
+			if (event.metadata().has_value()) new_event->set_metadata(std::string(*event.metadata()));
+		}
+	};
+
+	auto guid = es::guid();
+
+	es::message::WriteEvents write_events;
+	write_events.set_event_stream_id("viewed-stream");
+	write_events.set_expected_version(300);
+	write_events.set_require_master(false);
+	fill(&write_events);
+
+	tcp_package<> expected_write(tcp_command::write_events, tcp_flags::none, guid, write_events);
+	tcp_package<> write(
+		tcp_command::write_events,
+		tcp_flags::none,
+		guid,
+		es::detail::tcp::write_events_encoder(std::string_view("viewed-stream"), 300, false, events)
+	);
+	REQUIRE(write.is_valid());
+	REQUIRE(std::string(write.data(), write.size()) == std::string(expected_write.data(), expected_write.size()));
+
+	es::message::TransactionWrite transaction_write;
+	transaction_write.set_transaction_id(4242);
+	transaction_write.set_require_master(true);
+	fill(&transaction_write);
+
+	tcp_package<> expected_transaction(tcp_command::transaction_write, tcp_flags::authenticated, guid, "admin", "changeit", transaction_write);
+	tcp_package<> transaction(
+		tcp_command::transaction_write,
+		tcp_flags::authenticated,
+		guid,
+		"admin",
+		"changeit",
+		es::detail::tcp::transaction_write_encoder(4242, true, events)
+	);
+	REQUIRE(transaction.is_valid());
+	REQUIRE(std::string(transaction.data(), transaction.size()) == std::string(expected_transaction.data(), expected_transaction.size()));
+}
+
+TEST_CASE("request encoders match the generated serialization", "[tcp][encoders]")
+{
+	namespace tcp = es::detail::tcp;
+
+	auto encode = [](auto const& encoder)
+	{
+		std::string buffer(encoder.size(), '\0');
+		auto* end = encoder.encode(reinterpret_cast<std::uint8_t*>(buffer.data()));
+		REQUIRE(end == reinterpret_cast<std::uint8_t*>(buffer.data()) + buffer.size());
+		return buffer;
+	};
+
+	SECTION("read stream events")
+	{
+		for (std::int64_t from : { std::int64_t(0), std::int64_t(-1), std::int64_t(1) << 40 })
+		{
+			es::message::ReadStreamEvents expected;
+			expected.set_event_stream_id("stream-1");
+			expected.set_from_event_number(from);
+			expected.set_max_count(500);
+			expected.set_resolve_link_tos(true);
+			expected.set_require_master(false);
+
+			REQUIRE(encode(tcp::read_stream_events_encoder("stream-1", from, 500, true, false)) == expected.SerializeAsString());
+		}
+	}
+
+	SECTION("read event")
+	{
+		for (std::int64_t number : { std::int64_t(0), std::int64_t(42), std::int64_t(-1) })
+		{
+			es::message::ReadEvent expected;
+			expected.set_event_stream_id("stream-1");
+			expected.set_event_number(number);
+			expected.set_resolve_link_tos(false);
+			expected.set_require_master(true);
+
+			REQUIRE(encode(tcp::read_event_encoder("stream-1", number, false, true)) == expected.SerializeAsString());
+		}
+	}
+
+	SECTION("read all events")
+	{
+		es::message::ReadAllEvents expected;
+		expected.set_commit_position(123456789);
+		expected.set_prepare_position(-1);
+		expected.set_max_count(-3);
+		expected.set_resolve_link_tos(false);
+		expected.set_require_master(true);
+
+		REQUIRE(encode(tcp::read_all_events_encoder(123456789, -1, -3, false, true)) == expected.SerializeAsString());
+	}
+
+	SECTION("persistent subscription ack events")
+	{
+		std::vector<es::guid_type> ids{ es::guid(), es::guid(), es::guid() };
+
+		es::message::PersistentSubscriptionAckEvents expected;
+		expected.set_subscription_id("group::stream");
+		for (auto const& id : ids) expected.add_processed_event_ids()->assign((char const*)id.data, id.size());
+
+		REQUIRE(encode(tcp::persistent_subscription_ack_events_encoder("group::stream", ids.cbegin(), ids.cend())) == expected.SerializeAsString());
+	}
+
+	SECTION("subscribe to stream")
+	{
+		es::message::SubscribeToStream expected;
+		expected.set_event_stream_id(std::string(200, 's'));
+		expected.set_resolve_link_tos(true);
+
+		REQUIRE(encode(tcp::subscribe_to_stream_encoder(std::string(200, 's'), true)) == expected.SerializeAsString());
+	}
+
+	SECTION("write events of owning events")
+	{
+		std::vector<es::event_data> events{
+			es::event_data{ es::guid(), "Test.Type", true, std::string(130, 'c'), std::nullopt },
+			es::event_data{ es::guid(), "Test.Type", false, "", std::string("meta") }
+		};
+
+		es::message::WriteEvents expected;
+		expected.set_event_stream_id("stream-2");
+		expected.set_expected_version(-1);
+		expected.set_require_master(true);
+		for (auto const& event : events)
+		{
+			auto* new_event = expected.add_events();
+			new_event->set_event_id(event.event_id().data, event.event_id().size());
+			new_event->set_event_type(event.type());
+			new_event->set_data_content_type(event.is_json() ? 1 : 0);
+			new_event->set_metadata_content_type(0);
+			new_event->set_data(event.content());
+			if (event.metadata().has_value()) new_event->set_metadata(*event.metadata());
+		}
+
+		REQUIRE(encode(tcp::write_events_encoder(std::string_view("stream-2"), -1, true, events)) == expected.SerializeAsString());
+	}
+}
@@ -1,5 +1,10 @@
 #include <catch2/catch.hpp>
 
+#include <array>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
 #include "operations_map.hpp"
 #include "guid.hpp"
 
@@ -65,4 +70,139 @@ TEST_CASE("operations_map has random access by guid to type erased operations",
 		REQUIRE(test1 == 1);
 		REQUIRE(test2 == 1);
 	}
-}
\ No newline at end of file
+}
+TEST_CASE("operation stores small handlers inline and large handlers on the heap", "[operations_map]")
+{
+	using operation_type = es::operation<>;
+	using package_view_type = typename operation_type::package_view_type;
+
+	auto alive = std::make_shared<int>(0);
+	int calls = 0;
+
+	auto small = [&calls, alive](boost::system::error_code, package_view_type) { ++calls; };
+	std::array<char, 256> payload{};
+	auto large = [&calls, alive, payload](boost::system::error_code, package_view_type) { calls += 1 + payload[0]; };
+
+	REQUIRE(operation_type::stored_inline<decltype(small)>);
+	REQUIRE_FALSE(operation_type::stored_inline<decltype(large)>);
+	REQUIRE(operation_type::stored_inline<decltype(&op_func1)>);
+
+	{
+		operation_type op1(std::move(small));
+		operation_type op2(std::move(large));
+		REQUIRE(alive.use_count() == 3);
+
+		operation_type moved1(std::move(op1));
+		operation_type moved2(std::move(op2));
+		REQUIRE_FALSE(op1);
+		REQUIRE_FALSE(op2);
+		REQUIRE(alive.use_count() == 3);
+
+		moved1(boost::system::error_code{}, package_view_type{ nullptr, 0 });
+		moved2(boost::system::error_code{}, package_view_type{ nullptr, 0 });
+		REQUIRE(calls == 2);
+
+		// assigning over an operation destroys its handler
+		moved1 = std::move(moved2);
+		REQUIRE(alive.use_count() == 2);
+		moved1(boost::system::error_code{}, package_view_type{ nullptr, 0 });
+		REQUIRE(calls == 3);
+	}
+	REQUIRE(alive.use_count() == 1);
+}
+
+TEST_CASE("operations_map extracts operations with a single lookup", "[operations_map]")
+{
+	using operation_type = es::operation<>;
+	using operations_map_type = es::operations_map<operation_type>;
+	using package_view_type = typename operation_type::package_view_type;
+
+	operations_map_type ops_manager;
+
+	std::vector<es::guid_type> keys;
+	int calls = 0;
+	for (int i = 0; i < 1000; ++i)
+	{
+		keys.push_back(es::guid());
+		ops_manager.register_op(keys.back(), operation_type([&calls](boost::system::error_code, package_view_type) { ++calls; }));
+	}
+	REQUIRE(ops_manager.size() == 1000);
+
+	// remove every other key, survivors must still be reachable after backward shifting
+	for (std::size_t i = 0; i < keys.size(); i += 2)
+	{
+		auto op = ops_manager.find_and_extract(keys[i]);
+		REQUIRE(op.has_value());
+		(*op)(boost::system::error_code{}, package_view_type{ nullptr, 0 });
+		REQUIRE_FALSE(ops_manager.contains(keys[i]));
+		REQUIRE_FALSE(ops_manager.find_and_extract(keys[i]).has_value());
+	}
+	REQUIRE(calls == 500);
+	REQUIRE(ops_manager.size() == 500);
+
+	for (std::size_t i = 1; i < keys.size(); i += 2)
+	{
+		REQUIRE(ops_manager.find(keys[i]) != nullptr);
+	}
+	REQUIRE_THROWS_AS(ops_manager[keys[0]], std::out_of_range);
+
+	SECTION("stored operations do not move when the map grows")
+	{
+		operation_type* first = ops_manager.find(keys[1]);
+		for (int i = 0; i < 10000; ++i)
+		{
+			ops_manager.register_op(es::guid(), operation_type(&op_func1));
+		}
+		REQUIRE(ops_manager.find(keys[1]) == first);
+	}
+}
+
+TEST_CASE("operations_map dispatch benchmark", "[operations_map][!benchmark]")
+{
+	using operation_type = es::operation<>;
+	using operations_map_type = es::operations_map<operation_type>;
+	using package_view_type = typename operation_type::package_view_type;
+	using unordered_map_type = std::unordered_map<es::guid_type, operation_type>;
+
+	constexpr std::size_t in_flight = 10000;
+
+	std::vector<es::guid_type> keys;
+	for (std::size_t i = 0; i < in_flight; ++i) keys.push_back(es::guid());
+
+	auto make_op = []() { return operation_type([](boost::system::error_code, package_view_type) {}); };
+
+	operations_map_type flat_map;
+	unordered_map_type node_map;
+	for (auto const& key : keys)
+	{
+		flat_map.register_op(key, make_op());
+		node_map.emplace(key, make_op());
+	}
+
+	// every dispatch completes one operation and registers the next one, like a saturated connection
+	BENCHMARK("flat operations_map find_and_extract + register_op")
+	{
+		for (auto const& key : keys)
+		{
+			auto op = flat_map.find_and_extract(key);
+			(*op)(boost::system::error_code{}, package_view_type{ nullptr, 0 });
+			flat_map.register_op(key, std::move(*op));
+		}
+		return flat_map.size();
+	};
+
+	BENCHMARK("std::unordered_map contains + at + erase + emplace")
+	{
+		for (auto const& key : keys)
+		{
+			if (node_map.find(key) != node_map.end())
+			{
+				auto op = std::move(node_map.at(key));
+				op(boost::system::error_code{}, package_view_type{ nullptr, 0 });
+				node_map.erase(key);
+				node_map.emplace(key, std::move(op));
+			}
+		}
+		return node_map.size();
+	};
+}
@@ -119,4 +119,78 @@ TEST_CASE("read operations on es tcp connections", "[tcp][read]")
 			REQUIRE(frame_size == 4);
 		}
 	}
-}
\ No newline at end of file
+}
+TEST_CASE("batched read operations split every complete frame out of a single socket read", "[tcp][read]")
+{
+	const int size = 1 << 16;
+
+	char socket_buffer[size];
+	boost::asio::io_context ioc;
+
+	using socket_type = es::test::mock_async_read_stream;
+	using connection_type = es::test::mock_tcp_connection<socket_type>;
+
+	auto write_frame = [&socket_buffer](int offset, int length, es::detail::tcp::tcp_command command) -> int
+	{
+		*reinterpret_cast<int*>(&socket_buffer[offset]) = length;
+		socket_buffer[offset + es::detail::tcp::kCommandOffset] = static_cast<char>(command);
+		socket_buffer[offset + es::detail::tcp::kFlagsOffset] = static_cast<char>(es::detail::tcp::tcp_flags::none);
+		return offset + length + 4;
+	};
+
+	es::buffer::frame_buffer frame_buffer{ size };
+	std::vector<std::size_t> frame_sizes;
+	std::vector<es::detail::tcp::tcp_command> commands;
+	boost::system::error_code errc;
+
+	auto token = [&frame_sizes, &commands, &errc](boost::system::error_code ec, es::detail::tcp::tcp_package_view view)
+	{
+		errc = ec;
+		if (ec) return;
+		frame_sizes.push_back(view.size());
+		commands.push_back(view.command());
+	};
+
+	SECTION("all complete frames are dispatched by one completion handler, the partial frame is kept")
+	{
+		int offset = 0;
+		offset = write_frame(offset, 18, es::detail::tcp::tcp_command::heartbeat_request_command);
+		offset = write_frame(offset, 200, es::detail::tcp::tcp_command::stream_event_appeared);
+		offset = write_frame(offset, 18, es::detail::tcp::tcp_command::heartbeat_response_command);
+		// partial frame, its body was not received yet
+		*reinterpret_cast<int*>(&socket_buffer[offset]) = 1000;
+
+		socket_type read_stream{ ioc.get_executor(), socket_buffer, static_cast<std::size_t>(offset + 4 + 100) };
+		auto conn = std::make_shared<connection_type>(std::move(read_stream));
+
+		es::tcp::operations::read_tcp_packages_op<connection_type> op{ conn, frame_buffer };
+		op.initiate(token);
+
+		auto completed_handler_count = ioc.poll_one();
+		REQUIRE(completed_handler_count == 1);
+		REQUIRE(!errc);
+		REQUIRE(frame_sizes == std::vector<std::size_t>{ 22, 204, 22 });
+		REQUIRE(commands[0] == es::detail::tcp::tcp_command::heartbeat_request_command);
+		REQUIRE(commands[1] == es::detail::tcp::tcp_command::stream_event_appeared);
+		REQUIRE(commands[2] == es::detail::tcp::tcp_command::heartbeat_response_command);
+		// the partial frame's bytes are still buffered
+		REQUIRE(frame_buffer.size() == 4 + 100);
+	}
+	SECTION("an invalid length prefix stops the read loop with an error")
+	{
+		int offset = write_frame(0, 18, es::detail::tcp::tcp_command::heartbeat_request_command);
+		*reinterpret_cast<int*>(&socket_buffer[offset]) = 17;
+
+		socket_type read_stream{ ioc.get_executor(), socket_buffer, static_cast<std::size_t>(offset + 4) };
+		auto conn = std::make_shared<connection_type>(std::move(read_stream));
+
+		es::tcp::operations::read_tcp_packages_op<connection_type> op{ conn, frame_buffer };
+		op.initiate(token);
+
+		ioc.poll_one();
+		REQUIRE(frame_sizes.size() == 1);
+		REQUIRE(errc == es::communication_errors::bad_length_prefix);
+		// no read was started after the error
+		REQUIRE(ioc.poll_one() == 0);
+	}
+}
@@ -1,5 +1,10 @@
 #include <catch2/catch.hpp>
 
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
 #include "guid.hpp"
 #include "version.hpp"
 
@@ -97,4 +102,145 @@ TEST_CASE("tcp_package is consistent with tcp_package_view", "[tcp_package]")
 		auto pkg_view_data = std::string_view(pkg_view.data(), pkg_view.size());
 		REQUIRE(pkg_data == pkg_view_data);
 	}
-}
\ No newline at end of file
+}
+TEST_CASE("tcp_package serializes protobuf messages in place", "[tcp_package]")
+{
+	using es::detail::tcp::tcp_package;
+	using es::detail::tcp::tcp_command;
+	using es::detail::tcp::tcp_flags;
+
+	es::message::WriteEvents request;
+	request.set_event_stream_id("test-stream");
+	request.set_expected_version(-2);
+	request.set_require_master(false);
+	for (int i = 0; i < 3; ++i)
+	{
+		auto* event = request.add_events();
+		auto id = es::guid();
+		event->set_event_id(id.data, id.size());
+		event->set_event_type("Test.Type");
+		event->set_data_content_type(1);
+		event->set_metadata_content_type(0);
+		event->set_data("{ \"test\": \"data\" }");
+	}
+	auto serialized = request.SerializeAsString();
+	auto guid = es::guid();
+
+	SECTION("unauthenticated frames are identical to frames built from a serialized string")
+	{
+		tcp_package<> expected(tcp_command::write_events, tcp_flags::none, guid, (std::byte*)serialized.data(), serialized.size());
+		tcp_package<> pkg(tcp_command::write_events, tcp_flags::none, guid, request);
+
+		REQUIRE(pkg.is_valid());
+		REQUIRE(pkg.size() == expected.size());
+		REQUIRE(std::memcmp(pkg.data(), expected.data(), pkg.size()) == 0);
+	}
+	SECTION("authenticated frames are identical to frames built from a serialized string")
+	{
+		std::string login = "admin";
+		std::string password = "changeit";
+		tcp_package<> expected(tcp_command::write_events, tcp_flags::authenticated, guid, login, password, (std::byte*)serialized.data(), serialized.size());
+		tcp_package<> pkg(tcp_command::write_events, tcp_flags::authenticated, guid, login, password, request);
+
+		REQUIRE(pkg.is_valid());
+		REQUIRE(pkg.size() == expected.size());
+		REQUIRE(std::memcmp(pkg.data(), expected.data(), pkg.size()) == 0);
+	}
+}
+
+TEST_CASE("tcp_package frames are recycled by their frame pool", "[tcp_package]")
+{
+	using es::detail::tcp::tcp_package;
+	using es::detail::tcp::tcp_command;
+	using es::detail::tcp::tcp_flags;
+	using es::detail::tcp::kMandatorySize;
+
+	auto pool = std::make_shared<es::buffer::frame_pool>();
+	tcp_package<>::allocator_type alloc(pool);
+	std::string message(300, 'm');
+	auto make_package = [&]()
+	{
+		return tcp_package<>(tcp_command::write_events, tcp_flags::none, es::guid(), (std::byte*)message.data(), message.size(), alloc);
+	};
+
+	{
+		auto pkg = make_package();
+		REQUIRE(pkg.is_valid());
+		REQUIRE(pool->bytes_in_use() == pkg.size());
+
+		// copies allocate from the pool of the package they copy
+		tcp_package<> copy(pkg);
+		REQUIRE(copy.get_allocator() == alloc);
+		REQUIRE(pool->bytes_in_use() == 2 * pkg.size());
+	}
+	REQUIRE(pool->bytes_in_use() == 0);
+
+	std::size_t const reserved = pool->bytes_reserved();
+	REQUIRE(reserved != 0);
+	for (int i = 0; i < 1000; ++i)
+	{
+		auto pkg = make_package();
+		auto moved = std::move(pkg);
+	}
+	REQUIRE(pool->bytes_in_use() == 0);
+	REQUIRE(pool->bytes_reserved() == reserved);
+
+	SECTION("huge pages back the pool where supported")
+	{
+		es::buffer::frame_pool_options options;
+		options.huge_pages = true;
+		auto huge_pool = std::make_shared<es::buffer::frame_pool>(options);
+		tcp_package<>::allocator_type huge_alloc(huge_pool);
+		tcp_package<> pkg(tcp_command::write_events, tcp_flags::none, es::guid(), (std::byte*)message.data(), message.size(), huge_alloc);
+		REQUIRE(pkg.is_valid());
+		REQUIRE(std::memcmp(pkg.data() + kMandatorySize, message.data(), message.size()) == 0);
+
+#if defined(__linux__)
+		// the pool reserves whole mappings, slabs of every size class share the first one
+		std::size_t const mapped = huge_pool->bytes_reserved();
+		REQUIRE(mapped % es::buffer::kHugePageSize == 0);
+		std::vector<tcp_package<>> packages;
+		for (std::size_t size : { 16, 300, 1000, 4000, 16000 })
+		{
+			std::string small(size, 's');
+			packages.emplace_back(tcp_command::write_events, tcp_flags::none, es::guid(), (std::byte*)small.data(), small.size(), huge_alloc);
+		}
+		REQUIRE(huge_pool->bytes_reserved() == mapped);
+
+		// frames too large to be pooled keep their mapping for the next ones
+		std::string large(es::buffer::kDefaultLargestPooledFrameSize * 2, 'l');
+		{
+			tcp_package<> large_pkg(tcp_command::write_events, tcp_flags::none, es::guid(), (std::byte*)large.data(), large.size(), huge_alloc);
+			REQUIRE(std::memcmp(large_pkg.data() + kMandatorySize, large.data(), large.size()) == 0);
+		}
+		std::size_t const with_large = huge_pool->bytes_reserved();
+		REQUIRE(with_large == mapped + es::buffer::kHugePageSize);
+		for (int i = 0; i < 100; ++i)
+		{
+			tcp_package<> large_pkg(tcp_command::write_events, tcp_flags::none, es::guid(), (std::byte*)large.data(), large.size(), huge_alloc);
+		}
+		REQUIRE(huge_pool->bytes_reserved() == with_large);
+#endif
+	}
+
+	SECTION("huge pages recycle frames above the largest size class")
+	{
+		es::buffer::frame_pool_options options;
+		options.huge_pages = true;
+		options.largest_pooled_frame_size = 16 * 1024 * 1024;
+		auto huge_pool = std::make_shared<es::buffer::frame_pool>(options);
+		tcp_package<>::allocator_type huge_alloc(huge_pool);
+
+		std::string large(6 * 1024 * 1024, 'l');
+		{
+			tcp_package<> large_pkg(tcp_command::write_events, tcp_flags::none, es::guid(), (std::byte*)large.data(), large.size(), huge_alloc);
+		}
+		std::size_t const reserved_once = huge_pool->bytes_reserved();
+		for (int i = 0; i < 10; ++i)
+		{
+			tcp_package<> large_pkg(tcp_command::write_events, tcp_flags::none, es::guid(), (std::byte*)large.data(), large.size(), huge_alloc);
+		}
+		REQUIRE(huge_pool->bytes_reserved() == reserved_once);
+		REQUIRE(huge_pool->bytes_in_use() == 0);
+	}
+}